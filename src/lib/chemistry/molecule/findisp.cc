@@ -27,6 +27,7 @@
 
 #include <stdlib.h>
 #include <cassert>
+#include <sstream>
 #include <sys/stat.h>
 
 #include <util/misc/scexception.h>
@@ -38,6 +39,7 @@
 #include <util/group/mstate.h>
 #include <util/keyval/keyval.h>
 #include <math/scmat/blocked.h>
+#include <math/scmat/repl.h>
 #include <math/symmetry/corrtab.h>
 #include <chemistry/molecule/findisp.h>
 
@@ -47,6 +49,77 @@ using namespace sc;
 #define DEFAULT_CHECKPOINT  0
 #define DEFAULT_RESTART     1
 
+/////////////////////////////////////////////////////////////////
+// DisplacementFarm
+
+DisplacementFarm::DisplacementFarm(int ngroup)
+{
+  grp_ = MessageGrp::get_default_messagegrp();
+  mem_ = MemoryGrp::get_default_memorygrp();
+  kit_ = SCMatrixKit::default_matrixkit();
+
+  ngroup_ = std::max(1, std::min(ngroup, grp_->n()));
+  group_ = (grp_->me() * ngroup_) / grp_->n();
+  subgrp_ = grp_->split(group_);
+  // the new subgroup makes its own first process print; keep output on
+  // the first process of grp_
+  SCFormIO::init_mp(grp_->me());
+
+  // the subgroup MemoryGrp and SCMatrixKit are made from the default MessageGrp
+  MessageGrp::set_default_messagegrp(subgrp_);
+  MemoryGrp::set_default_memorygrp(0);
+  submem_ = MemoryGrp::get_default_memorygrp();
+  subkit_ = new ReplSCMatrixKit;
+  leave();
+}
+
+DisplacementFarm::~DisplacementFarm()
+{
+}
+
+void
+DisplacementFarm::enter()
+{
+  MessageGrp::set_default_messagegrp(subgrp_);
+  MemoryGrp::set_default_memorygrp(submem_);
+  SCMatrixKit::set_default_matrixkit(subkit_);
+}
+
+void
+DisplacementFarm::leave()
+{
+  MessageGrp::set_default_messagegrp(grp_);
+  MemoryGrp::set_default_memorygrp(mem_);
+  SCMatrixKit::set_default_matrixkit(kit_);
+}
+
+Ref<MolecularEnergy>
+DisplacementFarm::clone(const Ref<MolecularEnergy>& mole)
+{
+  std::ostringstream os;
+  {
+    StateOutBin so(os);
+    SavableState::save_state(mole.pointer(), so);
+  }
+
+  enter();
+  Ref<MolecularEnergy> result;
+  {
+    std::istringstream is(os.str());
+    StateInBin si(is);
+    result << SavableState::restore_state(si);
+  }
+  leave();
+
+  return result;
+}
+
+void
+DisplacementFarm::gather(double* data, int n)
+{
+  grp_->sum(data, n);
+}
+
 /////////////////////////////////////////////////////////////////
 // FinDispMolecularHessian::Impl
 
@@ -88,7 +161,7 @@ sc::ToStateOut<EGH>(const EGH& v, StateOut& s, int& count) {
 // FinDispMolecularHessian::Params
 
 ClassDesc FinDispMolecularHessian::Params::class_desc_(
-  typeid(FinDispMolecularHessian::Params),"FinDispMolecularHessian::Params",1,"virtual public SavableState",
+  typeid(FinDispMolecularHessian::Params),"FinDispMolecularHessian::Params",2,"virtual public SavableState",
   create<FinDispMolecularHessian::Params>, create<FinDispMolecularHessian::Params>, create<FinDispMolecularHessian::Params>);
 
 FinDispMolecularHessian::Params::Params()
@@ -108,6 +181,7 @@ FinDispMolecularHessian::Params::Params()
   restart_ = DEFAULT_RESTART;
   restart_file_ = SCFormIO::fileext_to_filename_string(".ckpt.hess");
   debug_ = 0;
+  ngroup_ = 1;
 }
 
 FinDispMolecularHessian::Params::Params(const Ref<KeyVal>& keyval)
@@ -138,6 +212,11 @@ FinDispMolecularHessian::Params::Params(const Ref<KeyVal>& keyval)
   KeyValValueboolean def_restart(DEFAULT_RESTART);
   restart_ = keyval->booleanvalue("restart", def_restart);
   restart_file_ = keyval->stringvalue("restart_file", def_restart_file);
+
+  ngroup_ = keyval->intvalue("ngroup", KeyValValueint(1));
+  if (ngroup_ < 1)
+    throw InputError("ngroup must be positive",
+                     __FILE__, __LINE__, "ngroup");
 }
 
 FinDispMolecularHessian::Params::Params(StateIn& s)
@@ -155,6 +234,10 @@ FinDispMolecularHessian::Params::Params(StateIn& s)
   s.get(checkpoint_file_);
   s.get(restart_);
   s.get(restart_file_);
+  if (s.version(::class_desc<Params>()) >= 2)
+    s.get(ngroup_);
+  else
+    ngroup_ = 1;
 }
 
 FinDispMolecularHessian::Params::~Params()
@@ -177,6 +260,7 @@ FinDispMolecularHessian::Params::save_data_state(StateOut& s)
   s.put(checkpoint_file_);
   s.put(restart_);
   s.put(restart_file_);
+  s.put(ngroup_);
 }
 
 void
@@ -195,13 +279,15 @@ ClassDesc FinDispMolecularHessian::Impl::class_desc_(
 FinDispMolecularHessian::Impl::Impl(const Ref<MolecularEnergy>& e,
                                     const Ref<Params>& params) :
   params_(params),
-  mole_(e)
+  mole_(e),
+  dry_run_(0)
 {
   init();
 }
 
 FinDispMolecularHessian::Impl::Impl(StateIn& s):
-  SavableState(s)
+  SavableState(s),
+  dry_run_(0)
 {
   restore_displacements(s);
 }
@@ -286,6 +372,90 @@ FinDispMolecularHessian::Impl::checkpoint_displacements(StateOut& s)
   values_.save(s);
 }
 
+void
+FinDispMolecularHessian::Impl::write_checkpoint()
+{
+  if (params_->checkpoint()) {
+    const char *hessckptfile;
+    if (MessageGrp::get_default_messagegrp()->me() == 0) {
+      hessckptfile = params_->checkpoint_file().c_str();
+    }
+    else {
+      hessckptfile = "/dev/null";
+    }
+    StateOutBin so(hessckptfile);
+    checkpoint_displacements(so);
+  }
+}
+
+void
+FinDispMolecularHessian::Impl::record(const Displacement& disp,
+                                      const EGH& placeholder)
+{
+  dry_run_->push_back(disp);
+  values_.push(disp, placeholder);
+}
+
+void
+FinDispMolecularHessian::Impl::farm()
+{
+  if (params_->ngroup() <= 1) return;
+
+  // find the displacements that remain by running compute_hessian
+  // on placeholder values
+  std::vector<Displacement> todo;
+  Displacements<EGH> values = values_;
+  dry_run_ = &todo;
+  compute_hessian();
+  dry_run_ = 0;
+  values_ = values;
+  if (todo.empty()) return;
+
+  DisplacementFarm farm(params_->ngroup());
+  if (farm.ngroup() == 1) return;
+
+  ExEnv::out0() << indent
+       << "Computing " << todo.size() << " displacements in "
+       << farm.ngroup() << " process groups" << endl;
+
+  Ref<MolecularEnergy> mole = mole_;
+  Ref<MolecularEnergy> submole = farm.clone(mole_);
+
+  const int ngroup = farm.ngroup();
+  const int nres = nresult();
+  std::vector<double> results;
+  for (int first=0; first<int(todo.size()); first+=ngroup) {
+    const int n = std::min(ngroup, int(todo.size()) - first);
+    results.resize(n*nres);
+    std::fill(results.begin(), results.end(), 0.0);
+
+    ExEnv::out0() << endl;
+    for (int i=0; i<n; i++)
+      ExEnv::out0() << indent
+           << "Beginning displacement " << values_.size()+i+1
+           << " in process group " << i << endl;
+
+    if (farm.group() < n) {
+      const Displacement& disp = todo[first + farm.group()];
+      std::vector<double> result(nres);
+      mole_ = submole;
+      farm.enter();
+      evaluate(disp, &result[0]);
+      farm.leave();
+      mole_ = mole;
+      if (farm.leader())
+        std::copy(result.begin(), result.end(),
+                  results.begin() + farm.group()*nres);
+    }
+
+    farm.gather(&results[0], n*nres);
+    for (int i=0; i<n; i++)
+      store(todo[first + i], &results[i*nres]);
+
+    write_checkpoint();
+  }
+}
+
 RefSCMatrix
 FinDispMolecularHessian::Impl::displacements(int irrep) const
 {
@@ -418,7 +588,8 @@ FinDispMolecularHessian::Impl::do_hess_for_irrep(int irrep,
   RefSCMatrix dtrans = displacements(irrep);
   RefSCDimension ddim = dtrans.coldim();
   if (ddim.n() == 0) return;
-  if (params_->debug()) {
+  // a dry run only has placeholder values
+  if (params_->debug() && !dry_run_) {
     std::ostringstream oss; oss << "dhessian for irrep " << irrep;
     dhessian.print(oss.str().c_str());
     dtrans.print("dtrans");
@@ -430,6 +601,7 @@ RefSymmSCMatrix
 FinDispMolecularHessian::Impl::cartesian_hessian()
 {
   Timer tim("hessian");
+  farm();
   RefSymmSCMatrix xhessian = compute_hessian();
   tim.exit("hessian");
 
@@ -496,31 +668,47 @@ FinDispMolecularHessian::GradientsImpl::compute_mole(const Displacement& disp) {
       return;
   }
 
-  // This produces side-effects in mol and may even change
-  // its symmetry.
+  if (dry_run_) {
+    const int irrep = disp.empty() ? 0 : coor_to_irrep(disp[0].first);
+    RefSCVector grad = matrixkit()->vector(displacements(irrep).coldim());
+    grad.assign(0.0);
+    record(disp, EGH(0.0, grad, 0));
+    return;
+  }
+
   ExEnv::out0() << endl << indent
        << "Beginning displacement " << values_.size()+1 << ":" << endl;
+  std::vector<double> result(nresult());
+  evaluate(disp, &result[0]);
+  store(disp, &result[0]);
+
+  write_checkpoint();
+}
+
+void
+FinDispMolecularHessian::GradientsImpl::evaluate(const Displacement& disp,
+                                                 double* result)
+{
+  // This produces side-effects in mol and may even change
+  // its symmetry.
   displace(disp);
 
   // mole_->obsolete(); displace obsoleted mole
   const double original_accuracy = mole_->desired_gradient_accuracy();
   mole_->set_desired_gradient_accuracy(params_->gradient_accuracy());
   RefSCVector gradv = mole_->get_cartesian_gradient();
-  const double energy = mole_->energy();
+  result[0] = mole_->energy();
+  gradv.convert(result + 1);
   mole_->set_desired_gradient_accuracy(original_accuracy);
-  set_gradient(disp, energy, gradv);
+}
 
-  if (params_->checkpoint()) {
-    const char *hessckptfile;
-    if (MessageGrp::get_default_messagegrp()->me() == 0) {
-      hessckptfile = params_->checkpoint_file().c_str();
-    }
-    else {
-      hessckptfile = "/dev/null";
-    }
-    StateOutBin so(hessckptfile);
-    checkpoint_displacements(so);
-  }
+void
+FinDispMolecularHessian::GradientsImpl::store(const Displacement& disp,
+                                              const double* result)
+{
+  RefSCVector gradv = matrixkit()->vector(d3natom());
+  gradv.assign(result + 1);
+  set_gradient(disp, result[0], gradv);
 }
 
 void
@@ -671,7 +859,7 @@ FinDispMolecularHessian::GradientsImpl::compute_hessian()
     }
   }
 
-  if (params_->debug()) {
+  if (params_->debug() && !dry_run_) {
     xhessian.print("xhessian");
   }
 
@@ -860,7 +1048,7 @@ FinDispMolecularHessian::EnergiesImpl::compute_hessian()
     }
   }
 
-  if (params_->debug()) {
+  if (params_->debug() && !dry_run_) {
     xhessian.print("xhessian");
   }
 
@@ -879,30 +1067,40 @@ FinDispMolecularHessian::EnergiesImpl::compute_mole(const Displacement& disp) {
     return;
   }
 
-  // This produces side-effects in mol and may even change
-  // its symmetry.
+  if (dry_run_) {
+    record(disp, EGH());
+    return;
+  }
+
   ExEnv::out0() << endl << indent
        << "Beginning displacement " << values_.size()+1 << ":" << endl;
+  std::vector<double> result(nresult());
+  evaluate(disp, &result[0]);
+  store(disp, &result[0]);
+
+  write_checkpoint();
+}
+
+void
+FinDispMolecularHessian::EnergiesImpl::evaluate(const Displacement& disp,
+                                                double* result)
+{
+  // This produces side-effects in mol and may even change
+  // its symmetry.
   displace(disp);
 
   // mole_->obsolete(); displace obsoleted mole
   const double original_accuracy = mole_->desired_value_accuracy();
   mole_->set_desired_value_accuracy(params_->energy_accuracy());
-  const double energy = mole_->energy();
-  values_.push(disp,EGH(energy,0,0));
+  result[0] = mole_->energy();
   mole_->set_desired_value_accuracy(original_accuracy);
+}
 
-  if (params_->checkpoint()) {
-    const char *hessckptfile;
-    if (MessageGrp::get_default_messagegrp()->me() == 0) {
-      hessckptfile = params_->checkpoint_file().c_str();
-    }
-    else {
-      hessckptfile = "/dev/null";
-    }
-    StateOutBin so(hessckptfile);
-    checkpoint_displacements(so);
-  }
+void
+FinDispMolecularHessian::EnergiesImpl::store(const Displacement& disp,
+                                             const double* result)
+{
+  values_.push(disp,EGH(result[0],0,0));
 }
 
 
@@ -1043,7 +1241,7 @@ FinDispMolecularHessian::set_desired_accuracy(double acc) {
 // FinDispMolecularGradient
 
 static ClassDesc FinDispMolecularGradient_cd(
-  typeid(FinDispMolecularGradient),"FinDispMolecularGradient",1,"public MolecularGradient",
+  typeid(FinDispMolecularGradient),"FinDispMolecularGradient",2,"public MolecularGradient",
   0, create<FinDispMolecularGradient>, create<FinDispMolecularGradient>);
 
 FinDispMolecularGradient::FinDispMolecularGradient(const Ref<MolecularEnergy> &e):
@@ -1057,6 +1255,7 @@ FinDispMolecularGradient::FinDispMolecularGradient(const Ref<MolecularEnergy> &e
   checkpoint_ = DEFAULT_CHECKPOINT;
   checkpoint_file_ = SCFormIO::fileext_to_filename_string(".ckpt.grad");
   restart_file_ = SCFormIO::fileext_to_filename_string(".ckpt.grad");
+  ngroup_ = 1;
 }
 
 FinDispMolecularGradient::FinDispMolecularGradient(const Ref<KeyVal>&keyval):
@@ -1092,6 +1291,10 @@ FinDispMolecularGradient::FinDispMolecularGradient(const Ref<KeyVal>&keyval):
   energy_accuracy_ = keyval->doublevalue("energy_accuracy",
                                          KeyValValuedouble(MolecularGradient::desired_accuracy() * disp_));
 
+  ngroup_ = keyval->intvalue("ngroup", KeyValValueint(1));
+  if (ngroup_ < 1)
+    throw InputError("ngroup must be positive",
+                     __FILE__, __LINE__, "ngroup", 0, class_desc());
 }
 
 FinDispMolecularGradient::FinDispMolecularGradient(StateIn&s):
@@ -1104,6 +1307,10 @@ FinDispMolecularGradient::FinDispMolecularGradient(StateIn&s):
   s.get(energy_accuracy_);
   s.get(checkpoint_file_);
   s.get(restart_file_);
+  if (s.version(::class_desc<FinDispMolecularGradient>()) >= 2)
+    s.get(ngroup_);
+  else
+    ngroup_ = 1;
 
   restore_displacements(s);
 }
@@ -1123,6 +1330,7 @@ FinDispMolecularGradient::save_data_state(StateOut&s)
   s.put(energy_accuracy_);
   s.put(checkpoint_file_);
   s.put(restart_file_);
+  s.put(ngroup_);
 
   checkpoint_displacements(s);
 }
@@ -1240,6 +1448,84 @@ FinDispMolecularGradient::checkpoint_displacements(StateOut& s)
     }
 }
 
+void
+FinDispMolecularGradient::write_checkpoint()
+{
+  if (checkpoint_) {
+    const char *gradckptfile;
+    if (MessageGrp::get_default_messagegrp()->me() == 0) {
+      gradckptfile = checkpoint_file_.c_str();
+      }
+    else {
+      gradckptfile = "/dev/null";
+      }
+    StateOutBin so(gradckptfile);
+    checkpoint_displacements(so);
+    }
+}
+
+void
+FinDispMolecularGradient::farm()
+{
+  if (ngroup_ <= 1 || ndisplacements_done() == ndisplace()) return;
+
+  DisplacementFarm farm(ngroup_);
+  if (farm.ngroup() == 1) return;
+
+  ExEnv::out0() << indent
+       << "Computing " << ndisplace() - ndisplacements_done()
+       << " displacements in " << farm.ngroup() << " process groups" << endl;
+
+  Ref<MolecularEnergy> mole = mole_;
+  Ref<Molecule> mol = mol_;
+  Ref<MolecularEnergy> submole = farm.clone(mole_);
+
+  const int ngroup = farm.ngroup();
+  std::vector<double> energies;
+  while (ndisplacements_done() < ndisplace()) {
+    const int first = ndisplacements_done();
+    const int n = std::min(ngroup, ndisplace() - first);
+    energies.resize(n);
+    std::fill(energies.begin(), energies.end(), 0.0);
+
+    ExEnv::out0() << endl;
+    for (int i=0; i<n; i++)
+      ExEnv::out0() << indent
+           << "Beginning displacement " << first+i+1
+           << " in process group " << i << endl;
+
+    if (farm.group() < n) {
+      mole_ = submole;
+      mol_ = submole->molecule();
+      farm.enter();
+      const double energy = evaluate(first + farm.group());
+      farm.leave();
+      mole_ = mole;
+      mol_ = mol;
+      if (farm.leader()) energies[farm.group()] = energy;
+      }
+
+    farm.gather(&energies[0], n);
+    energies_.insert(energies_.end(), energies.begin(), energies.end());
+
+    write_checkpoint();
+    }
+}
+
+double
+FinDispMolecularGradient::evaluate(int disp)
+{
+  // This produces side-effects in mol
+  displace(disp);
+
+  // mole_->obsolete(); displace() obsoleted mole
+  const double original_accuracy = mole_->desired_value_accuracy();
+  mole_->set_desired_value_accuracy(energy_accuracy_);
+  const double energy = mole_->energy();
+  mole_->set_desired_value_accuracy(original_accuracy);
+  return energy;
+}
+
 RefSCMatrix
 FinDispMolecularGradient::displacements(int irrep) const
 {
@@ -1406,31 +1692,15 @@ FinDispMolecularGradient::cartesian_gradient()
   ExEnv::out0() << indent << "  eliminate_cubic_terms: "
                << (eliminate_cubic_terms_==0?"no":"yes") << endl;
 
+  farm();
+
   for (int i=ndisplacements_done(); i<ndisplace(); i++) {
     // This produces side-effects in mol
     ExEnv::out0() << endl << indent
          << "Beginning displacement " << i+1 << ":" << endl;
-    displace(i);
-
-    // mole_->obsolete(); displace() obsoleted mole
-    double original_accuracy;
-    original_accuracy = mole_->desired_value_accuracy();
-    mole_->set_desired_value_accuracy(energy_accuracy_);
-    const double energy = mole_->energy();
-    mole_->set_desired_value_accuracy(original_accuracy);
-    energies_.push_back(energy);
-
-    if (checkpoint_) {
-      const char *gradckptfile;
-      if (MessageGrp::get_default_messagegrp()->me() == 0) {
-        gradckptfile = checkpoint_file_.c_str();
-        }
-      else {
-        gradckptfile = "/dev/null";
-        }
-      StateOutBin so(gradckptfile);
-      checkpoint_displacements(so);
-      }
+    energies_.push_back(evaluate(i));
+
+    write_checkpoint();
     }
   original_geometry();
   RefSCVector gradient = compute_gradient();
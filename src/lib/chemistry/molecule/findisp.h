@@ -34,6 +34,8 @@
 #include <algorithm>
 
 #include <util/misc/scexception.h>
+#include <util/group/message.h>
+#include <util/group/memory.h>
 #include <chemistry/molecule/deriv.h>
 #include <chemistry/molecule/energy.h>
 
@@ -133,6 +135,54 @@ namespace sc {
       std::map< Key, Value> disps_;
   };
 
+  /** DisplacementFarm lets independent displaced geometries be computed
+      concurrently.  The default MessageGrp is split into ngroup subgroups
+      of consecutive processes; each subgroup gets its own MemoryGrp and
+      (replicated) SCMatrixKit.  Between enter() and leave() these are the
+      defaults, so that objects created or restored (see clone()) in that
+      interval live entirely in the subgroup.  The constructor is collective
+      over the default MessageGrp.
+   */
+  class DisplacementFarm {
+    public:
+      /// ngroup is reduced to the number of processes if necessary
+      DisplacementFarm(int ngroup);
+      ~DisplacementFarm();
+
+      /// the number of subgroups
+      int ngroup() const { return ngroup_; }
+      /// the subgroup of this process
+      int group() const { return group_; }
+      /// true if this process is the first of its subgroup
+      bool leader() const { return subgrp_->me() == 0; }
+      /// the MessageGrp that was split
+      const Ref<MessageGrp>& grp() const { return grp_; }
+
+      /// makes the subgroup defaults current
+      void enter();
+      /// restores the defaults of the constructor
+      void leave();
+
+      /** Returns a copy of mole that lives in the subgroup of this
+          process.  mole is copied through its saved state, which must
+          be identical on all processes of the subgroup. */
+      Ref<MolecularEnergy> clone(const Ref<MolecularEnergy>& mole);
+
+      /** Sums data over grp().  Only the subgroup leaders should give
+          nonzero data, so that each subgroup contributes its result once. */
+      void gather(double* data, int n);
+
+    private:
+      int ngroup_;
+      int group_;
+      Ref<MessageGrp> grp_;
+      Ref<MemoryGrp> mem_;
+      Ref<SCMatrixKit> kit_;
+      Ref<MessageGrp> subgrp_;
+      Ref<MemoryGrp> submem_;
+      Ref<SCMatrixKit> subkit_;
+  };
+
 #if 0
   /** FinDispDerivative computes derivatives of functions using finite-difference formulas
    * @tparam TargetOrder desired order of the derivative
@@ -215,6 +265,7 @@ class FinDispMolecularHessian: public MolecularHessian {
       bool use_energies() const { return use_energies_; }
       double gradient_accuracy() const { return gradient_accuracy_; }
       double energy_accuracy() const { return energy_accuracy_; }
+      int ngroup() const { return ngroup_; }
       int nirrep() const { return disp_pg_->char_table().nirrep(); }
 
       void set_eliminate_cubic_terms(bool e) { eliminate_cubic_terms_ = e; }
@@ -255,6 +306,8 @@ class FinDispMolecularHessian: public MolecularHessian {
       double energy_accuracy_;
       // the accuracy for gradient calculations
       double gradient_accuracy_;
+      // the number of process groups that compute displacements concurrently
+      int ngroup_;
   };
 
 
@@ -271,6 +324,8 @@ class FinDispMolecularHessian: public MolecularHessian {
 
       void checkpoint_displacements(StateOut&);
       void restore_displacements(StateIn&);
+      /// checkpoints to the checkpoint file, if requested
+      void write_checkpoint();
 
       const Ref<Params>& params() const { return params_; }
       const Ref<MolecularEnergy>& mole() const { return mole_; }
@@ -307,11 +362,26 @@ class FinDispMolecularHessian: public MolecularHessian {
 
       // values, gradients, and hessians at various (displaced) geometries
       Displacements<EGH> values_;
+      // if nonnull, compute_mole only appends the displacements still
+      // needed here and gives them placeholder values
+      std::vector<Displacement>* dry_run_;
 
       /** computes a cartesian hessian from energies or gradients at displaced geometries */
       virtual RefSymmSCMatrix compute_hessian() =0;
       /// computes MolecularEnergy object
       virtual void compute_mole(const Displacement& d) =0;
+      /// the number of doubles that evaluate() produces
+      int nresult() const { return 1 + d3natom().n(); }
+      /** displaces mole_ by d and computes the energy and, if needed,
+          the cartesian gradient into result */
+      virtual void evaluate(const Displacement& d, double* result) =0;
+      /// stores a result of evaluate() in values_
+      virtual void store(const Displacement& d, const double* result) =0;
+      /** computes the displacements needed by compute_hessian() that are
+          not yet done concurrently in Params::ngroup() process groups */
+      void farm();
+      /// gives d a placeholder value and appends it to dry_run_
+      void record(const Displacement& d, const EGH& placeholder);
 
       Ref<SCMatrixKit> matrixkit() const { return mole_->matrixkit(); }
       RefSCDimension d3natom() const { return mole_->moldim(); }
@@ -338,6 +408,8 @@ class FinDispMolecularHessian: public MolecularHessian {
         void set_gradient(const Displacement& d, double energy, const RefSCVector &grad);
         RefSymmSCMatrix compute_hessian();
         void compute_mole(const Displacement& d);
+        void evaluate(const Displacement& d, double* result);
+        void store(const Displacement& d, const double* result);
 
         static ClassDesc class_desc_;
     };
@@ -358,6 +430,8 @@ class FinDispMolecularHessian: public MolecularHessian {
         int ndisplace() const;
         RefSymmSCMatrix compute_hessian();
         void compute_mole(const Displacement& d);
+        void evaluate(const Displacement& d, double* result);
+        void store(const Displacement& d, const double* result);
         const Displacements<EGH>& values() const { return values_; }
 
         struct Eij {
@@ -467,6 +541,12 @@ class FinDispMolecularHessian: public MolecularHessian {
         <tr><td><tt>use_energies</tt><td>boolean<td>false<td>Setting to true will
         force computation from energies.
 
+        <tr><td><tt>ngroup</tt><td>integer<td>1<td>The number of groups
+        the processes are split into to compute displacements
+        concurrently.  Each group computes with a copy of <tt>energy</tt>
+        that is restricted to its processes.  Results are checkpointed
+        after every round of <tt>ngroup</tt> displacements.
+
         </table>
     */
     FinDispMolecularHessian(const Ref<KeyVal>&);
@@ -534,6 +614,8 @@ class FinDispMolecularGradient: public MolecularGradient {
     RefSCMatrix symbasis_;
     // the energies at each of the completed displacements
     std::vector<double> energies_;
+    // the number of process groups that compute displacements concurrently
+    int ngroup_;
 
     // given displacement # disp returns internal coordinate index and displacement size (in units of disp_)
     void get_disp(int disp, int &index, double &dispsize);
@@ -550,10 +632,15 @@ class FinDispMolecularGradient: public MolecularGradient {
     int ndisplacements_done() const { return energies_.size(); }
     RefSCMatrix displacements(int irrep) const;
     void displace(int disp);
+    /// displaces the molecule and returns the energy at displacement disp
+    double evaluate(int disp);
     void original_geometry();
     //void set_gradient(int disp, const RefSCVector &grad);
     void checkpoint_displacements(StateOut&);
     void restore_displacements(StateIn&);
+    void write_checkpoint();
+    /// computes the remaining displacements concurrently in ngroup_ process groups
+    void farm();
 
   public:
     FinDispMolecularGradient(const Ref<MolecularEnergy>&);
@@ -600,6 +687,12 @@ class FinDispMolecularGradient: public MolecularGradient {
         <tr><td><tt>energy_accuracy</tt><td>double<td><tt>accuracy</tt> * <tt>displacement</tt>
         <td>The accuracy to which the energies will be computed.
 
+        <tr><td><tt>ngroup</tt><td>integer<td>1<td>The number of groups
+        the processes are split into to compute displacements
+        concurrently.  Each group computes with a copy of <tt>energy</tt>
+        that is restricted to its processes.  Results are checkpointed
+        after every round of <tt>ngroup</tt> displacements.
+
         </table>
     */
     FinDispMolecularGradient(const Ref<KeyVal>&);
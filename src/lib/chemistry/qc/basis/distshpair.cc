@@ -28,8 +28,11 @@
 //
 
 #include <math.h>
+#include <algorithm>
+#include <vector>
 
 #include <util/misc/formio.h>
+#include <chemistry/qc/basis/tbint.h>
 #include <chemistry/qc/basis/distshpair.h>
 
 using namespace std;
@@ -40,48 +43,35 @@ using namespace sc;
 // for stressing MPI libraries up front instead of at the end of a run).
 #undef REVERSE_ORDERING
 
+// The number of chunks each thread gets, on average, of the remaining
+// work.  Larger values give smaller chunks and better balance.
+#define CHUNKS_PER_THREAD 2
+
 /////////////////////////////////////////////////////////////////
-// Function iquicksort performs a quick sort (larger -> smaller) 
-// of the integer data in item by the integer indices in index;
-// data in item remain unchanged
+// Atomically add n to *counter and return its old value.
 /////////////////////////////////////////////////////////////////
-static void
-iqs(int *item,int *index,int left,int right)
+static long int
+fetch_and_add(volatile long int *counter, long int n, const Ref<ThreadLock> &lock)
 {
-  int i,j;
-  int x,y;
- 
-  i=left; j=right;
-  x=item[index[(left+right)/2]];
- 
-  do {
-    while(item[index[i]]>x && i<right) i++;
-    while(x>item[index[j]] && j>left) j--;
- 
-    if (i<=j) {
-      if (item[index[i]] != item[index[j]]) {
-        y=index[i];
-        index[i]=index[j];
-        index[j]=y;
-        }
-      i++; j--;
-      }
-    } while(i<=j);
-       
-  if (left<j) iqs(item,index,left,j);
-  if (i<right) iqs(item,index,i,right);
+#ifdef HAVE_SYNC_FETCH_AND_ADD
+  return __sync_fetch_and_add(counter, n);
+#else
+  lock->lock();
+  long int old = *counter;
+  *counter = old + n;
+  lock->unlock();
+  return old;
+#endif
 }
 
-static void
-iquicksort(int *item,int *index,long int n)
-{
-  int i;
-  if (n<=0) return;
-  for (i=0; i<n; i++) {
-    index[i] = i;
-    }
-  iqs(item,index,0,n-1);
-  }
+namespace {
+  // orders task indices by decreasing cost
+  struct CostGreater {
+    const double *cost;
+    CostGreater(const double *c): cost(c) {}
+    bool operator()(int a, int b) const { return cost[a] > cost[b]; }
+  };
+}
 
 /////////////////////////////////////////////////////////////////
 // DistShellPair class
@@ -102,6 +92,7 @@ DistShellPair::DistShellPair(const Ref<MessageGrp> & msg,
   Svec_(0),
   Rvec_(0),
   Ivec_(0),
+  cumcost_(0),
   shared_(shared)
 {
   ncpu_ = nthread_*msg->n();
@@ -112,6 +103,11 @@ DistShellPair::DistShellPair(const Ref<MessageGrp> & msg,
     task_dynamic_ = false;
     if (dynamic && shared_ != 0) thread_dynamic_ = true;
     }
+  // the threads of task 0 need a shared counter to take work from
+  else if (shared_ == 0) {
+    if (nthread_ > 1) task_dynamic_ = false;
+    else shared_ = &own_shared_;
+    }
   debug_ = 0;
   print_percent_ = 10;
   bs1_eq_bs2_ = (bs1_ == bs2_);
@@ -146,6 +142,7 @@ DistShellPair::~DistShellPair()
   delete[] Svec_;
   delete[] Rvec_;
   delete[] Ivec_;
+  delete[] cumcost_;
 }
 
 void
@@ -170,6 +167,10 @@ DistShellPair::init()
       R_ = absthreadindex%nsh2;
       }
   current_shellpair_ = 0;
+  if (shared_ == &own_shared_) own_shared_.init();
+  chunk_next_ = 0;
+  chunk_end_ = 0;
+  ndone_ = 0;
 }
 
 void
@@ -183,32 +184,53 @@ DistShellPair::init_dynamic_work()
   delete[] Svec_;
   delete[] Rvec_;
   delete[] Ivec_;
-  cost_ = new int[ntask_];
+  delete[] cumcost_;
+  cost_ = new double[ntask_];
   Svec_ = new int[ntask_];
   Rvec_ = new int[ntask_];
   Ivec_ = new int[ntask_];
+  cumcost_ = new double[ntask_+1];
   index = 0;
   for (S=0; S<nsh1; S++) {
     int Rmax = (bs1_eq_bs2_ ? S : nsh2-1);
     for (R=0; R<=Rmax; R++) {
       cost_[index] = bs1_->shell(S).nfunction() * bs2_->shell(R).nfunction() *
 	            bs1_->shell(S).nprimitive() * bs2_->shell(R).nprimitive();
-#ifdef REVERSE_ORDERING
-      cost_[index] = - cost[index];
-#endif
       Svec_[index] = S;
       Rvec_[index] = R;
-      Ivec_[index] = index;
       index++;
     }
   }
 
-  // sort work
-  iquicksort(cost_, Ivec_, ntask_);
+  sort_dynamic_work();
+}
+
+void
+DistShellPair::sort_dynamic_work()
+{
+  int index;
+  for (index=0; index<ntask_; index++) {
+    Ivec_[index] = index;
+  }
+#ifdef REVERSE_ORDERING
+  for (index=0; index<ntask_; index++) cost_[index] = -cost_[index];
+#endif
+  // the sort is stable so that all threads and tasks agree on the order
+  std::stable_sort(Ivec_, Ivec_+ntask_, CostGreater(cost_));
+#ifdef REVERSE_ORDERING
+  for (index=0; index<ntask_; index++) cost_[index] = -cost_[index];
+#endif
+
+  // every task counts one extra so that chunks of negligible tasks don't vanish
+  cumcost_[0] = 0.0;
+  for (index=0; index<ntask_; index++) {
+    cumcost_[index+1] = cumcost_[index] + cost_[Ivec_[index]] + 1.0;
+  }
+
   if (debug_ > 1) {
     ExEnv::outn() << "costs of shell pairs" << endl;
     for (index=0; index<ntask_; index++) {
-      ExEnv::outn() << scprintf(" (%d %d):%d",Svec_[Ivec_[index]],Rvec_[Ivec_[index]],
+      ExEnv::outn() << scprintf(" (%d %d):%g",Svec_[Ivec_[index]],Rvec_[Ivec_[index]],
 			       cost_[Ivec_[index]])
 		   << endl;
     }
@@ -216,87 +238,133 @@ DistShellPair::init_dynamic_work()
 }
 
 void
-DistShellPair::serve_tasks()
+DistShellPair::set_schwarz_bounds(const Ref<TwoBodyInt>& tbint, int tol)
 {
-  // process requests
-  long int nreq = ntask_ + ncpu_less_0_;
-  int nreq_left = nreq;
-  while (nreq_left) {
-    int node;
-    msg_->recvt(MessageGrp::AnySender,req_type_,&node,1);
-    int SR[2];
-    if (current_shellpair_ < ntask_) {
-      SR[0] = Svec_[Ivec_[current_shellpair_]];
-      SR[1] = Rvec_[Ivec_[current_shellpair_]];
-      msg_->sendt(node,ans_type_,SR,2);
-      if (print_percent_ <= 100.0
-          && current_shellpair_%print_interval_ == 0) {
-        ExEnv::outn() << indent
-                      << scprintf("sent shell pair (%3d %3d) to %3d, %6.3f%% complete",
-                                  SR[0],SR[1],node,(double)current_shellpair_*100.0/nreq)
-                      << " (" << current_shellpair_ << " of " << ntask_ << ")"
-                      << endl;
-      }
-      current_shellpair_++;
-    }
-    else {
-      SR[0] = -1;
-      SR[1] = -1;
-      msg_->sendt(node,ans_type_,SR,2);
-      if (print_percent_ <= 100.0
-          && current_shellpair_%print_interval_ == 0) {
-        ExEnv::outn() << indent
-		     << scprintf("sent no more tasks message to %3d, %6.3f%% complete",
-				 node,(double)current_shellpair_*100.0/nreq)
-		     << endl;
-      }
-      current_shellpair_++;
-    }
-    nreq_left--;
+  if (!(task_dynamic_ || thread_dynamic_)) return;
+  if (tbint->basis1() != bs1_ || tbint->basis2() != bs2_
+      || tbint->basis3() != bs1_ || tbint->basis4() != bs2_) return;
+
+  // log2 of the bound on (PQ|PQ) for every pair, in the order of cost_
+  std::vector<int> diag(ntask_);
+  long int index;
+  for (index=0; index<ntask_; index++) {
+    int S = Svec_[index], R = Rvec_[index];
+    diag[index] = tbint->log2_shell_bound(S,R,S,R);
   }
+  std::vector<int> sorted(diag);
+  std::sort(sorted.begin(), sorted.end());
 
-  if (debug_) {
-    ExEnv::outn() << "all requests processed" << endl;
+  // the bound on (PQ|RS) is the geometric mean of those on (PQ|PQ) and (RS|RS)
+  for (index=0; index<ntask_; index++) {
+    std::vector<int>::iterator first
+      = std::lower_bound(sorted.begin(), sorted.end(), 2*tol - diag[index]);
+    long int nsurvive = sorted.end() - first;
+    int S = Svec_[index], R = Rvec_[index];
+    cost_[index] = (double)nsurvive
+                 * bs1_->shell(S).nfunction() * bs2_->shell(R).nfunction()
+                 * bs1_->shell(S).nprimitive() * bs2_->shell(R).nprimitive();
   }
+
+  sort_dynamic_work();
+}
+
+long int
+DistShellPair::chunk_end(long int begin) const
+{
+  // take 1/(CHUNKS_PER_THREAD*ncpu) of the cost that remains
+  double target = (cumcost_[ntask_] - cumcost_[begin])
+                / (CHUNKS_PER_THREAD*(task_dynamic_?ncpu_:nthread_));
+  double *end = std::lower_bound(cumcost_+begin+1, cumcost_+ntask_+1,
+                                 cumcost_[begin] + target);
+  if (end > cumcost_+ntask_) end = cumcost_+ntask_;
+  return end - cumcost_;
+}
+
+bool
+DistShellPair::grab_chunk(long int &begin, long int &end)
+{
+  long int guess = shared_->shellpair_;
+  if (guess >= ntask_) return false;
+  long int n = chunk_end(guess) - guess;
+  begin = fetch_and_add(&shared_->shellpair_, n, lock_);
+  if (begin >= ntask_) return false;
+  end = std::min(begin + n, ntask_);
+  return true;
+}
+
+void
+DistShellPair::serve_request()
+{
+  int node;
+  msg_->recvt(MessageGrp::AnySender,req_type_,&node,1);
+  long int begin, end;
+  long int chunk[2];
+  if (grab_chunk(begin, end)) {
+    chunk[0] = begin;
+    chunk[1] = end;
+    if (debug_) {
+      ExEnv::outn() << indent
+                    << scprintf("sent shell pairs [%ld,%ld) to %3d",begin,end,node)
+                    << endl;
+    }
+  }
+  else {
+    chunk[0] = chunk[1] = -1;
+    ndone_++;
+    if (debug_) {
+      ExEnv::outn() << indent
+                    << scprintf("sent no more tasks message to %3d",node)
+                    << endl;
+    }
+  }
+  msg_->sendt(node,ans_type_,chunk,2);
 }
 
 int
 DistShellPair::get_task(int &S, int &R)
 {
-  if (task_dynamic_) { // dynamic load balancing
+  if (task_dynamic_ || thread_dynamic_) { // dynamic load balancing
     int me = msg_->me();
-    if (me == 0) {
-      if (mythread_ == 0) serve_tasks();
-      return 0;
+    bool server = (task_dynamic_ && me == 0 && mythread_ == 0);
+    if (server) {
+      // answer the requests that came in while working on the last pair
+      while (ndone_ < ncpu_less_0_ && msg_->probet(MessageGrp::AnySender,req_type_))
+        serve_request();
     }
-    else {
-      int SR[2];
-      
-      lock_->lock();
-      msg_->sendt(0,req_type_,&me,1);
-      msg_->recvt(MessageGrp::AnySender,ans_type_,SR,2);
-      lock_->unlock();
-
-      S = SR[0];
-      R = SR[1];
-      if (S == -1) return 0;
-    }
-  }
-  else if (thread_dynamic_) {
-    long my_shellpair;
-    lock_->lock();
-    my_shellpair = shared_->shellpair_++;
-    lock_->unlock();
-    if (my_shellpair < ntask_) {
-      S = Svec_[Ivec_[my_shellpair]];
-      R = Rvec_[Ivec_[my_shellpair]];
+
+    if (chunk_next_ == chunk_end_) {
+      bool have_chunk;
+      if (task_dynamic_ && me != 0) {
+        long int chunk[2];
+        lock_->lock();
+        msg_->sendt(0,req_type_,&me,1);
+        msg_->recvt(0,ans_type_,chunk,2);
+        lock_->unlock();
+        have_chunk = (chunk[0] >= 0);
+        chunk_next_ = chunk[0];
+        chunk_end_ = chunk[1];
       }
-    else {
-      S = R = -1;
-      return 0;
+      else {
+        have_chunk = grab_chunk(chunk_next_, chunk_end_);
       }
+
+      if (!have_chunk) {
+        chunk_next_ = chunk_end_ = 0;
+        if (server) {
+          // the other tasks keep asking until they are told there is no more
+          while (ndone_ < ncpu_less_0_) serve_request();
+          if (debug_) ExEnv::outn() << "all requests processed" << endl;
+        }
+        S = R = -1;
+        return 0;
+      }
+    }
+
+    long int my_shellpair = chunk_next_++;
+    S = Svec_[Ivec_[my_shellpair]];
+    R = Rvec_[Ivec_[my_shellpair]];
     if (my_shellpair%print_interval_ == 0) {
-      if (print_percent_ <= 100.0 && msg_->me() == 0) {
+      if (print_percent_ <= 100.0 && me == 0) {
         ExEnv::outn() << indent 
              << scprintf("  working on shell pair (%3d %3d), %6.3f%% complete",
                  S,R,((double)my_shellpair*100.0)/ntask_)
@@ -37,7 +37,16 @@
 
 namespace sc {
 
-/// Distributes shell pairs either statically or dynamically.
+class TwoBodyInt;
+
+/** Distributes shell pairs either statically or dynamically.
+
+    Dynamic distribution hands out the shell pairs most expensive first.
+    Threads take guided chunks, whose cost shrinks as the work is used
+    up, with an atomic increment of a counter in SharedData.  With more
+    than one task, the counter lives on task 0 and the other tasks obtain
+    chunks from it with messages; thread 0 of task 0 answers them between
+    its own shell pairs, so no thread is dedicated to serving. */
 class DistShellPair {
   public:
     /** This is used to store data that must be shared between all
@@ -66,6 +75,8 @@ class DistShellPair {
     // How often updates are printed (i.e. every 10% of total work)
     double print_percent_;
     SharedData *shared_;
+    // used as shared_ when there is one thread and none is given
+    SharedData own_shared_;
 
     // Number of tasks handled by thread 0 in task 0:
     // if dynamic == true : it will distribute all of them
@@ -80,7 +91,17 @@ class DistShellPair {
     int req_type_;
     int ans_type_;
     int ncpu_less_0_;
-    void serve_tasks();
+    // the chunk of sorted work this thread is working on
+    long int chunk_next_;
+    long int chunk_end_;
+    // the number of other threads told that there is no more work
+    int ndone_;
+    // returns the end of the next chunk starting at the sorted task begin
+    long int chunk_end(long int begin) const;
+    // takes the next chunk from the shared counter; false if none is left
+    bool grab_chunk(long int &begin, long int &end);
+    // answers one chunk request from another task
+    void serve_request();
 
     // for static load balancing
     int S_, R_;          // NOTE: S is in bs1, R is in bs2
@@ -89,16 +110,21 @@ class DistShellPair {
     int mythread_;
 
     // sorted work for dynamic load balancing
-    int *cost_;
+    double *cost_;
     int *Svec_;
     int *Rvec_;
     int *Ivec_;
+    // cumcost_[i] is the cost of the first i sorted tasks
+    double *cumcost_;
 
     void init_dynamic_work();
+    void sort_dynamic_work();
   public:
     /** The DistShellPair class is used to distribute shell pair indices among tasks.
 
-        Both static (round-robin) and dynamic methods are supported. */
+        Both static (round-robin) and dynamic methods are supported.
+        Dynamic distribution among the threads of a task requires shared;
+        without it, the distribution is static. */
     DistShellPair(const Ref<MessageGrp> &, int nthread, int mythread,
                   const Ref<ThreadLock>& lock,
                   const Ref<GaussianBasisSet>& bs1, const Ref<GaussianBasisSet>& bs2,
@@ -111,6 +137,13 @@ class DistShellPair {
     /** How often to print status from node 0.  If p > 100.0, then
         no printing will be done. */
     void set_print_percent(double p);
+    /** Estimates the cost of the shell pairs for dynamic load balancing
+        from Schwarz bounds: the cost of PQ is weighted by the number of
+        pairs RS for which the bound on (PQ|RS) is at least 2^tol.  This
+        has no effect unless all four basis sets of tbint are those of
+        the shell pairs.  Must be called by all cooperating threads and
+        tasks before the first get_task. */
+    void set_schwarz_bounds(const Ref<TwoBodyInt>& tbint, int tol);
     /** Puts the current PQ shell pair into P and Q and returns 1.
         When there are no more shell pairs to be processed by this processor,
         0 is returned.  Once we start doing get_tasks, we have to go to the
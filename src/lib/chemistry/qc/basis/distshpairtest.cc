@@ -0,0 +1,183 @@
+//
+// distshpairtest.cc
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+// Checks that DistShellPair hands out every shell pair exactly once.
+// Run on one process this tests the distribution among threads; run on
+// several processes, e.g. with mpirun, it also tests the distribution
+// among tasks, with one thread per task and with several.
+
+#include <mpqc_config.h>
+#include <vector>
+
+#include <util/misc/formio.h>
+#include <util/keyval/keyval.h>
+#include <util/group/message.h>
+#include <util/group/thread.h>
+#include <chemistry/qc/basis/basis.h>
+#include <chemistry/qc/basis/integral.h>
+#include <chemistry/qc/basis/tbint.h>
+#include <chemistry/qc/basis/distshpair.h>
+#include <chemistry/qc/intv3/intv3.h>
+
+using namespace std;
+using namespace sc;
+
+// counts the shell pairs that one thread obtains from its DistShellPair
+class PairCounter: public Thread {
+  private:
+    DistShellPair pairs_;
+    int nshell2_;
+    std::vector<int> &count_;
+  public:
+    PairCounter(const Ref<MessageGrp> &msg, int nthread, int mythread,
+                const Ref<ThreadLock> &lock,
+                const Ref<GaussianBasisSet> &bs1,
+                const Ref<GaussianBasisSet> &bs2,
+                bool dynamic, DistShellPair::SharedData *shared,
+                std::vector<int> &count):
+      pairs_(msg,nthread,mythread,lock,bs1,bs2,dynamic,shared),
+      nshell2_(bs2->nshell()),
+      count_(count)
+    {
+      pairs_.set_print_percent(1000.0);
+    }
+    DistShellPair &pairs() { return pairs_; }
+    void run() {
+      int S, R;
+      while (pairs_.get_task(S,R)) count_[S*nshell2_ + R]++;
+    }
+};
+
+// distributes the shell pairs of bs1 and bs2 npass times with nthread
+// threads per task and returns the number of errors
+static int
+test(const Ref<MessageGrp> &msg, const Ref<ThreadGrp> &thr,
+     const Ref<GaussianBasisSet> &bs1, const Ref<GaussianBasisSet> &bs2,
+     const Ref<TwoBodyInt> &tbint,
+     bool dynamic, bool schwarz, int npass)
+{
+  const int nthread = thr->nthread();
+  const int nsh1 = bs1->nshell();
+  const int nsh2 = bs2->nshell();
+  const bool bs1_eq_bs2 = (bs1 == bs2);
+  Ref<ThreadLock> lock = thr->new_lock();
+  DistShellPair::SharedData shared;
+
+  std::vector<std::vector<int> > counts(nthread,
+                                        std::vector<int>(nsh1*nsh2));
+  std::vector<PairCounter*> threads(nthread);
+  for (int i=0; i<nthread; i++) {
+    threads[i] = new PairCounter(msg, nthread, i, lock, bs1, bs2,
+                                 dynamic, &shared, counts[i]);
+    if (schwarz) threads[i]->pairs().set_schwarz_bounds(tbint, -10);
+  }
+
+  int nerror = 0;
+  for (int pass=0; pass<npass; pass++) {
+    for (int i=0; i<nthread; i++) {
+      std::fill(counts[i].begin(), counts[i].end(), 0);
+      threads[i]->pairs().init();
+      thr->add_thread(i, threads[i]);
+    }
+    shared.init();
+    msg->sync();
+    thr->start_threads();
+    thr->wait_threads();
+
+    std::vector<int> count(nsh1*nsh2, 0);
+    for (int i=0; i<nthread; i++)
+      for (int j=0; j<nsh1*nsh2; j++) count[j] += counts[i][j];
+    msg->sum(&count[0], nsh1*nsh2);
+
+    for (int S=0; S<nsh1; S++) {
+      for (int R=0; R<nsh2; R++) {
+        int expected = (!bs1_eq_bs2 || S >= R) ? 1 : 0;
+        if (count[S*nsh2 + R] != expected) {
+          if (msg->me() == 0 && nerror < 10)
+            ExEnv::out0() << indent
+                          << scprintf("pass %d: shell pair (%d %d) was"
+                                      " handed out %d times",
+                                      pass, S, R, count[S*nsh2 + R])
+                          << endl;
+          nerror++;
+        }
+      }
+    }
+  }
+  thr->delete_threads();
+
+  ExEnv::out0() << indent
+                << scprintf("%d tasks, %d threads, %s%s, %s basis sets: %s",
+                            msg->n(), nthread,
+                            dynamic ? "dynamic" : "static",
+                            schwarz ? " with Schwarz bounds" : "",
+                            bs1_eq_bs2 ? "equal" : "different",
+                            nerror ? "FAILED" : "ok")
+                << endl;
+  return nerror;
+}
+
+int
+main(int argc, char**argv)
+{
+  Ref<MessageGrp> msg = MessageGrp::initial_messagegrp(argc, argv);
+  if (msg.null()) msg = MessageGrp::get_default_messagegrp();
+  MessageGrp::set_default_messagegrp(msg);
+
+  Ref<ThreadGrp> thr = ThreadGrp::initial_threadgrp(argc, argv);
+  if (thr.null()) thr = ThreadGrp::get_default_threadgrp();
+
+  const char *input = (argc > 1) ? argv[1] : SRCDIR "/distshpairtest.in";
+  Ref<KeyVal> keyval = new ParsedKeyVal(input);
+
+  Ref<GaussianBasisSet> bs1; bs1 << keyval->describedclassvalue("basis1");
+  Ref<GaussianBasisSet> bs2; bs2 << keyval->describedclassvalue("basis2");
+  Ref<Integral> integral; integral << keyval->describedclassvalue("integral");
+  const int maxthread = keyval->intvalue("nthread", KeyValValueint(4));
+  const int npass = keyval->intvalue("npass", KeyValValueint(3));
+
+  integral->set_basis(bs1);
+  integral->set_storage(32000000);
+  Ref<TwoBodyInt> tbint = integral->electron_repulsion();
+
+  // one thread per task, then maxthread threads per task
+  int nerror = 0;
+  int nthreads[2] = { 1, maxthread };
+  for (int i=0; i<(maxthread>1?2:1); i++) {
+    Ref<ThreadGrp> grp = thr->clone(nthreads[i]);
+    for (int dynamic=0; dynamic<2; dynamic++) {
+      for (int schwarz=0; schwarz<2; schwarz++) {
+        nerror += test(msg, grp, bs1, bs1, tbint, dynamic, schwarz, npass);
+      }
+      nerror += test(msg, grp, bs1, bs2, tbint, dynamic, false, npass);
+    }
+  }
+
+  return nerror ? 1 : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
@@ -30,6 +30,11 @@
 
 #include <tiledarray.h>
 #include <memory>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <utility>
+#include <vector>
 #include <chemistry/qc/basis/tiledbasisset.hpp>
 #include <mpqc/integrals/integrals.hpp>
 #include <chemistry/qc/basis/integral.h>
@@ -87,6 +92,264 @@ namespace mpqc {
         mpqc::integrals::evaluate(engine, s[0], s[1], s[2], s[3], tile_map);
       }
 
+      // Computes the shells that span each dimension of a tile range
+      template<typename Range, typename RefEngine>
+      std::vector<shell_range> tile_shells(const Range &range, RefEngine &engine) {
+
+        // Calculate the rank of our tiles
+        constexpr std::size_t rank = EngineTypeTraits<RefEngine>::ncenters;
+
+        std::vector<shell_range> ranges(rank);
+
+        // Loop over each dimension of the tile.
+        for (std::size_t i = 0; i < rank; ++i) {
+
+          // Get the global indices of the first and last function in a tile
+          // This corresponds to basis functions.
+          const std::size_t first_func = range.start()[i];
+          const std::size_t last_func = range.finish()[i] - 1;
+
+          // Compute the first and  last shell for a given dimension of a tile
+          const std::size_t first_shell = engine->basis(i)->function_to_shell(
+                  first_func);
+          const std::size_t last_shell = engine->basis(i)->function_to_shell(
+                  last_func);
+
+          // fill a vector with the shell indices that belong to dimension i
+          for (auto j = first_shell; j < last_shell + 1; ++j) {
+            ranges[i].push_back(j);
+          }
+        }
+
+        return ranges;
+      }
+
+      // Calls op(s) for every tuple s of shells from ranges, the last index running fastest
+      template<typename Op>
+      void foreach_shell_tuple(const std::vector<shell_range> &ranges, Op op) {
+        const std::size_t rank = ranges.size();
+        for (std::size_t i = 0; i < rank; ++i)
+          if (ranges[i].empty()) return;
+
+        std::vector<std::size_t> idx(rank, 0);
+        std::vector<int> s(rank);
+        while (true) {
+          for (std::size_t i = 0; i < rank; ++i)
+            s[i] = ranges[i][idx[i]];
+          op(s);
+
+          std::size_t d = rank;
+          for (; d > 0; --d) {
+            if (++idx[d - 1] < ranges[d - 1].size()) break;
+            idx[d - 1] = 0;
+          }
+          if (d == 0) return;
+        }
+      }
+
+      // Returned by log2_bound when the engine cannot estimate its integrals.
+      const int no_log2_bound = std::numeric_limits<int>::max();
+
+      // Schwarz-type estimates of the magnitude of a block of shell integrals
+      inline int log2_bound(sc::Ref<sc::TwoBodyInt> &engine, const std::vector<int> &s) {
+        return engine->log2_shell_bound(s[0], s[1], s[2], s[3]);
+      }
+
+      inline int log2_bound(sc::Ref<sc::TwoBodyThreeCenterInt> &engine, const std::vector<int> &s) {
+        return engine->log2_shell_bound(s[0], s[1], s[2]);
+      }
+
+      inline int log2_bound(sc::Ref<sc::TwoBodyTwoCenterInt> &engine, const std::vector<int> &s) {
+        return engine->log2_shell_bound(s[0], s[1]);
+      }
+
+      template<typename RefEngine>
+      int log2_bound(RefEngine &engine, const std::vector<int> &s) {
+        return no_log2_bound;
+      }
+
+      // Computes a single block of shell integrals
+      inline void compute_shell(sc::Ref<sc::TwoBodyInt> &engine, const std::vector<int> &s) {
+        engine->compute_shell(s[0], s[1], s[2], s[3]);
+      }
+
+      inline void compute_shell(sc::Ref<sc::TwoBodyThreeCenterInt> &engine, const std::vector<int> &s) {
+        engine->compute_shell(s[0], s[1], s[2]);
+      }
+
+      inline void compute_shell(sc::Ref<sc::TwoBodyTwoCenterInt> &engine, const std::vector<int> &s) {
+        engine->compute_shell(s[0], s[1]);
+      }
+
+      inline void compute_shell(sc::Ref<sc::OneBodyInt> &engine, const std::vector<int> &s) {
+        engine->compute_shell(s[0], s[1]);
+      }
+
+      inline void compute_shell(sc::Ref<sc::OneBodyOneCenterInt> &engine, const std::vector<int> &s) {
+        engine->compute_shell(s[0]);
+      }
+
+      // Converts a log2 screening threshold from a threshold on the integrals.
+      // Thresholds <= 0 disable screening.
+      inline int log2_threshold(double threshold) {
+        return (threshold > 0.0) ? static_cast<int>(std::floor(std::log2(threshold)))
+                                 : std::numeric_limits<int>::min();
+      }
+
+      /*
+       * Schwarz bounds on the shell blocks of an integral array, summarized
+       * per tile. The log2 bounds of the engines are the sum of a bra part,
+       * that depends on the first two shells (the first one for two center
+       * integrals), and a ket part, that depends on the others. The bound
+       * of a block is thus bra + ket - ref, where bra (ket) is the bound
+       * with the ket (bra) shells of the reference block 0, whose bound is
+       * ref. The bra and ket shell tuples of every tile are visited once,
+       * which takes O(nshell^2) bound evaluations, and are binned by their
+       * bound, so that the norm and cost of a tile are estimated in time
+       * proportional to the number of distinct bounds.
+       */
+      class ShellBlockBounds {
+        public:
+          template<typename RefEngine>
+          ShellBlockBounds(const ::TiledArray::TiledRange &trange,
+                           RefEngine &engine) {
+            constexpr std::size_t rank = EngineTypeTraits<RefEngine>::ncenters;
+            const std::size_t nbra = (rank > 2) ? 2 : 1;
+
+            std::vector<int> s(rank, 0);
+            ref_ = log2_bound(engine, s);
+            bounded_ = (ref_ != no_log2_bound);
+            if (!bounded_) ref_ = 0;
+
+            nket_tiles_ = 1;
+            for (std::size_t i = nbra; i < rank; ++i)
+              nket_tiles_ *= trange.tiles().size()[i];
+            const std::size_t nbra_tiles = trange.tiles().volume() / nket_tiles_;
+
+            // tile b*nket_tiles_ has the bra of bra tile b, tile k the ket
+            // of ket tile k
+            bra_.resize(nbra_tiles);
+            for (std::size_t b = 0; b < nbra_tiles; ++b)
+              bin(tile_shells(trange.make_tile_range(b * nket_tiles_), engine),
+                  0, nbra, engine, bra_[b]);
+            ket_.resize(nket_tiles_);
+            for (std::size_t k = 0; k < nket_tiles_; ++k)
+              bin(tile_shells(trange.make_tile_range(k), engine),
+                  nbra, rank, engine, ket_[k]);
+          }
+
+          /// False if the engine cannot estimate its integrals.
+          bool bounded() const { return bounded_; }
+
+          /// Estimates the Frobenius norm of tile ord, blocks with bounds
+          /// below 2^log2_thresh are neglected.
+          float norm(std::size_t ord, int log2_thresh) const {
+            if (!bounded_) return std::numeric_limits<float>::max();
+            const Bins &bra = bra_[ord / nket_tiles_];
+            const Bins &ket = ket_[ord % nket_tiles_];
+            double norm2 = 0.0;
+            for (int v = bra.lo; v <= bra.hi; ++v) {
+              const double nf = bra.nfunc[v - bra.lo];
+              const int first = ket.first(log2_thresh, ref_ - v);
+              if (nf == 0.0 || first > ket.hi - ket.lo) continue;
+              norm2 += nf * std::ldexp(ket.norm2_from[first],
+                                       2 * (v + ket.hi - ref_));
+            }
+            return static_cast<float>(std::min(std::sqrt(norm2),
+                    double(std::numeric_limits<float>::max())));
+          }
+
+          /// Estimates the relative cost of computing tile ord. The cost of
+          /// a block is the product of the number of functions and
+          /// primitives of its shells, blocks that do not survive screening
+          /// with log2_thresh do not contribute.
+          double cost(std::size_t ord, int log2_thresh) const {
+            const Bins &bra = bra_[ord / nket_tiles_];
+            const Bins &ket = ket_[ord % nket_tiles_];
+            double cost = 0.0;
+            for (int v = bra.lo; v <= bra.hi; ++v) {
+              const int first = ket.first(log2_thresh, ref_ - v);
+              if (first > ket.hi - ket.lo) continue;
+              cost += bra.cost[v - bra.lo] * ket.cost_from[first];
+            }
+            return cost;
+          }
+
+          /// True if no block of tile ord is below 2^log2_thresh.
+          bool all_significant(std::size_t ord, int log2_thresh) const {
+            return !bounded_ || log2_thresh == std::numeric_limits<int>::min()
+                || bra_[ord / nket_tiles_].lo + ket_[ord % nket_tiles_].lo
+                   - ref_ >= log2_thresh;
+          }
+
+        private:
+          // The bra or ket shell tuples of a tile, binned by their bound
+          struct Bins {
+            int lo = 0, hi = 0;  // smallest and largest bound
+            std::vector<double> nfunc;  // number of functions
+            std::vector<double> cost;
+            // sums over the bins from the given one on of nfunc * 4^(v-hi)
+            // and of cost
+            std::vector<double> norm2_from;
+            std::vector<double> cost_from;
+
+            // the first bin whose blocks survive log2_thresh when combined
+            // with bounds of -offset
+            int first(int log2_thresh, int offset) const {
+              if (log2_thresh == std::numeric_limits<int>::min()) return 0;
+              return std::max(0, log2_thresh + offset - lo);
+            }
+          };
+
+          template<typename RefEngine>
+          void bin(const std::vector<shell_range> &ranges,
+                   std::size_t begin, std::size_t end,
+                   RefEngine &engine, Bins &bins) const {
+            struct Tuple { int bound; double nfunc, cost; };
+            std::vector<Tuple> tuples;
+            const std::vector<shell_range> sub(ranges.begin() + begin,
+                                               ranges.begin() + end);
+            std::vector<int> s(ranges.size(), 0);
+            foreach_shell_tuple(sub, [&](const std::vector<int> &t) {
+              std::copy(t.begin(), t.end(), s.begin() + begin);
+              Tuple tuple = { bounded_ ? log2_bound(engine, s) : 0, 1.0, 1.0 };
+              for (std::size_t i = 0; i < t.size(); ++i) {
+                const sc::GaussianShell &shell = engine->basis(begin + i)->shell(t[i]);
+                tuple.nfunc *= shell.nfunction();
+                tuple.cost *= double(shell.nfunction()) * shell.nprimitive();
+              }
+              tuples.push_back(tuple);
+            });
+            if (tuples.empty()) return;
+
+            bins.lo = bins.hi = tuples.front().bound;
+            for (const auto &t : tuples) {
+              bins.lo = std::min(bins.lo, t.bound);
+              bins.hi = std::max(bins.hi, t.bound);
+            }
+            const std::size_t nbin = bins.hi - bins.lo + 1;
+            bins.nfunc.assign(nbin, 0.0);
+            bins.cost.assign(nbin, 0.0);
+            for (const auto &t : tuples) {
+              bins.nfunc[t.bound - bins.lo] += t.nfunc;
+              bins.cost[t.bound - bins.lo] += t.cost;
+            }
+            bins.norm2_from.assign(nbin + 1, 0.0);
+            bins.cost_from.assign(nbin + 1, 0.0);
+            for (std::size_t v = nbin; v > 0; --v) {
+              bins.norm2_from[v - 1] = bins.norm2_from[v]
+                  + std::ldexp(bins.nfunc[v - 1], 2 * (int(v - 1) - int(nbin - 1)));
+              bins.cost_from[v - 1] = bins.cost_from[v] + bins.cost[v - 1];
+            }
+          }
+
+          std::vector<Bins> bra_;
+          std::vector<Bins> ket_;
+          std::size_t nket_tiles_;
+          int ref_;
+          bool bounded_;
+      };
+
     } // namespace int_details
 
     /*
@@ -99,27 +362,7 @@ namespace mpqc {
       constexpr std::size_t rank = EngineTypeTraits<RefEngine>::ncenters;
       typedef int_details::shell_range shell_range;
 
-      std::vector<shell_range> ranges(rank);
-
-      // Loop over each dimension of the tile.
-      for (std::size_t i = 0; i < rank; ++i) {
-
-        // Get the global indices of the first and last function in a tile
-        // This corresponds to basis functions.
-        const std::size_t first_func = tile.range().start()[i];
-        const std::size_t last_func = tile.range().finish()[i] - 1;
-
-        // Compute the first and  last shell for a given dimension of a tile
-        const std::size_t first_shell = engine->basis(i)->function_to_shell(
-                first_func);
-        const std::size_t last_shell = engine->basis(i)->function_to_shell(
-                last_func);
-
-        // fill a vector with the shell indices that belong to dimension i
-        for (auto j = first_shell; j < last_shell + 1; ++j) {
-          ranges[i].push_back(j);
-        }
-      }
+      std::vector<shell_range> ranges = int_details::tile_shells(tile.range(), engine);
 
       // passes the TiledArray size into a fixed c-style array for Tensor class
       const std::size_t (&dim)[rank] =
@@ -131,50 +374,185 @@ namespace mpqc {
 
     }
 
-    template<typename ShrPtrPool, typename It, class A>
-    void make_integral_task(It first, It last, const A &array, ShrPtrPool pool);
-
     /*
-     * Splits work in into manageable chunks by creating tasks. And then fills
-     * each tile with integrals.
+     * Same as get_integrals(tile, engine), but shell blocks whose bound is
+     * below 2^log2_thresh are not computed and left zero. tile must be
+     * zero-initialized.
      */
-    template<typename ShrPtrPool, typename It, class A>
-    void integral_task(It first, It last, A &array, ShrPtrPool &pool) {
-
-      // Divide work.   If the distance between the first and last pointer
-      // is greater than some number then split the range in half and send
-      // half of the work to another task.  Continue to do this until
-      // the distance between the pointers is small enough.
-      while (last - first > 10) {
-        It middle = first;
-        std::advance(middle, std::distance(first, last) / 2);
-        make_integral_task(middle, last, array, pool);
-        last = middle;
+    template<typename Tile, typename RefEngine>
+    void get_integrals(Tile &tile, RefEngine &engine, int log2_thresh) {
+
+      if (log2_thresh == std::numeric_limits<int>::min()) {
+        get_integrals(tile, engine);
+        return;
       }
 
-      // Once the pointer range is small enough unwrap the engine type
-      // and get a local instance
-      typename PoolPtrType<ShrPtrPool>::engine_type engine = pool->instance();
+      constexpr std::size_t rank = EngineTypeTraits<RefEngine>::ncenters;
+      typedef int_details::shell_range shell_range;
 
-      // Loop over the iterator range and  create tiles to populate the
-      // TiledArray. Fill the tiles with data in get_integrals
-      for (; first != last; ++first) {
-        typename A::value_type tile(array.trange().make_tile_range(*first));
-        get_integrals(tile, engine);
+      std::vector<shell_range> ranges = int_details::tile_shells(tile.range(), engine);
+
+      // row-major strides of the tile
+      std::size_t stride[rank];
+      stride[rank - 1] = 1;
+      for (std::size_t i = rank - 1; i > 0; --i)
+        stride[i - 1] = stride[i] * tile.range().size()[i];
+
+      double *tile_data = tile.data();
+      int_details::foreach_shell_tuple(ranges, [&](const std::vector<int> &s) {
+        if (int_details::log2_bound(engine, s) < log2_thresh) return;
+
+        // offset of this block in the tile and its dimensions
+        std::size_t offset = 0;
+        std::size_t nf[rank];
+        for (std::size_t i = 0; i < rank; ++i) {
+          const sc::Ref<sc::GaussianBasisSet> basis = engine->basis(i);
+          offset += (basis->shell_to_function(s[i]) - tile.range().start()[i]) * stride[i];
+          nf[i] = basis->shell(s[i]).nfunction();
+        }
+
+        int_details::compute_shell(engine, s);
+        const double *buf = engine->buffer();
+
+        // copy the block, one row of the last dimension at a time
+        std::size_t idx[rank];
+        std::fill(idx, idx + rank, 0);
+        while (true) {
+          std::size_t row_offset = offset;
+          for (std::size_t i = 0; i + 1 < rank; ++i)
+            row_offset += idx[i] * stride[i];
+          std::copy(buf, buf + nf[rank - 1], tile_data + row_offset);
+          buf += nf[rank - 1];
+
+          std::size_t d = rank - 1;
+          for (; d > 0; --d) {
+            if (++idx[d - 1] < nf[d - 1]) break;
+            idx[d - 1] = 0;
+          }
+          if (d == 0) break;
+        }
+      });
+    }
 
-        array.set(*first, tile);
+    /*
+     * Fills each of the tiles with integrals. Each tile comes with the
+     * log2 screening threshold to use for it.
+     */
+    template<typename ShrPtrPool, class A>
+    void integral_task(const std::vector<std::pair<std::size_t, int> > &tiles,
+                       A &array, ShrPtrPool &pool) {
+
+      // Unwrap the engine type and get a local instance
+      typename PoolPtrType<ShrPtrPool>::engine_type engine = pool->instance();
+
+      // Loop over the tiles and create tiles to populate the TiledArray.
+      // Fill the tiles with data in get_integrals.
+      for (const auto &t : tiles) {
+        if (t.second != std::numeric_limits<int>::min()) {
+          typename A::value_type tile(array.trange().make_tile_range(t.first), 0.0);
+          get_integrals(tile, engine, t.second);
+          array.set(t.first, tile);
+        }
+        else {
+          typename A::value_type tile(array.trange().make_tile_range(t.first));
+          get_integrals(tile, engine);
+          array.set(t.first, tile);
+        }
       }
     }
 
     /*
-     * Spawns tasks to fill tiles with integrals.
+     * Spawns a task to fill tiles with integrals.
      */
-    template<typename ShrPtrPool, typename It, class A>
-    void make_integral_task(It first, It last, const A &array, ShrPtrPool pool){
-      array.get_world().taskq.add(&integral_task<ShrPtrPool, It, A>, first, last,
+    template<typename ShrPtrPool, class A>
+    void make_integral_task(const std::vector<std::pair<std::size_t, int> > &tiles,
+                            const A &array, ShrPtrPool pool){
+      array.get_world().taskq.add(&integral_task<ShrPtrPool, A>, tiles,
                                   array, pool);
     }
 
+    /*
+     * Groups the local tiles of array into tasks of roughly equal cost and
+     * spawns them, most expensive tiles first, so that no long task is
+     * started last. Tiles that are zero in the shape of a sparse array are
+     * skipped, and tiles whose blocks all survive screening are computed
+     * without checking the blocks again.
+     */
+    template<typename ShrPtrPool, class A>
+    void make_integral_tasks(A &array, const ShrPtrPool &pool, int log2_thresh,
+                             const int_details::ShellBlockBounds &bounds) {
+
+      // Estimate the cost of each local tile
+      std::vector<std::pair<double, std::size_t> > costs;
+      double total_cost = 0.0;
+      for (auto it = array.get_pmap()->begin(); it != array.get_pmap()->end(); ++it) {
+        if (array.is_zero(*it)) continue;
+        const double cost = bounds.cost(*it, log2_thresh);
+        costs.push_back(std::make_pair(cost, std::size_t(*it)));
+        total_cost += cost;
+      }
+      if (costs.empty()) return;
+      std::sort(costs.begin(), costs.end(),
+                [](const std::pair<double, std::size_t> &a,
+                   const std::pair<double, std::size_t> &b) {
+                  return a.first > b.first;
+                });
+
+      // Aim for several tasks per thread, but no more than one per tile and
+      // on average at least ten tiles per task when there are many tiles.
+      const std::size_t nthread = madness::ThreadPool::size() + 1;
+      const std::size_t ntask = std::min(costs.size(),
+              std::max(costs.size() / 10, 4 * nthread));
+      const double task_cost = total_cost / ntask;
+
+      // Tiles costing more than task_cost get a task of their own, the
+      // cheaper ones are batched.
+      std::vector<std::pair<std::size_t, int> > tiles;
+      double cost = 0.0;
+      for (const auto &c : costs) {
+        tiles.push_back(std::make_pair(c.second,
+                bounds.all_significant(c.second, log2_thresh)
+                ? std::numeric_limits<int>::min() : log2_thresh));
+        cost += c.first;
+        if (cost >= task_cost) {
+          make_integral_task(tiles, array, pool);
+          tiles.clear();
+          cost = 0.0;
+        }
+      }
+      if (!tiles.empty())
+        make_integral_task(tiles, array, pool);
+    }
+
+    namespace int_details {
+
+      // Constructs the TiledRange of an integral array. If dfbasis is nonnull
+      // it is used for the last dimension.
+      template<std::size_t rank>
+      ::TiledArray::TiledRange
+      integral_trange(const sc::Ref<mpqc::TA::TiledBasisSet> &tbasis,
+                      const sc::Ref<mpqc::TA::TiledBasisSet> &dfbasis) {
+        std::array<::TiledArray::TiledRange1, rank> blocking;
+        for (auto i = 0; i < rank; ++i) {
+          blocking[i] = tbasis->trange1();
+        }
+        if (dfbasis.nonnull())
+          blocking.back() = dfbasis->trange1();
+        return ::TiledArray::TiledRange(blocking.begin(), blocking.end());
+      }
+
+      // Constructs a sparse array whose shape is given by the Schwarz
+      // estimates of the norms of its tiles and fills it with integrals
+      template<typename ShrPtrPool>
+      ::TiledArray::Array<double,
+              EngineTypeTraits<typename PoolPtrType<ShrPtrPool>::engine_type>::ncenters,
+              ::TiledArray::Tensor<double>, ::TiledArray::SparsePolicy>
+      sparse_integrals(madness::World &world, const ShrPtrPool &pool,
+                       const ::TiledArray::TiledRange &trange,
+                       double threshold);
+
+    } // namespace int_details
+
 #endif //DOXYGEN
     /**
      * Initial function called to fill a TiledArray with integrals.
@@ -182,27 +560,72 @@ namespace mpqc {
      * @param[in] pool is an IntegralEnginePool object to provide integrals.
      */
     template<typename ShrPtrPool, class A>
-    void fill_tiles(A &array, const ShrPtrPool &pool) {
-
-      // get pointers
-      auto begin = array.get_pmap()->begin();
-      auto end = array.get_pmap()->end();
+    void fill_tiles(A &array, const ShrPtrPool &pool, double threshold = 0.0) {
 
       // Create tasks to fill tiles with data. Boost const reference is used
       // because Integral Engine pool is not copyable, but when sent to the
       // Madness task queue all objects are copied.
-      make_integral_task(begin, end, array, pool);
+      typename PoolPtrType<ShrPtrPool>::engine_type engine = pool->instance();
+      const int_details::ShellBlockBounds bounds(array.trange(), engine);
+      make_integral_tasks(array, pool, int_details::log2_threshold(threshold),
+                          bounds);
     }
 
+#ifndef DOXYGEN
+    namespace int_details {
+
+      template<typename ShrPtrPool>
+      ::TiledArray::Array<double,
+              EngineTypeTraits<typename PoolPtrType<ShrPtrPool>::engine_type>::ncenters,
+              ::TiledArray::Tensor<double>, ::TiledArray::SparsePolicy>
+      sparse_integrals(madness::World &world, const ShrPtrPool &pool,
+                       const ::TiledArray::TiledRange &trange,
+                       double threshold) {
+
+        namespace TA = ::TiledArray;
+
+        typedef typename PoolPtrType<ShrPtrPool>::engine_type engine_type;
+        constexpr size_t rank = EngineTypeTraits<engine_type>::ncenters;
+
+        // Each process estimates the norms of a subset of the tiles, the
+        // SparseShape constructor sums the contributions of all processes.
+        const int log2_thresh = log2_threshold(threshold);
+        engine_type engine = pool->instance();
+        const ShellBlockBounds bounds(trange, engine);
+        TA::Tensor<float> norms(trange.tiles(), 0.0f);
+        for (std::size_t t = 0; t < norms.size(); ++t) {
+          if (t % world.size() != world.rank()) continue;
+          const float norm = bounds.norm(t, log2_thresh);
+          norms[t] = (norm < threshold) ? 0.0f : norm;
+        }
+
+        TA::SparseShape<float> shape(world, norms, trange);
+        TA::Array<double, rank, TA::Tensor<double>, TA::SparsePolicy>
+            array(world, trange, shape);
+
+        make_integral_tasks(array, pool, log2_thresh, bounds);
+
+        return array;
+      }
+
+    } // namespace int_details
+#endif //DOXYGEN
+
 /// @addtogroup ChemistryBasisIntegralTA
 /// @{
 
+    /**
+     * Computes the integrals of pool over the tiled basis tbasis in a dense
+     * TiledArray. If screen_threshold is positive, shell blocks whose
+     * Schwarz estimate is below it are not computed and left zero.
+     */
     template<typename ShrPtrPool>
     ::TiledArray::Array<double,
             EngineTypeTraits<typename PoolPtrType<ShrPtrPool>::engine_type>::ncenters >
     Integrals(
             madness::World &world, const ShrPtrPool &pool,
-            const sc::Ref<mpqc::TA::TiledBasisSet> &tbasis) {
+            const sc::Ref<mpqc::TA::TiledBasisSet> &tbasis,
+            double screen_threshold = 0.0) {
 
       namespace TA = ::TiledArray;
 
@@ -211,32 +634,30 @@ namespace mpqc {
       // Determine the dimensions of our integrals as well as our TiledArray
       constexpr size_t rank = EngineTypeTraits<engine_type>::ncenters;
 
-      // Get the array to initialize the TiledArray::TiledRange using the
-      // TiledBasis
-      std::array<TiledArray::TiledRange1, rank> blocking;
-      for (auto i = 0; i < rank; ++i) {
-        blocking[i] = tbasis->trange1();
-      }
-
-      // Construct the TiledArray::TiledRange object
-      TA::TiledRange trange(blocking.begin(), blocking.end());
+      // Construct the TiledArray::TiledRange object using the TiledBasis
+      TA::TiledRange trange = int_details::integral_trange<rank>(tbasis, 0);
 
       // Initialize the TiledArray
       TA::Array<double, rank> array(world, trange);
 
       // Fill the TiledArray with data by looping over tiles and sending
       // each tile to a madness task to be filled in parallel.
-      fill_tiles(array, pool);
+      fill_tiles(array, pool, screen_threshold);
 
       return array;
     }
 
+    /**
+     * Same as above, but the last dimension is spanned by the tiled
+     * (density fitting) basis dftbasis.
+     */
     template<typename ShrPtrPool>
     ::TiledArray::Array<double,
             EngineTypeTraits<typename PoolPtrType<ShrPtrPool>::engine_type>::ncenters >
     Integrals( madness::World &world, const ShrPtrPool &pool,
             const sc::Ref<mpqc::TA::TiledBasisSet> &tbasis,
-            const sc::Ref<mpqc::TA::TiledBasisSet> &dftbasis) {
+            const sc::Ref<mpqc::TA::TiledBasisSet> &dftbasis,
+            double screen_threshold = 0.0) {
 
       namespace TA = ::TiledArray;
 
@@ -245,27 +666,60 @@ namespace mpqc {
       // Determine the dimensions of our integrals as well as our TiledArray
       constexpr size_t rank = EngineTypeTraits<engine_type>::ncenters;
 
-      // Get the array to initialize the TiledArray::TiledRange using the
-      // TiledBasis
-      std::array<TiledArray::TiledRange1, rank> blocking;
-      for (auto i = 0; i < (rank - 1); ++i) {
-        blocking[i] = tbasis->trange1(); // Asign first 2 dims to regular basis
-      }
-      blocking.back() = dftbasis->trange1(); // Asign last dim to df basis
-
-      // Construct the TiledArray::TiledRange object
-      TA::TiledRange trange(blocking.begin(), blocking.end());
+      // Construct the TiledArray::TiledRange object, the first dims use the
+      // regular basis and the last dim the df basis
+      TA::TiledRange trange = int_details::integral_trange<rank>(tbasis, dftbasis);
 
       // Initialize the TiledArray
       TA::Array<double, rank> array(world, trange);
 
       // Fill the TiledArray with data by looping over tiles and sending
       // each tile to a madness task to be filled in parallel.
-      fill_tiles(array, pool);
+      fill_tiles(array, pool, screen_threshold);
 
       return array;
     }
 
+    /**
+     * Computes the integrals of pool over the tiled basis tbasis in a
+     * block-sparse TiledArray. Tiles whose Schwarz norm estimate is below
+     * threshold are zero in the shape of the array and never computed,
+     * and shell blocks below threshold are skipped within the remaining
+     * tiles. For engines without Schwarz estimates all tiles are kept.
+     */
+    template<typename ShrPtrPool>
+    ::TiledArray::Array<double,
+            EngineTypeTraits<typename PoolPtrType<ShrPtrPool>::engine_type>::ncenters,
+            ::TiledArray::Tensor<double>, ::TiledArray::SparsePolicy>
+    SparseIntegrals(
+            madness::World &world, const ShrPtrPool &pool,
+            const sc::Ref<mpqc::TA::TiledBasisSet> &tbasis,
+            double threshold = 1.0e-12) {
+      typedef typename PoolPtrType<ShrPtrPool>::engine_type engine_type;
+      constexpr size_t rank = EngineTypeTraits<engine_type>::ncenters;
+      return int_details::sparse_integrals(world, pool,
+              int_details::integral_trange<rank>(tbasis, 0), threshold);
+    }
+
+    /**
+     * Same as above, but the last dimension is spanned by the tiled
+     * (density fitting) basis dftbasis.
+     */
+    template<typename ShrPtrPool>
+    ::TiledArray::Array<double,
+            EngineTypeTraits<typename PoolPtrType<ShrPtrPool>::engine_type>::ncenters,
+            ::TiledArray::Tensor<double>, ::TiledArray::SparsePolicy>
+    SparseIntegrals(
+            madness::World &world, const ShrPtrPool &pool,
+            const sc::Ref<mpqc::TA::TiledBasisSet> &tbasis,
+            const sc::Ref<mpqc::TA::TiledBasisSet> &dftbasis,
+            double threshold = 1.0e-12) {
+      typedef typename PoolPtrType<ShrPtrPool>::engine_type engine_type;
+      constexpr size_t rank = EngineTypeTraits<engine_type>::ncenters;
+      return int_details::sparse_integrals(world, pool,
+              int_details::integral_trange<rank>(tbasis, dftbasis), threshold);
+    }
+
 /// @} // ChemistryBasisIntegralTA
 
   }// namespace TA
@@ -200,6 +200,11 @@ TwoBodyInt::set_integral_storage(size_t storage)
 {
 }
 
+void
+TwoBodyInt::set_integral_precision(double precision)
+{
+}
+
 double
 TwoBodyInt::shell_bound(int s1, int s2, int s3, int s4)
 {
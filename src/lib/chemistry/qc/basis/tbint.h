@@ -169,6 +169,9 @@ class TwoBodyInt : public RefCount {
 
     /// This storage is used to cache computed integrals.
     virtual void set_integral_storage(size_t storage);
+    /** Cached integrals may differ from the computed ones by up to
+        precision.  The default implementation ignores it. */
+    virtual void set_integral_precision(double precision);
 
     /** Return true if the clone member can be called.  The default
      * implementation returns false. */
@@ -28,8 +28,10 @@
 #ifndef _mpqc_src_lib_chemistry_qc_basis_tbint_batch_h
 #define _mpqc_src_lib_chemistry_qc_basis_tbint_batch_h
 
+#include <vector>
 #include <util/ref/ref.h>
 #include <chemistry/qc/basis/gaussbas.h>
+#include <chemistry/qc/basis/integral.h>
 
 namespace sc {
 
@@ -43,9 +45,10 @@ struct tuple {
     T& operator[](size_t i) {
       return data[i];
     }
-    T operator= (const tuple<NumCenters, T> t )  {
+    tuple& operator= (const tuple<NumCenters, T>& t )  {
         for(int i = 0; i < NumCenters; i++)
           data[i] = t[i];
+        return *this;
     }
 };
 }
@@ -78,13 +81,10 @@ class TensorIndexRangeIterator : public IndexRangeIterator<NDIM> {
     }
 
     void init() {
-      current_ = start_;
-      next_ = current_;
-      // if range is nonempty -- find next
-      if (is_nonempty()) {
-        in_range_ = true;
-        next();
-      }
+      next_ = start_;
+      // if range is nonempty -- make start current and find next
+      have_next_ = is_nonempty();
+      next();
     }
 
     bool in_range() const {
@@ -113,6 +113,7 @@ class TensorIndexRangeIterator : public IndexRangeIterator<NDIM> {
        --d;
         ++s[d];
       }
+      return true;
     }
     // return true if range is nonempty
     bool is_nonempty() {
@@ -152,15 +153,14 @@ class TwoBodyIntBatch:public RefCount {
       if (NumCenters > 2)
         bs_[2] = i->basis3();
       if (NumCenters > 3)
-        bs_[3] - i->basis4();
+        bs_[3] = i->basis4();
     }
 
 
     virtual ~TwoBodyIntBatch(){}
 
-    /// prepare to iterate using seed s
-    /// TODO JTF implement
-    template <typename Seed> void init(const Ref<IndexRangeIterator<NumCenters> >& n, Seed s = Seed());
+    /// prepare to iterate over the shell sets in range
+    virtual void init(const Ref<IndexRangeIterator<NumCenters> >& range) = 0;
 
     /// compute next batch, return true if have another
     /// may need to be split into have_next and next
@@ -178,8 +178,9 @@ class TwoBodyIntBatch:public RefCount {
     virtual const double * buffer(TwoBodyOper::type type = TwoBodyOper::eri) const = 0;
 
     /// Return the basis set on center c
-    /// TODO JTF implement
-    const Ref<GaussianBasisSet>& basis(unsigned int c = 0) const;
+    const Ref<GaussianBasisSet>& basis(unsigned int c = 0) const {
+      return bs_[c];
+    }
 
     /** Returns the type of the operator set that this object computes.
      this function is necessary to describe the computed integrals
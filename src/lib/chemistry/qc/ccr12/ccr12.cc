@@ -116,9 +116,21 @@ CCR12::CCR12(const Ref<KeyVal>& keyval): Wavefunction(keyval), ccr12_info_(0) {
   memorysize_ = keyval->longvalue("memory",   KeyValValuelong(200000000));
   ExEnv::out0() << indent << "Memory size per node: " << memorysize_ << endl;
   worksize_ = keyval->longvalue("workmemory",   KeyValValuelong(50000000));
-#ifdef DISK_BASED_SMITH
-  worksize_ = memorysize_; 
-#endif
+  // the disk-based algorithm supports only serial runs
+  const std::string storage = keyval->stringvalue("tensor_storage",
+                                                  KeyValValuestring(mem_->n() > 1 ? "memory" : "disk"));
+  if (storage == "memory")
+    Tensor::set_default_storage(Tensor::MemoryStorage);
+  else if (storage == "disk")
+    Tensor::set_default_storage(Tensor::DiskStorage);
+  else
+    throw InputError("invalid keyword value",
+                     __FILE__, __LINE__, "tensor_storage", storage.c_str(),
+                     this->class_desc());
+  Tensor::set_default_cache_size(keyval->longvalue("tensor_cache", KeyValValuelong(Tensor::default_cache_size())));
+  if (Tensor::default_storage() == Tensor::DiskStorage)
+    worksize_ = memorysize_;
+  ExEnv::out0() << indent << "Tensor storage: " << storage << endl;
   ExEnv::out0() << indent << "Work   size per node: " << worksize_   << endl;
   tilesize_forced_ = keyval->intvalue("force_tilesize",KeyValValueint(0));
 }
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cassert>
+#include <util/misc/scexception.h>
 #include <math/scmat/abstract.h>
 #include <chemistry/qc/ccr12/ccr12_info.h>
 
@@ -46,7 +47,8 @@ CCR12_Info::CCR12_Info(const Ref<R12WavefunctionWorld>& r12world,
                        long workmem, long memsize, int nnode, int ndiis,
                        string theory, string per, int tilef):
 r12world_(r12world), mem_(mem), ref_(reference), nfzc_(nfc),
-nfzv_(nfv), nirrep_(nirr), workmemsize_(workmem), theory_(theory), perturbative_(per), maxtilesize_(tilef)
+nfzv_(nfv), nirrep_(nirr), workmemsize_(workmem), theory_(theory), perturbative_(per), maxtilesize_(tilef),
+thr_(ThreadGrp::get_default_threadgrp()), in_threads_(false)
 {
   MPQC_ASSERT(r12world_->r12tech()->corrfactor()->nfunctions() == 1);
   restricted_ = !ref()->spin_polarized();
@@ -304,11 +306,7 @@ nfzv_(nfv), nirrep_(nirr), workmemsize_(workmem), theory_(theory), perturbative_
 /// The tensors would better be inverted before they are transformed
 /// into block-wise structure.
 
-#ifndef DISK_BASED_SMITH
-  const long input_tensors = static_size / 1000000L / nnode;
-#else
-  const long input_tensors = 0L;
-#endif
+  const long input_tensors = Tensor::default_storage() == Tensor::MemoryStorage ? static_size / 1000000L / nnode : 0L;
   const long work_space    = workmem / 1000000L;
   const long intermediates = memsize / 1000000L - work_space - input_tensors;
 
@@ -331,6 +329,73 @@ CCR12_Info::~CCR12_Info(){
 }
 
 
+namespace sc {
+  /// executes a SMITH routine on one of the threads of CCR12_Info::run_threads()
+  class CCR12_InfoThread: public Thread {
+    public:
+      CCR12_InfoThread(const std::function<void()>& routine, Tensor::TileCounter* counter):
+        routine_(routine), counter_(counter) {}
+      void run() {
+        Tensor::set_thread_tiles(counter_);
+        try {
+          routine_();
+        }
+        catch (std::exception& e) {
+          error_ = e.what();
+        }
+        signature_ = Tensor::thread_tiles_signature();
+        Tensor::set_thread_tiles(0);
+      }
+      const std::string& error() const { return error_; }
+      /// identifies the sequence of local tiles this thread has queried
+      unsigned long signature() const { return signature_; }
+    private:
+      const std::function<void()>& routine_;
+      Tensor::TileCounter* counter_;
+      std::string error_;
+      unsigned long signature_;
+  };
+}
+
+void CCR12_Info::run_threads(const std::function<void()>& routine){
+  const int nthread = thr_->nthread();
+  if (nthread == 1 || in_threads_) {
+    routine();
+    return;
+  }
+
+  Tensor::TileCounter counter(thr_->new_lock());
+  std::vector<CCR12_InfoThread*> threads(nthread);
+  for (int i = 0; i < nthread; ++i) {
+    threads[i] = new CCR12_InfoThread(routine, &counter);
+    thr_->add_thread(i, threads[i]);
+  }
+  in_threads_ = true;
+  thr_->start_threads();
+  thr_->wait_threads();
+  in_threads_ = false;
+
+  std::string error;
+  bool same_tiles = true;
+  for (int i = 0; i < nthread; ++i) {
+    if (error.empty()) error = threads[i]->error();
+    if (threads[i]->signature() != threads[0]->signature()) same_tiles = false;
+  }
+  thr_->delete_threads();
+  if (!error.empty())
+    throw AlgorithmException(error.c_str(), __FILE__, __LINE__);
+  // a tile is claimed by the thread that queries it as the n-th local tile
+  // when it obtains n from the counter, so if the threads query different
+  // tiles some are skipped and others are computed twice
+  if (!same_tiles)
+    throw ProgrammingError("CCR12_Info::run_threads: the threads queried different local tiles",
+                           __FILE__, __LINE__);
+
+  // the routines do not synchronize while the threads are running
+  mem_->sync();
+}
+
+
 void CCR12_Info::determine_tilesizes(){
 
   double workdouble = static_cast<double>(workmemsize_) / sizeof(double);
@@ -30,6 +30,7 @@
 
 #include <string>
 #include <vector>
+#include <functional>
 #include <util/misc/compute.h>
 #include <util/group/memory.h>
 #include <util/group/message.h>
@@ -150,6 +151,11 @@ class CCR12_Info : virtual public RefCount {
     const Ref<R12WavefunctionWorld>& r12world_;
     size_t workmemsize_;
 
+    // the threads that execute the SMITH routines
+    Ref<ThreadGrp> thr_;
+    bool in_threads_;
+    void run_threads(const std::function<void()>& routine);
+
     // orbital data after sorted
     std::vector<double> orbital_evl_sorted_;
     std::vector<long> orbital_spin_sorted_;
@@ -236,35 +242,53 @@ class CCR12_Info : virtual public RefCount {
     long get_alpha(long tile) const {return alpha_[tile];};
     double get_orb_energy(long orb) const {return orbital_evl_sorted_[orb];};
 
-    Ref<Tensor> f1() const {return d_f1;};
-    Ref<Tensor> v2() const {return d_v2;};
-    Ref<Tensor> t1() const {return d_t1;};
-    Ref<Tensor> t2() const {return d_t2;};
-    Ref<Tensor> gt2()const {return d_gt2;};
-    Ref<Tensor> t3() const {return d_t3;};
-    Ref<Tensor> t4() const {return d_t4;};
-
-    Ref<Tensor> fr2() const {return d_fr2;};
-    Ref<Tensor> fd2() const {return d_fd2;};
-    Ref<Tensor> vr2() const {return d_vr2;};
-    Ref<Tensor> vd2() const {return d_vd2;};
-    Ref<Tensor> xs2() const {return d_xs2;};
-    Ref<Tensor> bs2() const {return d_bs2;};
-    Ref<Tensor> ps2() const {return d_ps2;};
-
-    Ref<Tensor> vd2_gen() const {return d_vd2_gen; };
-
-    Ref<Tensor> qy() const {return d_qy;};
-    Ref<Tensor> qx() const {return d_qx;};
-    Ref<Tensor> ly() const {return d_ly;};
-    Ref<Tensor> lx() const {return d_lx;};
-
-    Ref<Tensor> lambda1() const {return d_lambda1;};
-    Ref<Tensor> lambda2() const {return d_lambda2;};
-    Ref<Tensor> glambda2() const {return d_glambda2;};
-    Ref<Tensor> lambda3() const {return d_lambda3;};
+    const Ref<Tensor>& f1() const {return d_f1;};
+    const Ref<Tensor>& v2() const {return d_v2;};
+    const Ref<Tensor>& t1() const {return d_t1;};
+    const Ref<Tensor>& t2() const {return d_t2;};
+    const Ref<Tensor>& gt2() const {return d_gt2;};
+    const Ref<Tensor>& t3() const {return d_t3;};
+    const Ref<Tensor>& t4() const {return d_t4;};
+
+    const Ref<Tensor>& fr2() const {return d_fr2;};
+    const Ref<Tensor>& fd2() const {return d_fd2;};
+    const Ref<Tensor>& vr2() const {return d_vr2;};
+    const Ref<Tensor>& vd2() const {return d_vd2;};
+    const Ref<Tensor>& xs2() const {return d_xs2;};
+    const Ref<Tensor>& bs2() const {return d_bs2;};
+    const Ref<Tensor>& ps2() const {return d_ps2;};
+
+    const Ref<Tensor>& vd2_gen() const {return d_vd2_gen;};
+
+    const Ref<Tensor>& qy() const {return d_qy;};
+    const Ref<Tensor>& qx() const {return d_qx;};
+    const Ref<Tensor>& ly() const {return d_ly;};
+    const Ref<Tensor>& lx() const {return d_lx;};
+
+    const Ref<Tensor>& lambda1() const {return d_lambda1;};
+    const Ref<Tensor>& lambda2() const {return d_lambda2;};
+    const Ref<Tensor>& glambda2() const {return d_glambda2;};
+    const Ref<Tensor>& lambda3() const {return d_lambda3;};
 
     const Ref<MemoryGrp>& mem() const {return mem_;};
+    /// synchronizes the nodes, except inside parallel() which synchronizes once all threads are done
+    void sync() const { if (!in_threads_) mem_->sync(); }
+
+    /** Executes a SMITH routine of obj on every thread of the default ThreadGrp.
+        The routine may call is_this_local() on one tensor only; the local tiles
+        are handed out to the threads as they ask for them (see
+        Tensor::set_thread_tiles()), and each thread uses its own scratch arrays.
+        This requires that every thread queries the same sequence of tiles,
+        i.e. that the tile loops depend on nothing but this object's constants,
+        which is checked once the threads are done.  The tile loops must not
+        copy Refs to shared objects, whose reference counts need not be
+        thread-safe; hence the tensors are returned by reference. */
+    template <class T> void parallel(T* obj, void (T::*routine)()) {
+      run_threads([obj,routine]() { (obj->*routine)(); });
+    }
+    template <class T> void parallel(T* obj, void (T::*routine)(Ref<Tensor>&), Ref<Tensor>& out) {
+      run_threads([obj,routine,&out]() { (obj->*routine)(out); });
+    }
     long irrep_f() const {return irrep_f_;};
     long irrep_v() const {return irrep_v_;};
     long irrep_t() const {return irrep_t_;};
@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <math/scmat/blas.h>
 #include <chemistry/qc/ccr12/ccr12_info.h>
+#include <chemistry/qc/ccr12/sort_indices.h>
 
 
 using namespace sc;
@@ -135,27 +136,11 @@ void CCR12_Info::restricted_8(const long inp1,const long inp2,const long inp3,co
 void CCR12_Info::sort_indices2(const double* unsorted,double* sorted,
                                const long a,const long b,
                                const int i,const int j,const double factor) const
-{ 
-  // prototype
-  if (i==0) {
-    const int j0max=static_cast<int>(a*b);
-    for (int j0=0; j0<a*b; ++j0) sorted[j0]=unsorted[j0]*factor;
-  } else { 
-    long id[2];
-    long jd[2] = {a, b};
-    long iall=0;
-    for(int j0=0;j0<(int)a;++j0){
-      id[0]=j0;
-      for(int j1=0;j1<(int)b;++j1,++iall){
-        id[1]=j1;
-        long ib=id[j]+jd[j]*id[i];
-        sorted[ib]=unsorted[iall]*factor;
-      }
-    }
-  }
-  
-  // is there any good code for matrix transposition?
-} 
+{
+  const long dims[2] = {a, b};
+  const int perm[2] = {i, j};
+  sort_indices(unsorted, sorted, 2, dims, perm, factor);
+}
 
 
 void CCR12_Info::sort_indices4(const double* unsorted,double* sorted,
@@ -163,25 +148,9 @@ void CCR12_Info::sort_indices4(const double* unsorted,double* sorted,
                                const int i,const int j,const int k,const int l,
                                const double factor) const
 {
-  // prototype
-  long id[4];
-  long jd[4] = {a, b, c, d};
-
-  long iall=0;
-  for(int j0=0;j0<(int)a;++j0){
-    id[0]=j0;
-    for(int j1=0;j1<(int)b;++j1){
-      id[1]=j1;
-      for(int j2=0;j2<(int)c;++j2){
-        id[2]=j2;
-        for (int j3=0;j3<(int)d;++j3,++iall){
-          id[3]=j3;
-          long ib=id[l]+jd[l]*(id[k]+jd[k]*(id[j]+jd[j]*id[i]));
-          sorted[ib]=unsorted[iall]*factor;
-        }
-      }
-    } 
-  } 
+  const long dims[4] = {a, b, c, d};
+  const int perm[4] = {i, j, k, l};
+  sort_indices(unsorted, sorted, 4, dims, perm, factor);
 }
 
 
@@ -192,31 +161,9 @@ void CCR12_Info::sort_indices6(const double* unsorted,double* sorted,
                                const int l,const int m,const int n,
                                const double factor) const
 {
-  // prototype
-  long id[6];
-  long jd[6] = {a, b, c, d, e, f};
-
-  int iall=0;
-  for(int j0=0;j0<(int)a;++j0){
-   id[0]=j0;
-   for(int j1=0;j1<(int)b;++j1){
-    id[1]=j1;
-    for(int j2=0;j2<(int)c;++j2){
-     id[2]=j2;
-     for(int j3=0;j3<(int)d;++j3){
-      id[3]=j3;
-      for (int j4=0;j4<(int)e;++j4){
-       id[4]=j4;
-       for (int j5=0;j5<(int)f;++j5,++iall){
-        id[5]=j5;
-        long ib=id[n]+jd[n]*(id[m]+jd[m]*(id[l]+jd[l]*(id[k]+jd[k]*(id[j]+jd[j]*id[i]))));
-        sorted[ib]=unsorted[iall]*factor;
-       }
-      }
-     }
-    } 
-   }
-  } 
+  const long dims[6] = {a, b, c, d, e, f};
+  const int perm[6] = {i, j, k, l, m, n};
+  sort_indices(unsorted, sorted, 6, dims, perm, factor);
 }
 
 
@@ -227,37 +174,9 @@ void CCR12_Info::sort_indices8(const double* unsorted,double* sorted,
                                const int m,const int n,const int o,const int p,
                                const double factor) const
 {
-  // prototype
-  long id[8];
-  long jd[8] = {a, b, c, d, e, f, g, h};
-
-  int iall=0;
-  for(int j0=0;j0<(int)a;++j0){
-   id[0]=j0;
-   for(int j1=0;j1<(int)b;++j1){
-    id[1]=j1;
-    for(int j2=0;j2<(int)c;++j2){
-     id[2]=j2;
-     for(int j3=0;j3<(int)d;++j3){
-      id[3]=j3;
-      for(int j4=0;j4<(int)e;++j4){
-       id[4]=j4;
-       for(int j5=0;j5<(int)f;++j5){
-        id[5]=j5;
-        for(int j6=0;j6<(int)g;++j6){
-         id[6]=j6;
-         for(int j7=0;j7<(int)h;++j7,++iall){
-          id[7]=j7;
-          long ib=id[p]+jd[p]*(id[o]+jd[o]*(id[n]+jd[n]*(id[m]+jd[m]*(id[l]+jd[l]*(id[k]+jd[k]*(id[j]+jd[j]*id[i]))))));
-          sorted[ib]=unsorted[iall]*factor;
-         }
-        }
-       }
-      }
-     }
-    } 
-   }
-  } 
+  const long dims[8] = {a, b, c, d, e, f, g, h};
+  const int perm[8] = {i, j, k, l, m, n, o, p};
+  sort_indices(unsorted, sorted, 8, dims, perm, factor);
 }
 
 
@@ -268,31 +187,9 @@ void CCR12_Info::sort_indices_acc6(const double* unsorted,double* sorted,
                                    const int l,const int m,const int n,
                                    const double factor) const
 {
-  // prototype
-  long id[6];
-  long jd[6] = {a, b, c, d, e, f};
-
-  int iall=0;
-  for(int j0=0;j0<(int)a;++j0){
-   id[0]=j0;
-   for(int j1=0;j1<(int)b;++j1){
-    id[1]=j1;
-    for(int j2=0;j2<(int)c;++j2){
-     id[2]=j2;
-     for(int j3=0;j3<(int)d;++j3){
-      id[3]=j3;
-      for (int j4=0;j4<(int)e;++j4){
-       id[4]=j4;
-       for (int j5=0;j5<(int)f;++j5,++iall){
-        id[5]=j5;
-        long ib=id[n]+jd[n]*(id[m]+jd[m]*(id[l]+jd[l]*(id[k]+jd[k]*(id[j]+jd[j]*id[i]))));
-        sorted[ib]+=unsorted[iall]*factor;
-       }
-      }
-     }
-    } 
-   }
-  } 
+  const long dims[6] = {a, b, c, d, e, f};
+  const int perm[6] = {i, j, k, l, m, n};
+  sort_indices(unsorted, sorted, 6, dims, perm, factor, true);
 }
 
 
@@ -303,37 +200,9 @@ void CCR12_Info::sort_indices_acc8(const double* unsorted,double* sorted,
                                    const int m,const int n,const int o,const int p,
                                    const double factor) const
 {
-  // prototype
-  long id[8];
-  long jd[8] = {a, b, c, d, e, f, g, h};
-
-  int iall=0;
-  for(int j0=0;j0<(int)a;++j0){
-   id[0]=j0;
-   for(int j1=0;j1<(int)b;++j1){
-    id[1]=j1;
-    for(int j2=0;j2<(int)c;++j2){
-     id[2]=j2;
-     for(int j3=0;j3<(int)d;++j3){
-      id[3]=j3;
-      for(int j4=0;j4<(int)e;++j4){
-       id[4]=j4;
-       for(int j5=0;j5<(int)f;++j5){
-        id[5]=j5;
-        for(int j6=0;j6<(int)g;++j6){
-         id[6]=j6;
-         for(int j7=0;j7<(int)h;++j7,++iall){
-          id[7]=j7;
-          long ib=id[p]+jd[p]*(id[o]+jd[o]*(id[n]+jd[n]*(id[m]+jd[m]*(id[l]+jd[l]*(id[k]+jd[k]*(id[j]+jd[j]*id[i]))))));
-          sorted[ib]+=unsorted[iall]*factor;
-         }
-        }
-       }
-      }
-     }
-    } 
-   }
-  } 
+  const long dims[8] = {a, b, c, d, e, f, g, h};
+  const int perm[8] = {i, j, k, l, m, n, o, p};
+  sort_indices(unsorted, sorted, 8, dims, perm, factor, true);
 }
 
 
@@ -47,28 +47,28 @@ i1xn.at(0)=new Tensor("ccsd_2q_right_1x0_0",z->mem());
 offset_smith_0_1();
 in.at(2)=new Tensor("ccsd_2q_right_2_0",z->mem());
 offset_smith_1_1();
-smith_1_1_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_1_1_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_2q_right_3_0",z->mem());
 offset_smith_2_4();
-smith_2_4_0(); //z->v2()=>in.at(3)
-smith_3_8(); //z->t1(),z->v2()=>in.at(3)
-smith_2_4(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_4_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_3_8); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_4); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_13(); //z->t2(),z->v2()=>in.at(2)
-smith_1_1(); //z->t2(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_13); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_1_1); //z->t2(),in.at(2)=>in.at(1x0)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_2q_right_2_1",z->mem());
 offset_smith_1_2();
-smith_1_2_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_1_2_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_2q_right_3_0",z->mem());
 offset_smith_2_5();
-smith_2_5_0(); //z->v2()=>in.at(3)
-smith_3_10(); //z->t1(),z->v2()=>in.at(3)
-smith_2_5(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_5_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_3_10); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_5); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_7(); //z->t1(),z->v2()=>in.at(2)
-smith_2_12(); //z->t2(),z->v2()=>in.at(2)
-smith_1_2(); //z->t2(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_7); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_12); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_1_2); //z->t2(),in.at(2)=>in.at(1x0)
 delete in.at(2);
 }
 if (toggle==2L) {
@@ -79,15 +79,15 @@ i1xn.at(1)=new Tensor("ccsd_2q_right_1x1_1",z->mem());
 offset_smith_0_3();
 in.at(2)=new Tensor("ccsd_2q_right_2_0",z->mem());
 offset_smith_1_3();
-smith_1_3_0(); //z->v2()=>in.at(2)
-smith_2_6(); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_1_3_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_6); //z->t1(),z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_2q_right_3_9",z->mem());
 offset_smith_2_9();
-smith_3_9(); //z->t1(),z->t1()=>in.at(3)
-smith_2_9(); //z->v2(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_3_9); //z->t1(),z->t1()=>in.at(3)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_9); //z->v2(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_11(); //z->t2(),z->v2()=>in.at(2)
-smith_1_3(); //z->t2(),in.at(2)=>in.at(1x1)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_2_11); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2Q_RIGHT::smith_1_3); //z->t2(),in.at(2)=>in.at(1x1)
 delete in.at(2);
 }
 if (toggle==2L) {
@@ -272,7 +272,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 i1xn[0]->set_filesize(size); 
 i1xn[0]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_0_3(double* a_i0,const long t_p5b,const long t_p6b,const long t_p7b,const long t_p8b,const long t_h1b,const long t_h2b,const long t_h3b,const long t_h4b){ 
@@ -447,7 +447,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
 } 
 i1xn[1]->set_filesize(size); 
 i1xn[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_1_1(){ 
@@ -543,7 +543,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_1_1_0(){ 
@@ -584,7 +584,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::offset_smith_1_1(){ 
@@ -608,7 +608,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_1_2(){ 
@@ -719,7 +719,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_1_2_0(){ 
@@ -760,7 +760,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::offset_smith_1_2(){ 
@@ -784,7 +784,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_1_3(){ 
@@ -880,7 +880,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_1_3_0(){ 
@@ -921,7 +921,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::offset_smith_1_3(){ 
@@ -945,7 +945,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_11(){ 
@@ -1012,7 +1012,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_12(){ 
@@ -1104,7 +1104,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_13(){ 
@@ -1171,7 +1171,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_4(){ 
@@ -1244,7 +1244,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_4_0(){ 
@@ -1285,7 +1285,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::offset_smith_2_4(){ 
@@ -1309,7 +1309,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_5(){ 
@@ -1377,7 +1377,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_5_0(){ 
@@ -1418,7 +1418,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::offset_smith_2_5(){ 
@@ -1442,7 +1442,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_6(){ 
@@ -1515,7 +1515,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_7(){ 
@@ -1583,7 +1583,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_2_9(){ 
@@ -1650,7 +1650,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::offset_smith_2_9(){ 
@@ -1674,7 +1674,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_3_10(){ 
@@ -1742,7 +1742,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_3_8(){ 
@@ -1810,7 +1810,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2Q_RIGHT::smith_3_9(){ 
@@ -1895,5 +1895,5 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
@@ -45,49 +45,49 @@ i1xn.resize(16);
 if (toggle==1L) {
 i1xn.at(0)=new Tensor("ccsd_2t_pr12_right_1x0_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->v2()=>in.at(1x0)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_0_1_0); //z->v2()=>in.at(1x0)
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_4_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_2t_pr12_right_3_0",z->mem());
 offset_smith_2_10();
-smith_2_10_0(); //z->v2()=>in.at(3)
-smith_3_25(); //z->t1(),z->v2()=>in.at(3)
-smith_2_10(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_10_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_3_25); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_10); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_32(); //z->t2(),z->v2()=>in.at(2)
-smith_2_38(); //z->gt2(),z->vr2()=>in.at(2)
-smith_1_4(); //z->t1(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_32); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_38); //z->gt2(),z->vr2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_4); //z->t1(),in.at(2)=>in.at(1x0)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_1",z->mem());
 offset_smith_1_5();
-smith_1_5_0(); //z->v2()=>in.at(2)
-smith_2_11(); //z->t1(),z->v2()=>in.at(2)
-smith_1_5(); //z->t1(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_5_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_11); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_5); //z->t1(),in.at(2)=>in.at(1x0)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_2",z->mem());
 offset_smith_1_17();
-smith_1_17_0(); //z->v2()=>in.at(2)
-smith_2_31(); //z->t1(),z->v2()=>in.at(2)
-smith_1_17(); //z->t2(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_17_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_31); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_17); //z->t2(),in.at(2)=>in.at(1x0)
 delete in.at(2);
-smith_1_19(); //z->t2(),z->v2()=>in.at(1x0)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_19); //z->t2(),z->v2()=>in.at(1x0)
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_3",z->mem());
 offset_smith_1_22();
-smith_1_22_0(); //z->v2()=>in.at(2)
-smith_2_37(); //z->t1(),z->v2()=>in.at(2)
-smith_1_22(); //z->qy(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_22_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_37); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_22); //z->qy(),in.at(2)=>in.at(1x0)
 delete in.at(2);
-smith_1_24(); //z->gt2(),z->vr2()=>in.at(1x0)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_24); //z->gt2(),z->vr2()=>in.at(1x0)
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_29",z->mem());
 offset_smith_1_29();
-smith_2_29(); //z->t1(),z->v2()=>in.at(2)
-smith_1_29(); //z->t2(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_29); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_29); //z->t2(),in.at(2)=>in.at(1x0)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_35",z->mem());
 offset_smith_1_35();
-smith_2_35(); //z->t1(),z->v2()=>in.at(2)
-smith_1_35(); //z->qy(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_35); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_35); //z->qy(),in.at(2)=>in.at(1x0)
 delete in.at(2);
 }
 if (toggle==2L) {
@@ -96,30 +96,30 @@ smith_0_1(a_i0,t_p4b,t_p5b,t_p6b,t_h1b,t_h2b,t_h3b);
 if (toggle==1L) {
 i1xn.at(1)=new Tensor("ccsd_2t_pr12_right_1x1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->v2()=>in.at(1x1)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_0_2_0); //z->v2()=>in.at(1x1)
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_0",z->mem());
 offset_smith_1_6();
-smith_1_6_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_6_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_2t_pr12_right_3_0",z->mem());
 offset_smith_2_12();
-smith_2_12_0(); //z->v2()=>in.at(3)
-smith_3_26(); //z->t1(),z->v2()=>in.at(3)
-smith_2_12(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_12_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_3_26); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_12); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_13(); //z->t1(),z->v2()=>in.at(2)
-smith_2_30(); //z->t2(),z->v2()=>in.at(2)
-smith_2_36(); //z->qy(),z->v2()=>in.at(2)
-smith_1_6(); //z->t1(),in.at(2)=>in.at(1x1)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_13); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_30); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_36); //z->qy(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_6); //z->t1(),in.at(2)=>in.at(1x1)
 delete in.at(2);
-smith_1_7(); //z->t1(),z->v2()=>in.at(1x1)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_7); //z->t1(),z->v2()=>in.at(1x1)
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_1",z->mem());
 offset_smith_1_16();
-smith_1_16_0(); //z->v2()=>in.at(2)
-smith_2_28(); //z->t1(),z->v2()=>in.at(2)
-smith_1_16(); //z->t2(),in.at(2)=>in.at(1x1)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_16_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_28); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_16); //z->t2(),in.at(2)=>in.at(1x1)
 delete in.at(2);
-smith_1_18(); //z->t2(),z->v2()=>in.at(1x1)
-smith_1_23(); //z->qy(),z->v2()=>in.at(1x1)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_18); //z->t2(),z->v2()=>in.at(1x1)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_23); //z->qy(),z->v2()=>in.at(1x1)
 }
 if (toggle==2L) {
 smith_0_2(a_i0,t_p4b,t_p5b,t_p6b,t_h1b,t_h2b,t_h3b);
@@ -127,36 +127,36 @@ smith_0_2(a_i0,t_p4b,t_p5b,t_p6b,t_h1b,t_h2b,t_h3b);
 if (toggle==1L) {
 i1xn.at(2)=new Tensor("ccsd_2t_pr12_right_1x2_2",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->v2()=>in.at(1x2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_0_3_0); //z->v2()=>in.at(1x2)
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_0",z->mem());
 offset_smith_1_8();
-smith_1_8_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_8_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_2t_pr12_right_3_27",z->mem());
 offset_smith_2_27();
-smith_3_27(); //z->t1(),z->v2()=>in.at(3)
-smith_2_27(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_3_27); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_27); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_33(); //z->t2(),z->v2()=>in.at(2)
-smith_1_8(); //z->t1(),in.at(2)=>in.at(1x2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_33); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_8); //z->t1(),in.at(2)=>in.at(1x2)
 delete in.at(2);
-smith_1_9(); //z->t1(),z->v2()=>in.at(1x2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_9); //z->t1(),z->v2()=>in.at(1x2)
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_14",z->mem());
 offset_smith_1_14();
-smith_2_14(); //z->t1(),z->t1()=>in.at(2)
-smith_1_14(); //z->v2(),in.at(2)=>in.at(1x2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_14); //z->t1(),z->t1()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_14); //z->v2(),in.at(2)=>in.at(1x2)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_15",z->mem());
 offset_smith_1_15();
-smith_2_15(); //z->t1(),z->t1()=>in.at(2)
-smith_1_15(); //z->v2(),in.at(2)=>in.at(1x2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_15); //z->t1(),z->t1()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_15); //z->v2(),in.at(2)=>in.at(1x2)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_2t_pr12_right_2_1",z->mem());
 offset_smith_1_20();
-smith_1_20_0(); //z->v2()=>in.at(2)
-smith_2_34(); //z->t1(),z->v2()=>in.at(2)
-smith_1_20(); //z->t2(),in.at(2)=>in.at(1x2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_20_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_2_34); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_20); //z->t2(),in.at(2)=>in.at(1x2)
 delete in.at(2);
-smith_1_21(); //z->t2(),z->v2()=>in.at(1x2)
+z->parallel(this,&CCSD_2T_PR12_RIGHT::smith_1_21); //z->t2(),z->v2()=>in.at(1x2)
 }
 if (toggle==2L) {
 smith_0_3(a_i0,t_p4b,t_p5b,t_p6b,t_h1b,t_h2b,t_h3b);
@@ -305,7 +305,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_0_1(){ 
@@ -329,7 +329,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 i1xn[0]->set_filesize(size); 
 i1xn[0]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_0_2(double* a_i0,const long t_p4b,const long t_p5b,const long t_p6b,const long t_h1b,const long t_h2b,const long t_h3b){ 
@@ -468,7 +468,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_0_2(){ 
@@ -492,7 +492,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 i1xn[1]->set_filesize(size); 
 i1xn[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_0_3(double* a_i0,const long t_p4b,const long t_p5b,const long t_p6b,const long t_h1b,const long t_h2b,const long t_h3b){ 
@@ -625,7 +625,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_0_3(){ 
@@ -649,7 +649,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 i1xn[2]->set_filesize(size); 
 i1xn[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_14(){ 
@@ -716,7 +716,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_14(){ 
@@ -740,7 +740,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_15(){ 
@@ -815,7 +815,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_15(){ 
@@ -839,7 +839,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_16(){ 
@@ -906,7 +906,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_16_0(){ 
@@ -947,7 +947,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_16(){ 
@@ -971,7 +971,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_17(){ 
@@ -1066,7 +1066,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_17_0(){ 
@@ -1107,7 +1107,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_17(){ 
@@ -1131,7 +1131,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_18(){ 
@@ -1226,7 +1226,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_19(){ 
@@ -1293,7 +1293,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_20(){ 
@@ -1360,7 +1360,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_20_0(){ 
@@ -1401,7 +1401,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_20(){ 
@@ -1425,7 +1425,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_21(){ 
@@ -1514,7 +1514,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_22(){ 
@@ -1601,7 +1601,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_22_0(){ 
@@ -1642,7 +1642,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_22(){ 
@@ -1666,7 +1666,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_23(){ 
@@ -1747,7 +1747,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_24(){ 
@@ -1814,7 +1814,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_29(){ 
@@ -1882,7 +1882,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_29(){ 
@@ -1902,7 +1902,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_35(){ 
@@ -1964,7 +1964,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_35(){ 
@@ -1984,7 +1984,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_4(){ 
@@ -2052,7 +2052,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_4_0(){ 
@@ -2093,7 +2093,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_4(){ 
@@ -2117,7 +2117,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_5(){ 
@@ -2190,7 +2190,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_5_0(){ 
@@ -2231,7 +2231,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_5(){ 
@@ -2255,7 +2255,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_6(){ 
@@ -2328,7 +2328,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_6_0(){ 
@@ -2369,7 +2369,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_6(){ 
@@ -2393,7 +2393,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_7(){ 
@@ -2461,7 +2461,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_8(){ 
@@ -2534,7 +2534,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_8_0(){ 
@@ -2575,7 +2575,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_1_8(){ 
@@ -2599,7 +2599,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_1_9(){ 
@@ -2661,7 +2661,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_10(){ 
@@ -2734,7 +2734,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_10_0(){ 
@@ -2775,7 +2775,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_2_10(){ 
@@ -2799,7 +2799,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_11(){ 
@@ -2867,7 +2867,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_12(){ 
@@ -2935,7 +2935,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_12_0(){ 
@@ -2976,7 +2976,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_2_12(){ 
@@ -3000,7 +3000,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_13(){ 
@@ -3068,7 +3068,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_14(){ 
@@ -3153,7 +3153,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_15(){ 
@@ -3213,7 +3213,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_27(){ 
@@ -3281,7 +3281,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::offset_smith_2_27(){ 
@@ -3305,7 +3305,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_28(){ 
@@ -3373,7 +3373,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_29(){ 
@@ -3447,7 +3447,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_30(){ 
@@ -3539,7 +3539,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_31(){ 
@@ -3607,7 +3607,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_32(){ 
@@ -3674,7 +3674,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_33(){ 
@@ -3758,7 +3758,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_34(){ 
@@ -3820,7 +3820,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_35(){ 
@@ -3886,7 +3886,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_36(){ 
@@ -3962,7 +3962,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_37(){ 
@@ -4024,7 +4024,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_2_38(){ 
@@ -4091,7 +4091,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_3_25(){ 
@@ -4159,7 +4159,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_3_26(){ 
@@ -4227,7 +4227,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_PR12_RIGHT::smith_3_27(){ 
@@ -4289,5 +4289,5 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
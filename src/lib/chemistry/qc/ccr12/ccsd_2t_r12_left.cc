@@ -48,8 +48,8 @@ smith_0_1(a_i0,t_h4b,t_h5b,t_h6b,t_p1b,t_p2b,t_p3b);
 if (toggle==1L) {
 i1xn.at(0)=new Tensor("ccsd_2t_r12_left_1x0_0",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1x0)
-smith_1_6(); //z->t1(),z->v2()=>in.at(1x0)
+z->parallel(this,&CCSD_2T_R12_LEFT::smith_0_2_0); //z->f1()=>in.at(1x0)
+z->parallel(this,&CCSD_2T_R12_LEFT::smith_1_6); //z->t1(),z->v2()=>in.at(1x0)
 }
 if (toggle==2L) {
 smith_0_2(a_i0,t_h4b,t_h5b,t_h6b,t_p1b,t_p2b,t_p3b);
@@ -57,8 +57,8 @@ smith_0_2(a_i0,t_h4b,t_h5b,t_h6b,t_p1b,t_p2b,t_p3b);
 if (toggle==1L) {
 i1xn.at(1)=new Tensor("ccsd_2t_r12_left_1x1_1",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->v2()=>in.at(1x1)
-smith_1_7(); //z->t1(),z->v2()=>in.at(1x1)
+z->parallel(this,&CCSD_2T_R12_LEFT::smith_0_3_0); //z->v2()=>in.at(1x1)
+z->parallel(this,&CCSD_2T_R12_LEFT::smith_1_7); //z->t1(),z->v2()=>in.at(1x1)
 }
 if (toggle==2L) {
 smith_0_3(a_i0,t_h4b,t_h5b,t_h6b,t_p1b,t_p2b,t_p3b);
@@ -72,7 +72,7 @@ smith_0_5(a_i0,t_h4b,t_h5b,t_h6b,t_p1b,t_p2b,t_p3b);
 if (toggle==1L) {
 i1xn.at(2)=new Tensor("ccsd_2t_r12_left_1x2_8",z->mem());
 offset_smith_0_8();
-smith_1_8(); //z->t1(),z->lambda2()=>in.at(1x2)
+z->parallel(this,&CCSD_2T_R12_LEFT::smith_1_8); //z->t1(),z->lambda2()=>in.at(1x2)
 }
 if (toggle==2L) {
 smith_0_8(a_i0,t_h4b,t_h5b,t_h6b,t_p1b,t_p2b,t_p3b);
@@ -299,7 +299,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_R12_LEFT::offset_smith_0_2(){ 
@@ -319,7 +319,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 i1xn[0]->set_filesize(size); 
 i1xn[0]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_R12_LEFT::smith_0_3(double* a_i0,const long t_h4b,const long t_h5b,const long t_h6b,const long t_p1b,const long t_p2b,const long t_p3b){ 
@@ -458,7 +458,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_R12_LEFT::offset_smith_0_3(){ 
@@ -482,7 +482,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 i1xn[1]->set_filesize(size); 
 i1xn[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_R12_LEFT::smith_0_4(double* a_i0,const long t_h4b,const long t_h5b,const long t_h6b,const long t_p1b,const long t_p2b,const long t_p3b){ 
@@ -794,7 +794,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 i1xn[2]->set_filesize(size); 
 i1xn[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_R12_LEFT::smith_1_6(){ 
@@ -868,7 +868,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_R12_LEFT::smith_1_7(){ 
@@ -936,7 +936,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_R12_LEFT::smith_1_8(){ 
@@ -1004,5 +1004,5 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
@@ -45,38 +45,38 @@ i1xn.resize(16);
 if (toggle==1L) {
 i1xn.at(0)=new Tensor("ccsd_2t_right_1x0_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->v2()=>in.at(1x0)
+z->parallel(this,&CCSD_2T_RIGHT::smith_0_1_0); //z->v2()=>in.at(1x0)
 in.at(2)=new Tensor("ccsd_2t_right_2_0",z->mem());
 offset_smith_1_1();
-smith_1_1_0(); //z->f1()=>in.at(2)
-smith_2_19(); //z->t1(),z->v2()=>in.at(2)
-smith_1_1(); //z->t2(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_1_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_19); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_1); //z->t2(),in.at(2)=>in.at(1x0)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_2t_right_2_1",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_4_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_2t_right_3_0",z->mem());
 offset_smith_2_8();
-smith_2_8_0(); //z->v2()=>in.at(3)
-smith_3_16(); //z->t1(),z->v2()=>in.at(3)
-smith_2_8(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_8_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2T_RIGHT::smith_3_16); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_8); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_22(); //z->t2(),z->v2()=>in.at(2)
-smith_1_4(); //z->t1(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_22); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_4); //z->t1(),in.at(2)=>in.at(1x0)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_2t_right_2_2",z->mem());
 offset_smith_1_5();
-smith_1_5_0(); //z->v2()=>in.at(2)
-smith_2_9(); //z->t1(),z->v2()=>in.at(2)
-smith_1_5(); //z->t1(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_5_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_9); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_5); //z->t1(),in.at(2)=>in.at(1x0)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_2t_right_2_3",z->mem());
 offset_smith_1_13();
-smith_1_13_0(); //z->v2()=>in.at(2)
-smith_2_21(); //z->t1(),z->v2()=>in.at(2)
-smith_1_13(); //z->t2(),in.at(2)=>in.at(1x0)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_13_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_21); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_13); //z->t2(),in.at(2)=>in.at(1x0)
 delete in.at(2);
-smith_1_15(); //z->t2(),z->v2()=>in.at(1x0)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_15); //z->t2(),z->v2()=>in.at(1x0)
 }
 if (toggle==2L) {
 smith_0_1(a_i0,t_p4b,t_p5b,t_p6b,t_h1b,t_h2b,t_h3b);
@@ -84,28 +84,28 @@ smith_0_1(a_i0,t_p4b,t_p5b,t_p6b,t_h1b,t_h2b,t_h3b);
 if (toggle==1L) {
 i1xn.at(1)=new Tensor("ccsd_2t_right_1x1_1",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->v2()=>in.at(1x1)
+z->parallel(this,&CCSD_2T_RIGHT::smith_0_3_0); //z->v2()=>in.at(1x1)
 in.at(2)=new Tensor("ccsd_2t_right_2_0",z->mem());
 offset_smith_1_6();
-smith_1_6_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_6_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_2t_right_3_0",z->mem());
 offset_smith_2_10();
-smith_2_10_0(); //z->v2()=>in.at(3)
-smith_3_17(); //z->t1(),z->v2()=>in.at(3)
-smith_2_10(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_10_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2T_RIGHT::smith_3_17); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_10); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_11(); //z->t1(),z->v2()=>in.at(2)
-smith_2_20(); //z->t2(),z->v2()=>in.at(2)
-smith_1_6(); //z->t1(),in.at(2)=>in.at(1x1)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_11); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_20); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_6); //z->t1(),in.at(2)=>in.at(1x1)
 delete in.at(2);
-smith_1_7(); //z->t1(),z->v2()=>in.at(1x1)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_7); //z->t1(),z->v2()=>in.at(1x1)
 in.at(2)=new Tensor("ccsd_2t_right_2_1",z->mem());
 offset_smith_1_12();
-smith_1_12_0(); //z->v2()=>in.at(2)
-smith_2_18(); //z->t1(),z->v2()=>in.at(2)
-smith_1_12(); //z->t2(),in.at(2)=>in.at(1x1)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_12_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_2_18); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_12); //z->t2(),in.at(2)=>in.at(1x1)
 delete in.at(2);
-smith_1_14(); //z->t2(),z->v2()=>in.at(1x1)
+z->parallel(this,&CCSD_2T_RIGHT::smith_1_14); //z->t2(),z->v2()=>in.at(1x1)
 }
 if (toggle==2L) {
 smith_0_3(a_i0,t_p4b,t_p5b,t_p6b,t_h1b,t_h2b,t_h3b);
@@ -253,7 +253,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_0_1(){ 
@@ -277,7 +277,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 i1xn[0]->set_filesize(size); 
 i1xn[0]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_0_3(double* a_i0,const long t_p4b,const long t_p5b,const long t_p6b,const long t_h1b,const long t_h2b,const long t_h3b){ 
@@ -416,7 +416,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_0_3(){ 
@@ -440,7 +440,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 i1xn[1]->set_filesize(size); 
 i1xn[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_1(){ 
@@ -508,7 +508,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_12(){ 
@@ -575,7 +575,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_12_0(){ 
@@ -616,7 +616,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_1_12(){ 
@@ -640,7 +640,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_13(){ 
@@ -735,7 +735,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_13_0(){ 
@@ -776,7 +776,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_1_13(){ 
@@ -800,7 +800,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_14(){ 
@@ -895,7 +895,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_15(){ 
@@ -962,7 +962,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_1_0(){ 
@@ -999,7 +999,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_1_1(){ 
@@ -1019,7 +1019,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_4(){ 
@@ -1087,7 +1087,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_4_0(){ 
@@ -1128,7 +1128,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_1_4(){ 
@@ -1152,7 +1152,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_5(){ 
@@ -1225,7 +1225,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_5_0(){ 
@@ -1266,7 +1266,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_1_5(){ 
@@ -1290,7 +1290,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_6(){ 
@@ -1363,7 +1363,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_6_0(){ 
@@ -1404,7 +1404,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_1_6(){ 
@@ -1428,7 +1428,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_1_7(){ 
@@ -1496,7 +1496,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_10(){ 
@@ -1564,7 +1564,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_10_0(){ 
@@ -1605,7 +1605,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_2_10(){ 
@@ -1629,7 +1629,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_11(){ 
@@ -1697,7 +1697,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_18(){ 
@@ -1765,7 +1765,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_19(){ 
@@ -1839,7 +1839,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_20(){ 
@@ -1931,7 +1931,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_21(){ 
@@ -1999,7 +1999,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_22(){ 
@@ -2066,7 +2066,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_8(){ 
@@ -2139,7 +2139,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_8_0(){ 
@@ -2180,7 +2180,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::offset_smith_2_8(){ 
@@ -2204,7 +2204,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_2_9(){ 
@@ -2272,7 +2272,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_3_16(){ 
@@ -2340,7 +2340,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_2T_RIGHT::smith_3_17(){ 
@@ -2408,5 +2408,5 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
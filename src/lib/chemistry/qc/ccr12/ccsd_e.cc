@@ -44,11 +44,11 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsd_e_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
-smith_1_2(); //z->t1(),z->v2()=>in.at(1)
-smith_0_1(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_E::smith_0_1_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_E::smith_1_2); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_E::smith_0_1,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
-smith_0_3(out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSD_E::smith_0_3,out); //z->t2(),z->v2()=>out
   
 }
   
@@ -100,7 +100,7 @@ if (out->is_this_local(0L)) {
   z->mem()->free_local_double(k_c_sort); 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_E::smith_0_1_0(){ 
@@ -137,7 +137,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_E::offset_smith_0_1(){ 
@@ -157,7 +157,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_E::smith_0_3(Ref<Tensor>& out){ 
@@ -218,7 +218,7 @@ if (out->is_this_local(0L)) {
   z->mem()->free_local_double(k_c_sort); 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_E::smith_1_2(){ 
@@ -292,6 +292,6 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
 
@@ -45,12 +45,12 @@ in.resize(8);
 
 in.at(1)=new Tensor("ccsd_r12_e_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
-smith_1_2(); //z->t1(),z->v2()=>in.at(1)
-smith_0_1(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_E::smith_0_1_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_R12_E::smith_1_2); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_E::smith_0_1,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
-smith_0_3(out); //z->t2(),z->v2()=>out
-smith_0_4(out); //z->gt2(),z->vr2()=>out
+z->parallel(this,&CCSD_R12_E::smith_0_3,out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSD_R12_E::smith_0_4,out); //z->gt2(),z->vr2()=>out
 
 }
 
@@ -102,7 +102,7 @@ if (out->is_this_local(0L)) {
   z->mem()->free_local_double(k_c_sort);
  }
 }
-z->mem()->sync();
+z->sync();
 }
 
 void CCSD_R12_E::smith_0_1_0(){
@@ -139,7 +139,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   }
  }
 }
-z->mem()->sync();
+z->sync();
 }
 
 void CCSD_R12_E::offset_smith_0_1(){
@@ -159,7 +159,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 }
 in[1]->set_filesize(size);
 in[1]->createfile();
-z->mem()->sync();
+z->sync();
 }
 
 void CCSD_R12_E::smith_0_3(Ref<Tensor>& out){
@@ -220,7 +220,7 @@ if (out->is_this_local(0L)) {
   z->mem()->free_local_double(k_c_sort);
  }
 }
-z->mem()->sync();
+z->sync();
 }
 
 void CCSD_R12_E::smith_0_4(Ref<Tensor>& out){
@@ -295,7 +295,7 @@ if (out->is_this_local(0L)) {
   z->mem()->free_local_double(k_c_sort);
  }
 }
-z->mem()->sync();
+z->sync();
 }
 
 void CCSD_R12_E::smith_1_2(){
@@ -369,6 +369,6 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   }
  }
 }
-z->mem()->sync();
+z->sync();
 }
 
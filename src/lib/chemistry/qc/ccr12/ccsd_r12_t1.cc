@@ -42,54 +42,54 @@ void CCSD_R12_T1::compute_amp(Ref<Tensor>& out){ //k_i0_offset,z->gt2(),z->f1(),
   
 in.resize(8);
   
-smith_0_1(out); //z->f1()=>out
+z->parallel(this,&CCSD_R12_T1::smith_0_1,out); //z->f1()=>out
 in.at(1)=new Tensor("ccsd_r12_t1_1_0",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_0_2_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsd_r12_t1_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_14(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_R12_T1::smith_2_14); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T1::smith_1_4); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_8(); //z->t1(),z->v2()=>in.at(1)
-smith_1_17(); //z->t2(),z->v2()=>in.at(1)
-smith_1_20(); //z->gt2(),z->vr2()=>in.at(1)
-smith_0_2(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T1::smith_1_8); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_1_17); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_1_20); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_0_2,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_r12_t1_1_1",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->f1()=>in.at(1)
-smith_1_9(); //z->t1(),z->v2()=>in.at(1)
-smith_0_3(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T1::smith_0_3_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_1_9); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_0_3,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_r12_t1_1_2",z->mem());
 offset_smith_0_5();
-smith_0_5_0(); //z->f1()=>in.at(1)
-smith_1_15(); //z->t1(),z->v2()=>in.at(1)
-smith_0_5(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T1::smith_0_5_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_1_15); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_0_5,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_r12_t1_1_3",z->mem());
 offset_smith_0_6();
-smith_0_6_0(); //z->f1()=>in.at(1)
-smith_1_18(); //z->t1(),z->v2()=>in.at(1)
-smith_0_6(out); //z->qy(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T1::smith_0_6_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_1_18); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_0_6,out); //z->qy(),in.at(1)=>out
 delete in.at(1);
-smith_0_7(out); //z->t1(),z->v2()=>out
+z->parallel(this,&CCSD_R12_T1::smith_0_7,out); //z->t1(),z->v2()=>out
 in.at(1)=new Tensor("ccsd_r12_t1_1_4",z->mem());
 offset_smith_0_10();
-smith_0_10_0(); //z->v2()=>in.at(1)
-smith_1_16(); //z->t1(),z->v2()=>in.at(1)
-smith_0_10(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T1::smith_0_10_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_1_16); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_0_10,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_11(out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSD_R12_T1::smith_0_11,out); //z->t2(),z->v2()=>out
 in.at(1)=new Tensor("ccsd_r12_t1_1_5",z->mem());
 offset_smith_0_12();
-smith_0_12_0(); //z->v2()=>in.at(1)
-smith_1_19(); //z->t1(),z->v2()=>in.at(1)
-smith_0_12(out); //z->qy(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T1::smith_0_12_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_1_19); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T1::smith_0_12,out); //z->qy(),in.at(1)=>out
 delete in.at(1);
-smith_0_13(out); //z->gt2(),z->vr2()=>out
+z->parallel(this,&CCSD_R12_T1::smith_0_13,out); //z->gt2(),z->vr2()=>out
   
 }
   
@@ -127,7 +127,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_10(Ref<Tensor>& out){ 
@@ -198,7 +198,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_10_0(){ 
@@ -239,7 +239,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::offset_smith_0_10(){ 
@@ -263,7 +263,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_11(Ref<Tensor>& out){ 
@@ -334,7 +334,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_12(Ref<Tensor>& out){ 
@@ -399,7 +399,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_12_0(){ 
@@ -440,7 +440,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::offset_smith_0_12(){ 
@@ -464,7 +464,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_13(Ref<Tensor>& out){ 
@@ -535,7 +535,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_2(Ref<Tensor>& out){ 
@@ -593,7 +593,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_2_0(){ 
@@ -630,7 +630,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::offset_smith_0_2(){ 
@@ -650,7 +650,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_3(Ref<Tensor>& out){ 
@@ -708,7 +708,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_3_0(){ 
@@ -745,7 +745,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::offset_smith_0_3(){ 
@@ -765,7 +765,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_5(Ref<Tensor>& out){ 
@@ -839,7 +839,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_5_0(){ 
@@ -876,7 +876,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::offset_smith_0_5(){ 
@@ -896,7 +896,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_6(Ref<Tensor>& out){ 
@@ -962,7 +962,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_6_0(){ 
@@ -999,7 +999,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::offset_smith_0_6(){ 
@@ -1019,7 +1019,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_0_7(Ref<Tensor>& out){ 
@@ -1079,7 +1079,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_15(){ 
@@ -1153,7 +1153,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_16(){ 
@@ -1221,7 +1221,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_17(){ 
@@ -1298,7 +1298,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_18(){ 
@@ -1364,7 +1364,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_19(){ 
@@ -1426,7 +1426,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_20(){ 
@@ -1503,7 +1503,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_4(){ 
@@ -1561,7 +1561,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_4_0(){ 
@@ -1598,7 +1598,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::offset_smith_1_4(){ 
@@ -1618,7 +1618,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_8(){ 
@@ -1684,7 +1684,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_1_9(){ 
@@ -1750,7 +1750,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T1::smith_2_14(){ 
@@ -1824,5 +1824,5 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
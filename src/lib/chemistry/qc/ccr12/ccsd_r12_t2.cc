@@ -44,121 +44,121 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsd_r12_t2_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_1_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsd_r12_t2_2_0",z->mem());
 offset_smith_1_6();
-smith_1_6_0(); //z->f1()=>in.at(2)
-smith_2_37(); //z->t1(),z->v2()=>in.at(2)
-smith_1_6(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_6_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_2_37); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_1_6); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_28(); //z->t1(),z->v2()=>in.at(1)
-smith_1_42(); //z->t2(),z->v2()=>in.at(1)
-smith_1_47(); //z->gt2(),z->vr2()=>in.at(1)
-smith_0_1(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T2::smith_1_28); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_42); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_47); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_1,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_r12_t2_1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_29(); //z->t1(),z->v2()=>in.at(1)
-smith_1_40(); //z->t2(),z->v2()=>in.at(1)
-smith_1_45(); //z->qy(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T2::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_29); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_40); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_45); //z->qy(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_2,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_r12_t2_1_2",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->f1()=>in.at(1)
-smith_1_20(); //z->t1(),z->v2()=>in.at(1)
-smith_1_43(); //z->t2(),z->v2()=>in.at(1)
-smith_1_49(); //z->qy(),z->v2()=>in.at(1)
-smith_0_3(out); //z->qy(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T2::smith_0_3_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_20); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_43); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_49); //z->qy(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_3,out); //z->qy(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_r12_t2_1_3",z->mem());
 offset_smith_0_4();
-smith_0_4_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_4_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsd_r12_t2_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_31(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->qy(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_2_31); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_1_4); //z->qy(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_r12_t2_2_1",z->mem());
 offset_smith_1_5();
-smith_1_5_0(); //z->f1()=>in.at(2)
-smith_2_38(); //z->t1(),z->v2()=>in.at(2)
-smith_1_5(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_5_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_2_38); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_1_5); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_r12_t2_2_2",z->mem());
 offset_smith_1_10();
-smith_1_10_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_1_10_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_r12_t2_3_0",z->mem());
 offset_smith_2_18();
-smith_2_18_0(); //z->v2()=>in.at(3)
-smith_3_30(); //z->t1(),z->v2()=>in.at(3)
-smith_2_18(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_2_18_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSD_R12_T2::smith_3_30); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_R12_T2::smith_2_18); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_33(); //z->gt2(),z->vr2()=>in.at(2)
-smith_2_34(); //z->t2(),z->v2()=>in.at(2)
-smith_1_10(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_2_33); //z->gt2(),z->vr2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_2_34); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_1_10); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_r12_t2_2_3",z->mem());
 offset_smith_1_11();
-smith_1_11_0(); //z->v2()=>in.at(2)
-smith_2_19(); //z->t1(),z->v2()=>in.at(2)
-smith_1_11(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_11_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_2_19); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_1_11); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_r12_t2_2_4",z->mem());
 offset_smith_1_21();
-smith_1_21_0(); //z->v2()=>in.at(2)
-smith_2_32(); //z->t1(),z->v2()=>in.at(2)
-smith_1_21(); //z->qy(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_21_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_2_32); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_1_21); //z->qy(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_23(); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_23); //z->gt2(),z->vr2()=>in.at(1)
 in.at(2)=new Tensor("ccsd_r12_t2_2_5",z->mem());
 offset_smith_1_24();
-smith_1_24_0(); //z->v2()=>in.at(2)
-smith_2_36(); //z->t1(),z->v2()=>in.at(2)
-smith_1_24(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_24_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_2_36); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_1_24); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_25(); //z->t2(),z->v2()=>in.at(1)
-smith_0_4(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T2::smith_1_25); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_4,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
-smith_0_7(out); //z->v2()=>out
+z->parallel(this,&CCSD_R12_T2::smith_0_7,out); //z->v2()=>out
 in.at(1)=new Tensor("ccsd_r12_t2_1_4",z->mem());
 offset_smith_0_9();
-smith_0_9_0(); //z->v2()=>in.at(1)
-smith_1_12(); //z->t1(),z->v2()=>in.at(1)
-smith_0_9(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T2::smith_0_9_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_12); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_9,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_r12_t2_1_5",z->mem());
 offset_smith_0_13();
-smith_0_13_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_13_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsd_r12_t2_2_0",z->mem());
 offset_smith_1_26();
-smith_1_26_0(); //z->v2()=>in.at(2)
-smith_2_35(); //z->t1(),z->v2()=>in.at(2)
-smith_1_26(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_26_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_2_35); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_R12_T2::smith_1_26); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_41(); //z->t2(),z->v2()=>in.at(1)
-smith_1_46(); //z->gt2(),z->vr2()=>in.at(1)
-smith_0_13(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T2::smith_1_41); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_46); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_13,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_r12_t2_1_6",z->mem());
 offset_smith_0_14();
-smith_0_14_0(); //z->v2()=>in.at(1)
-smith_1_27(); //z->t1(),z->v2()=>in.at(1)
-smith_1_39(); //z->t2(),z->v2()=>in.at(1)
-smith_1_44(); //z->qy(),z->v2()=>in.at(1)
-smith_0_14(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T2::smith_0_14_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_27); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_39); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_44); //z->qy(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_14,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_15(out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSD_R12_T2::smith_0_15,out); //z->t2(),z->v2()=>out
 in.at(1)=new Tensor("ccsd_r12_t2_1_7",z->mem());
 offset_smith_0_16();
-smith_0_16_0(); //z->v2()=>in.at(1)
-smith_1_22(); //z->t1(),z->v2()=>in.at(1)
-smith_1_48(); //z->qy(),z->v2()=>in.at(1)
-smith_0_16(out); //z->qy(),in.at(1)=>out
+z->parallel(this,&CCSD_R12_T2::smith_0_16_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_22); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_1_48); //z->qy(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_R12_T2::smith_0_16,out); //z->qy(),in.at(1)=>out
 delete in.at(1);
-smith_0_17(out); //z->gt2(),z->vr2()=>out
+z->parallel(this,&CCSD_R12_T2::smith_0_17,out); //z->gt2(),z->vr2()=>out
   
 }
   
@@ -238,7 +238,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_13(Ref<Tensor>& out){ 
@@ -305,7 +305,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_13_0(){ 
@@ -346,7 +346,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_0_13(){ 
@@ -370,7 +370,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_14(Ref<Tensor>& out){ 
@@ -473,7 +473,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_14_0(){ 
@@ -514,7 +514,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_0_14(){ 
@@ -538,7 +538,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_15(Ref<Tensor>& out){ 
@@ -605,7 +605,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_16(Ref<Tensor>& out){ 
@@ -700,7 +700,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_16_0(){ 
@@ -741,7 +741,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_0_16(){ 
@@ -765,7 +765,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_17(Ref<Tensor>& out){ 
@@ -832,7 +832,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_1_0(){ 
@@ -869,7 +869,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_0_1(){ 
@@ -889,7 +889,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_2(Ref<Tensor>& out){ 
@@ -968,7 +968,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_2_0(){ 
@@ -1005,7 +1005,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_0_2(){ 
@@ -1025,7 +1025,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_3(Ref<Tensor>& out){ 
@@ -1098,7 +1098,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_3_0(){ 
@@ -1135,7 +1135,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_0_3(){ 
@@ -1155,7 +1155,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_4(Ref<Tensor>& out){ 
@@ -1228,7 +1228,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_4_0(){ 
@@ -1269,7 +1269,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_0_4(){ 
@@ -1293,7 +1293,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_7(Ref<Tensor>& out){ 
@@ -1334,7 +1334,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_9(Ref<Tensor>& out){ 
@@ -1407,7 +1407,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_0_9_0(){ 
@@ -1448,7 +1448,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_0_9(){ 
@@ -1472,7 +1472,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_10(){ 
@@ -1540,7 +1540,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_10_0(){ 
@@ -1581,7 +1581,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_1_10(){ 
@@ -1605,7 +1605,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_11(){ 
@@ -1678,7 +1678,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_11_0(){ 
@@ -1719,7 +1719,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_1_11(){ 
@@ -1743,7 +1743,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_12(){ 
@@ -1811,7 +1811,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_20(){ 
@@ -1871,7 +1871,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_21(){ 
@@ -1958,7 +1958,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_21_0(){ 
@@ -1999,7 +1999,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_1_21(){ 
@@ -2023,7 +2023,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_22(){ 
@@ -2085,7 +2085,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_23(){ 
@@ -2152,7 +2152,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_24(){ 
@@ -2247,7 +2247,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_24_0(){ 
@@ -2288,7 +2288,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_1_24(){ 
@@ -2312,7 +2312,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_25(){ 
@@ -2379,7 +2379,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_26(){ 
@@ -2452,7 +2452,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_26_0(){ 
@@ -2493,7 +2493,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_1_26(){ 
@@ -2517,7 +2517,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_27(){ 
@@ -2585,7 +2585,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_28(){ 
@@ -2651,7 +2651,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_29(){ 
@@ -2717,7 +2717,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_39(){ 
@@ -2809,7 +2809,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_4(){ 
@@ -2871,7 +2871,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_40(){ 
@@ -2948,7 +2948,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_41(){ 
@@ -3015,7 +3015,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_42(){ 
@@ -3092,7 +3092,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_43(){ 
@@ -3163,7 +3163,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_44(){ 
@@ -3239,7 +3239,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_45(){ 
@@ -3304,7 +3304,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_46(){ 
@@ -3371,7 +3371,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_47(){ 
@@ -3448,7 +3448,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_48(){ 
@@ -3532,7 +3532,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_49(){ 
@@ -3603,7 +3603,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_4_0(){ 
@@ -3640,7 +3640,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_1_4(){ 
@@ -3660,7 +3660,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_5(){ 
@@ -3728,7 +3728,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_5_0(){ 
@@ -3765,7 +3765,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_1_5(){ 
@@ -3785,7 +3785,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_6(){ 
@@ -3843,7 +3843,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_1_6_0(){ 
@@ -3880,7 +3880,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_1_6(){ 
@@ -3900,7 +3900,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_18(){ 
@@ -3973,7 +3973,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_18_0(){ 
@@ -4014,7 +4014,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::offset_smith_2_18(){ 
@@ -4038,7 +4038,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_19(){ 
@@ -4106,7 +4106,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_31(){ 
@@ -4172,7 +4172,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_32(){ 
@@ -4234,7 +4234,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_33(){ 
@@ -4301,7 +4301,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_34(){ 
@@ -4368,7 +4368,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_35(){ 
@@ -4436,7 +4436,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_36(){ 
@@ -4504,7 +4504,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_37(){ 
@@ -4578,7 +4578,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_2_38(){ 
@@ -4652,7 +4652,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_R12_T2::smith_3_30(){ 
@@ -4720,5 +4720,5 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
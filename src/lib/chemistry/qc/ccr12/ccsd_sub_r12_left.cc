@@ -42,104 +42,104 @@ void CCSD_SUB_R12_LEFT::compute_amp(Ref<Tensor>& out){ //k_i0_offset,z->f1(),z->
   
 in.resize(8);
   
-smith_0_1(out); //z->vr2()=>out
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_1,out); //z->vr2()=>out
 in.at(1)=new Tensor("ccsd_sub_r12_left_1_0",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->vr2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_2_0); //z->vr2()=>in.at(1)
 in.at(2)=new Tensor("ccsd_sub_r12_left_2_0",z->mem());
 offset_smith_1_2();
-smith_1_2_0(); //z->f1()=>in.at(2)
-smith_2_5(); //z->t1(),z->v2()=>in.at(2)
-smith_1_2(); //z->fr2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_2_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_5); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_2); //z->fr2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_2(out); //z->lambda1(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_2,out); //z->lambda1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_sub_r12_left_1_3",z->mem());
 offset_smith_0_3();
-smith_1_3(); //z->lambda1(),z->fr2()=>in.at(1)
-smith_0_3(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_3); //z->lambda1(),z->fr2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_3,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_sub_r12_left_1_1",z->mem());
 offset_smith_0_6();
 in.at(2)=new Tensor("ccsd_sub_r12_left_2_6",z->mem());
 offset_smith_1_6();
-smith_2_6(); //z->lambda1(),z->fr2()=>in.at(2)
-smith_1_6(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_6); //z->lambda1(),z->fr2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_6); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_sub_r12_left_2_21",z->mem());
 offset_smith_1_21();
-smith_2_21(); //z->t2(),z->lambda2()=>in.at(2)
-smith_1_21(); //z->fr2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_21); //z->t2(),z->lambda2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_21); //z->fr2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_6(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_6,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_sub_r12_left_1_2",z->mem());
 offset_smith_0_7();
-smith_1_7(); //z->t1(),z->lambda1()=>in.at(1)
-smith_1_23(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_7(out); //z->vr2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_7); //z->t1(),z->lambda1()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_23); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_7,out); //z->vr2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_sub_r12_left_1_3",z->mem());
 offset_smith_0_8();
-smith_0_8_0(); //z->vr2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_8_0); //z->vr2()=>in.at(1)
 in.at(2)=new Tensor("ccsd_sub_r12_left_2_0",z->mem());
 offset_smith_1_8();
-smith_1_8_0(); //z->f1()=>in.at(2)
-smith_2_12(); //z->t1(),z->v2()=>in.at(2)
-smith_2_19(); //z->t2(),z->v2()=>in.at(2)
-smith_1_8(); //z->fr2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_8_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_12); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_19); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_8); //z->fr2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_sub_r12_left_2_1",z->mem());
 offset_smith_1_9();
 in.at(3)=new Tensor("ccsd_sub_r12_left_3_0",z->mem());
 offset_smith_2_9();
-smith_2_9_0(); //z->f1()=>in.at(3)
-smith_3_16(); //z->t1(),z->v2()=>in.at(3)
-smith_2_9(); //z->fr2(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_9_0); //z->f1()=>in.at(3)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_3_16); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_9); //z->fr2(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_1_9(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_9); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_8(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_8,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_sub_r12_left_1_4",z->mem());
 offset_smith_0_10();
 in.at(2)=new Tensor("ccsd_sub_r12_left_2_0",z->mem());
 offset_smith_1_10();
-smith_1_10_0(); //z->v2()=>in.at(2)
-smith_2_14(); //z->t1(),z->v2()=>in.at(2)
-smith_1_10(); //z->lambda2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_10_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_14); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_10); //z->lambda2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_sub_r12_left_2_13",z->mem());
 offset_smith_1_13();
-smith_2_13(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_13(); //z->v2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_13); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_13); //z->v2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_sub_r12_left_2_1",z->mem());
 offset_smith_1_17();
 in.at(3)=new Tensor("ccsd_sub_r12_left_3_17",z->mem());
 offset_smith_2_17();
-smith_3_17(); //z->t1(),z->lambda2()=>in.at(3)
-smith_2_17(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_3_17); //z->t1(),z->lambda2()=>in.at(3)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_17); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_20(); //z->t2(),z->lambda2()=>in.at(2)
-smith_1_17(); //z->v2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_20); //z->t2(),z->lambda2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_17); //z->v2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_10(out); //z->fr2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_10,out); //z->fr2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_sub_r12_left_1_15",z->mem());
 offset_smith_0_15();
-smith_1_15(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_15(out); //z->vr2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_15); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_15,out); //z->vr2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_sub_r12_left_1_5",z->mem());
 offset_smith_0_18();
 in.at(2)=new Tensor("ccsd_sub_r12_left_2_18",z->mem());
 offset_smith_1_18();
-smith_2_18(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_18(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_2_18); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_18); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_22(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_18(out); //z->vr2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_1_22); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_LEFT::smith_0_18,out); //z->vr2(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -182,7 +182,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_10(Ref<Tensor>& out){ 
@@ -246,7 +246,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_0_10(){ 
@@ -270,7 +270,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_15(Ref<Tensor>& out){ 
@@ -334,7 +334,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_0_15(){ 
@@ -358,7 +358,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_18(Ref<Tensor>& out){ 
@@ -425,7 +425,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_0_18(){ 
@@ -449,7 +449,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_2(Ref<Tensor>& out){ 
@@ -522,7 +522,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_2_0(){ 
@@ -563,7 +563,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_0_2(){ 
@@ -587,7 +587,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_3(Ref<Tensor>& out){ 
@@ -651,7 +651,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_0_3(){ 
@@ -675,7 +675,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_6(Ref<Tensor>& out){ 
@@ -739,7 +739,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_0_6(){ 
@@ -763,7 +763,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_7(Ref<Tensor>& out){ 
@@ -842,7 +842,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_0_7(){ 
@@ -862,7 +862,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_8(Ref<Tensor>& out){ 
@@ -929,7 +929,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_0_8_0(){ 
@@ -970,7 +970,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_0_8(){ 
@@ -994,7 +994,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_10(){ 
@@ -1083,7 +1083,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_10_0(){ 
@@ -1124,7 +1124,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_1_10(){ 
@@ -1148,7 +1148,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_13(){ 
@@ -1235,7 +1235,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_1_13(){ 
@@ -1259,7 +1259,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_15(){ 
@@ -1327,7 +1327,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_17(){ 
@@ -1408,7 +1408,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_1_17(){ 
@@ -1432,7 +1432,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_18(){ 
@@ -1505,7 +1505,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_1_18(){ 
@@ -1529,7 +1529,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_2(){ 
@@ -1591,7 +1591,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_21(){ 
@@ -1653,7 +1653,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_1_21(){ 
@@ -1673,7 +1673,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_22(){ 
@@ -1740,7 +1740,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_23(){ 
@@ -1817,7 +1817,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_2_0(){ 
@@ -1854,7 +1854,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_1_2(){ 
@@ -1874,7 +1874,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_3(){ 
@@ -1936,7 +1936,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_6(){ 
@@ -1998,7 +1998,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_1_6(){ 
@@ -2022,7 +2022,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_7(){ 
@@ -2080,7 +2080,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_8(){ 
@@ -2153,7 +2153,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_8_0(){ 
@@ -2190,7 +2190,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_1_8(){ 
@@ -2210,7 +2210,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_1_9(){ 
@@ -2283,7 +2283,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_1_9(){ 
@@ -2307,7 +2307,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_12(){ 
@@ -2367,7 +2367,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_13(){ 
@@ -2435,7 +2435,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_14(){ 
@@ -2497,7 +2497,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_17(){ 
@@ -2565,7 +2565,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_2_17(){ 
@@ -2589,7 +2589,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_18(){ 
@@ -2657,7 +2657,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_19(){ 
@@ -2728,7 +2728,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_20(){ 
@@ -2820,7 +2820,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_21(){ 
@@ -2897,7 +2897,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_5(){ 
@@ -2963,7 +2963,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_6(){ 
@@ -3025,7 +3025,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_9(){ 
@@ -3087,7 +3087,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_2_9_0(){ 
@@ -3124,7 +3124,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::offset_smith_2_9(){ 
@@ -3144,7 +3144,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_3_16(){ 
@@ -3210,7 +3210,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_LEFT::smith_3_17(){ 
@@ -3278,5 +3278,5 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
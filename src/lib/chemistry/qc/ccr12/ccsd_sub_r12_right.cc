@@ -44,55 +44,55 @@ in.resize(8);
 
 in.at(1)=new Tensor("ccsd_sub_r12_right_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->vd2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_0_1_0); //z->vd2()=>in.at(1)
 in.at(2)=new Tensor("ccsd_sub_r12_right_2_0",z->mem());
 offset_smith_1_1();
-smith_1_1_0(); //z->f1()=>in.at(2)
-smith_2_10(); //z->t1(),z->v2()=>in.at(2)
-smith_1_1(); //z->fd2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_1_1_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_2_10); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_1_1); //z->fd2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_sub_r12_right_2_12",z->mem());
 offset_smith_1_12();
-smith_2_12(); //z->t1(),z->fd2()=>in.at(2)
-smith_1_12(); //z->v2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_2_12); //z->t1(),z->fd2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_1_12); //z->v2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_1(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_0_1,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_2(out); //z->vd2()=>out
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_0_2,out); //z->vd2()=>out
 in.at(1)=new Tensor("ccsd_sub_r12_right_1_3",z->mem());
 offset_smith_0_3();
-smith_1_3(); //z->t1(),z->fd2()=>in.at(1)
-smith_0_3(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_1_3); //z->t1(),z->fd2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_0_3,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_sub_r12_right_1_1",z->mem());
 offset_smith_0_4();
-smith_0_4_0(); //z->vd2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_0_4_0); //z->vd2()=>in.at(1)
 in.at(2)=new Tensor("ccsd_sub_r12_right_2_5",z->mem());
 offset_smith_1_5();
-smith_2_5(); //z->t1(),z->fd2()=>in.at(2)
-smith_1_5(); //z->v2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_2_5); //z->t1(),z->fd2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_1_5); //z->v2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_6(); //z->t1(),z->vd2()=>in.at(1)
-smith_0_4(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_1_6); //z->t1(),z->vd2()=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_0_4,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_sub_r12_right_1_2",z->mem());
 offset_smith_0_7();
 in.at(2)=new Tensor("ccsd_sub_r12_right_2_0",z->mem());
 offset_smith_1_7();
-smith_1_7_0(); //z->v2()=>in.at(2)
-smith_2_11(); //z->t1(),z->v2()=>in.at(2)
-smith_1_7(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_1_7_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_2_11); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_1_7); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_sub_r12_right_2_9",z->mem());
 offset_smith_1_9();
 in.at(3)=new Tensor("ccsd_sub_r12_right_3_9",z->mem());
 offset_smith_2_9();
-smith_3_9(); //z->t1(),z->v2()=>in.at(3)
-smith_2_9(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_3_9); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_2_9); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_1_9(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_1_9); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_7(out); //z->fd2(),in.at(1)=>out
+z->parallel(this,&CCSD_SUB_R12_RIGHT::smith_0_7,out); //z->fd2(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -161,7 +161,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_0_1_0(){ 
@@ -202,7 +202,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_0_1(){ 
@@ -226,7 +226,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_0_2(Ref<Tensor>& out){ 
@@ -267,7 +267,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_0_3(Ref<Tensor>& out){ 
@@ -331,7 +331,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_0_3(){ 
@@ -355,7 +355,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_0_4(Ref<Tensor>& out){ 
@@ -428,7 +428,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_0_4_0(){ 
@@ -469,7 +469,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_0_4(){ 
@@ -493,7 +493,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_0_7(Ref<Tensor>& out){ 
@@ -557,7 +557,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_0_7(){ 
@@ -581,7 +581,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_1_1(){ 
@@ -654,7 +654,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_1_12(){ 
@@ -718,7 +718,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_1_12(){ 
@@ -742,7 +742,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_1_1_0(){ 
@@ -779,7 +779,7 @@ for (long q7b=z->noab()+z->nvab();q7b<z->nab();++q7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_1_1(){ 
@@ -799,7 +799,7 @@ for (long q7b=z->noab()+z->nvab();q7b<z->nab();++q7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_1_3(){ 
@@ -861,7 +861,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_1_5(){ 
@@ -925,7 +925,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_1_5(){ 
@@ -949,7 +949,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_1_6(){ 
@@ -1017,7 +1017,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_1_7(){ 
@@ -1106,7 +1106,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_1_7_0(){ 
@@ -1147,7 +1147,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_1_7(){ 
@@ -1171,7 +1171,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_1_9(){ 
@@ -1233,7 +1233,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_1_9(){ 
@@ -1257,7 +1257,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_2_10(){ 
@@ -1323,7 +1323,7 @@ for (long q7b=z->noab()+z->nvab();q7b<z->nab();++q7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_2_11(){ 
@@ -1391,7 +1391,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_2_12(){ 
@@ -1453,7 +1453,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_2_5(){ 
@@ -1515,7 +1515,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_2_9(){ 
@@ -1588,7 +1588,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::offset_smith_2_9(){ 
@@ -1612,7 +1612,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_SUB_R12_RIGHT::smith_3_9(){ 
@@ -1680,5 +1680,5 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
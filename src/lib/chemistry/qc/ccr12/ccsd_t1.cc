@@ -41,40 +41,40 @@ void CCSD_T1::compute_amp(Ref<Tensor>& out){ //k_i0_offset,z->f1(),z->in.at(0),z
   
 in.resize(8);
   
-smith_0_1(out); //z->f1()=>out
+z->parallel(this,&CCSD_T1::smith_0_1,out); //z->f1()=>out
 in.at(1)=new Tensor("ccsd_t1_1_0",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_0_2_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsd_t1_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_11(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_T1::smith_2_11); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T1::smith_1_4); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_7(); //z->t1(),z->v2()=>in.at(1)
-smith_1_14(); //z->t2(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_T1::smith_1_7); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_1_14); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_0_2,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_t1_1_1",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->f1()=>in.at(1)
-smith_1_8(); //z->t1(),z->v2()=>in.at(1)
-smith_0_3(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_T1::smith_0_3_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_1_8); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_0_3,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_t1_1_2",z->mem());
 offset_smith_0_5();
-smith_0_5_0(); //z->f1()=>in.at(1)
-smith_1_12(); //z->t1(),z->v2()=>in.at(1)
-smith_0_5(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_T1::smith_0_5_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_1_12); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_0_5,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_6(out); //z->t1(),z->v2()=>out
+z->parallel(this,&CCSD_T1::smith_0_6,out); //z->t1(),z->v2()=>out
 in.at(1)=new Tensor("ccsd_t1_1_3",z->mem());
 offset_smith_0_9();
-smith_0_9_0(); //z->v2()=>in.at(1)
-smith_1_13(); //z->t1(),z->v2()=>in.at(1)
-smith_0_9(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_T1::smith_0_9_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_1_13); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T1::smith_0_9,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_10(out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSD_T1::smith_0_10,out); //z->t2(),z->v2()=>out
   
 }
   
@@ -111,7 +111,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_10(Ref<Tensor>& out){ 
@@ -180,7 +180,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_2(Ref<Tensor>& out){ 
@@ -236,7 +236,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_2_0(){ 
@@ -272,7 +272,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::offset_smith_0_2(){ 
@@ -292,7 +292,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_3(Ref<Tensor>& out){ 
@@ -348,7 +348,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_3_0(){ 
@@ -384,7 +384,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::offset_smith_0_3(){ 
@@ -404,7 +404,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_5(Ref<Tensor>& out){ 
@@ -476,7 +476,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_5_0(){ 
@@ -512,7 +512,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::offset_smith_0_5(){ 
@@ -532,7 +532,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_6(Ref<Tensor>& out){ 
@@ -590,7 +590,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_9(Ref<Tensor>& out){ 
@@ -659,7 +659,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_0_9_0(){ 
@@ -699,7 +699,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::offset_smith_0_9(){ 
@@ -723,7 +723,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_1_12(){ 
@@ -795,7 +795,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_1_13(){ 
@@ -861,7 +861,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_1_14(){ 
@@ -936,7 +936,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_1_4(){ 
@@ -992,7 +992,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_1_4_0(){ 
@@ -1028,7 +1028,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::offset_smith_1_4(){ 
@@ -1048,7 +1048,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_1_7(){ 
@@ -1112,7 +1112,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_1_8(){ 
@@ -1176,7 +1176,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T1::smith_2_11(){ 
@@ -1248,5 +1248,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
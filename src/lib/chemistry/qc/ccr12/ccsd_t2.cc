@@ -43,87 +43,87 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsd_t2_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_0_1_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsd_t2_2_0",z->mem());
 offset_smith_1_3();
-smith_1_3_0(); //z->f1()=>in.at(2)
-smith_2_23(); //z->t1(),z->v2()=>in.at(2)
-smith_1_3(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_3_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_2_23); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_1_3); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_16(); //z->t1(),z->v2()=>in.at(1)
-smith_1_31(); //z->t2(),z->v2()=>in.at(1)
-smith_0_1(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_T2::smith_1_16); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_31); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_0_1,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_t2_1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_18(); //z->t1(),z->v2()=>in.at(1)
-smith_1_29(); //z->t2(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_T2::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_18); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_29); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_0_2,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_t2_1_2",z->mem());
 offset_smith_0_4();
-smith_0_4_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_0_4_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsd_t2_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_25(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_2_25); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_1_4); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_t2_2_1",z->mem());
 offset_smith_1_8();
-smith_1_8_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_1_8_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsd_t2_3_0",z->mem());
 offset_smith_2_14();
-smith_2_14_0(); //z->v2()=>in.at(3)
-smith_3_22(); //z->t1(),z->v2()=>in.at(3)
-smith_2_14(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_2_14_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSD_T2::smith_3_22); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSD_T2::smith_2_14); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_27(); //z->t2(),z->v2()=>in.at(2)
-smith_1_8(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_2_27); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_1_8); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_t2_2_2",z->mem());
 offset_smith_1_9();
-smith_1_9_0(); //z->v2()=>in.at(2)
-smith_2_15(); //z->t1(),z->v2()=>in.at(2)
-smith_1_9(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_9_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_2_15); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_1_9); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsd_t2_2_3",z->mem());
 offset_smith_1_19();
-smith_1_19_0(); //z->v2()=>in.at(2)
-smith_2_26(); //z->t1(),z->v2()=>in.at(2)
-smith_1_19(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_19_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_2_26); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_1_19); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_21(); //z->t2(),z->v2()=>in.at(1)
-smith_0_4(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_T2::smith_1_21); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_0_4,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
-smith_0_5(out); //z->v2()=>out
+z->parallel(this,&CCSD_T2::smith_0_5,out); //z->v2()=>out
 in.at(1)=new Tensor("ccsd_t2_1_3",z->mem());
 offset_smith_0_7();
-smith_0_7_0(); //z->v2()=>in.at(1)
-smith_1_10(); //z->t1(),z->v2()=>in.at(1)
-smith_0_7(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSD_T2::smith_0_7_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_10); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_0_7,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_t2_1_4",z->mem());
 offset_smith_0_11();
-smith_0_11_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_0_11_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsd_t2_2_0",z->mem());
 offset_smith_1_17();
-smith_1_17_0(); //z->v2()=>in.at(2)
-smith_2_24(); //z->t1(),z->v2()=>in.at(2)
-smith_1_17(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_17_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_2_24); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSD_T2::smith_1_17); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_30(); //z->t2(),z->v2()=>in.at(1)
-smith_0_11(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_T2::smith_1_30); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_0_11,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsd_t2_1_5",z->mem());
 offset_smith_0_12();
-smith_0_12_0(); //z->v2()=>in.at(1)
-smith_1_20(); //z->t1(),z->v2()=>in.at(1)
-smith_1_28(); //z->t2(),z->v2()=>in.at(1)
-smith_0_12(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSD_T2::smith_0_12_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_20); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_1_28); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSD_T2::smith_0_12,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_13(out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSD_T2::smith_0_13,out); //z->t2(),z->v2()=>out
   
 }
   
@@ -201,7 +201,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_11(Ref<Tensor>& out){ 
@@ -266,7 +266,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_11_0(){ 
@@ -306,7 +306,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_0_11(){ 
@@ -330,7 +330,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_12(Ref<Tensor>& out){ 
@@ -431,7 +431,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_12_0(){ 
@@ -471,7 +471,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_0_12(){ 
@@ -495,7 +495,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_13(Ref<Tensor>& out){ 
@@ -560,7 +560,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_1_0(){ 
@@ -596,7 +596,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_0_1(){ 
@@ -616,7 +616,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_2(Ref<Tensor>& out){ 
@@ -693,7 +693,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_2_0(){ 
@@ -729,7 +729,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_0_2(){ 
@@ -749,7 +749,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_4(Ref<Tensor>& out){ 
@@ -820,7 +820,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_4_0(){ 
@@ -860,7 +860,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_0_4(){ 
@@ -884,7 +884,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_5(Ref<Tensor>& out){ 
@@ -924,7 +924,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_7(Ref<Tensor>& out){ 
@@ -995,7 +995,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_0_7_0(){ 
@@ -1035,7 +1035,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_0_7(){ 
@@ -1059,7 +1059,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_10(){ 
@@ -1125,7 +1125,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_16(){ 
@@ -1189,7 +1189,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_17(){ 
@@ -1260,7 +1260,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_17_0(){ 
@@ -1300,7 +1300,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_1_17(){ 
@@ -1324,7 +1324,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_18(){ 
@@ -1388,7 +1388,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_19(){ 
@@ -1481,7 +1481,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_19_0(){ 
@@ -1521,7 +1521,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_1_19(){ 
@@ -1545,7 +1545,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_20(){ 
@@ -1611,7 +1611,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_21(){ 
@@ -1676,7 +1676,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_28(){ 
@@ -1766,7 +1766,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_29(){ 
@@ -1841,7 +1841,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_3(){ 
@@ -1897,7 +1897,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_30(){ 
@@ -1962,7 +1962,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_31(){ 
@@ -2037,7 +2037,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_3_0(){ 
@@ -2073,7 +2073,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_1_3(){ 
@@ -2093,7 +2093,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_4(){ 
@@ -2159,7 +2159,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_4_0(){ 
@@ -2195,7 +2195,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_1_4(){ 
@@ -2215,7 +2215,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_8(){ 
@@ -2281,7 +2281,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_8_0(){ 
@@ -2321,7 +2321,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_1_8(){ 
@@ -2345,7 +2345,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_9(){ 
@@ -2416,7 +2416,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_1_9_0(){ 
@@ -2456,7 +2456,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_1_9(){ 
@@ -2480,7 +2480,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_2_14(){ 
@@ -2551,7 +2551,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_2_14_0(){ 
@@ -2591,7 +2591,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::offset_smith_2_14(){ 
@@ -2615,7 +2615,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_2_15(){ 
@@ -2681,7 +2681,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_2_23(){ 
@@ -2753,7 +2753,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_2_24(){ 
@@ -2819,7 +2819,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_2_25(){ 
@@ -2891,7 +2891,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_2_26(){ 
@@ -2957,7 +2957,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_2_27(){ 
@@ -3022,7 +3022,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSD_T2::smith_3_22(){ 
@@ -3088,5 +3088,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
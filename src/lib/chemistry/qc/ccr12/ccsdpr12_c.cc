@@ -44,61 +44,61 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsdpr12_c_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->vd2()=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_0_1_0); //z->vd2()=>in.at(1)
 in.at(2)=new Tensor("ccsdpr12_c_2_0",z->mem());
 offset_smith_1_1();
-smith_1_1_0(); //z->f1()=>in.at(2)
-smith_2_12(); //z->t1(),z->v2()=>in.at(2)
-smith_1_1(); //z->fd2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_1_1_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDPR12_C::smith_2_12); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_C::smith_1_1); //z->fd2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdpr12_c_2_14",z->mem());
 offset_smith_1_14();
-smith_2_14(); //z->t1(),z->fd2()=>in.at(2)
-smith_1_14(); //z->v2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_2_14); //z->t1(),z->fd2()=>in.at(2)
+z->parallel(this,&CCSDPR12_C::smith_1_14); //z->v2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_1(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_C::smith_0_1,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_c_1_2",z->mem());
 offset_smith_0_2();
-smith_1_2(); //z->gt2(),z->f1()=>in.at(1)
-smith_0_2(out); //z->xs2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_C::smith_1_2); //z->gt2(),z->f1()=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_0_2,out); //z->xs2(),in.at(1)=>out
 delete in.at(1);
-smith_0_3(out); //z->gt2(),z->bs2()=>out
-smith_0_4(out); //z->vd2()=>out
+z->parallel(this,&CCSDPR12_C::smith_0_3,out); //z->gt2(),z->bs2()=>out
+z->parallel(this,&CCSDPR12_C::smith_0_4,out); //z->vd2()=>out
 in.at(1)=new Tensor("ccsdpr12_c_1_5",z->mem());
 offset_smith_0_5();
-smith_1_5(); //z->t1(),z->fd2()=>in.at(1)
-smith_0_5(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_C::smith_1_5); //z->t1(),z->fd2()=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_0_5,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_c_1_1",z->mem());
 offset_smith_0_6();
-smith_0_6_0(); //z->vd2()=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_0_6_0); //z->vd2()=>in.at(1)
 in.at(2)=new Tensor("ccsdpr12_c_2_7",z->mem());
 offset_smith_1_7();
-smith_2_7(); //z->t1(),z->fd2()=>in.at(2)
-smith_1_7(); //z->v2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_2_7); //z->t1(),z->fd2()=>in.at(2)
+z->parallel(this,&CCSDPR12_C::smith_1_7); //z->v2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_8(); //z->t1(),z->vd2()=>in.at(1)
-smith_0_6(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_C::smith_1_8); //z->t1(),z->vd2()=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_0_6,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_c_1_2",z->mem());
 offset_smith_0_9();
 in.at(2)=new Tensor("ccsdpr12_c_2_0",z->mem());
 offset_smith_1_9();
-smith_1_9_0(); //z->v2()=>in.at(2)
-smith_2_13(); //z->t1(),z->v2()=>in.at(2)
-smith_1_9(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_1_9_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_C::smith_2_13); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_C::smith_1_9); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdpr12_c_2_11",z->mem());
 offset_smith_1_11();
 in.at(3)=new Tensor("ccsdpr12_c_3_11",z->mem());
 offset_smith_2_11();
-smith_3_11(); //z->t1(),z->v2()=>in.at(3)
-smith_2_11(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDPR12_C::smith_3_11); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDPR12_C::smith_2_11); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_1_11(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_C::smith_1_11); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_9(out); //z->fd2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_C::smith_0_9,out); //z->fd2(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -165,7 +165,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_0_1_0(){ 
@@ -205,7 +205,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_0_1(){ 
@@ -229,7 +229,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_0_2(Ref<Tensor>& out){ 
@@ -294,7 +294,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_0_2(){ 
@@ -318,7 +318,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_0_3(Ref<Tensor>& out){ 
@@ -383,7 +383,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_0_4(Ref<Tensor>& out){ 
@@ -423,7 +423,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_0_5(Ref<Tensor>& out){ 
@@ -485,7 +485,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_0_5(){ 
@@ -509,7 +509,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_0_6(Ref<Tensor>& out){ 
@@ -580,7 +580,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_0_6_0(){ 
@@ -620,7 +620,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_0_6(){ 
@@ -644,7 +644,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_0_9(Ref<Tensor>& out){ 
@@ -706,7 +706,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_0_9(){ 
@@ -730,7 +730,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_1(){ 
@@ -801,7 +801,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_11(){ 
@@ -861,7 +861,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_1_11(){ 
@@ -885,7 +885,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_14(){ 
@@ -947,7 +947,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_1_14(){ 
@@ -971,7 +971,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_1_0(){ 
@@ -1007,7 +1007,7 @@ for (long q7b=z->noab()+z->nvab();q7b<z->nab();++q7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_1_1(){ 
@@ -1027,7 +1027,7 @@ for (long q7b=z->noab()+z->nvab();q7b<z->nab();++q7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_2(){ 
@@ -1104,7 +1104,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_5(){ 
@@ -1164,7 +1164,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_7(){ 
@@ -1226,7 +1226,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_1_7(){ 
@@ -1250,7 +1250,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_8(){ 
@@ -1316,7 +1316,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_9(){ 
@@ -1403,7 +1403,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_1_9_0(){ 
@@ -1443,7 +1443,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_1_9(){ 
@@ -1467,7 +1467,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_2_11(){ 
@@ -1538,7 +1538,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::offset_smith_2_11(){ 
@@ -1562,7 +1562,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_2_12(){ 
@@ -1626,7 +1626,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_2_13(){ 
@@ -1692,7 +1692,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_2_14(){ 
@@ -1752,7 +1752,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_2_7(){ 
@@ -1812,7 +1812,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_C::smith_3_11(){ 
@@ -1878,5 +1878,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
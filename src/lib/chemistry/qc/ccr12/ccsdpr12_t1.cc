@@ -44,47 +44,47 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsdpr12_t1_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
-smith_1_4(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_0_1_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_1_4); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdpr12_t1_2_10",z->mem());
 offset_smith_1_10();
-smith_2_10(); //z->t1(),z->v2()=>in.at(2)
-smith_1_10(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_2_10); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T1::smith_1_10); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_13(); //z->t2(),z->v2()=>in.at(1)
-smith_1_16(); //z->gt2(),z->vr2()=>in.at(1)
-smith_0_1(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T1::smith_1_13); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_1_16); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_0_1,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_t1_1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_5(); //z->t1(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T1::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_1_5); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_0_2,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
-smith_0_3(out); //z->t1(),z->v2()=>out
+z->parallel(this,&CCSDPR12_T1::smith_0_3,out); //z->t1(),z->v2()=>out
 in.at(1)=new Tensor("ccsdpr12_t1_1_2",z->mem());
 offset_smith_0_6();
-smith_0_6_0(); //z->v2()=>in.at(1)
-smith_1_12(); //z->t1(),z->v2()=>in.at(1)
-smith_0_6(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T1::smith_0_6_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_1_12); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_0_6,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_7(out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSDPR12_T1::smith_0_7,out); //z->t2(),z->v2()=>out
 in.at(1)=new Tensor("ccsdpr12_t1_1_3",z->mem());
 offset_smith_0_8();
-smith_0_8_0(); //z->v2()=>in.at(1)
-smith_1_15(); //z->t1(),z->v2()=>in.at(1)
-smith_0_8(out); //z->qy(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T1::smith_0_8_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_1_15); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_0_8,out); //z->qy(),in.at(1)=>out
 delete in.at(1);
-smith_0_9(out); //z->gt2(),z->vr2()=>out
+z->parallel(this,&CCSDPR12_T1::smith_0_9,out); //z->gt2(),z->vr2()=>out
 in.at(1)=new Tensor("ccsdpr12_t1_1_11",z->mem());
 offset_smith_0_11();
-smith_1_11(); //z->t1(),z->v2()=>in.at(1)
-smith_0_11(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T1::smith_1_11); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_0_11,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_t1_1_14",z->mem());
 offset_smith_0_14();
-smith_1_14(); //z->t1(),z->v2()=>in.at(1)
-smith_0_14(out); //z->qy(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T1::smith_1_14); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T1::smith_0_14,out); //z->qy(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -142,7 +142,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_11(Ref<Tensor>& out){ 
@@ -214,7 +214,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::offset_smith_0_11(){ 
@@ -234,7 +234,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_14(Ref<Tensor>& out){ 
@@ -298,7 +298,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::offset_smith_0_14(){ 
@@ -318,7 +318,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_1_0(){ 
@@ -354,7 +354,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::offset_smith_0_1(){ 
@@ -374,7 +374,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_2(Ref<Tensor>& out){ 
@@ -430,7 +430,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_2_0(){ 
@@ -466,7 +466,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::offset_smith_0_2(){ 
@@ -486,7 +486,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_3(Ref<Tensor>& out){ 
@@ -544,7 +544,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_6(Ref<Tensor>& out){ 
@@ -613,7 +613,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_6_0(){ 
@@ -653,7 +653,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::offset_smith_0_6(){ 
@@ -677,7 +677,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_7(Ref<Tensor>& out){ 
@@ -746,7 +746,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_8(Ref<Tensor>& out){ 
@@ -809,7 +809,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_8_0(){ 
@@ -849,7 +849,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::offset_smith_0_8(){ 
@@ -873,7 +873,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_0_9(Ref<Tensor>& out){ 
@@ -942,7 +942,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_1_10(){ 
@@ -998,7 +998,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::offset_smith_1_10(){ 
@@ -1018,7 +1018,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_1_11(){ 
@@ -1090,7 +1090,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_1_12(){ 
@@ -1156,7 +1156,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_1_13(){ 
@@ -1231,7 +1231,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_1_14(){ 
@@ -1295,7 +1295,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_1_15(){ 
@@ -1355,7 +1355,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_1_16(){ 
@@ -1430,7 +1430,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_1_4(){ 
@@ -1494,7 +1494,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_1_5(){ 
@@ -1558,7 +1558,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T1::smith_2_10(){ 
@@ -1630,5 +1630,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
@@ -44,116 +44,116 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsdpr12_t2_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
-smith_1_25(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_1_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_25); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdpr12_t2_2_34",z->mem());
 offset_smith_1_34();
-smith_2_34(); //z->t1(),z->v2()=>in.at(2)
-smith_1_34(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_2_34); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_1_34); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_39(); //z->t2(),z->v2()=>in.at(1)
-smith_1_44(); //z->gt2(),z->vr2()=>in.at(1)
-smith_0_1(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T2::smith_1_39); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_44); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_1,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_t2_1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_26(); //z->t1(),z->v2()=>in.at(1)
-smith_1_37(); //z->t2(),z->v2()=>in.at(1)
-smith_1_42(); //z->qy(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T2::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_26); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_37); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_42); //z->qy(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_2,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_t2_1_2",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->f1()=>in.at(1)
-smith_1_17(); //z->t1(),z->v2()=>in.at(1)
-smith_1_40(); //z->t2(),z->v2()=>in.at(1)
-smith_0_3(out); //z->qy(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T2::smith_0_3_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_17); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_40); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_3,out); //z->qy(),in.at(1)=>out
 delete in.at(1);
-smith_0_4(out); //z->v2()=>out
+z->parallel(this,&CCSDPR12_T2::smith_0_4,out); //z->v2()=>out
 in.at(1)=new Tensor("ccsdpr12_t2_1_3",z->mem());
 offset_smith_0_5();
-smith_0_5_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_5_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdpr12_t2_2_0",z->mem());
 offset_smith_1_7();
-smith_1_7_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_1_7_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsdpr12_t2_3_0",z->mem());
 offset_smith_2_15();
-smith_2_15_0(); //z->v2()=>in.at(3)
-smith_3_27(); //z->t1(),z->v2()=>in.at(3)
-smith_2_15(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_2_15_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDPR12_T2::smith_3_27); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDPR12_T2::smith_2_15); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_30(); //z->gt2(),z->vr2()=>in.at(2)
-smith_2_31(); //z->t2(),z->v2()=>in.at(2)
-smith_1_7(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_2_30); //z->gt2(),z->vr2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_2_31); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_1_7); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdpr12_t2_2_1",z->mem());
 offset_smith_1_8();
-smith_1_8_0(); //z->v2()=>in.at(2)
-smith_2_16(); //z->t1(),z->v2()=>in.at(2)
-smith_1_8(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_8_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_2_16); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_1_8); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdpr12_t2_2_2",z->mem());
 offset_smith_1_18();
-smith_1_18_0(); //z->v2()=>in.at(2)
-smith_2_29(); //z->t1(),z->v2()=>in.at(2)
-smith_1_18(); //z->qy(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_18_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_2_29); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_1_18); //z->qy(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_20(); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_20); //z->gt2(),z->vr2()=>in.at(1)
 in.at(2)=new Tensor("ccsdpr12_t2_2_3",z->mem());
 offset_smith_1_21();
-smith_1_21_0(); //z->v2()=>in.at(2)
-smith_2_33(); //z->t1(),z->v2()=>in.at(2)
-smith_1_21(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_21_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_2_33); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_1_21); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_22(); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_22); //z->t2(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdpr12_t2_2_28",z->mem());
 offset_smith_1_28();
-smith_2_28(); //z->t1(),z->v2()=>in.at(2)
-smith_1_28(); //z->qy(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_2_28); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_1_28); //z->qy(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdpr12_t2_2_35",z->mem());
 offset_smith_1_35();
-smith_2_35(); //z->t1(),z->v2()=>in.at(2)
-smith_1_35(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_2_35); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_1_35); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_5(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T2::smith_0_5,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_t2_1_4",z->mem());
 offset_smith_0_6();
-smith_0_6_0(); //z->v2()=>in.at(1)
-smith_1_9(); //z->t1(),z->v2()=>in.at(1)
-smith_0_6(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T2::smith_0_6_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_9); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_6,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_t2_1_5",z->mem());
 offset_smith_0_10();
-smith_0_10_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_10_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdpr12_t2_2_0",z->mem());
 offset_smith_1_23();
-smith_1_23_0(); //z->v2()=>in.at(2)
-smith_2_32(); //z->t1(),z->v2()=>in.at(2)
-smith_1_23(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_23_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_2_32); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDPR12_T2::smith_1_23); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_38(); //z->t2(),z->v2()=>in.at(1)
-smith_1_43(); //z->gt2(),z->vr2()=>in.at(1)
-smith_0_10(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T2::smith_1_38); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_43); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_10,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdpr12_t2_1_6",z->mem());
 offset_smith_0_11();
-smith_0_11_0(); //z->v2()=>in.at(1)
-smith_1_24(); //z->t1(),z->v2()=>in.at(1)
-smith_1_36(); //z->t2(),z->v2()=>in.at(1)
-smith_1_41(); //z->qy(),z->v2()=>in.at(1)
-smith_0_11(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T2::smith_0_11_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_24); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_36); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_41); //z->qy(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_11,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_12(out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSDPR12_T2::smith_0_12,out); //z->t2(),z->v2()=>out
 in.at(1)=new Tensor("ccsdpr12_t2_1_7",z->mem());
 offset_smith_0_13();
-smith_0_13_0(); //z->v2()=>in.at(1)
-smith_1_19(); //z->t1(),z->v2()=>in.at(1)
-smith_0_13(out); //z->qy(),in.at(1)=>out
+z->parallel(this,&CCSDPR12_T2::smith_0_13_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_1_19); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDPR12_T2::smith_0_13,out); //z->qy(),in.at(1)=>out
 delete in.at(1);
-smith_0_14(out); //z->gt2(),z->vr2()=>out
+z->parallel(this,&CCSDPR12_T2::smith_0_14,out); //z->gt2(),z->vr2()=>out
   
 }
   
@@ -231,7 +231,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_10(Ref<Tensor>& out){ 
@@ -296,7 +296,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_10_0(){ 
@@ -336,7 +336,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_0_10(){ 
@@ -360,7 +360,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_11(Ref<Tensor>& out){ 
@@ -461,7 +461,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_11_0(){ 
@@ -501,7 +501,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_0_11(){ 
@@ -525,7 +525,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_12(Ref<Tensor>& out){ 
@@ -590,7 +590,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_13(Ref<Tensor>& out){ 
@@ -683,7 +683,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_13_0(){ 
@@ -723,7 +723,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_0_13(){ 
@@ -747,7 +747,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_14(Ref<Tensor>& out){ 
@@ -812,7 +812,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_1_0(){ 
@@ -848,7 +848,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_0_1(){ 
@@ -868,7 +868,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_2(Ref<Tensor>& out){ 
@@ -945,7 +945,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_2_0(){ 
@@ -981,7 +981,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_0_2(){ 
@@ -1001,7 +1001,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_3(Ref<Tensor>& out){ 
@@ -1072,7 +1072,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_3_0(){ 
@@ -1108,7 +1108,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_0_3(){ 
@@ -1128,7 +1128,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_4(Ref<Tensor>& out){ 
@@ -1168,7 +1168,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_5(Ref<Tensor>& out){ 
@@ -1239,7 +1239,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_5_0(){ 
@@ -1279,7 +1279,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_0_5(){ 
@@ -1303,7 +1303,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_6(Ref<Tensor>& out){ 
@@ -1374,7 +1374,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_0_6_0(){ 
@@ -1414,7 +1414,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_0_6(){ 
@@ -1438,7 +1438,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_17(){ 
@@ -1496,7 +1496,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_18(){ 
@@ -1581,7 +1581,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_18_0(){ 
@@ -1621,7 +1621,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_1_18(){ 
@@ -1645,7 +1645,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_19(){ 
@@ -1705,7 +1705,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_20(){ 
@@ -1770,7 +1770,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_21(){ 
@@ -1863,7 +1863,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_21_0(){ 
@@ -1903,7 +1903,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_1_21(){ 
@@ -1927,7 +1927,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_22(){ 
@@ -1992,7 +1992,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_23(){ 
@@ -2063,7 +2063,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_23_0(){ 
@@ -2103,7 +2103,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_1_23(){ 
@@ -2127,7 +2127,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_24(){ 
@@ -2193,7 +2193,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_25(){ 
@@ -2257,7 +2257,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_26(){ 
@@ -2321,7 +2321,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_28(){ 
@@ -2381,7 +2381,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_1_28(){ 
@@ -2401,7 +2401,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_34(){ 
@@ -2457,7 +2457,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_1_34(){ 
@@ -2477,7 +2477,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_35(){ 
@@ -2543,7 +2543,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_1_35(){ 
@@ -2563,7 +2563,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_36(){ 
@@ -2653,7 +2653,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_37(){ 
@@ -2728,7 +2728,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_38(){ 
@@ -2793,7 +2793,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_39(){ 
@@ -2868,7 +2868,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_40(){ 
@@ -2937,7 +2937,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_41(){ 
@@ -3011,7 +3011,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_42(){ 
@@ -3074,7 +3074,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_43(){ 
@@ -3139,7 +3139,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_44(){ 
@@ -3214,7 +3214,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_7(){ 
@@ -3280,7 +3280,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_7_0(){ 
@@ -3320,7 +3320,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_1_7(){ 
@@ -3344,7 +3344,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_8(){ 
@@ -3415,7 +3415,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_8_0(){ 
@@ -3455,7 +3455,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_1_8(){ 
@@ -3479,7 +3479,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_1_9(){ 
@@ -3545,7 +3545,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_15(){ 
@@ -3616,7 +3616,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_15_0(){ 
@@ -3656,7 +3656,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::offset_smith_2_15(){ 
@@ -3680,7 +3680,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_16(){ 
@@ -3746,7 +3746,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_28(){ 
@@ -3810,7 +3810,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_29(){ 
@@ -3870,7 +3870,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_30(){ 
@@ -3935,7 +3935,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_31(){ 
@@ -4000,7 +4000,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_32(){ 
@@ -4066,7 +4066,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_33(){ 
@@ -4132,7 +4132,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_34(){ 
@@ -4204,7 +4204,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_2_35(){ 
@@ -4276,7 +4276,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDPR12_T2::smith_3_27(){ 
@@ -4342,5 +4342,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
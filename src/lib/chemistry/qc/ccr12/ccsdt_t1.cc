@@ -41,41 +41,41 @@ void CCSDT_T1::compute_amp(Ref<Tensor>& out){ //k_i0_offset,z->f1(),z->in.at(0),
   
 in.resize(8);
   
-smith_0_1(out); //z->f1()=>out
+z->parallel(this,&CCSDT_T1::smith_0_1,out); //z->f1()=>out
 in.at(1)=new Tensor("ccsdt_t1_1_0",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_0_2_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsdt_t1_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_11(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDT_T1::smith_2_11); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T1::smith_1_4); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_7(); //z->t1(),z->v2()=>in.at(1)
-smith_1_14(); //z->t2(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDT_T1::smith_1_7); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_1_14); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_0_2,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t1_1_1",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->f1()=>in.at(1)
-smith_1_8(); //z->t1(),z->v2()=>in.at(1)
-smith_0_3(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDT_T1::smith_0_3_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_1_8); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_0_3,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t1_1_2",z->mem());
 offset_smith_0_5();
-smith_0_5_0(); //z->f1()=>in.at(1)
-smith_1_12(); //z->t1(),z->v2()=>in.at(1)
-smith_0_5(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDT_T1::smith_0_5_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_1_12); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_0_5,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_6(out); //z->t1(),z->v2()=>out
+z->parallel(this,&CCSDT_T1::smith_0_6,out); //z->t1(),z->v2()=>out
 in.at(1)=new Tensor("ccsdt_t1_1_3",z->mem());
 offset_smith_0_9();
-smith_0_9_0(); //z->v2()=>in.at(1)
-smith_1_13(); //z->t1(),z->v2()=>in.at(1)
-smith_0_9(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDT_T1::smith_0_9_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_1_13); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T1::smith_0_9,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_10(out); //z->t2(),z->v2()=>out
-smith_0_15(out); //z->t3(),z->v2()=>out
+z->parallel(this,&CCSDT_T1::smith_0_10,out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSDT_T1::smith_0_15,out); //z->t3(),z->v2()=>out
   
 }
   
@@ -112,7 +112,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_10(Ref<Tensor>& out){ 
@@ -181,7 +181,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_15(Ref<Tensor>& out){ 
@@ -283,7 +283,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_2(Ref<Tensor>& out){ 
@@ -339,7 +339,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_2_0(){ 
@@ -375,7 +375,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::offset_smith_0_2(){ 
@@ -395,7 +395,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_3(Ref<Tensor>& out){ 
@@ -451,7 +451,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_3_0(){ 
@@ -487,7 +487,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::offset_smith_0_3(){ 
@@ -507,7 +507,7 @@ for (long p2b=z->noab();p2b<z->noab()+z->nvab();++p2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_5(Ref<Tensor>& out){ 
@@ -579,7 +579,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_5_0(){ 
@@ -615,7 +615,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::offset_smith_0_5(){ 
@@ -635,7 +635,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_6(Ref<Tensor>& out){ 
@@ -693,7 +693,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_9(Ref<Tensor>& out){ 
@@ -762,7 +762,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_0_9_0(){ 
@@ -802,7 +802,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::offset_smith_0_9(){ 
@@ -826,7 +826,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_1_12(){ 
@@ -898,7 +898,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_1_13(){ 
@@ -964,7 +964,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_1_14(){ 
@@ -1039,7 +1039,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_1_4(){ 
@@ -1095,7 +1095,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_1_4_0(){ 
@@ -1131,7 +1131,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::offset_smith_1_4(){ 
@@ -1151,7 +1151,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_1_7(){ 
@@ -1215,7 +1215,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_1_8(){ 
@@ -1279,7 +1279,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T1::smith_2_11(){ 
@@ -1351,5 +1351,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
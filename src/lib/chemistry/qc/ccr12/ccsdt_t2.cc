@@ -44,101 +44,101 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsdt_t2_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_1_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsdt_t2_2_0",z->mem());
 offset_smith_1_3();
-smith_1_3_0(); //z->f1()=>in.at(2)
-smith_2_26(); //z->t1(),z->v2()=>in.at(2)
-smith_1_3(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_3_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_2_26); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_1_3); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_17(); //z->t1(),z->v2()=>in.at(1)
-smith_1_34(); //z->t2(),z->v2()=>in.at(1)
-smith_0_1(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDT_T2::smith_1_17); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_34); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_1,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t2_1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_19(); //z->t1(),z->v2()=>in.at(1)
-smith_1_32(); //z->t2(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDT_T2::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_19); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_32); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_2,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t2_1_2",z->mem());
 offset_smith_0_4();
-smith_0_4_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_4_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdt_t2_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_28(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_2_28); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_1_4); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdt_t2_2_1",z->mem());
 offset_smith_1_9();
-smith_1_9_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_1_9_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsdt_t2_3_0",z->mem());
 offset_smith_2_15();
-smith_2_15_0(); //z->v2()=>in.at(3)
-smith_3_25(); //z->t1(),z->v2()=>in.at(3)
-smith_2_15(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_2_15_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDT_T2::smith_3_25); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDT_T2::smith_2_15); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_30(); //z->t2(),z->v2()=>in.at(2)
-smith_1_9(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_2_30); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_1_9); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdt_t2_2_2",z->mem());
 offset_smith_1_10();
-smith_1_10_0(); //z->v2()=>in.at(2)
-smith_2_16(); //z->t1(),z->v2()=>in.at(2)
-smith_1_10(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_10_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_2_16); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_1_10); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdt_t2_2_3",z->mem());
 offset_smith_1_20();
-smith_1_20_0(); //z->v2()=>in.at(2)
-smith_2_29(); //z->t1(),z->v2()=>in.at(2)
-smith_1_20(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_20_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_2_29); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_1_20); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_22(); //z->t2(),z->v2()=>in.at(1)
-smith_1_35(); //z->t3(),z->v2()=>in.at(1)
-smith_0_4(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDT_T2::smith_1_22); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_35); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_4,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t2_1_3",z->mem());
 offset_smith_0_5();
-smith_0_5_0(); //z->f1()=>in.at(1)
-smith_1_37(); //z->t1(),z->v2()=>in.at(1)
-smith_0_5(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDT_T2::smith_0_5_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_37); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_5,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
-smith_0_6(out); //z->v2()=>out
+z->parallel(this,&CCSDT_T2::smith_0_6,out); //z->v2()=>out
 in.at(1)=new Tensor("ccsdt_t2_1_4",z->mem());
 offset_smith_0_8();
-smith_0_8_0(); //z->v2()=>in.at(1)
-smith_1_11(); //z->t1(),z->v2()=>in.at(1)
-smith_0_8(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDT_T2::smith_0_8_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_11); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_8,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t2_1_5",z->mem());
 offset_smith_0_12();
-smith_0_12_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_12_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdt_t2_2_0",z->mem());
 offset_smith_1_18();
-smith_1_18_0(); //z->v2()=>in.at(2)
-smith_2_27(); //z->t1(),z->v2()=>in.at(2)
-smith_1_18(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_18_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_2_27); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T2::smith_1_18); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_33(); //z->t2(),z->v2()=>in.at(1)
-smith_0_12(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDT_T2::smith_1_33); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_12,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t2_1_6",z->mem());
 offset_smith_0_13();
-smith_0_13_0(); //z->v2()=>in.at(1)
-smith_1_21(); //z->t1(),z->v2()=>in.at(1)
-smith_1_31(); //z->t2(),z->v2()=>in.at(1)
-smith_0_13(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDT_T2::smith_0_13_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_21); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_31); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_13,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_14(out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSDT_T2::smith_0_14,out); //z->t2(),z->v2()=>out
 in.at(1)=new Tensor("ccsdt_t2_1_7",z->mem());
 offset_smith_0_23();
-smith_0_23_0(); //z->v2()=>in.at(1)
-smith_1_36(); //z->t1(),z->v2()=>in.at(1)
-smith_0_23(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDT_T2::smith_0_23_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_1_36); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T2::smith_0_23,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
-smith_0_24(out); //z->t3(),z->v2()=>out
+z->parallel(this,&CCSDT_T2::smith_0_24,out); //z->t3(),z->v2()=>out
   
 }
   
@@ -216,7 +216,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_12(Ref<Tensor>& out){ 
@@ -281,7 +281,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_12_0(){ 
@@ -321,7 +321,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_0_12(){ 
@@ -345,7 +345,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_13(Ref<Tensor>& out){ 
@@ -446,7 +446,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_13_0(){ 
@@ -486,7 +486,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_0_13(){ 
@@ -510,7 +510,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_14(Ref<Tensor>& out){ 
@@ -575,7 +575,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_1_0(){ 
@@ -611,7 +611,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_0_1(){ 
@@ -631,7 +631,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_2(Ref<Tensor>& out){ 
@@ -708,7 +708,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_23(Ref<Tensor>& out){ 
@@ -820,7 +820,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_23_0(){ 
@@ -860,7 +860,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_0_23(){ 
@@ -884,7 +884,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_24(Ref<Tensor>& out){ 
@@ -996,7 +996,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_2_0(){ 
@@ -1032,7 +1032,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_0_2(){ 
@@ -1052,7 +1052,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_4(Ref<Tensor>& out){ 
@@ -1123,7 +1123,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_4_0(){ 
@@ -1163,7 +1163,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_0_4(){ 
@@ -1187,7 +1187,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_5(Ref<Tensor>& out){ 
@@ -1283,7 +1283,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_5_0(){ 
@@ -1319,7 +1319,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_0_5(){ 
@@ -1339,7 +1339,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_6(Ref<Tensor>& out){ 
@@ -1379,7 +1379,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_8(Ref<Tensor>& out){ 
@@ -1450,7 +1450,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_0_8_0(){ 
@@ -1490,7 +1490,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_0_8(){ 
@@ -1514,7 +1514,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_10(){ 
@@ -1585,7 +1585,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_10_0(){ 
@@ -1625,7 +1625,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_1_10(){ 
@@ -1649,7 +1649,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_11(){ 
@@ -1715,7 +1715,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_17(){ 
@@ -1779,7 +1779,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_18(){ 
@@ -1850,7 +1850,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_18_0(){ 
@@ -1890,7 +1890,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_1_18(){ 
@@ -1914,7 +1914,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_19(){ 
@@ -1978,7 +1978,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_20(){ 
@@ -2071,7 +2071,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_20_0(){ 
@@ -2111,7 +2111,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_1_20(){ 
@@ -2135,7 +2135,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_21(){ 
@@ -2201,7 +2201,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_22(){ 
@@ -2266,7 +2266,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_3(){ 
@@ -2322,7 +2322,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_31(){ 
@@ -2412,7 +2412,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_32(){ 
@@ -2487,7 +2487,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_33(){ 
@@ -2552,7 +2552,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_34(){ 
@@ -2627,7 +2627,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_35(){ 
@@ -2734,7 +2734,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_36(){ 
@@ -2800,7 +2800,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_37(){ 
@@ -2872,7 +2872,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_3_0(){ 
@@ -2908,7 +2908,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_1_3(){ 
@@ -2928,7 +2928,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_4(){ 
@@ -2994,7 +2994,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_4_0(){ 
@@ -3030,7 +3030,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_1_4(){ 
@@ -3050,7 +3050,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_9(){ 
@@ -3116,7 +3116,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_1_9_0(){ 
@@ -3156,7 +3156,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_1_9(){ 
@@ -3180,7 +3180,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_2_15(){ 
@@ -3251,7 +3251,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_2_15_0(){ 
@@ -3291,7 +3291,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::offset_smith_2_15(){ 
@@ -3315,7 +3315,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_2_16(){ 
@@ -3381,7 +3381,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_2_26(){ 
@@ -3453,7 +3453,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_2_27(){ 
@@ -3519,7 +3519,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_2_28(){ 
@@ -3591,7 +3591,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_2_29(){ 
@@ -3657,7 +3657,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_2_30(){ 
@@ -3722,7 +3722,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T2::smith_3_25(){ 
@@ -3788,5 +3788,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
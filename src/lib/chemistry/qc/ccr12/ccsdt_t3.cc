@@ -44,134 +44,134 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsdt_t3_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_1_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsdt_t3_2_0",z->mem());
 offset_smith_1_3();
-smith_1_3_0(); //z->f1()=>in.at(2)
-smith_2_31(); //z->t1(),z->v2()=>in.at(2)
-smith_1_3(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_3_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_31); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_3); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_19(); //z->t1(),z->v2()=>in.at(1)
-smith_1_41(); //z->t2(),z->v2()=>in.at(1)
-smith_0_1(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDT_T3::smith_1_19); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_41); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_1,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t3_1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_21(); //z->t1(),z->v2()=>in.at(1)
-smith_1_43(); //z->t2(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDT_T3::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_21); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_43); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_2,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t3_1_2",z->mem());
 offset_smith_0_4();
 in.at(2)=new Tensor("ccsdt_t3_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_33(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->t3(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_33); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_4); //z->t3(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdt_t3_2_1",z->mem());
 offset_smith_1_10();
-smith_1_10_0(); //z->v2()=>in.at(2)
-smith_2_18(); //z->t1(),z->v2()=>in.at(2)
-smith_2_38(); //z->t2(),z->v2()=>in.at(2)
-smith_1_10(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_10_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_18); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_38); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_10); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdt_t3_2_2",z->mem());
 offset_smith_1_17();
 in.at(3)=new Tensor("ccsdt_t3_3_0",z->mem());
 offset_smith_2_17();
-smith_2_17_0(); //z->v2()=>in.at(3)
-smith_3_30(); //z->t1(),z->v2()=>in.at(3)
-smith_2_17(); //z->t2(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_17_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDT_T3::smith_3_30); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDT_T3::smith_2_17); //z->t2(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_35(); //z->t3(),z->v2()=>in.at(2)
-smith_1_17(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_2_35); //z->t3(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_17); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdt_t3_2_3",z->mem());
 offset_smith_1_22();
-smith_1_22_0(); //z->v2()=>in.at(2)
-smith_2_34(); //z->t1(),z->v2()=>in.at(2)
-smith_1_22(); //z->t3(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_22_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_34); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_22); //z->t3(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_24(); //z->t3(),z->v2()=>in.at(1)
-smith_0_4(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDT_T3::smith_1_24); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_4,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t3_1_3",z->mem());
 offset_smith_0_5();
-smith_0_5_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_5_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdt_t3_2_0",z->mem());
 offset_smith_1_5();
-smith_1_5_0(); //z->f1()=>in.at(2)
-smith_2_37(); //z->t1(),z->v2()=>in.at(2)
-smith_1_5(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_5_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_37); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_5); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdt_t3_2_1",z->mem());
 offset_smith_1_8();
-smith_1_8_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_8_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsdt_t3_3_0",z->mem());
 offset_smith_2_15();
-smith_2_15_0(); //z->v2()=>in.at(3)
-smith_3_29(); //z->t1(),z->v2()=>in.at(3)
-smith_2_15(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_15_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDT_T3::smith_3_29); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDT_T3::smith_2_15); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_40(); //z->t2(),z->v2()=>in.at(2)
-smith_1_8(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_2_40); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_8); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdt_t3_2_2",z->mem());
 offset_smith_1_9();
-smith_1_9_0(); //z->v2()=>in.at(2)
-smith_2_16(); //z->t1(),z->v2()=>in.at(2)
-smith_1_9(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_9_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_16); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_9); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdt_t3_2_3",z->mem());
 offset_smith_1_26();
-smith_1_26_0(); //z->v2()=>in.at(2)
-smith_2_39(); //z->t1(),z->v2()=>in.at(2)
-smith_1_26(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_26_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_39); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_26); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_28(); //z->t2(),z->v2()=>in.at(1)
-smith_1_47(); //z->t3(),z->v2()=>in.at(1)
-smith_0_5(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDT_T3::smith_1_28); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_47); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_5,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t3_1_4",z->mem());
 offset_smith_0_7();
-smith_0_7_0(); //z->v2()=>in.at(1)
-smith_1_11(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_7_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_11); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdt_t3_2_0",z->mem());
 offset_smith_1_25();
-smith_1_25_0(); //z->v2()=>in.at(2)
-smith_2_36(); //z->t1(),z->v2()=>in.at(2)
-smith_1_25(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_25_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_36); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_25); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_27(); //z->t2(),z->v2()=>in.at(1)
-smith_1_45(); //z->t3(),z->v2()=>in.at(1)
-smith_0_7(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDT_T3::smith_1_27); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_45); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_7,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t3_1_5",z->mem());
 offset_smith_0_12();
-smith_0_12_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_12_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdt_t3_2_0",z->mem());
 offset_smith_1_20();
-smith_1_20_0(); //z->v2()=>in.at(2)
-smith_2_32(); //z->t1(),z->v2()=>in.at(2)
-smith_1_20(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_20_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_2_32); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDT_T3::smith_1_20); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_42(); //z->t2(),z->v2()=>in.at(1)
-smith_0_12(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDT_T3::smith_1_42); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_12,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdt_t3_1_6",z->mem());
 offset_smith_0_13();
-smith_0_13_0(); //z->v2()=>in.at(1)
-smith_1_23(); //z->t1(),z->v2()=>in.at(1)
-smith_1_44(); //z->t2(),z->v2()=>in.at(1)
-smith_0_13(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDT_T3::smith_0_13_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_23); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_1_44); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_13,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
-smith_0_14(out); //z->t3(),z->v2()=>out
+z->parallel(this,&CCSDT_T3::smith_0_14,out); //z->t3(),z->v2()=>out
 in.at(1)=new Tensor("ccsdt_t3_1_46",z->mem());
 offset_smith_0_46();
-smith_1_46(); //z->t3(),z->v2()=>in.at(1)
-smith_0_46(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDT_T3::smith_1_46); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDT_T3::smith_0_46,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -265,7 +265,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_12(Ref<Tensor>& out){ 
@@ -362,7 +362,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_12_0(){ 
@@ -402,7 +402,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_0_12(){ 
@@ -426,7 +426,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_13(Ref<Tensor>& out){ 
@@ -586,7 +586,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_13_0(){ 
@@ -626,7 +626,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_0_13(){ 
@@ -650,7 +650,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_14(Ref<Tensor>& out){ 
@@ -747,7 +747,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_1_0(){ 
@@ -783,7 +783,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_0_1(){ 
@@ -803,7 +803,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_2(Ref<Tensor>& out){ 
@@ -895,7 +895,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_2_0(){ 
@@ -931,7 +931,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_0_2(){ 
@@ -951,7 +951,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_4(Ref<Tensor>& out){ 
@@ -1033,7 +1033,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_46(Ref<Tensor>& out){ 
@@ -1120,7 +1120,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_0_46(){ 
@@ -1148,7 +1148,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_0_4(){ 
@@ -1176,7 +1176,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_5(Ref<Tensor>& out){ 
@@ -1306,7 +1306,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_5_0(){ 
@@ -1346,7 +1346,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_0_5(){ 
@@ -1370,7 +1370,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_7(Ref<Tensor>& out){ 
@@ -1500,7 +1500,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_0_7_0(){ 
@@ -1540,7 +1540,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_0_7(){ 
@@ -1564,7 +1564,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_10(){ 
@@ -1673,7 +1673,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_10_0(){ 
@@ -1713,7 +1713,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_10(){ 
@@ -1737,7 +1737,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_11(){ 
@@ -1803,7 +1803,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_17(){ 
@@ -1884,7 +1884,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_17(){ 
@@ -1912,7 +1912,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_19(){ 
@@ -1976,7 +1976,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_20(){ 
@@ -2047,7 +2047,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_20_0(){ 
@@ -2087,7 +2087,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_20(){ 
@@ -2111,7 +2111,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_21(){ 
@@ -2175,7 +2175,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_22(){ 
@@ -2299,7 +2299,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_22_0(){ 
@@ -2339,7 +2339,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_22(){ 
@@ -2363,7 +2363,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_23(){ 
@@ -2429,7 +2429,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_24(){ 
@@ -2519,7 +2519,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_25(){ 
@@ -2584,7 +2584,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_25_0(){ 
@@ -2624,7 +2624,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_25(){ 
@@ -2648,7 +2648,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_26(){ 
@@ -2741,7 +2741,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_26_0(){ 
@@ -2781,7 +2781,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_26(){ 
@@ -2805,7 +2805,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_27(){ 
@@ -2898,7 +2898,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_28(){ 
@@ -2963,7 +2963,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_3(){ 
@@ -3019,7 +3019,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_3_0(){ 
@@ -3055,7 +3055,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_3(){ 
@@ -3075,7 +3075,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_4(){ 
@@ -3149,7 +3149,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_41(){ 
@@ -3224,7 +3224,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_42(){ 
@@ -3289,7 +3289,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_43(){ 
@@ -3364,7 +3364,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_44(){ 
@@ -3454,7 +3454,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_45(){ 
@@ -3561,7 +3561,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_46(){ 
@@ -3640,7 +3640,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_47(){ 
@@ -3747,7 +3747,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_4_0(){ 
@@ -3783,7 +3783,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_4(){ 
@@ -3803,7 +3803,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_5(){ 
@@ -3869,7 +3869,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_5_0(){ 
@@ -3905,7 +3905,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_5(){ 
@@ -3925,7 +3925,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_8(){ 
@@ -3991,7 +3991,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_8_0(){ 
@@ -4031,7 +4031,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_8(){ 
@@ -4055,7 +4055,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_9(){ 
@@ -4126,7 +4126,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_1_9_0(){ 
@@ -4166,7 +4166,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_1_9(){ 
@@ -4190,7 +4190,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_15(){ 
@@ -4261,7 +4261,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_15_0(){ 
@@ -4301,7 +4301,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_2_15(){ 
@@ -4325,7 +4325,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_16(){ 
@@ -4391,7 +4391,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_17(){ 
@@ -4479,7 +4479,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_17_0(){ 
@@ -4519,7 +4519,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::offset_smith_2_17(){ 
@@ -4543,7 +4543,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_18(){ 
@@ -4609,7 +4609,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_31(){ 
@@ -4681,7 +4681,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_32(){ 
@@ -4747,7 +4747,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_33(){ 
@@ -4819,7 +4819,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_34(){ 
@@ -4885,7 +4885,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_35(){ 
@@ -4964,7 +4964,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_36(){ 
@@ -5030,7 +5030,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_37(){ 
@@ -5102,7 +5102,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_38(){ 
@@ -5192,7 +5192,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_39(){ 
@@ -5258,7 +5258,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_2_40(){ 
@@ -5323,7 +5323,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_3_29(){ 
@@ -5389,7 +5389,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDT_T3::smith_3_30(){ 
@@ -5455,5 +5455,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
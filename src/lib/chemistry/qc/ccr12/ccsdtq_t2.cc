@@ -44,102 +44,102 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsdtq_t2_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_1_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t2_2_0",z->mem());
 offset_smith_1_3();
-smith_1_3_0(); //z->f1()=>in.at(2)
-smith_2_26(); //z->t1(),z->v2()=>in.at(2)
-smith_1_3(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_3_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_2_26); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_1_3); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_17(); //z->t1(),z->v2()=>in.at(1)
-smith_1_37(); //z->t2(),z->v2()=>in.at(1)
-smith_0_1(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T2::smith_1_17); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_37); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_1,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t2_1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_19(); //z->t1(),z->v2()=>in.at(1)
-smith_1_35(); //z->t2(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T2::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_19); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_35); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_2,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t2_1_2",z->mem());
 offset_smith_0_4();
-smith_0_4_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_4_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t2_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_28(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_2_28); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_1_4); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t2_2_1",z->mem());
 offset_smith_1_9();
-smith_1_9_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_1_9_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsdtq_t2_3_0",z->mem());
 offset_smith_2_15();
-smith_2_15_0(); //z->v2()=>in.at(3)
-smith_3_25(); //z->t1(),z->v2()=>in.at(3)
-smith_2_15(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_2_15_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T2::smith_3_25); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T2::smith_2_15); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_30(); //z->t2(),z->v2()=>in.at(2)
-smith_1_9(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_2_30); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_1_9); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t2_2_2",z->mem());
 offset_smith_1_10();
-smith_1_10_0(); //z->v2()=>in.at(2)
-smith_2_16(); //z->t1(),z->v2()=>in.at(2)
-smith_1_10(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_10_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_2_16); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_1_10); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t2_2_3",z->mem());
 offset_smith_1_20();
-smith_1_20_0(); //z->v2()=>in.at(2)
-smith_2_29(); //z->t1(),z->v2()=>in.at(2)
-smith_1_20(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_20_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_2_29); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_1_20); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_22(); //z->t2(),z->v2()=>in.at(1)
-smith_1_33(); //z->t3(),z->v2()=>in.at(1)
-smith_0_4(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T2::smith_1_22); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_33); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_4,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t2_1_3",z->mem());
 offset_smith_0_5();
-smith_0_5_0(); //z->f1()=>in.at(1)
-smith_1_31(); //z->t1(),z->v2()=>in.at(1)
-smith_0_5(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T2::smith_0_5_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_31); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_5,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
-smith_0_6(out); //z->v2()=>out
+z->parallel(this,&CCSDTQ_T2::smith_0_6,out); //z->v2()=>out
 in.at(1)=new Tensor("ccsdtq_t2_1_4",z->mem());
 offset_smith_0_8();
-smith_0_8_0(); //z->v2()=>in.at(1)
-smith_1_11(); //z->t1(),z->v2()=>in.at(1)
-smith_0_8(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T2::smith_0_8_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_11); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_8,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t2_1_5",z->mem());
 offset_smith_0_12();
-smith_0_12_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_12_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t2_2_0",z->mem());
 offset_smith_1_18();
-smith_1_18_0(); //z->v2()=>in.at(2)
-smith_2_27(); //z->t1(),z->v2()=>in.at(2)
-smith_1_18(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_18_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_2_27); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T2::smith_1_18); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_36(); //z->t2(),z->v2()=>in.at(1)
-smith_0_12(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T2::smith_1_36); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_12,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t2_1_6",z->mem());
 offset_smith_0_13();
-smith_0_13_0(); //z->v2()=>in.at(1)
-smith_1_21(); //z->t1(),z->v2()=>in.at(1)
-smith_1_34(); //z->t2(),z->v2()=>in.at(1)
-smith_0_13(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T2::smith_0_13_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_21); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_34); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_13,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
-smith_0_14(out); //z->t2(),z->v2()=>out
+z->parallel(this,&CCSDTQ_T2::smith_0_14,out); //z->t2(),z->v2()=>out
 in.at(1)=new Tensor("ccsdtq_t2_1_7",z->mem());
 offset_smith_0_23();
-smith_0_23_0(); //z->v2()=>in.at(1)
-smith_1_32(); //z->t1(),z->v2()=>in.at(1)
-smith_0_23(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T2::smith_0_23_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_1_32); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T2::smith_0_23,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
-smith_0_24(out); //z->t3(),z->v2()=>out
-smith_0_38(out); //z->t4(),z->v2()=>out
+z->parallel(this,&CCSDTQ_T2::smith_0_24,out); //z->t3(),z->v2()=>out
+z->parallel(this,&CCSDTQ_T2::smith_0_38,out); //z->t4(),z->v2()=>out
   
 }
   
@@ -217,7 +217,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_12(Ref<Tensor>& out){ 
@@ -282,7 +282,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_12_0(){ 
@@ -322,7 +322,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_0_12(){ 
@@ -346,7 +346,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_13(Ref<Tensor>& out){ 
@@ -447,7 +447,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_13_0(){ 
@@ -487,7 +487,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_0_13(){ 
@@ -511,7 +511,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_14(Ref<Tensor>& out){ 
@@ -576,7 +576,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_1_0(){ 
@@ -612,7 +612,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_0_1(){ 
@@ -632,7 +632,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_2(Ref<Tensor>& out){ 
@@ -709,7 +709,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_23(Ref<Tensor>& out){ 
@@ -821,7 +821,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_23_0(){ 
@@ -861,7 +861,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_0_23(){ 
@@ -885,7 +885,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_24(Ref<Tensor>& out){ 
@@ -997,7 +997,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_2_0(){ 
@@ -1033,7 +1033,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_0_2(){ 
@@ -1053,7 +1053,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_38(Ref<Tensor>& out){ 
@@ -1267,7 +1267,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_4(Ref<Tensor>& out){ 
@@ -1338,7 +1338,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_4_0(){ 
@@ -1378,7 +1378,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_0_4(){ 
@@ -1402,7 +1402,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_5(Ref<Tensor>& out){ 
@@ -1498,7 +1498,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_5_0(){ 
@@ -1534,7 +1534,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_0_5(){ 
@@ -1554,7 +1554,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_6(Ref<Tensor>& out){ 
@@ -1594,7 +1594,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_8(Ref<Tensor>& out){ 
@@ -1665,7 +1665,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_0_8_0(){ 
@@ -1705,7 +1705,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_0_8(){ 
@@ -1729,7 +1729,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_10(){ 
@@ -1800,7 +1800,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_10_0(){ 
@@ -1840,7 +1840,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_1_10(){ 
@@ -1864,7 +1864,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_11(){ 
@@ -1930,7 +1930,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_17(){ 
@@ -1994,7 +1994,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_18(){ 
@@ -2065,7 +2065,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_18_0(){ 
@@ -2105,7 +2105,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_1_18(){ 
@@ -2129,7 +2129,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_19(){ 
@@ -2193,7 +2193,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_20(){ 
@@ -2286,7 +2286,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_20_0(){ 
@@ -2326,7 +2326,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_1_20(){ 
@@ -2350,7 +2350,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_21(){ 
@@ -2416,7 +2416,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_22(){ 
@@ -2481,7 +2481,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_3(){ 
@@ -2537,7 +2537,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_31(){ 
@@ -2609,7 +2609,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_32(){ 
@@ -2675,7 +2675,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_33(){ 
@@ -2782,7 +2782,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_34(){ 
@@ -2872,7 +2872,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_35(){ 
@@ -2947,7 +2947,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_36(){ 
@@ -3012,7 +3012,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_37(){ 
@@ -3087,7 +3087,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_3_0(){ 
@@ -3123,7 +3123,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_1_3(){ 
@@ -3143,7 +3143,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_4(){ 
@@ -3209,7 +3209,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_4_0(){ 
@@ -3245,7 +3245,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_1_4(){ 
@@ -3265,7 +3265,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_9(){ 
@@ -3331,7 +3331,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_1_9_0(){ 
@@ -3371,7 +3371,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_1_9(){ 
@@ -3395,7 +3395,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_2_15(){ 
@@ -3466,7 +3466,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_2_15_0(){ 
@@ -3506,7 +3506,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::offset_smith_2_15(){ 
@@ -3530,7 +3530,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_2_16(){ 
@@ -3596,7 +3596,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_2_26(){ 
@@ -3668,7 +3668,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_2_27(){ 
@@ -3734,7 +3734,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_2_28(){ 
@@ -3806,7 +3806,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_2_29(){ 
@@ -3872,7 +3872,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_2_30(){ 
@@ -3937,7 +3937,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T2::smith_3_25(){ 
@@ -4003,5 +4003,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
@@ -44,148 +44,148 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsdtq_t3_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_1_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t3_2_0",z->mem());
 offset_smith_1_3();
-smith_1_3_0(); //z->f1()=>in.at(2)
-smith_2_34(); //z->t1(),z->v2()=>in.at(2)
-smith_1_3(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_3_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_34); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_3); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_20(); //z->t1(),z->v2()=>in.at(1)
-smith_1_47(); //z->t2(),z->v2()=>in.at(1)
-smith_0_1(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_1_20); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_47); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_1,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t3_1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_22(); //z->t1(),z->v2()=>in.at(1)
-smith_1_49(); //z->t2(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_22); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_49); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_2,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t3_1_2",z->mem());
 offset_smith_0_4();
 in.at(2)=new Tensor("ccsdtq_t3_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_36(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->t3(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_36); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_4); //z->t3(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t3_2_1",z->mem());
 offset_smith_1_11();
-smith_1_11_0(); //z->v2()=>in.at(2)
-smith_2_19(); //z->t1(),z->v2()=>in.at(2)
-smith_2_41(); //z->t2(),z->v2()=>in.at(2)
-smith_1_11(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_11_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_19); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_41); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_11); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t3_2_2",z->mem());
 offset_smith_1_18();
 in.at(3)=new Tensor("ccsdtq_t3_3_0",z->mem());
 offset_smith_2_18();
-smith_2_18_0(); //z->v2()=>in.at(3)
-smith_3_33(); //z->t1(),z->v2()=>in.at(3)
-smith_2_18(); //z->t2(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_18_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T3::smith_3_33); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T3::smith_2_18); //z->t2(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_38(); //z->t3(),z->v2()=>in.at(2)
-smith_1_18(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_2_38); //z->t3(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_18); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t3_2_3",z->mem());
 offset_smith_1_23();
-smith_1_23_0(); //z->v2()=>in.at(2)
-smith_2_37(); //z->t1(),z->v2()=>in.at(2)
-smith_1_23(); //z->t3(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_23_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_37); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_23); //z->t3(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_25(); //z->t3(),z->v2()=>in.at(1)
-smith_1_46(); //z->t4(),z->v2()=>in.at(1)
-smith_0_4(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_1_25); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_46); //z->t4(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_4,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t3_1_3",z->mem());
 offset_smith_0_5();
-smith_0_5_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_5_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t3_2_0",z->mem());
 offset_smith_1_5();
-smith_1_5_0(); //z->f1()=>in.at(2)
-smith_2_40(); //z->t1(),z->v2()=>in.at(2)
-smith_1_5(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_5_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_40); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_5); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t3_2_1",z->mem());
 offset_smith_1_9();
-smith_1_9_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_9_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsdtq_t3_3_0",z->mem());
 offset_smith_2_16();
-smith_2_16_0(); //z->v2()=>in.at(3)
-smith_3_32(); //z->t1(),z->v2()=>in.at(3)
-smith_2_16(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_16_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T3::smith_3_32); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T3::smith_2_16); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_43(); //z->t2(),z->v2()=>in.at(2)
-smith_1_9(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_2_43); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_9); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t3_2_2",z->mem());
 offset_smith_1_10();
-smith_1_10_0(); //z->v2()=>in.at(2)
-smith_2_17(); //z->t1(),z->v2()=>in.at(2)
-smith_1_10(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_10_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_17); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_10); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t3_2_3",z->mem());
 offset_smith_1_27();
-smith_1_27_0(); //z->v2()=>in.at(2)
-smith_2_42(); //z->t1(),z->v2()=>in.at(2)
-smith_1_27(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_27_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_42); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_27); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_29(); //z->t2(),z->v2()=>in.at(1)
-smith_1_53(); //z->t3(),z->v2()=>in.at(1)
-smith_0_5(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_1_29); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_53); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_5,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t3_1_4",z->mem());
 offset_smith_0_6();
-smith_0_6_0(); //z->f1()=>in.at(1)
-smith_1_44(); //z->t1(),z->v2()=>in.at(1)
-smith_0_6(out); //z->t4(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_0_6_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_44); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_6,out); //z->t4(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t3_1_5",z->mem());
 offset_smith_0_8();
-smith_0_8_0(); //z->v2()=>in.at(1)
-smith_1_12(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_8_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_12); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t3_2_0",z->mem());
 offset_smith_1_26();
-smith_1_26_0(); //z->v2()=>in.at(2)
-smith_2_39(); //z->t1(),z->v2()=>in.at(2)
-smith_1_26(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_26_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_39); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_26); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_28(); //z->t2(),z->v2()=>in.at(1)
-smith_1_51(); //z->t3(),z->v2()=>in.at(1)
-smith_0_8(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_1_28); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_51); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_8,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t3_1_6",z->mem());
 offset_smith_0_13();
-smith_0_13_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_13_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t3_2_0",z->mem());
 offset_smith_1_21();
-smith_1_21_0(); //z->v2()=>in.at(2)
-smith_2_35(); //z->t1(),z->v2()=>in.at(2)
-smith_1_21(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_21_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_2_35); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T3::smith_1_21); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_48(); //z->t2(),z->v2()=>in.at(1)
-smith_0_13(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_1_48); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_13,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t3_1_7",z->mem());
 offset_smith_0_14();
-smith_0_14_0(); //z->v2()=>in.at(1)
-smith_1_24(); //z->t1(),z->v2()=>in.at(1)
-smith_1_50(); //z->t2(),z->v2()=>in.at(1)
-smith_0_14(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_0_14_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_24); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_50); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_14,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
-smith_0_15(out); //z->t3(),z->v2()=>out
+z->parallel(this,&CCSDTQ_T3::smith_0_15,out); //z->t3(),z->v2()=>out
 in.at(1)=new Tensor("ccsdtq_t3_1_8",z->mem());
 offset_smith_0_30();
-smith_0_30_0(); //z->v2()=>in.at(1)
-smith_1_45(); //z->t1(),z->v2()=>in.at(1)
-smith_0_30(out); //z->t4(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_0_30_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_1_45); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_30,out); //z->t4(),in.at(1)=>out
 delete in.at(1);
-smith_0_31(out); //z->t4(),z->v2()=>out
+z->parallel(this,&CCSDTQ_T3::smith_0_31,out); //z->t4(),z->v2()=>out
 in.at(1)=new Tensor("ccsdtq_t3_1_52",z->mem());
 offset_smith_0_52();
-smith_1_52(); //z->t3(),z->v2()=>in.at(1)
-smith_0_52(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T3::smith_1_52); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T3::smith_0_52,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -279,7 +279,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_13(Ref<Tensor>& out){ 
@@ -376,7 +376,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_13_0(){ 
@@ -416,7 +416,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_13(){ 
@@ -440,7 +440,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_14(Ref<Tensor>& out){ 
@@ -600,7 +600,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_14_0(){ 
@@ -640,7 +640,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_14(){ 
@@ -664,7 +664,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_15(Ref<Tensor>& out){ 
@@ -761,7 +761,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_1_0(){ 
@@ -797,7 +797,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_1(){ 
@@ -817,7 +817,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_2(Ref<Tensor>& out){ 
@@ -909,7 +909,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_2_0(){ 
@@ -945,7 +945,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_2(){ 
@@ -965,7 +965,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_30(Ref<Tensor>& out){ 
@@ -1148,7 +1148,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_30_0(){ 
@@ -1188,7 +1188,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_30(){ 
@@ -1212,7 +1212,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_31(Ref<Tensor>& out){ 
@@ -1395,7 +1395,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_4(Ref<Tensor>& out){ 
@@ -1477,7 +1477,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_4(){ 
@@ -1505,7 +1505,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_5(Ref<Tensor>& out){ 
@@ -1635,7 +1635,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_52(Ref<Tensor>& out){ 
@@ -1722,7 +1722,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_52(){ 
@@ -1750,7 +1750,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_5_0(){ 
@@ -1790,7 +1790,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_5(){ 
@@ -1814,7 +1814,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_6(Ref<Tensor>& out){ 
@@ -1942,7 +1942,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_6_0(){ 
@@ -1978,7 +1978,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_6(){ 
@@ -1998,7 +1998,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_8(Ref<Tensor>& out){ 
@@ -2128,7 +2128,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_0_8_0(){ 
@@ -2168,7 +2168,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_0_8(){ 
@@ -2192,7 +2192,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_10(){ 
@@ -2263,7 +2263,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_10_0(){ 
@@ -2303,7 +2303,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_10(){ 
@@ -2327,7 +2327,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_11(){ 
@@ -2436,7 +2436,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_11_0(){ 
@@ -2476,7 +2476,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_11(){ 
@@ -2500,7 +2500,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_12(){ 
@@ -2566,7 +2566,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_18(){ 
@@ -2647,7 +2647,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_18(){ 
@@ -2675,7 +2675,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_20(){ 
@@ -2739,7 +2739,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_21(){ 
@@ -2810,7 +2810,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_21_0(){ 
@@ -2850,7 +2850,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_21(){ 
@@ -2874,7 +2874,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_22(){ 
@@ -2938,7 +2938,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_23(){ 
@@ -3062,7 +3062,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_23_0(){ 
@@ -3102,7 +3102,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_23(){ 
@@ -3126,7 +3126,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_24(){ 
@@ -3192,7 +3192,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_25(){ 
@@ -3282,7 +3282,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_26(){ 
@@ -3347,7 +3347,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_26_0(){ 
@@ -3387,7 +3387,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_26(){ 
@@ -3411,7 +3411,7 @@ for (long h8b=0L;h8b<z->noab();++h8b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_27(){ 
@@ -3504,7 +3504,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_27_0(){ 
@@ -3544,7 +3544,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_27(){ 
@@ -3568,7 +3568,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_28(){ 
@@ -3661,7 +3661,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_29(){ 
@@ -3726,7 +3726,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_3(){ 
@@ -3782,7 +3782,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_3_0(){ 
@@ -3818,7 +3818,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_3(){ 
@@ -3838,7 +3838,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_4(){ 
@@ -3912,7 +3912,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_44(){ 
@@ -3984,7 +3984,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_45(){ 
@@ -4050,7 +4050,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_46(){ 
@@ -4221,7 +4221,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_47(){ 
@@ -4296,7 +4296,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_48(){ 
@@ -4361,7 +4361,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_49(){ 
@@ -4436,7 +4436,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_4_0(){ 
@@ -4472,7 +4472,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_4(){ 
@@ -4492,7 +4492,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_5(){ 
@@ -4558,7 +4558,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_50(){ 
@@ -4648,7 +4648,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_51(){ 
@@ -4755,7 +4755,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_52(){ 
@@ -4834,7 +4834,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_53(){ 
@@ -4941,7 +4941,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_5_0(){ 
@@ -4977,7 +4977,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_5(){ 
@@ -4997,7 +4997,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_9(){ 
@@ -5063,7 +5063,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_1_9_0(){ 
@@ -5103,7 +5103,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_1_9(){ 
@@ -5127,7 +5127,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_16(){ 
@@ -5198,7 +5198,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_16_0(){ 
@@ -5238,7 +5238,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_2_16(){ 
@@ -5262,7 +5262,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_17(){ 
@@ -5328,7 +5328,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_18(){ 
@@ -5416,7 +5416,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_18_0(){ 
@@ -5456,7 +5456,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::offset_smith_2_18(){ 
@@ -5480,7 +5480,7 @@ for (long h7b=0L;h7b<z->noab();++h7b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_19(){ 
@@ -5546,7 +5546,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_34(){ 
@@ -5618,7 +5618,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_35(){ 
@@ -5684,7 +5684,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_36(){ 
@@ -5756,7 +5756,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_37(){ 
@@ -5822,7 +5822,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_38(){ 
@@ -5901,7 +5901,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_39(){ 
@@ -5967,7 +5967,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_40(){ 
@@ -6039,7 +6039,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_41(){ 
@@ -6129,7 +6129,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_42(){ 
@@ -6195,7 +6195,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_2_43(){ 
@@ -6260,7 +6260,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_3_32(){ 
@@ -6326,7 +6326,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T3::smith_3_33(){ 
@@ -6392,5 +6392,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
@@ -44,221 +44,221 @@ in.resize(8);
   
 in.at(1)=new Tensor("ccsdtq_t4_1_0",z->mem());
 offset_smith_0_1();
-smith_0_1_0(); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_1_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t4_2_0",z->mem());
 offset_smith_1_3();
-smith_1_3_0(); //z->f1()=>in.at(2)
-smith_2_43(); //z->t1(),z->v2()=>in.at(2)
-smith_1_3(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_3_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_43); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_3); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_23(); //z->t1(),z->v2()=>in.at(1)
-smith_1_64(); //z->t2(),z->v2()=>in.at(1)
-smith_0_1(out); //z->t4(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_1_23); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_64); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_1,out); //z->t4(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_1",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_25(); //z->t1(),z->v2()=>in.at(1)
-smith_1_66(); //z->t2(),z->v2()=>in.at(1)
-smith_0_2(out); //z->t4(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_25); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_66); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_2,out); //z->t4(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_2",z->mem());
 offset_smith_0_4();
 in.at(2)=new Tensor("ccsdtq_t4_2_0",z->mem());
 offset_smith_1_4();
-smith_1_4_0(); //z->f1()=>in.at(2)
-smith_2_45(); //z->t1(),z->v2()=>in.at(2)
-smith_1_4(); //z->t4(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_4_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_45); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_4); //z->t4(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_1",z->mem());
 offset_smith_1_11();
-smith_1_11_0(); //z->v2()=>in.at(2)
-smith_2_22(); //z->t1(),z->v2()=>in.at(2)
-smith_2_54(); //z->t2(),z->v2()=>in.at(2)
-smith_1_11(); //z->t3(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_11_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_22); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_54); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_11); //z->t3(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_2",z->mem());
 offset_smith_1_21();
 in.at(3)=new Tensor("ccsdtq_t4_3_0",z->mem());
 offset_smith_2_21();
-smith_2_21_0(); //z->v2()=>in.at(3)
-smith_3_42(); //z->t1(),z->v2()=>in.at(3)
-smith_2_21(); //z->t3(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_21_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T4::smith_3_42); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T4::smith_2_21); //z->t3(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_47(); //z->t4(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_47); //z->t4(),z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsdtq_t4_3_58",z->mem());
 offset_smith_2_58();
-smith_3_58(); //z->t2(),z->v2()=>in.at(3)
-smith_2_58(); //z->t2(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_3_58); //z->t2(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T4::smith_2_58); //z->t2(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_1_21(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_21); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_3",z->mem());
 offset_smith_1_26();
-smith_1_26_0(); //z->v2()=>in.at(2)
-smith_2_46(); //z->t1(),z->v2()=>in.at(2)
-smith_1_26(); //z->t4(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_26_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_46); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_26); //z->t4(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_28(); //z->t4(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_28); //z->t4(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t4_2_4",z->mem());
 offset_smith_1_30();
-smith_2_30(); //z->t2(),z->v2()=>in.at(2)
-smith_2_56(); //z->t3(),z->v2()=>in.at(2)
-smith_1_30(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_2_30); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_56); //z->t3(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_30); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_4(out); //z->t1(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_0_4,out); //z->t1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_3",z->mem());
 offset_smith_0_5();
-smith_0_5_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_5_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t4_2_0",z->mem());
 offset_smith_1_5();
-smith_1_5_0(); //z->f1()=>in.at(2)
-smith_2_48(); //z->t1(),z->v2()=>in.at(2)
-smith_1_5(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_5_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_48); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_5); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_1",z->mem());
 offset_smith_1_9();
-smith_1_9_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_9_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsdtq_t4_3_0",z->mem());
 offset_smith_2_19();
-smith_2_19_0(); //z->v2()=>in.at(3)
-smith_3_41(); //z->t1(),z->v2()=>in.at(3)
-smith_2_19(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_19_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T4::smith_3_41); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T4::smith_2_19); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_50(); //z->t2(),z->v2()=>in.at(2)
-smith_1_9(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_2_50); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_9); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_2",z->mem());
 offset_smith_1_10();
-smith_1_10_0(); //z->v2()=>in.at(2)
-smith_2_20(); //z->t1(),z->v2()=>in.at(2)
-smith_1_10(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_10_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_20); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_10); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_3",z->mem());
 offset_smith_1_33();
-smith_1_33_0(); //z->v2()=>in.at(2)
-smith_2_49(); //z->t1(),z->v2()=>in.at(2)
-smith_1_33(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_33_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_49); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_33); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_34(); //z->t2(),z->v2()=>in.at(1)
-smith_1_74(); //z->t3(),z->v2()=>in.at(1)
-smith_0_5(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_1_34); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_74); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_5,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_4",z->mem());
 offset_smith_0_6();
 in.at(2)=new Tensor("ccsdtq_t4_2_0",z->mem());
 offset_smith_1_6();
-smith_1_6_0(); //z->f1()=>in.at(2)
-smith_2_52(); //z->t1(),z->v2()=>in.at(2)
-smith_1_6(); //z->t3(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_6_0); //z->f1()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_52); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_6); //z->t3(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_1",z->mem());
 offset_smith_1_13();
-smith_1_13_0(); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_13_0); //z->v2()=>in.at(2)
 in.at(3)=new Tensor("ccsdtq_t4_3_0",z->mem());
 offset_smith_2_31();
-smith_2_31_0(); //z->v2()=>in.at(3)
-smith_3_59(); //z->t1(),z->v2()=>in.at(3)
-smith_2_31(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_31_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T4::smith_3_59); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T4::smith_2_31); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_63(); //z->t2(),z->v2()=>in.at(2)
-smith_1_13(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_2_63); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_13); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_2",z->mem());
 offset_smith_1_14();
-smith_1_14_0(); //z->v2()=>in.at(2)
-smith_2_32(); //z->t1(),z->v2()=>in.at(2)
-smith_2_62(); //z->t2(),z->v2()=>in.at(2)
-smith_1_14(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_14_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_32); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_62); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_14); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_3",z->mem());
 offset_smith_1_29();
 in.at(3)=new Tensor("ccsdtq_t4_3_0",z->mem());
 offset_smith_2_29();
-smith_2_29_0(); //z->v2()=>in.at(3)
-smith_3_60(); //z->t1(),z->v2()=>in.at(3)
-smith_2_29(); //z->t2(),in.at(3)=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_29_0); //z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T4::smith_3_60); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&CCSDTQ_T4::smith_2_29); //z->t2(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_57(); //z->t3(),z->v2()=>in.at(2)
-smith_1_29(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_2_57); //z->t3(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_29); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_4",z->mem());
 offset_smith_1_38();
-smith_1_38_0(); //z->v2()=>in.at(2)
-smith_2_55(); //z->t1(),z->v2()=>in.at(2)
-smith_1_38(); //z->t3(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_38_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_55); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_38); //z->t3(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_40(); //z->t3(),z->v2()=>in.at(1)
-smith_1_70(); //z->t4(),z->v2()=>in.at(1)
-smith_0_6(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_1_40); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_70); //z->t4(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_6,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_5",z->mem());
 offset_smith_0_8();
-smith_0_8_0(); //z->v2()=>in.at(1)
-smith_1_12(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_8_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_12); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t4_2_0",z->mem());
 offset_smith_1_36();
-smith_1_36_0(); //z->v2()=>in.at(2)
-smith_2_53(); //z->t1(),z->v2()=>in.at(2)
-smith_1_36(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_36_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_53); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_36); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_37(); //z->t2(),z->v2()=>in.at(1)
-smith_1_72(); //z->t3(),z->v2()=>in.at(1)
-smith_0_8(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_1_37); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_72); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_8,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_6",z->mem());
 offset_smith_0_15();
 in.at(2)=new Tensor("ccsdtq_t4_2_0",z->mem());
 offset_smith_1_15();
-smith_1_15_0(); //z->v2()=>in.at(2)
-smith_2_61(); //z->t2(),z->v2()=>in.at(2)
-smith_1_15(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_15_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_61); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_15); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("ccsdtq_t4_2_1",z->mem());
 offset_smith_1_35();
-smith_1_35_0(); //z->v2()=>in.at(2)
-smith_2_51(); //z->t1(),z->v2()=>in.at(2)
-smith_1_35(); //z->t3(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_35_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_51); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_35); //z->t3(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_39(); //z->t3(),z->v2()=>in.at(1)
-smith_1_68(); //z->t4(),z->v2()=>in.at(1)
-smith_0_15(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_1_39); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_68); //z->t4(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_15,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_7",z->mem());
 offset_smith_0_16();
-smith_0_16_0(); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_16_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("ccsdtq_t4_2_0",z->mem());
 offset_smith_1_24();
-smith_1_24_0(); //z->v2()=>in.at(2)
-smith_2_44(); //z->t1(),z->v2()=>in.at(2)
-smith_1_24(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_24_0); //z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_2_44); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&CCSDTQ_T4::smith_1_24); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_65(); //z->t2(),z->v2()=>in.at(1)
-smith_0_16(out); //z->t4(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_1_65); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_16,out); //z->t4(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_8",z->mem());
 offset_smith_0_17();
-smith_0_17_0(); //z->v2()=>in.at(1)
-smith_1_27(); //z->t1(),z->v2()=>in.at(1)
-smith_1_67(); //z->t2(),z->v2()=>in.at(1)
-smith_0_17(out); //z->t4(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_0_17_0); //z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_27); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_1_67); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_17,out); //z->t4(),in.at(1)=>out
 delete in.at(1);
-smith_0_18(out); //z->t4(),z->v2()=>out
+z->parallel(this,&CCSDTQ_T4::smith_0_18,out); //z->t4(),z->v2()=>out
 in.at(1)=new Tensor("ccsdtq_t4_1_69",z->mem());
 offset_smith_0_69();
-smith_1_69(); //z->t4(),z->v2()=>in.at(1)
-smith_0_69(out); //z->t2(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_1_69); //z->t4(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_69,out); //z->t2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_71",z->mem());
 offset_smith_0_71();
-smith_1_71(); //z->t3(),z->v2()=>in.at(1)
-smith_0_71(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_1_71); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_71,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("ccsdtq_t4_1_73",z->mem());
 offset_smith_0_73();
-smith_1_73(); //z->t3(),z->v2()=>in.at(1)
-smith_0_73(out); //z->t3(),in.at(1)=>out
+z->parallel(this,&CCSDTQ_T4::smith_1_73); //z->t3(),z->v2()=>in.at(1)
+z->parallel(this,&CCSDTQ_T4::smith_0_73,out); //z->t3(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -367,7 +367,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_15(Ref<Tensor>& out){ 
@@ -606,7 +606,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_15(){ 
@@ -634,7 +634,7 @@ for (long p6b=z->noab();p6b<z->noab()+z->nvab();++p6b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_16(Ref<Tensor>& out){ 
@@ -768,7 +768,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_16_0(){ 
@@ -808,7 +808,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_16(){ 
@@ -832,7 +832,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_17(Ref<Tensor>& out){ 
@@ -1073,7 +1073,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_17_0(){ 
@@ -1113,7 +1113,7 @@ for (long h10b=0L;h10b<z->noab();++h10b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_17(){ 
@@ -1137,7 +1137,7 @@ for (long h10b=0L;h10b<z->noab();++h10b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_18(Ref<Tensor>& out){ 
@@ -1271,7 +1271,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_1_0(){ 
@@ -1307,7 +1307,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_1(){ 
@@ -1327,7 +1327,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_2(Ref<Tensor>& out){ 
@@ -1434,7 +1434,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_2_0(){ 
@@ -1470,7 +1470,7 @@ for (long p8b=z->noab();p8b<z->noab()+z->nvab();++p8b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_2(){ 
@@ -1490,7 +1490,7 @@ for (long p8b=z->noab();p8b<z->noab()+z->nvab();++p8b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_4(Ref<Tensor>& out){ 
@@ -1583,7 +1583,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_4(){ 
@@ -1615,7 +1615,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_5(Ref<Tensor>& out){ 
@@ -1858,7 +1858,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_5_0(){ 
@@ -1898,7 +1898,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_5(){ 
@@ -1922,7 +1922,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_6(Ref<Tensor>& out){ 
@@ -2161,7 +2161,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_69(Ref<Tensor>& out){ 
@@ -2273,7 +2273,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_69(){ 
@@ -2305,7 +2305,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_6(){ 
@@ -2333,7 +2333,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_71(Ref<Tensor>& out){ 
@@ -2686,7 +2686,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_71(){ 
@@ -2714,7 +2714,7 @@ for (long h10b=0L;h10b<z->noab();++h10b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_73(Ref<Tensor>& out){ 
@@ -2906,7 +2906,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_73(){ 
@@ -2934,7 +2934,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_8(Ref<Tensor>& out){ 
@@ -3177,7 +3177,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_0_8_0(){ 
@@ -3217,7 +3217,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_0_8(){ 
@@ -3241,7 +3241,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_10(){ 
@@ -3312,7 +3312,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_10_0(){ 
@@ -3352,7 +3352,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_10(){ 
@@ -3376,7 +3376,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_11(){ 
@@ -3535,7 +3535,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_11_0(){ 
@@ -3575,7 +3575,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_11(){ 
@@ -3599,7 +3599,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_12(){ 
@@ -3665,7 +3665,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_13(){ 
@@ -3759,7 +3759,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_13_0(){ 
@@ -3799,7 +3799,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_13(){ 
@@ -3823,7 +3823,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_14(){ 
@@ -3932,7 +3932,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_14_0(){ 
@@ -3972,7 +3972,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_14(){ 
@@ -3996,7 +3996,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_15(){ 
@@ -4090,7 +4090,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_15_0(){ 
@@ -4130,7 +4130,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_15(){ 
@@ -4154,7 +4154,7 @@ for (long p7b=z->noab();p7b<z->noab()+z->nvab();++p7b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_21(){ 
@@ -4246,7 +4246,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_21(){ 
@@ -4278,7 +4278,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_23(){ 
@@ -4342,7 +4342,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_24(){ 
@@ -4413,7 +4413,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_24_0(){ 
@@ -4453,7 +4453,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_24(){ 
@@ -4477,7 +4477,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_25(){ 
@@ -4541,7 +4541,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_26(){ 
@@ -4704,7 +4704,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_26_0(){ 
@@ -4744,7 +4744,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_26(){ 
@@ -4768,7 +4768,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_27(){ 
@@ -4834,7 +4834,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_28(){ 
@@ -4947,7 +4947,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_29(){ 
@@ -5028,7 +5028,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_29(){ 
@@ -5056,7 +5056,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_3(){ 
@@ -5112,7 +5112,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_30(){ 
@@ -5309,7 +5309,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_30(){ 
@@ -5337,7 +5337,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_33(){ 
@@ -5430,7 +5430,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_33_0(){ 
@@ -5470,7 +5470,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_33(){ 
@@ -5494,7 +5494,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_34(){ 
@@ -5559,7 +5559,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_35(){ 
@@ -5649,7 +5649,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_35_0(){ 
@@ -5689,7 +5689,7 @@ for (long h10b=0L;h10b<z->noab();++h10b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_35(){ 
@@ -5713,7 +5713,7 @@ for (long h10b=0L;h10b<z->noab();++h10b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_36(){ 
@@ -5778,7 +5778,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_36_0(){ 
@@ -5818,7 +5818,7 @@ for (long h10b=0L;h10b<z->noab();++h10b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_36(){ 
@@ -5842,7 +5842,7 @@ for (long h10b=0L;h10b<z->noab();++h10b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_37(){ 
@@ -5935,7 +5935,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_38(){ 
@@ -6059,7 +6059,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_38_0(){ 
@@ -6099,7 +6099,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_38(){ 
@@ -6123,7 +6123,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_39(){ 
@@ -6247,7 +6247,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_3_0(){ 
@@ -6283,7 +6283,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_3(){ 
@@ -6303,7 +6303,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_4(){ 
@@ -6385,7 +6385,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_40(){ 
@@ -6475,7 +6475,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_4_0(){ 
@@ -6511,7 +6511,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_4(){ 
@@ -6531,7 +6531,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_5(){ 
@@ -6597,7 +6597,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_5_0(){ 
@@ -6633,7 +6633,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_5(){ 
@@ -6653,7 +6653,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_6(){ 
@@ -6727,7 +6727,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_64(){ 
@@ -6802,7 +6802,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_65(){ 
@@ -6867,7 +6867,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_66(){ 
@@ -6942,7 +6942,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_67(){ 
@@ -7032,7 +7032,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_68(){ 
@@ -7203,7 +7203,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_69(){ 
@@ -7298,7 +7298,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_6_0(){ 
@@ -7334,7 +7334,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_6(){ 
@@ -7354,7 +7354,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_70(){ 
@@ -7525,7 +7525,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_71(){ 
@@ -7639,7 +7639,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_72(){ 
@@ -7746,7 +7746,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_73(){ 
@@ -7825,7 +7825,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_74(){ 
@@ -7932,7 +7932,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_9(){ 
@@ -7998,7 +7998,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_1_9_0(){ 
@@ -8038,7 +8038,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_1_9(){ 
@@ -8062,7 +8062,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_19(){ 
@@ -8133,7 +8133,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_19_0(){ 
@@ -8173,7 +8173,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_2_19(){ 
@@ -8197,7 +8197,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_20(){ 
@@ -8263,7 +8263,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_21(){ 
@@ -8366,7 +8366,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_21_0(){ 
@@ -8406,7 +8406,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_2_21(){ 
@@ -8430,7 +8430,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_22(){ 
@@ -8496,7 +8496,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_29(){ 
@@ -8584,7 +8584,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_29_0(){ 
@@ -8624,7 +8624,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_2_29(){ 
@@ -8648,7 +8648,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_30(){ 
@@ -8735,7 +8735,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_31(){ 
@@ -8806,7 +8806,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_31_0(){ 
@@ -8846,7 +8846,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 z->mem()->free_local_double(k_c); 
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_a0_sort); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_2_31(){ 
@@ -8870,7 +8870,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_32(){ 
@@ -8936,7 +8936,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_43(){ 
@@ -9008,7 +9008,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_44(){ 
@@ -9074,7 +9074,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_45(){ 
@@ -9146,7 +9146,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_46(){ 
@@ -9212,7 +9212,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_47(){ 
@@ -9307,7 +9307,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_48(){ 
@@ -9379,7 +9379,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_49(){ 
@@ -9445,7 +9445,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_50(){ 
@@ -9510,7 +9510,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_51(){ 
@@ -9576,7 +9576,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_52(){ 
@@ -9648,7 +9648,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_53(){ 
@@ -9714,7 +9714,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_54(){ 
@@ -9804,7 +9804,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_55(){ 
@@ -9870,7 +9870,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_56(){ 
@@ -9984,7 +9984,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_57(){ 
@@ -10063,7 +10063,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_58(){ 
@@ -10218,7 +10218,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::offset_smith_2_58(){ 
@@ -10246,7 +10246,7 @@ for (long h9b=0L;h9b<z->noab();++h9b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_61(){ 
@@ -10311,7 +10311,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_62(){ 
@@ -10401,7 +10401,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_2_63(){ 
@@ -10466,7 +10466,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_3_41(){ 
@@ -10532,7 +10532,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_3_42(){ 
@@ -10598,7 +10598,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_3_58(){ 
@@ -10674,7 +10674,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_3_59(){ 
@@ -10740,7 +10740,7 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void CCSDTQ_T4::smith_3_60(){ 
@@ -10806,5 +10806,5 @@ z->mem()->free_local_double(k_a0_sort);
 z->mem()->free_local_double(k_a0); 
 z->mem()->free_local_double(k_c_sort); 
 z->mem()->free_local_double(k_c); 
-z->mem()->sync(); 
+z->sync(); 
 } 
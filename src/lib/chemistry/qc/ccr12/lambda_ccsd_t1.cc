@@ -42,162 +42,162 @@ void LAMBDA_CCSD_T1::compute_amp(Ref<Tensor>& out){ //k_i0_offset,z->f1(),z->in.
   
 in.resize(8);
   
-smith_0_1(out); //z->f1()=>out
-smith_0_2(out); //z->t1(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_1,out); //z->f1()=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_2,out); //z->t1(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsd_t1_1_0",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_3_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsd_t1_2_0",z->mem());
 offset_smith_1_5();
-smith_1_5_0(); //z->f1()=>in.at(2)
-smith_2_12(); //z->t1(),z->v2()=>in.at(2)
-smith_1_5(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_5_0); //z->f1()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_12); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_5); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_8(); //z->t1(),z->v2()=>in.at(1)
-smith_1_15(); //z->t2(),z->v2()=>in.at(1)
-smith_0_3(out); //z->lambda1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_8); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_15); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_3,out); //z->lambda1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_1",z->mem());
 offset_smith_0_4();
-smith_0_4_0(); //z->f1()=>in.at(1)
-smith_1_9(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_4_0); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_9); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsd_t1_2_13",z->mem());
 offset_smith_1_13();
-smith_2_13(); //z->t1(),z->v2()=>in.at(2)
-smith_1_13(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_13); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_13); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_4(out); //z->lambda1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_4,out); //z->lambda1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_2",z->mem());
 offset_smith_0_6();
-smith_1_6(); //z->t1(),z->lambda1()=>in.at(1)
-smith_1_19(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_6(out); //z->f1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_6); //z->t1(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_19); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_6,out); //z->f1(),in.at(1)=>out
 delete in.at(1);
-smith_0_7(out); //z->lambda1(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_7,out); //z->lambda1(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsd_t1_1_3",z->mem());
 offset_smith_0_10();
-smith_1_10(); //z->t1(),z->lambda1()=>in.at(1)
-smith_1_34(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_10(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_10); //z->t1(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_34); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_10,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_4",z->mem());
 offset_smith_0_11();
-smith_1_11(); //z->t1(),z->lambda1()=>in.at(1)
-smith_1_35(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_11(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_11); //z->t1(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_35); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_11,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_5",z->mem());
 offset_smith_0_14();
 in.at(2)=new Tensor("lambda_ccsd_t1_2_0",z->mem());
 offset_smith_1_14();
-smith_2_14(); //z->t1(),z->lambda1()=>in.at(2)
-smith_2_45(); //z->t2(),z->lambda2()=>in.at(2)
-smith_1_14(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_14); //z->t1(),z->lambda1()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_45); //z->t2(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_14); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_17(); //z->t2(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_17); //z->t2(),z->lambda1()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsd_t1_2_44",z->mem());
 offset_smith_1_44();
-smith_2_44(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_44(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_44); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_44); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_14(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_14,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_6",z->mem());
 offset_smith_0_16();
-smith_1_16(); //z->t2(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_16); //z->t2(),z->lambda1()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsd_t1_2_0",z->mem());
 offset_smith_1_37();
 in.at(3)=new Tensor("lambda_ccsd_t1_3_37",z->mem());
 offset_smith_2_37();
-smith_3_37(); //z->t1(),z->lambda2()=>in.at(3)
-smith_2_37(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_3_37); //z->t1(),z->lambda2()=>in.at(3)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_37); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_42(); //z->t2(),z->lambda2()=>in.at(2)
-smith_1_37(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_42); //z->t2(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_37); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsd_t1_2_41",z->mem());
 offset_smith_1_41();
-smith_2_41(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_41(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_41); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_41); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsd_t1_2_43",z->mem());
 offset_smith_1_43();
-smith_2_43(); //z->t2(),z->lambda2()=>in.at(2)
-smith_1_43(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_43); //z->t2(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_43); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_16(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_16,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_7",z->mem());
 offset_smith_0_18();
-smith_0_18_0(); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_18_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsd_t1_2_0",z->mem());
 offset_smith_1_18();
-smith_1_18_0(); //z->f1()=>in.at(2)
-smith_2_40(); //z->t1(),z->v2()=>in.at(2)
-smith_1_18(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_18_0); //z->f1()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_40); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_18); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsd_t1_2_1",z->mem());
 offset_smith_1_23();
-smith_1_23_0(); //z->v2()=>in.at(2)
-smith_2_27(); //z->t1(),z->v2()=>in.at(2)
-smith_1_23(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_23_0); //z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_27); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_23); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsd_t1_2_2",z->mem());
 offset_smith_1_26();
 in.at(3)=new Tensor("lambda_ccsd_t1_3_0",z->mem());
 offset_smith_2_26();
-smith_2_26_0(); //z->v2()=>in.at(3)
-smith_3_36(); //z->t1(),z->v2()=>in.at(3)
-smith_2_26(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_26_0); //z->v2()=>in.at(3)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_3_36); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_26); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_38(); //z->t2(),z->v2()=>in.at(2)
-smith_1_26(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_38); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_26); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsd_t1_2_3",z->mem());
 offset_smith_1_30();
-smith_1_30_0(); //z->v2()=>in.at(2)
-smith_2_39(); //z->t1(),z->v2()=>in.at(2)
-smith_1_30(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_30_0); //z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_39); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_30); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_31(); //z->t2(),z->v2()=>in.at(1)
-smith_0_18(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_31); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_18,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
-smith_0_21(out); //z->lambda2(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_21,out); //z->lambda2(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsd_t1_1_22",z->mem());
 offset_smith_0_22();
-smith_1_22(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_22(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_22); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_22,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_24",z->mem());
 offset_smith_0_24();
-smith_1_24(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_24(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_24); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_24,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_25",z->mem());
 offset_smith_0_25();
-smith_1_25(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_25(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_25); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_25,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_8",z->mem());
 offset_smith_0_28();
 in.at(2)=new Tensor("lambda_ccsd_t1_2_28",z->mem());
 offset_smith_1_28();
-smith_2_28(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_28(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_28); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_28); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_32(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_28(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_32); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_28,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t1_1_9",z->mem());
 offset_smith_0_29();
 in.at(2)=new Tensor("lambda_ccsd_t1_2_29",z->mem());
 offset_smith_1_29();
-smith_2_29(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_29(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_2_29); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_29); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_33(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_29(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T1::smith_1_33); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T1::smith_0_29,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -236,7 +236,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_10(Ref<Tensor>& out){ 
@@ -302,7 +302,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_10(){ 
@@ -322,7 +322,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_11(Ref<Tensor>& out){ 
@@ -388,7 +388,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_11(){ 
@@ -408,7 +408,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_14(Ref<Tensor>& out){ 
@@ -482,7 +482,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_14(){ 
@@ -502,7 +502,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_16(Ref<Tensor>& out){ 
@@ -573,7 +573,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_16(){ 
@@ -597,7 +597,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_18(Ref<Tensor>& out){ 
@@ -668,7 +668,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_18_0(){ 
@@ -709,7 +709,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_18(){ 
@@ -733,7 +733,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_2(Ref<Tensor>& out){ 
@@ -807,7 +807,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_21(Ref<Tensor>& out){ 
@@ -878,7 +878,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_22(Ref<Tensor>& out){ 
@@ -949,7 +949,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_22(){ 
@@ -973,7 +973,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_24(Ref<Tensor>& out){ 
@@ -1041,7 +1041,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_24(){ 
@@ -1065,7 +1065,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_25(Ref<Tensor>& out){ 
@@ -1136,7 +1136,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_25(){ 
@@ -1160,7 +1160,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_28(Ref<Tensor>& out){ 
@@ -1231,7 +1231,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_28(){ 
@@ -1255,7 +1255,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_29(Ref<Tensor>& out){ 
@@ -1323,7 +1323,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_29(){ 
@@ -1347,7 +1347,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_3(Ref<Tensor>& out){ 
@@ -1405,7 +1405,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_3_0(){ 
@@ -1442,7 +1442,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_3(){ 
@@ -1462,7 +1462,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_4(Ref<Tensor>& out){ 
@@ -1520,7 +1520,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_4_0(){ 
@@ -1557,7 +1557,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_4(){ 
@@ -1577,7 +1577,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_6(Ref<Tensor>& out){ 
@@ -1635,7 +1635,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_0_6(){ 
@@ -1655,7 +1655,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_0_7(Ref<Tensor>& out){ 
@@ -1715,7 +1715,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_10(){ 
@@ -1773,7 +1773,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_11(){ 
@@ -1831,7 +1831,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_13(){ 
@@ -1889,7 +1889,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_13(){ 
@@ -1909,7 +1909,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_14(){ 
@@ -1967,7 +1967,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_14(){ 
@@ -1987,7 +1987,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_15(){ 
@@ -2064,7 +2064,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_16(){ 
@@ -2132,7 +2132,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_17(){ 
@@ -2206,7 +2206,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_18(){ 
@@ -2274,7 +2274,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_18_0(){ 
@@ -2311,7 +2311,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_18(){ 
@@ -2331,7 +2331,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_19(){ 
@@ -2408,7 +2408,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_22(){ 
@@ -2476,7 +2476,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_23(){ 
@@ -2549,7 +2549,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_23_0(){ 
@@ -2590,7 +2590,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_23(){ 
@@ -2614,7 +2614,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_24(){ 
@@ -2682,7 +2682,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_25(){ 
@@ -2750,7 +2750,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_26(){ 
@@ -2818,7 +2818,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_26(){ 
@@ -2842,7 +2842,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_28(){ 
@@ -2915,7 +2915,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_28(){ 
@@ -2939,7 +2939,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_29(){ 
@@ -3007,7 +3007,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_29(){ 
@@ -3031,7 +3031,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_30(){ 
@@ -3126,7 +3126,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_30_0(){ 
@@ -3167,7 +3167,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_30(){ 
@@ -3191,7 +3191,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_31(){ 
@@ -3258,7 +3258,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_32(){ 
@@ -3325,7 +3325,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_33(){ 
@@ -3417,7 +3417,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_34(){ 
@@ -3494,7 +3494,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_35(){ 
@@ -3571,7 +3571,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_37(){ 
@@ -3639,7 +3639,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_37(){ 
@@ -3663,7 +3663,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_41(){ 
@@ -3758,7 +3758,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_41(){ 
@@ -3782,7 +3782,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_43(){ 
@@ -3853,7 +3853,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_43(){ 
@@ -3873,7 +3873,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_44(){ 
@@ -3944,7 +3944,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_44(){ 
@@ -3968,7 +3968,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_5(){ 
@@ -4026,7 +4026,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_5_0(){ 
@@ -4063,7 +4063,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_1_5(){ 
@@ -4083,7 +4083,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_6(){ 
@@ -4141,7 +4141,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_8(){ 
@@ -4207,7 +4207,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_1_9(){ 
@@ -4273,7 +4273,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_12(){ 
@@ -4347,7 +4347,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_13(){ 
@@ -4421,7 +4421,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_14(){ 
@@ -4479,7 +4479,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_26(){ 
@@ -4552,7 +4552,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_26_0(){ 
@@ -4593,7 +4593,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_2_26(){ 
@@ -4617,7 +4617,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_27(){ 
@@ -4685,7 +4685,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_28(){ 
@@ -4753,7 +4753,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_29(){ 
@@ -4821,7 +4821,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_37(){ 
@@ -4894,7 +4894,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::offset_smith_2_37(){ 
@@ -4918,7 +4918,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_38(){ 
@@ -4985,7 +4985,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_39(){ 
@@ -5053,7 +5053,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_40(){ 
@@ -5127,7 +5127,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_41(){ 
@@ -5195,7 +5195,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_42(){ 
@@ -5262,7 +5262,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_43(){ 
@@ -5339,7 +5339,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_44(){ 
@@ -5407,7 +5407,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_2_45(){ 
@@ -5484,7 +5484,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_3_36(){ 
@@ -5552,7 +5552,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T1::smith_3_37(){ 
@@ -5620,5 +5620,5 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
@@ -42,109 +42,109 @@ void LAMBDA_CCSD_T2::compute_amp(Ref<Tensor>& out){ //k_i0_offset,z->f1(),z->in.
   
 in.resize(8);
   
-smith_0_1(out); //z->v2()=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_1,out); //z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsd_t2_1_0",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_5(); //z->t1(),z->v2()=>in.at(1)
-smith_0_2(out); //z->lambda1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_5); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_2,out); //z->lambda1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_1",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->v2()=>in.at(1)
-smith_1_6(); //z->t1(),z->v2()=>in.at(1)
-smith_0_3(out); //z->lambda1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_3_0); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_6); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_3,out); //z->lambda1(),in.at(1)=>out
 delete in.at(1);
-smith_0_4(out); //z->lambda1(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_4,out); //z->lambda1(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsd_t2_1_2",z->mem());
 offset_smith_0_7();
-smith_1_7(); //z->t1(),z->lambda1()=>in.at(1)
-smith_1_32(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_7(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_7); //z->t1(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_32); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_7,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_3",z->mem());
 offset_smith_0_8();
-smith_0_8_0(); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_8_0); //z->f1()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsd_t2_2_0",z->mem());
 offset_smith_1_10();
-smith_1_10_0(); //z->f1()=>in.at(2)
-smith_2_21(); //z->t1(),z->v2()=>in.at(2)
-smith_1_10(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_10_0); //z->f1()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_2_21); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_10); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_15(); //z->t1(),z->v2()=>in.at(1)
-smith_1_26(); //z->t2(),z->v2()=>in.at(1)
-smith_0_8(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_15); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_26); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_8,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_4",z->mem());
 offset_smith_0_9();
-smith_0_9_0(); //z->f1()=>in.at(1)
-smith_1_17(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_9_0); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_17); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsd_t2_2_23",z->mem());
 offset_smith_1_23();
-smith_2_23(); //z->t1(),z->v2()=>in.at(2)
-smith_1_23(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_2_23); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_23); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_28(); //z->t2(),z->v2()=>in.at(1)
-smith_0_9(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_28); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_9,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_11",z->mem());
 offset_smith_0_11();
-smith_1_11(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_11(out); //z->f1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_11); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_11,out); //z->f1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_5",z->mem());
 offset_smith_0_12();
-smith_0_12_0(); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_12_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsd_t2_2_0",z->mem());
 offset_smith_1_16();
-smith_1_16_0(); //z->v2()=>in.at(2)
-smith_2_22(); //z->t1(),z->v2()=>in.at(2)
-smith_1_16(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_16_0); //z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_2_22); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_16); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_27(); //z->t2(),z->v2()=>in.at(1)
-smith_0_12(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_27); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_12,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_6",z->mem());
 offset_smith_0_13();
-smith_0_13_0(); //z->v2()=>in.at(1)
-smith_1_19(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_13_0); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_19); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsd_t2_2_24",z->mem());
 offset_smith_1_24();
-smith_2_24(); //z->t1(),z->v2()=>in.at(2)
-smith_1_24(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_2_24); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_24); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_13(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_13,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
-smith_0_14(out); //z->lambda2(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_14,out); //z->lambda2(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsd_t2_1_18",z->mem());
 offset_smith_0_18();
-smith_1_18(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_18(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_18); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_18,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_20",z->mem());
 offset_smith_0_20();
-smith_1_20(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_20(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_20); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_20,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_7",z->mem());
 offset_smith_0_25();
 in.at(2)=new Tensor("lambda_ccsd_t2_2_25",z->mem());
 offset_smith_1_25();
-smith_2_25(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_25(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_2_25); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_25); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_31(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_25(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_31); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_25,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_29",z->mem());
 offset_smith_0_29();
-smith_1_29(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_29(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_29); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_29,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsd_t2_1_30",z->mem());
 offset_smith_0_30();
-smith_1_30(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_30(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSD_T2::smith_1_30); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSD_T2::smith_0_30,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -187,7 +187,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_11(Ref<Tensor>& out){ 
@@ -260,7 +260,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_11(){ 
@@ -284,7 +284,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_12(Ref<Tensor>& out){ 
@@ -351,7 +351,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_12_0(){ 
@@ -392,7 +392,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_12(){ 
@@ -416,7 +416,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_13(Ref<Tensor>& out){ 
@@ -519,7 +519,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_13_0(){ 
@@ -560,7 +560,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_13(){ 
@@ -584,7 +584,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_14(Ref<Tensor>& out){ 
@@ -651,7 +651,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_18(Ref<Tensor>& out){ 
@@ -752,7 +752,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_18(){ 
@@ -776,7 +776,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_2(Ref<Tensor>& out){ 
@@ -861,7 +861,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_20(Ref<Tensor>& out){ 
@@ -925,7 +925,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_20(){ 
@@ -949,7 +949,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_25(Ref<Tensor>& out){ 
@@ -1016,7 +1016,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_25(){ 
@@ -1040,7 +1040,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_29(Ref<Tensor>& out){ 
@@ -1143,7 +1143,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_29(){ 
@@ -1167,7 +1167,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_2_0(){ 
@@ -1204,7 +1204,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_2(){ 
@@ -1224,7 +1224,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_3(Ref<Tensor>& out){ 
@@ -1297,7 +1297,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_30(Ref<Tensor>& out){ 
@@ -1376,7 +1376,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_30(){ 
@@ -1396,7 +1396,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_3_0(){ 
@@ -1437,7 +1437,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_3(){ 
@@ -1461,7 +1461,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_4(Ref<Tensor>& out){ 
@@ -1534,7 +1534,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_7(Ref<Tensor>& out){ 
@@ -1613,7 +1613,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_7(){ 
@@ -1633,7 +1633,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_8(Ref<Tensor>& out){ 
@@ -1712,7 +1712,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_8_0(){ 
@@ -1749,7 +1749,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_8(){ 
@@ -1769,7 +1769,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_9(Ref<Tensor>& out){ 
@@ -1848,7 +1848,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_0_9_0(){ 
@@ -1885,7 +1885,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_0_9(){ 
@@ -1905,7 +1905,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_10(){ 
@@ -1963,7 +1963,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_10_0(){ 
@@ -2000,7 +2000,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_1_10(){ 
@@ -2020,7 +2020,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_11(){ 
@@ -2088,7 +2088,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_15(){ 
@@ -2154,7 +2154,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_16(){ 
@@ -2227,7 +2227,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_16_0(){ 
@@ -2268,7 +2268,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_1_16(){ 
@@ -2292,7 +2292,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_17(){ 
@@ -2358,7 +2358,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_18(){ 
@@ -2426,7 +2426,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_19(){ 
@@ -2494,7 +2494,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_20(){ 
@@ -2562,7 +2562,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_23(){ 
@@ -2620,7 +2620,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_1_23(){ 
@@ -2640,7 +2640,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_24(){ 
@@ -2708,7 +2708,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_1_24(){ 
@@ -2732,7 +2732,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_25(){ 
@@ -2805,7 +2805,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::offset_smith_1_25(){ 
@@ -2829,7 +2829,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_26(){ 
@@ -2906,7 +2906,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_27(){ 
@@ -2973,7 +2973,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_28(){ 
@@ -3050,7 +3050,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_29(){ 
@@ -3142,7 +3142,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_30(){ 
@@ -3219,7 +3219,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_31(){ 
@@ -3286,7 +3286,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_32(){ 
@@ -3363,7 +3363,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_5(){ 
@@ -3437,7 +3437,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_6(){ 
@@ -3505,7 +3505,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_1_7(){ 
@@ -3563,7 +3563,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_2_21(){ 
@@ -3637,7 +3637,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_2_22(){ 
@@ -3705,7 +3705,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_2_23(){ 
@@ -3779,7 +3779,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_2_24(){ 
@@ -3847,7 +3847,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSD_T2::smith_2_25(){ 
@@ -3915,5 +3915,5 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
@@ -42,235 +42,235 @@ void LAMBDA_CCSDPR12_T1::compute_amp(Ref<Tensor>& out){ //k_i0_offset,z->gt2(),z
   
 in.resize(8);
   
-smith_0_1(out); //z->t1(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_1,out); //z->t1(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_0",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->f1()=>in.at(1)
-smith_1_5(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_2_0); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_5); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_9",z->mem());
 offset_smith_1_9();
-smith_2_9(); //z->t1(),z->v2()=>in.at(2)
-smith_1_9(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_9); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_9); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_12(); //z->t2(),z->v2()=>in.at(1)
-smith_1_15(); //z->gt2(),z->vr2()=>in.at(1)
-smith_0_2(out); //z->lambda1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_12); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_15); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_2,out); //z->lambda1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_1",z->mem());
 offset_smith_0_3();
-smith_0_3_0(); //z->f1()=>in.at(1)
-smith_1_6(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_3_0); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_6); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_10",z->mem());
 offset_smith_1_10();
-smith_2_10(); //z->t1(),z->v2()=>in.at(2)
-smith_1_10(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_10); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_10); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_3(out); //z->lambda1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_3,out); //z->lambda1(),in.at(1)=>out
 delete in.at(1);
-smith_0_4(out); //z->lambda1(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_4,out); //z->lambda1(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_2",z->mem());
 offset_smith_0_7();
-smith_1_7(); //z->t1(),z->lambda1()=>in.at(1)
-smith_1_37(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_7(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_7); //z->t1(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_37); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_7,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_3",z->mem());
 offset_smith_0_8();
-smith_1_8(); //z->t1(),z->lambda1()=>in.at(1)
-smith_1_38(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_8(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_8); //z->t1(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_38); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_8,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_4",z->mem());
 offset_smith_0_11();
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_0",z->mem());
 offset_smith_1_11();
-smith_2_11(); //z->t1(),z->lambda1()=>in.at(2)
-smith_2_57(); //z->t2(),z->lambda2()=>in.at(2)
-smith_1_11(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_11); //z->t1(),z->lambda1()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_57); //z->t2(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_11); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_14(); //z->t2(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_14); //z->t2(),z->lambda1()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_56",z->mem());
 offset_smith_1_56();
-smith_2_56(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_56(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_56); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_56); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_11(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_11,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_5",z->mem());
 offset_smith_0_13();
-smith_1_13(); //z->t2(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_13); //z->t2(),z->lambda1()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_0",z->mem());
 offset_smith_1_49();
 in.at(3)=new Tensor("lambda_ccsdpr12_t1_3_49",z->mem());
 offset_smith_2_49();
-smith_3_49(); //z->t1(),z->lambda2()=>in.at(3)
-smith_2_49(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_3_49); //z->t1(),z->lambda2()=>in.at(3)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_49); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_54(); //z->t2(),z->lambda2()=>in.at(2)
-smith_1_49(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_54); //z->t2(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_49); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_53",z->mem());
 offset_smith_1_53();
-smith_2_53(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_53(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_53); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_53); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_55",z->mem());
 offset_smith_1_55();
-smith_2_55(); //z->t2(),z->lambda2()=>in.at(2)
-smith_1_55(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_55); //z->t2(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_55); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_13(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_13,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_6",z->mem());
 offset_smith_0_16();
-smith_1_16(); //z->lambda1(),z->qy()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_16); //z->lambda1(),z->qy()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_61",z->mem());
 offset_smith_1_61();
-smith_2_61(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_61(); //z->qy(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_61); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_61); //z->qy(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_16(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_16,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_7",z->mem());
 offset_smith_0_17();
-smith_1_17(); //z->lambda1(),z->qy()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_17); //z->lambda1(),z->qy()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_62",z->mem());
 offset_smith_1_62();
-smith_2_62(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_62(); //z->qy(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_62); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_62); //z->qy(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_17(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_17,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_8",z->mem());
 offset_smith_0_18();
-smith_0_18_0(); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_18_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_0",z->mem());
 offset_smith_1_23();
-smith_1_23_0(); //z->v2()=>in.at(2)
-smith_2_30(); //z->t1(),z->v2()=>in.at(2)
-smith_1_23(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_23_0); //z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_30); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_23); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_1",z->mem());
 offset_smith_1_29();
 in.at(3)=new Tensor("lambda_ccsdpr12_t1_3_0",z->mem());
 offset_smith_2_29();
-smith_2_29_0(); //z->v2()=>in.at(3)
-smith_3_48(); //z->t1(),z->v2()=>in.at(3)
-smith_2_29(); //z->t1(),in.at(3)=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_29_0); //z->v2()=>in.at(3)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_3_48); //z->t1(),z->v2()=>in.at(3)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_29); //z->t1(),in.at(3)=>in.at(2)
 delete in.at(3);
-smith_2_50(); //z->t2(),z->v2()=>in.at(2)
-smith_2_58(); //z->gt2(),z->vr2()=>in.at(2)
-smith_1_29(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_50); //z->t2(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_58); //z->gt2(),z->vr2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_29); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_2",z->mem());
 offset_smith_1_33();
-smith_1_33_0(); //z->v2()=>in.at(2)
-smith_2_51(); //z->t1(),z->v2()=>in.at(2)
-smith_1_33(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_33_0); //z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_51); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_33); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_34(); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_34); //z->t2(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_3",z->mem());
 offset_smith_1_39();
-smith_1_39_0(); //z->v2()=>in.at(2)
-smith_2_59(); //z->t1(),z->v2()=>in.at(2)
-smith_1_39(); //z->qy(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_39_0); //z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_59); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_39); //z->qy(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_40(); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_40); //z->gt2(),z->vr2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_52",z->mem());
 offset_smith_1_52();
-smith_2_52(); //z->t1(),z->v2()=>in.at(2)
-smith_1_52(); //z->t2(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_52); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_52); //z->t2(),in.at(2)=>in.at(1)
 delete in.at(2);
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_60",z->mem());
 offset_smith_1_60();
-smith_2_60(); //z->t1(),z->v2()=>in.at(2)
-smith_1_60(); //z->qy(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_60); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_60); //z->qy(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_0_18(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_18,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
-smith_0_19(out); //z->lambda2(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_19,out); //z->lambda2(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_9",z->mem());
 offset_smith_0_20();
-smith_0_20_0(); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_20_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_0",z->mem());
 offset_smith_1_26();
-smith_1_26_0(); //z->v2()=>in.at(2)
-smith_2_43(); //z->t1(),z->v2()=>in.at(2)
-smith_1_26(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_26_0); //z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_43); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_26); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_45(); //z->t2(),z->v2()=>in.at(1)
-smith_0_20(out); //z->ly(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_45); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_20,out); //z->ly(),in.at(1)=>out
 delete in.at(1);
-smith_0_21(out); //z->glambda2(),z->vd2()=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_21,out); //z->glambda2(),z->vd2()=>out
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_22",z->mem());
 offset_smith_0_22();
-smith_1_22(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_22(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_22); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_22,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_24",z->mem());
 offset_smith_0_24();
-smith_1_24(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_24(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_24); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_24,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_25",z->mem());
 offset_smith_0_25();
-smith_1_25(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_25(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_25); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_25,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_27",z->mem());
 offset_smith_0_27();
-smith_1_27(); //z->t1(),z->ly()=>in.at(1)
-smith_0_27(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_27); //z->t1(),z->ly()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_27,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_28",z->mem());
 offset_smith_0_28();
-smith_1_28(); //z->t1(),z->glambda2()=>in.at(1)
-smith_0_28(out); //z->vd2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_28); //z->t1(),z->glambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_28,out); //z->vd2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_10",z->mem());
 offset_smith_0_31();
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_31",z->mem());
 offset_smith_1_31();
-smith_2_31(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_31(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_31); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_31); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_35(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_31(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_35); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_31,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_11",z->mem());
 offset_smith_0_32();
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_32",z->mem());
 offset_smith_1_32();
-smith_2_32(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_32(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_32); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_32); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_36(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_32(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_36); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_32,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_41",z->mem());
 offset_smith_0_41();
-smith_1_41(); //z->lambda2(),z->qy()=>in.at(1)
-smith_0_41(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_41); //z->lambda2(),z->qy()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_41,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_42",z->mem());
 offset_smith_0_42();
-smith_1_42(); //z->lambda2(),z->qy()=>in.at(1)
-smith_0_42(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_42); //z->lambda2(),z->qy()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_42,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_12",z->mem());
 offset_smith_0_44();
 in.at(2)=new Tensor("lambda_ccsdpr12_t1_2_44",z->mem());
 offset_smith_1_44();
-smith_2_44(); //z->t1(),z->ly()=>in.at(2)
-smith_1_44(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_2_44); //z->t1(),z->ly()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_44); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_46(); //z->t2(),z->ly()=>in.at(1)
-smith_0_44(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_46); //z->t2(),z->ly()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_44,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t1_1_47",z->mem());
 offset_smith_0_47();
-smith_1_47(); //z->t2(),z->ly()=>in.at(1)
-smith_0_47(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_1_47); //z->t2(),z->ly()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T1::smith_0_47,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -346,7 +346,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_11(Ref<Tensor>& out){ 
@@ -420,7 +420,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_11(){ 
@@ -440,7 +440,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_13(Ref<Tensor>& out){ 
@@ -511,7 +511,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_13(){ 
@@ -535,7 +535,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_16(Ref<Tensor>& out){ 
@@ -600,7 +600,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_16(){ 
@@ -624,7 +624,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_17(Ref<Tensor>& out){ 
@@ -690,7 +690,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_17(){ 
@@ -710,7 +710,7 @@ for (long q4b=z->noab()+z->nvab();q4b<z->nab();++q4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_18(Ref<Tensor>& out){ 
@@ -781,7 +781,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_18_0(){ 
@@ -822,7 +822,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_18(){ 
@@ -846,7 +846,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_19(Ref<Tensor>& out){ 
@@ -917,7 +917,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_2(Ref<Tensor>& out){ 
@@ -975,7 +975,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_20(Ref<Tensor>& out){ 
@@ -1040,7 +1040,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_20_0(){ 
@@ -1081,7 +1081,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_20(){ 
@@ -1105,7 +1105,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_21(Ref<Tensor>& out){ 
@@ -1176,7 +1176,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_22(Ref<Tensor>& out){ 
@@ -1247,7 +1247,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_22(){ 
@@ -1271,7 +1271,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_24(Ref<Tensor>& out){ 
@@ -1339,7 +1339,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_24(){ 
@@ -1363,7 +1363,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_25(Ref<Tensor>& out){ 
@@ -1434,7 +1434,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_25(){ 
@@ -1458,7 +1458,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_27(Ref<Tensor>& out){ 
@@ -1526,7 +1526,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_27(){ 
@@ -1550,7 +1550,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_28(Ref<Tensor>& out){ 
@@ -1621,7 +1621,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_28(){ 
@@ -1645,7 +1645,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_2_0(){ 
@@ -1682,7 +1682,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_2(){ 
@@ -1702,7 +1702,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_3(Ref<Tensor>& out){ 
@@ -1760,7 +1760,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_31(Ref<Tensor>& out){ 
@@ -1831,7 +1831,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_31(){ 
@@ -1855,7 +1855,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_32(Ref<Tensor>& out){ 
@@ -1923,7 +1923,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_32(){ 
@@ -1947,7 +1947,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_3_0(){ 
@@ -1984,7 +1984,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_3(){ 
@@ -2004,7 +2004,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_4(Ref<Tensor>& out){ 
@@ -2064,7 +2064,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_41(Ref<Tensor>& out){ 
@@ -2126,7 +2126,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_41(){ 
@@ -2150,7 +2150,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_42(Ref<Tensor>& out){ 
@@ -2210,7 +2210,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_42(){ 
@@ -2230,7 +2230,7 @@ for (long q4b=z->noab()+z->nvab();q4b<z->nab();++q4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_44(Ref<Tensor>& out){ 
@@ -2298,7 +2298,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_44(){ 
@@ -2322,7 +2322,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_47(Ref<Tensor>& out){ 
@@ -2388,7 +2388,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_47(){ 
@@ -2408,7 +2408,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_7(Ref<Tensor>& out){ 
@@ -2474,7 +2474,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_7(){ 
@@ -2494,7 +2494,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_0_8(Ref<Tensor>& out){ 
@@ -2560,7 +2560,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_0_8(){ 
@@ -2580,7 +2580,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_10(){ 
@@ -2638,7 +2638,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_10(){ 
@@ -2658,7 +2658,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_11(){ 
@@ -2716,7 +2716,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_11(){ 
@@ -2736,7 +2736,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_12(){ 
@@ -2813,7 +2813,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_13(){ 
@@ -2881,7 +2881,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_14(){ 
@@ -2955,7 +2955,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_15(){ 
@@ -3032,7 +3032,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_16(){ 
@@ -3094,7 +3094,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_17(){ 
@@ -3160,7 +3160,7 @@ for (long q4b=z->noab()+z->nvab();q4b<z->nab();++q4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_22(){ 
@@ -3228,7 +3228,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_23(){ 
@@ -3301,7 +3301,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_23_0(){ 
@@ -3342,7 +3342,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_23(){ 
@@ -3366,7 +3366,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_24(){ 
@@ -3434,7 +3434,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_25(){ 
@@ -3502,7 +3502,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_26(){ 
@@ -3575,7 +3575,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_26_0(){ 
@@ -3616,7 +3616,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_26(){ 
@@ -3640,7 +3640,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_27(){ 
@@ -3702,7 +3702,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_28(){ 
@@ -3770,7 +3770,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_29(){ 
@@ -3838,7 +3838,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_29(){ 
@@ -3862,7 +3862,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_31(){ 
@@ -3935,7 +3935,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_31(){ 
@@ -3959,7 +3959,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_32(){ 
@@ -4027,7 +4027,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_32(){ 
@@ -4051,7 +4051,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_33(){ 
@@ -4146,7 +4146,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_33_0(){ 
@@ -4187,7 +4187,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_33(){ 
@@ -4211,7 +4211,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_34(){ 
@@ -4278,7 +4278,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_35(){ 
@@ -4345,7 +4345,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_36(){ 
@@ -4437,7 +4437,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_37(){ 
@@ -4514,7 +4514,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_38(){ 
@@ -4591,7 +4591,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_39(){ 
@@ -4678,7 +4678,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_39_0(){ 
@@ -4719,7 +4719,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_39(){ 
@@ -4743,7 +4743,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_40(){ 
@@ -4810,7 +4810,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_41(){ 
@@ -4894,7 +4894,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_42(){ 
@@ -4965,7 +4965,7 @@ for (long q4b=z->noab()+z->nvab();q4b<z->nab();++q4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_44(){ 
@@ -5033,7 +5033,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_44(){ 
@@ -5057,7 +5057,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_45(){ 
@@ -5124,7 +5124,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_46(){ 
@@ -5208,7 +5208,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_47(){ 
@@ -5279,7 +5279,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_49(){ 
@@ -5347,7 +5347,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_49(){ 
@@ -5371,7 +5371,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_5(){ 
@@ -5437,7 +5437,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_52(){ 
@@ -5505,7 +5505,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_52(){ 
@@ -5525,7 +5525,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_53(){ 
@@ -5620,7 +5620,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_53(){ 
@@ -5644,7 +5644,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_55(){ 
@@ -5715,7 +5715,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_55(){ 
@@ -5735,7 +5735,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_56(){ 
@@ -5806,7 +5806,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_56(){ 
@@ -5830,7 +5830,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_6(){ 
@@ -5896,7 +5896,7 @@ for (long p3b=z->noab();p3b<z->noab()+z->nvab();++p3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_60(){ 
@@ -5958,7 +5958,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_60(){ 
@@ -5978,7 +5978,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_61(){ 
@@ -6065,7 +6065,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_61(){ 
@@ -6089,7 +6089,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_62(){ 
@@ -6154,7 +6154,7 @@ for (long q4b=z->noab()+z->nvab();q4b<z->nab();++q4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_62(){ 
@@ -6178,7 +6178,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_7(){ 
@@ -6236,7 +6236,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_8(){ 
@@ -6294,7 +6294,7 @@ for (long p4b=z->noab();p4b<z->noab()+z->nvab();++p4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_1_9(){ 
@@ -6352,7 +6352,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_1_9(){ 
@@ -6372,7 +6372,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_10(){ 
@@ -6446,7 +6446,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_11(){ 
@@ -6504,7 +6504,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_29(){ 
@@ -6577,7 +6577,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_29_0(){ 
@@ -6618,7 +6618,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_2_29(){ 
@@ -6642,7 +6642,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_30(){ 
@@ -6710,7 +6710,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_31(){ 
@@ -6778,7 +6778,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_32(){ 
@@ -6846,7 +6846,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_43(){ 
@@ -6914,7 +6914,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_44(){ 
@@ -6976,7 +6976,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_49(){ 
@@ -7049,7 +7049,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::offset_smith_2_49(){ 
@@ -7073,7 +7073,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
 } 
 in[3]->set_filesize(size); 
 in[3]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_50(){ 
@@ -7140,7 +7140,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_51(){ 
@@ -7208,7 +7208,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_52(){ 
@@ -7282,7 +7282,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_53(){ 
@@ -7350,7 +7350,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_54(){ 
@@ -7417,7 +7417,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_55(){ 
@@ -7494,7 +7494,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_56(){ 
@@ -7562,7 +7562,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_57(){ 
@@ -7639,7 +7639,7 @@ for (long h5b=0L;h5b<z->noab();++h5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_58(){ 
@@ -7706,7 +7706,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_59(){ 
@@ -7768,7 +7768,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_60(){ 
@@ -7834,7 +7834,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_61(){ 
@@ -7902,7 +7902,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_62(){ 
@@ -7970,7 +7970,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_2_9(){ 
@@ -8044,7 +8044,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_3_48(){ 
@@ -8112,7 +8112,7 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T1::smith_3_49(){ 
@@ -8180,5 +8180,5 @@ for (long h2b=0L;h2b<z->noab();++h2b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
@@ -42,129 +42,129 @@ void LAMBDA_CCSDPR12_T2::compute_amp(Ref<Tensor>& out){ //k_i0_offset,z->gt2(),z
   
 in.resize(8);
   
-smith_0_1(out); //z->v2()=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_1,out); //z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_0",z->mem());
 offset_smith_0_2();
-smith_0_2_0(); //z->v2()=>in.at(1)
-smith_1_5(); //z->t1(),z->v2()=>in.at(1)
-smith_0_2(out); //z->lambda1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_2_0); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_5); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_2,out); //z->lambda1(),in.at(1)=>out
 delete in.at(1);
-smith_0_3(out); //z->lambda1(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_3,out); //z->lambda1(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_4",z->mem());
 offset_smith_0_4();
-smith_1_4(); //z->t1(),z->v2()=>in.at(1)
-smith_0_4(out); //z->lambda1(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_4); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_4,out); //z->lambda1(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_1",z->mem());
 offset_smith_0_6();
-smith_1_6(); //z->t1(),z->lambda1()=>in.at(1)
-smith_1_35(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_6(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_6); //z->t1(),z->lambda1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_35); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_6,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_2",z->mem());
 offset_smith_0_7();
-smith_0_7_0(); //z->f1()=>in.at(1)
-smith_1_15(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_7_0); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_15); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t2_2_24",z->mem());
 offset_smith_1_24();
-smith_2_24(); //z->t1(),z->v2()=>in.at(2)
-smith_1_24(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_2_24); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_24); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_29(); //z->t2(),z->v2()=>in.at(1)
-smith_1_36(); //z->gt2(),z->vr2()=>in.at(1)
-smith_0_7(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_29); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_36); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_7,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_3",z->mem());
 offset_smith_0_8();
-smith_0_8_0(); //z->f1()=>in.at(1)
-smith_1_17(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_8_0); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_17); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t2_2_26",z->mem());
 offset_smith_1_26();
-smith_2_26(); //z->t1(),z->v2()=>in.at(2)
-smith_1_26(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_2_26); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_26); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_31(); //z->t2(),z->v2()=>in.at(1)
-smith_1_38(); //z->qy(),z->v2()=>in.at(1)
-smith_0_8(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_31); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_38); //z->qy(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_8,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_4",z->mem());
 offset_smith_0_9();
-smith_0_9_0(); //z->f1()=>in.at(1)
-smith_1_21(); //z->t1(),z->v2()=>in.at(1)
-smith_0_9(out); //z->ly(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_9_0); //z->f1()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_21); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_9,out); //z->ly(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_5",z->mem());
 offset_smith_0_10();
-smith_0_10_0(); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_10_0); //z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t2_2_0",z->mem());
 offset_smith_1_16();
-smith_1_16_0(); //z->v2()=>in.at(2)
-smith_2_25(); //z->t1(),z->v2()=>in.at(2)
-smith_1_16(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_16_0); //z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_2_25); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_16); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_30(); //z->t2(),z->v2()=>in.at(1)
-smith_1_37(); //z->gt2(),z->vr2()=>in.at(1)
-smith_0_10(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_30); //z->t2(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_37); //z->gt2(),z->vr2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_10,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_6",z->mem());
 offset_smith_0_11();
-smith_0_11_0(); //z->v2()=>in.at(1)
-smith_1_19(); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_11_0); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_19); //z->t1(),z->v2()=>in.at(1)
 in.at(2)=new Tensor("lambda_ccsdpr12_t2_2_27",z->mem());
 offset_smith_1_27();
-smith_2_27(); //z->t1(),z->v2()=>in.at(2)
-smith_1_27(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_2_27); //z->t1(),z->v2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_27); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_39(); //z->qy(),z->v2()=>in.at(1)
-smith_0_11(out); //z->lambda2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_39); //z->qy(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_11,out); //z->lambda2(),in.at(1)=>out
 delete in.at(1);
-smith_0_12(out); //z->lambda2(),z->v2()=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_12,out); //z->lambda2(),z->v2()=>out
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_7",z->mem());
 offset_smith_0_13();
-smith_0_13_0(); //z->v2()=>in.at(1)
-smith_1_22(); //z->t1(),z->v2()=>in.at(1)
-smith_0_13(out); //z->ly(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_13_0); //z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_22); //z->t1(),z->v2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_13,out); //z->ly(),in.at(1)=>out
 delete in.at(1);
-smith_0_14(out); //z->glambda2(),z->vd2()=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_14,out); //z->glambda2(),z->vd2()=>out
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_18",z->mem());
 offset_smith_0_18();
-smith_1_18(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_18(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_18); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_18,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_20",z->mem());
 offset_smith_0_20();
-smith_1_20(); //z->t1(),z->lambda2()=>in.at(1)
-smith_0_20(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_20); //z->t1(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_20,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_23",z->mem());
 offset_smith_0_23();
-smith_1_23(); //z->t1(),z->ly()=>in.at(1)
-smith_0_23(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_23); //z->t1(),z->ly()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_23,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_8",z->mem());
 offset_smith_0_28();
 in.at(2)=new Tensor("lambda_ccsdpr12_t2_2_28",z->mem());
 offset_smith_1_28();
-smith_2_28(); //z->t1(),z->lambda2()=>in.at(2)
-smith_1_28(); //z->t1(),in.at(2)=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_2_28); //z->t1(),z->lambda2()=>in.at(2)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_28); //z->t1(),in.at(2)=>in.at(1)
 delete in.at(2);
-smith_1_34(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_28(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_34); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_28,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_32",z->mem());
 offset_smith_0_32();
-smith_1_32(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_32(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_32); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_32,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_33",z->mem());
 offset_smith_0_33();
-smith_1_33(); //z->t2(),z->lambda2()=>in.at(1)
-smith_0_33(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_33); //z->t2(),z->lambda2()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_33,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
 in.at(1)=new Tensor("lambda_ccsdpr12_t2_1_40",z->mem());
 offset_smith_0_40();
-smith_1_40(); //z->lambda2(),z->qy()=>in.at(1)
-smith_0_40(out); //z->v2(),in.at(1)=>out
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_1_40); //z->lambda2(),z->qy()=>in.at(1)
+z->parallel(this,&LAMBDA_CCSDPR12_T2::smith_0_40,out); //z->v2(),in.at(1)=>out
 delete in.at(1);
   
 }
@@ -207,7 +207,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_10(Ref<Tensor>& out){ 
@@ -274,7 +274,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_10_0(){ 
@@ -315,7 +315,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_10(){ 
@@ -339,7 +339,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_11(Ref<Tensor>& out){ 
@@ -442,7 +442,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_11_0(){ 
@@ -483,7 +483,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_11(){ 
@@ -507,7 +507,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_12(Ref<Tensor>& out){ 
@@ -574,7 +574,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_13(Ref<Tensor>& out){ 
@@ -669,7 +669,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_13_0(){ 
@@ -710,7 +710,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_13(){ 
@@ -734,7 +734,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_14(Ref<Tensor>& out){ 
@@ -801,7 +801,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_18(Ref<Tensor>& out){ 
@@ -902,7 +902,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_18(){ 
@@ -926,7 +926,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_2(Ref<Tensor>& out){ 
@@ -999,7 +999,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_20(Ref<Tensor>& out){ 
@@ -1063,7 +1063,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_20(){ 
@@ -1087,7 +1087,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_23(Ref<Tensor>& out){ 
@@ -1151,7 +1151,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_23(){ 
@@ -1175,7 +1175,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_28(Ref<Tensor>& out){ 
@@ -1242,7 +1242,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_28(){ 
@@ -1266,7 +1266,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_2_0(){ 
@@ -1307,7 +1307,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_2(){ 
@@ -1331,7 +1331,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_3(Ref<Tensor>& out){ 
@@ -1404,7 +1404,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_32(Ref<Tensor>& out){ 
@@ -1507,7 +1507,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_32(){ 
@@ -1531,7 +1531,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_33(Ref<Tensor>& out){ 
@@ -1610,7 +1610,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_33(){ 
@@ -1630,7 +1630,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_4(Ref<Tensor>& out){ 
@@ -1715,7 +1715,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_40(Ref<Tensor>& out){ 
@@ -1788,7 +1788,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_40(){ 
@@ -1808,7 +1808,7 @@ for (long q5b=z->noab()+z->nvab();q5b<z->nab();++q5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_4(){ 
@@ -1828,7 +1828,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_6(Ref<Tensor>& out){ 
@@ -1907,7 +1907,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_6(){ 
@@ -1927,7 +1927,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_7(Ref<Tensor>& out){ 
@@ -2006,7 +2006,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_7_0(){ 
@@ -2043,7 +2043,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_7(){ 
@@ -2063,7 +2063,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_8(Ref<Tensor>& out){ 
@@ -2142,7 +2142,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_8_0(){ 
@@ -2179,7 +2179,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_8(){ 
@@ -2199,7 +2199,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_9(Ref<Tensor>& out){ 
@@ -2272,7 +2272,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_0_9_0(){ 
@@ -2309,7 +2309,7 @@ for (long q5b=z->noab()+z->nvab();q5b<z->nab();++q5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_0_9(){ 
@@ -2329,7 +2329,7 @@ for (long q5b=z->noab()+z->nvab();q5b<z->nab();++q5b) {
 } 
 in[1]->set_filesize(size); 
 in[1]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_15(){ 
@@ -2395,7 +2395,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_16(){ 
@@ -2468,7 +2468,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_16_0(){ 
@@ -2509,7 +2509,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_1_16(){ 
@@ -2533,7 +2533,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_17(){ 
@@ -2599,7 +2599,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_18(){ 
@@ -2667,7 +2667,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_19(){ 
@@ -2735,7 +2735,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_20(){ 
@@ -2803,7 +2803,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_21(){ 
@@ -2869,7 +2869,7 @@ for (long q5b=z->noab()+z->nvab();q5b<z->nab();++q5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_22(){ 
@@ -2937,7 +2937,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_23(){ 
@@ -2999,7 +2999,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_24(){ 
@@ -3057,7 +3057,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_1_24(){ 
@@ -3077,7 +3077,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_26(){ 
@@ -3135,7 +3135,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_1_26(){ 
@@ -3155,7 +3155,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_27(){ 
@@ -3223,7 +3223,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_1_27(){ 
@@ -3247,7 +3247,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_28(){ 
@@ -3320,7 +3320,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::offset_smith_1_28(){ 
@@ -3344,7 +3344,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
 } 
 in[2]->set_filesize(size); 
 in[2]->createfile(); 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_29(){ 
@@ -3421,7 +3421,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_30(){ 
@@ -3488,7 +3488,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_31(){ 
@@ -3565,7 +3565,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_32(){ 
@@ -3657,7 +3657,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_33(){ 
@@ -3734,7 +3734,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_34(){ 
@@ -3801,7 +3801,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_35(){ 
@@ -3878,7 +3878,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_36(){ 
@@ -3955,7 +3955,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_37(){ 
@@ -4022,7 +4022,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_38(){ 
@@ -4087,7 +4087,7 @@ for (long p5b=z->noab();p5b<z->noab()+z->nvab();++p5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_39(){ 
@@ -4163,7 +4163,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_4(){ 
@@ -4237,7 +4237,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_40(){ 
@@ -4308,7 +4308,7 @@ for (long q5b=z->noab()+z->nvab();q5b<z->nab();++q5b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_5(){ 
@@ -4376,7 +4376,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_1_6(){ 
@@ -4434,7 +4434,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_2_24(){ 
@@ -4508,7 +4508,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_2_25(){ 
@@ -4576,7 +4576,7 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_2_26(){ 
@@ -4650,7 +4650,7 @@ for (long h6b=0L;h6b<z->noab();++h6b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_2_27(){ 
@@ -4718,7 +4718,7 @@ for (long h4b=0L;h4b<z->noab();++h4b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
   
 void LAMBDA_CCSDPR12_T2::smith_2_28(){ 
@@ -4786,5 +4786,5 @@ for (long h3b=0L;h3b<z->noab();++h3b) {
   } 
  } 
 } 
-z->mem()->sync(); 
+z->sync(); 
 } 
@@ -0,0 +1,210 @@
+//
+// sort_indices.cc
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#include <algorithm>
+#include <vector>
+#include <util/misc/scexception.h>
+#include <chemistry/qc/ccr12/sort_indices.h>
+
+using namespace sc;
+
+namespace {
+
+  // the tile edge of the blocked transposes; 16x16 doubles fit into L1
+  const long tblock = 16;
+
+  template <bool Acc>
+  inline void store(double& dest, double value) {
+    if (Acc) dest += value;
+    else     dest  = value;
+  }
+
+  // out[j] (+)= f * in[j], j < n
+  template <bool Acc>
+  inline void scale_copy(const double* in, double* out, long n, double f) {
+    for (long j = 0; j < n; ++j) store<Acc>(out[j], f * in[j]);
+  }
+
+  // out[c*ldout + r] (+)= f * in[r*ldin + c], r < nrow, c < ncol
+  template <bool Acc>
+  void transpose(const double* in, long ldin, double* out, long ldout,
+                 long nrow, long ncol, double f) {
+    for (long r0 = 0; r0 < nrow; r0 += tblock) {
+      const long rfence = std::min(r0 + tblock, nrow);
+      for (long c0 = 0; c0 < ncol; c0 += tblock) {
+        const long cfence = std::min(c0 + tblock, ncol);
+        for (long c = c0; c < cfence; ++c) {
+          const double* inc = in + c;
+          double* outc = out + c * ldout;
+          for (long r = r0; r < rfence; ++r)
+            store<Acc>(outc[r], f * inc[r * ldin]);
+        }
+      }
+    }
+  }
+
+  // rank-4 kernel for permutation (P0,P1,P2,P3)
+  template <int P0, int P1, int P2, int P3, bool Acc>
+  void sort4(const double* u, double* s, const long* n, double f) {
+    // strides of the input indices in u and s
+    const long is[4] = { n[1] * n[2] * n[3], n[2] * n[3], n[3], 1 };
+    long os[4];
+    os[P3] = 1;
+    os[P2] = n[P3];
+    os[P1] = n[P3] * n[P2];
+    os[P0] = n[P3] * n[P2] * n[P1];
+
+    if (P3 == 3) {
+      // the last index is the fastest in both
+      for (long x0 = 0; x0 < n[0]; ++x0)
+        for (long x1 = 0; x1 < n[1]; ++x1)
+          for (long x2 = 0; x2 < n[2]; ++x2)
+            scale_copy<Acc>(u + x0 * is[0] + x1 * is[1] + x2 * is[2],
+                            s + x0 * os[0] + x1 * os[1] + x2 * os[2], n[3], f);
+    }
+    else {
+      // transpose index P3 (fastest in s) with index 3 (fastest in u);
+      // A and B are the other two
+      const int A = (P3 == 0) ? 1 : 0;
+      const int B = (P3 == 2) ? 1 : 2;
+      for (long xa = 0; xa < n[A]; ++xa)
+        for (long xb = 0; xb < n[B]; ++xb)
+          transpose<Acc>(u + xa * is[A] + xb * is[B], is[P3],
+                         s + xa * os[A] + xb * os[B], os[3],
+                         n[P3], n[3], f);
+    }
+  }
+
+  // general kernel, any rank
+  template <bool Acc>
+  void sortn(const double* u, double* s, int rank, const long* n, const int* perm, double f) {
+    std::vector<long> is(rank), os(rank);
+    is[rank - 1] = 1;
+    for (int d = rank - 2; d >= 0; --d) is[d] = is[d + 1] * n[d + 1];
+    os[perm[rank - 1]] = 1;
+    for (int d = rank - 2; d >= 0; --d) os[perm[d]] = os[perm[d + 1]] * n[perm[d + 1]];
+
+    const int last = rank - 1;
+    const int q = perm[rank - 1];
+    // the indices over which the outer loops run
+    std::vector<int> outer;
+    for (int d = 0; d < last; ++d)
+      if (d != q) outer.push_back(d);
+    const int nouter = outer.size();
+
+    std::vector<long> x(nouter, 0L);
+    long ioff = 0L, ooff = 0L;
+    for (int d = 0; d < nouter; ++d)
+      if (n[outer[d]] == 0) return;
+    while (true) {
+      if (q == last)
+        scale_copy<Acc>(u + ioff, s + ooff, n[last], f);
+      else
+        transpose<Acc>(u + ioff, is[q], s + ooff, os[last], n[q], n[last], f);
+
+      // advance the outer indices
+      int d = nouter - 1;
+      for (; d >= 0; --d) {
+        const int dd = outer[d];
+        ++x[d];
+        ioff += is[dd];
+        ooff += os[dd];
+        if (x[d] < n[dd]) break;
+        ioff -= x[d] * is[dd];
+        ooff -= x[d] * os[dd];
+        x[d] = 0;
+      }
+      if (d < 0) break;
+    }
+  }
+
+  typedef void (*Sort4Kernel)(const double*, double*, const long*, double);
+
+  // kernels for all 24 permutations of 4 indices, indexed by 64*P0+16*P1+4*P2+P3
+  struct Sort4Table {
+    Sort4Kernel kernel[256][2];
+    Sort4Table() {
+      std::fill(&kernel[0][0], &kernel[0][0] + 512, (Sort4Kernel)0);
+#define SC_CCR12_SORT4(i,j,k,l) \
+      kernel[64*i+16*j+4*k+l][0] = &sort4<i,j,k,l,false>; \
+      kernel[64*i+16*j+4*k+l][1] = &sort4<i,j,k,l,true>;
+      SC_CCR12_SORT4(0,1,2,3) SC_CCR12_SORT4(0,1,3,2) SC_CCR12_SORT4(0,2,1,3)
+      SC_CCR12_SORT4(0,2,3,1) SC_CCR12_SORT4(0,3,1,2) SC_CCR12_SORT4(0,3,2,1)
+      SC_CCR12_SORT4(1,0,2,3) SC_CCR12_SORT4(1,0,3,2) SC_CCR12_SORT4(1,2,0,3)
+      SC_CCR12_SORT4(1,2,3,0) SC_CCR12_SORT4(1,3,0,2) SC_CCR12_SORT4(1,3,2,0)
+      SC_CCR12_SORT4(2,0,1,3) SC_CCR12_SORT4(2,0,3,1) SC_CCR12_SORT4(2,1,0,3)
+      SC_CCR12_SORT4(2,1,3,0) SC_CCR12_SORT4(2,3,0,1) SC_CCR12_SORT4(2,3,1,0)
+      SC_CCR12_SORT4(3,0,1,2) SC_CCR12_SORT4(3,0,2,1) SC_CCR12_SORT4(3,1,0,2)
+      SC_CCR12_SORT4(3,1,2,0) SC_CCR12_SORT4(3,2,0,1) SC_CCR12_SORT4(3,2,1,0)
+#undef SC_CCR12_SORT4
+    }
+  };
+  const Sort4Table sort4_table;
+
+}
+
+void
+sc::sort_indices(const double* unsorted, double* sorted,
+                 int rank, const long* dims, const int* perm,
+                 double factor, bool accumulate)
+{
+  long size = 1L;
+  for (int d = 0; d < rank; ++d) size *= dims[d];
+  if (size == 0L) return;
+
+  switch (rank) {
+    case 0:
+      if (accumulate) *sorted += factor * (*unsorted);
+      else            *sorted  = factor * (*unsorted);
+      return;
+    case 1:
+      if (accumulate) scale_copy<true>(unsorted, sorted, dims[0], factor);
+      else            scale_copy<false>(unsorted, sorted, dims[0], factor);
+      return;
+    case 2:
+      if (perm[0] == 0) {
+        if (accumulate) scale_copy<true>(unsorted, sorted, size, factor);
+        else            scale_copy<false>(unsorted, sorted, size, factor);
+      }
+      else {
+        if (accumulate) transpose<true>(unsorted, dims[1], sorted, dims[0], dims[0], dims[1], factor);
+        else            transpose<false>(unsorted, dims[1], sorted, dims[0], dims[0], dims[1], factor);
+      }
+      return;
+    case 4: {
+      const int code = 64 * perm[0] + 16 * perm[1] + 4 * perm[2] + perm[3];
+      Sort4Kernel kernel = (code >= 0 && code < 256) ? sort4_table.kernel[code][accumulate ? 1 : 0] : 0;
+      if (kernel == 0)
+        throw ProgrammingError("sort_indices: invalid permutation", __FILE__, __LINE__);
+      kernel(unsorted, sorted, dims, factor);
+      return;
+    }
+    default:
+      if (accumulate) sortn<true>(unsorted, sorted, rank, dims, perm, factor);
+      else            sortn<false>(unsorted, sorted, rank, dims, perm, factor);
+  }
+}
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
@@ -0,0 +1,48 @@
+//
+// sort_indices.h --- index permutation kernels for the SMITH-generated code
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#ifndef _chemistry_qc_ccr12_sort_indices_h
+#define _chemistry_qc_ccr12_sort_indices_h
+
+namespace sc {
+
+  /** Permutes the indices of a tile.  unsorted is a row-major array with
+      dimensions dims[0],...,dims[rank-1]; element (x[0],...,x[rank-1]) is
+      multiplied by factor and stored (or, if accumulate is true, added) to
+      sorted at the position of (x[perm[0]],...,x[perm[rank-1]]) in a
+      row-major array with dimensions dims[perm[0]],...,dims[perm[rank-1]].
+
+      Kernels specialized for each permutation are used for tiles of rank
+      up to 4, higher ranks use a general kernel.  In all cases the innermost
+      loops are either contiguous in both arrays or a blocked transpose. */
+  void sort_indices(const double* unsorted, double* sorted,
+                    int rank, const long* dims, const int* perm,
+                    double factor, bool accumulate = false);
+
+}
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
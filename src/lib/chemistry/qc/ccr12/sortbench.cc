@@ -0,0 +1,139 @@
+//
+// sortbench.cc
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+// Checks the index permutation kernels used by the SMITH-generated code
+// against a straightforward implementation and reports their speed.  Usage:
+//   sortbench [t1 t2 ...]
+// where t1, t2, ... are the tile sizes (the extent of each index).
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+#include <util/misc/formio.h>
+#include <util/misc/regtime.h>
+#include <chemistry/qc/ccr12/sort_indices.h>
+
+using namespace std;
+using namespace sc;
+
+// the scattered-store loop that the kernels replaced
+static void
+reference_sort(const double* u, double* s, int rank, const long* n, const int* perm,
+               double f, bool acc)
+{
+  long size = 1;
+  for (int d=0; d<rank; d++) size *= n[d];
+  std::vector<long> x(rank, 0);
+  for (long iall=0; iall<size; iall++) {
+    long ib = 0;
+    for (int d=0; d<rank; d++) ib = ib*n[perm[d]] + x[perm[d]];
+    if (acc) s[ib] += f*u[iall];
+    else     s[ib]  = f*u[iall];
+    for (int d=rank-1; d>=0; d--) {
+      if (++x[d] < n[d]) break;
+      x[d] = 0;
+    }
+  }
+}
+
+static int
+bench(int rank, const int* perm, long tile, bool acc)
+{
+  std::vector<long> n(rank);
+  long size = 1;
+  for (int d=0; d<rank; d++) {
+    // make the extents differ so that wrong strides are caught
+    n[d] = tile + d%2;
+    size *= n[d];
+  }
+  const int nrepeat = std::max(1L, 20000000L/size);
+
+  std::vector<double> u(size), sref(size), s(size);
+  for (long i=0; i<size; i++) {
+    u[i] = double(rand())/RAND_MAX - 0.5;
+    sref[i] = s[i] = double(i%7);
+  }
+  const double f = -0.5;
+
+  double t0 = RegionTimer::get_wall_time();
+  for (int r=0; r<nrepeat; r++)
+    reference_sort(&u[0], &sref[0], rank, &n[0], perm, f, acc);
+  double t_ref = (RegionTimer::get_wall_time() - t0)/nrepeat;
+
+  t0 = RegionTimer::get_wall_time();
+  for (int r=0; r<nrepeat; r++)
+    sort_indices(&u[0], &s[0], rank, &n[0], perm, f, acc);
+  double t_new = (RegionTimer::get_wall_time() - t0)/nrepeat;
+
+  double diff = 0.0;
+  for (long i=0; i<size; i++) diff = std::max(diff, fabs(s[i]-sref[i]));
+  // with accumulation both have been summed nrepeat times in the same order
+  const bool ok = diff <= 1.0e-12*nrepeat;
+
+  char permstr[32];
+  int pos = 0;
+  for (int d=0; d<rank; d++) pos += sprintf(permstr+pos, "%d", perm[d]);
+  ExEnv::out0() << indent
+                << scprintf("rank %d perm %-8s tile %3ld %s  ref %10.3e s  new %10.3e s"
+                            "  speedup %6.2f  |diff| %8.2e%s",
+                            rank, permstr, tile, acc ? "acc" : "   ", t_ref, t_new,
+                            t_ref/t_new, diff, ok ? "" : "  FAILED")
+                << endl;
+  return ok ? 0 : 1;
+}
+
+int
+main(int argc, char** argv)
+{
+  std::vector<long> tiles;
+  for (int i=1; i<argc; i++) tiles.push_back(atol(argv[i]));
+  if (tiles.empty()) {
+    tiles.push_back(8);
+    tiles.push_back(16);
+    tiles.push_back(32);
+  }
+
+  const int perm2[][2] = { {0,1}, {1,0} };
+  const int perm4[][4] = { {0,1,2,3}, {1,0,3,2}, {2,1,0,3}, {3,2,1,0},
+                           {0,2,1,3}, {2,3,0,1}, {1,3,0,2} };
+  const int perm6[][6] = { {0,1,2,3,4,5}, {3,4,5,0,1,2}, {2,1,0,5,4,3},
+                           {0,2,1,4,3,5} };
+
+  int nfail = 0;
+  for (size_t t=0; t<tiles.size(); t++) {
+    const long tile = tiles[t];
+    for (size_t p=0; p<sizeof(perm2)/sizeof(perm2[0]); p++)
+      nfail += bench(2, perm2[p], tile*tile, false);
+    for (size_t p=0; p<sizeof(perm4)/sizeof(perm4[0]); p++)
+      nfail += bench(4, perm4[p], tile, false);
+    for (size_t p=0; p<sizeof(perm6)/sizeof(perm6[0]); p++) {
+      // keep rank-6 tiles to a few million elements
+      const long tile6 = std::min(tile, 12L);
+      nfail += bench(6, perm6[p], tile6, false);
+      nfail += bench(6, perm6[p], tile6, true);
+    }
+  }
+
+  if (nfail) ExEnv::out0() << indent << nfail << " permutations FAILED" << endl;
+  return nfail ? 1 : 0;
+}
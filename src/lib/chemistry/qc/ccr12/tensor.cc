@@ -35,7 +35,7 @@
 #include <cstdio>
 #include <unistd.h>
 #include <util/misc/exenv.h>
-#include <util/misc/exenv.h>
+#include <util/misc/scexception.h>
 #include <math/scmat/blas.h>
 #include <util/misc/consumableresources.h>
 #include <chemistry/qc/ccr12/tensor.h>
@@ -48,12 +48,56 @@ static ClassDesc Tensor_cd(
   typeid(Tensor), "Tensor", 1, "virtual public RefCount",
   0, 0, 0);
 
+Tensor::Storage Tensor::default_storage_ = Tensor::MemoryStorage;
+long Tensor::default_cache_size_ = 64L * 1024L * 1024L;
+Ref<ThreadLock> Tensor::memgrp_lock_;
+
+namespace {
+  // the tiles claimed by a thread, see Tensor::set_thread_tiles()
+  struct ThreadTiles {
+    Tensor::TileCounter* counter;
+    long nqueried;   // the number of local tiles queried so far
+    long mine;       // the next tile claimed by this thread
+    unsigned long signature;  // a hash of the tags of the local tiles queried
+  };
+  thread_local ThreadTiles thread_tiles = { 0, 0L, 0L, 0UL };
+
+  // the number of locks guarding the local blocks of a tensor
+  const int nstripe = 16;
+}
+
+void Tensor::set_thread_tiles(TileCounter* counter){
+  thread_tiles.counter = counter;
+  thread_tiles.nqueried = 0L;
+  thread_tiles.mine = counter ? counter->next() : 0L;
+  thread_tiles.signature = 0UL;
+}
+
+unsigned long Tensor::thread_tiles_signature(){
+  return thread_tiles.signature;
+}
+
 Tensor::Tensor(string filename, const Ref<MemoryGrp>& mem): mem_(mem) {
   const std::string basename_prefix = SCFormIO::fileext_to_filename(".smith.");
   const std::string full_prefix = ConsumableResources::get_default_instance()->disk_location() +
                                   basename_prefix;
   filename_ = full_prefix + filename;
+  storage_ = default_storage_;
+  // only serial runs are supported by the disk-based algorithm so far
+  if (storage_ == DiskStorage && mem_->n() > 1)
+    throw FeatureNotImplemented("Tensor: disk storage is not supported in parallel runs",
+                                __FILE__, __LINE__);
+  region_ = 0;
+  stream_ = 0;
   file_allocated_ = false;
+  cache_used_ = 0L;
+  cache_limit_ = default_cache_size_ / sizeof(double);
+
+  Ref<ThreadGrp> thr = ThreadGrp::get_default_threadgrp();
+  lock_ = thr->new_lock();
+  stripes_.resize(nstripe);
+  for (int i = 0; i < nstripe; ++i) stripes_[i] = thr->new_lock();
+  if (memgrp_lock_.null()) memgrp_lock_ = thr->new_lock();
 }
 
 Tensor::~Tensor(){
@@ -75,40 +119,71 @@ void Tensor::set_filesize(long i){
 }
 
 
-#ifdef DISK_BASED_SMITH
+void Tensor::build_index(){
+  // the size of a block is given by the offset of the next one in tag order;
+  // the last entry is the end of the tensor (see set_filesize)
+  index_.clear();
+  index_.rehash(hash_table_.size());
+  offsets_.clear();
+  offsets_.reserve(hash_table_.size());
+  for (std::map<long, long>::const_iterator i = hash_table_.begin(); i != hash_table_.end(); ++i) {
+    index_[i->first] = offsets_.size();
+    offsets_.push_back(i->second);
+  }
+  index_.erase(LONG_MAX - 1);
+}
+
+
+void Tensor::block_extent(long tag, long& doffset, long& dsize) const {
+  std::unordered_map<long, long>::const_iterator iter = index_.find(tag);
+  MPQC_ASSERT(iter != index_.end());
+  doffset = offsets_[iter->second];
+  dsize   = offsets_[iter->second + 1] - doffset;
+}
+
+
+double* Tensor::local_block(long doffset, long dsize) const {
+  const long localoffset = region_->localoffset() / sizeof(double);
+  const long localsize   = region_->localsize() / sizeof(double);
+  if (doffset < localoffset || doffset + dsize > localoffset + localsize) return 0;
+  return (double*) region_->localdata() + (doffset - localoffset);
+}
+
+
 // must fit into the cache of the hard drive (?)
 static const long cachesize = 100000;
-#endif
 
 void Tensor::createfile(){
-#ifndef DISK_BASED_SMITH
- mem_->sync();
- vector<long> filesizes = determine_filesizes();
- long maxsize = *max_element(filesizes.begin(), filesizes.end());
-
- file_ = new MemoryGrpRegion(mem_, sizeof(double) * maxsize);
- file_->set_localsize(sizeof(double) * filesizes[mem_->me()]);
-
- zero();
-#else
- // create a zero-cleared file of the specified size
- file_ = new fstream(filename_.c_str(), fstream::out | fstream::binary); 
- MPQC_ASSERT(file()->is_open());
- double* aux_array = new double[cachesize];
- fill(aux_array, aux_array + cachesize, 0.0);
- long size_back = filesize_; 
- while (size_back > 0L) {
-   file_->write((const char*)aux_array, min(cachesize, size_back) * sizeof(double)); 
-   size_back -= cachesize;
+ build_index();
+
+ if (storage_ == MemoryStorage) {
+   mem_->sync();
+   vector<long> filesizes = determine_filesizes();
+   long maxsize = *max_element(filesizes.begin(), filesizes.end());
+
+   region_ = new MemoryGrpRegion(mem_, sizeof(double) * maxsize);
+   region_->set_localsize(sizeof(double) * filesizes[mem_->me()]);
+
+   zero();
+ } else {
+   // create a zero-cleared file of the specified size
+   stream_ = new fstream(filename_.c_str(), fstream::out | fstream::binary);
+   MPQC_ASSERT(stream_->is_open());
+   double* aux_array = new double[cachesize];
+   fill(aux_array, aux_array + cachesize, 0.0);
+   long size_back = filesize_;
+   while (size_back > 0L) {
+     stream_->write((const char*)aux_array, min(cachesize, size_back) * sizeof(double));
+     size_back -= cachesize;
+   }
+   delete[] aux_array;
+   delete stream_;
+
+   // reopen with in/out/binary; will be delete'd in the destructor
+   stream_ = new fstream(filename_.c_str(), fstream::in | fstream::out | fstream::binary);
+   // Unlinking while open to avoid garbage. When closed, the file is physically removed.
+   unlink(filename_.c_str());
  }
- delete[] aux_array;
- delete file_;
-
- // reopen with in/out/binary; will be delete'd in the destructor
- file_ = new fstream(filename_.c_str(), fstream::in | fstream::out | fstream::binary); 
- // Unlinking while open to avoid garbage. When closed, the file is physically removed.
- unlink(filename_.c_str());
-#endif
 
  file_allocated_ = true;
 }
@@ -146,137 +221,214 @@ vector<long> Tensor::determine_filesizes(){
 
 
 void Tensor::deletefile(){
- delete file_;
+ // modified blocks need not be written back, the file is removed
+ cache_.clear();
+ lru_.clear();
+ cache_used_ = 0L;
+ delete region_;
+ delete stream_;
+ region_ = 0;
+ stream_ = 0;
+}
+
+
+/// the block cache of the disk-based algorithm >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+Tensor::CachedBlock& Tensor::cache_entry(long tag){
+  std::unordered_map<long, CachedBlock>::iterator iter = cache_.find(tag);
+  if (iter != cache_.end()) {
+    lru_.splice(lru_.begin(), lru_, iter->second.lru);
+    return iter->second;
+  }
+
+  long doffset, dsize;
+  block_extent(tag, doffset, dsize);
+
+  // make room; a block larger than the cache is still cached (alone)
+  while (!lru_.empty() && cache_used_ + dsize > cache_limit_) {
+    const long victim = lru_.back();
+    std::unordered_map<long, CachedBlock>::iterator v = cache_.find(victim);
+    write_back(victim, v->second);
+    cache_used_ -= v->second.data.size();
+    cache_.erase(v);
+    lru_.pop_back();
+  }
+
+  CachedBlock& b = cache_[tag];
+  b.data.resize(dsize);
+  b.dirty = false;
+  lru_.push_front(tag);
+  b.lru = lru_.begin();
+  cache_used_ += dsize;
+
+  stream_->clear();
+  stream_->seekg(doffset * sizeof(double));
+  stream_->read((char*) &b.data[0], dsize * sizeof(double));
+  return b;
+}
+
+
+void Tensor::write_back(long tag, CachedBlock& b) const {
+  if (!b.dirty) return;
+  long doffset, dsize;
+  block_extent(tag, doffset, dsize);
+  stream_->clear();
+  stream_->seekp(doffset * sizeof(double));
+  stream_->write((const char*) &b.data[0], dsize * sizeof(double));
+  b.dirty = false;
+}
+
+
+void Tensor::flush_cache() const {
+  for (std::unordered_map<long, CachedBlock>::iterator i = cache_.begin(); i != cache_.end(); ++i)
+    write_back(i->first, i->second);
+  cache_.clear();
+  lru_.clear();
+  cache_used_ = 0L;
 }
 
 
 /// routines called from one node (i.e. inside the loops) >>>>>>>>>>>>>>>>>>>>>>>>>
 void Tensor::get_block(long tag, double* data){
-  std::map<long, long>::iterator iter = hash_table_.find(tag);
-  MPQC_ASSERT(iter != hash_table_.end());
-  long doffset = iter->second;
-  long dsize   = (++iter)->second-doffset;
-  distsize_t offset = (distsize_t)doffset * sizeof(double);
-  const int    size =        (int)dsize   * sizeof(double); // in byte
-
-#ifndef DISK_BASED_SMITH
-  double* buffer = (double*) file_->obtain_readonly(offset, size);
-  ::memcpy((void*) data, (void*) buffer, size);
-  file_->release_readonly(buffer, offset, size);
-#else
-  file_->clear();
-  file_->seekg(doffset * sizeof(double));
-  file_->read((char*) data, size);
-#endif
+  long doffset, dsize;
+  block_extent(tag, doffset, dsize);
+  if (dsize == 0L) return;
+
+  if (storage_ == MemoryStorage) {
+    const size_t size = (size_t)dsize * sizeof(double); // in byte
+    const double* local = local_block(doffset, dsize);
+    if (local) {
+      ThreadLockHolder h(stripe(tag));
+      ::memcpy((void*) data, (const void*) local, size);
+      return;
+    }
+    distsize_t offset = (distsize_t)doffset * sizeof(double);
+    ThreadLockHolder h(memgrp_lock_);
+    double* buffer = (double*) region_->obtain_readonly(offset, size);
+    ::memcpy((void*) data, (void*) buffer, size);
+    region_->release_readonly(buffer, offset, size);
+  } else {
+    ThreadLockHolder h(lock_);
+    const CachedBlock& b = cache_entry(tag);
+    std::copy(b.data.begin(), b.data.end(), data);
+  }
 }
 
 
 void Tensor::put_block(long tag, double* data){
-  std::map<long,long>::iterator iter = hash_table_.find(tag);
-  MPQC_ASSERT(iter != hash_table_.end());
-  long doffset = iter->second;
-  long dsize   = (++iter)->second - doffset;
-  distsize_t offset = (distsize_t)doffset * sizeof(double);
-  const int    size =        (int)dsize   * sizeof(double); // in byte
-
-#ifndef DISK_BASED_SMITH
-  double* buffer = (double *) file_->obtain_writeonly(offset, size);
-  ::memcpy((void*) buffer, (void*) data, size);
-  file_->release_writeonly((void*) buffer, offset, size);
-#else
-  file_->clear();
-  file_->seekp(doffset * sizeof(double));
-  file_->write((char*)data, size);
-#endif
+  long doffset, dsize;
+  block_extent(tag, doffset, dsize);
+  if (dsize == 0L) return;
+
+  if (storage_ == MemoryStorage) {
+    const size_t size = (size_t)dsize * sizeof(double); // in byte
+    double* local = local_block(doffset, dsize);
+    if (local) {
+      ThreadLockHolder h(stripe(tag));
+      ::memcpy((void*) local, (const void*) data, size);
+      return;
+    }
+    distsize_t offset = (distsize_t)doffset * sizeof(double);
+    ThreadLockHolder h(memgrp_lock_);
+    double* buffer = (double *) region_->obtain_writeonly(offset, size);
+    ::memcpy((void*) buffer, (void*) data, size);
+    region_->release_writeonly((void*) buffer, offset, size);
+  } else {
+    ThreadLockHolder h(lock_);
+    CachedBlock& b = cache_entry(tag);
+    std::copy(data, data + dsize, b.data.begin());
+    b.dirty = true;
+  }
 }
 
 
 void Tensor::add_block(long tag, double* data){
-// copy of data will be allocated;
-// probably it is ok (in smith codes, k_a and k_a_sort are
-// already deallocated at the time this is called)...
-  std::map<long,long>::iterator iter = hash_table_.find(tag);
-  MPQC_ASSERT(iter != hash_table_.end());
-  long doffset = iter->second;
-  blasint dsize    = (int)((++iter)->second - doffset);
-  distsize_t offset = (distsize_t) doffset * sizeof(double);
-  const int    size =          (int)dsize  * sizeof(double); // in byte
-
-  double* copy_data = mem_->malloc_local_double(dsize);
-#ifndef DISK_BASED_SMITH
-  ::memcpy((void*) copy_data, (void*) data, size);
-
-  double* buffer = (double*) file_->obtain_readonly(offset, size);
+  long doffset, dsize;
+  block_extent(tag, doffset, dsize);
+  if (dsize == 0L) return;
+
+  const blasint n = dsize;
   const blasint unit = 1;
   const double one = 1.0;
-  F77_DAXPY(&dsize, &one, buffer, &unit, copy_data, &unit);
-  file_->release_readonly((void*) buffer, offset, size);
-
-  buffer = (double*) file_->obtain_writeonly(offset, size);
-  ::memcpy((void*) buffer, (void*) copy_data, size);
-  file_->release_writeonly((void*) buffer, offset, size);
-#else
-  file_->clear();
-  file_->seekg(doffset * sizeof(double));
-  file_->read((char*)copy_data, size);
-  const double one = 1.0;
-  const blasint unit = 1;
-  F77_DAXPY(&dsize, &one, data, &unit, copy_data, &unit);
-
-  file_->clear();
-  file_->seekp(doffset * sizeof(double));
-  file_->write((const char*)copy_data, size);
-#endif
-
-  mem_->free_local_double(copy_data);
+  if (storage_ == MemoryStorage) {
+    double* local = local_block(doffset, dsize);
+    if (local) {
+      ThreadLockHolder h(stripe(tag));
+      F77_DAXPY(&n, &one, data, &unit, local, &unit);
+      return;
+    }
+    // the block is locked while it is updated, hence contributions of
+    // several nodes to the same block are not lost
+    ThreadLockHolder h(memgrp_lock_);
+    region_->sum_reduction(data, doffset, dsize);
+  } else {
+    ThreadLockHolder h(lock_);
+    CachedBlock& b = cache_entry(tag);
+    F77_DAXPY(&n, &one, data, &unit, &b.data[0], &unit);
+    b.dirty = true;
+  }
 }
 
 bool Tensor::exists(long tag) const {
-  std::map<long, long>::const_iterator iter = hash_table_.find(tag);
-  if (iter == hash_table_.end()) return false;
-  return true;
+  return index_.find(tag) != index_.end();
 }
 
 bool Tensor::is_this_local(long tag){
-  std::map<long,long>::iterator iter = hash_table_.find(tag);
-  if (iter == hash_table_.end()) return false;
-
-#ifndef DISK_BASED_SMITH
-  long myoffset_   = iter->second * sizeof(double); // in byte
-  long localoffset_= (long)(file()->localoffset());
-  long nextoffset_ = (long)(file()->localsize()) + localoffset_;
-  return localoffset_ <= myoffset_ && myoffset_ < nextoffset_;
-#else
-  // Only serial runs are supported with DISK_BASED_SMITH so far
+  std::unordered_map<long, long>::const_iterator iter = index_.find(tag);
+  if (iter == index_.end()) return false;
+
+  bool local = true;  // only serial runs are supported with DiskStorage so far
+  if (storage_ == MemoryStorage) {
+    long myoffset_   = offsets_[iter->second] * sizeof(double); // in byte
+    long localoffset_= (long)(region_->localoffset());
+    long nextoffset_ = (long)(region_->localsize()) + localoffset_;
+    local = localoffset_ <= myoffset_ && myoffset_ < nextoffset_;
+  }
+
+  ThreadTiles& t = thread_tiles;
+  if (!local || t.counter == 0) return local;
+  t.signature = t.signature * 1000003UL + (unsigned long)tag;
+  if (t.nqueried++ != t.mine) return false;
+  t.mine = t.counter->next();
   return true;
-#endif
 }
 
 
 /// routines called from all the nodes at the same time >>>>>>>>>>>>>>>>>>>>>>>>>
+void Tensor::sync() const {
+  if (storage_ == MemoryStorage)
+    region_->sync();
+  else
+    flush_cache();
+}
+
 void Tensor::zero(){
   assign(0.0);
 }
 
 void Tensor::assign(double a){
-#ifndef DISK_BASED_SMITH
-  double* buffer = (double *) file_->localdata();
-  const size_t dsize = (size_t)file()->localsize() / sizeof(double);
-  fill(buffer, buffer + dsize, a);
-  sync();
-#else
-  file_->clear();
-  file_->seekp(0);
+  if (storage_ == MemoryStorage) {
+    double* buffer = (double *) region_->localdata();
+    const size_t dsize = (size_t)region_->localsize() / sizeof(double);
+    fill(buffer, buffer + dsize, a);
+    sync();
+    return;
+  }
+
+  // the cached blocks are overwritten
+  cache_.clear();
+  lru_.clear();
+  cache_used_ = 0L;
+  stream_->clear();
+  stream_->seekp(0);
   double* aux_array = new double[cachesize];
   fill(aux_array, aux_array + cachesize, a);
   long size_back = filesize_;
   while (size_back > 0) {
     const size_t readsize = min(size_back, cachesize) * sizeof(double);
-    file_->write((const char*)aux_array, readsize); 
+    stream_->write((const char*)aux_array, readsize);
     size_back -= cachesize;
   }
   delete[] aux_array;
-#endif
 }
 
 namespace {
@@ -290,16 +442,19 @@ namespace {
   };
 }
 void Tensor::scale(double a){
-#ifndef DISK_BASED_SMITH
-  double* buffer=(double *) file_->localdata();
-  const size_t dsize =(size_t)file()->localsize() / sizeof(double);
-  ElementScaler scaler(a);
-  for_each(buffer, buffer + dsize, scaler);
-  sync();
-#else
-  file_->clear();
+  if (storage_ == MemoryStorage) {
+    double* buffer=(double *) region_->localdata();
+    const size_t dsize =(size_t)region_->localsize() / sizeof(double);
+    ElementScaler scaler(a);
+    for_each(buffer, buffer + dsize, scaler);
+    sync();
+    return;
+  }
+
+  flush_cache();
+  stream_->clear();
   double* aux_array = new double [cachesize];
-  size_t size_now = 0UL; 
+  size_t size_now = 0UL;
   long size_back = filesize_;
   ElementScaler scaler(a);
   while (size_back > 0) {
@@ -307,58 +462,61 @@ void Tensor::scale(double a){
    const size_t readsize = rsize * sizeof(double);
    const size_t position = size_now * sizeof(double);
 
-   file_->seekg(position);
-   file_->read((char*)aux_array, readsize); 
+   stream_->seekg(position);
+   stream_->read((char*)aux_array, readsize);
    for_each(aux_array, aux_array + rsize, scaler);
 
-   file_->seekp(position);
-   file_->write((const char*)aux_array, readsize); 
+   stream_->seekp(position);
+   stream_->write((const char*)aux_array, readsize);
 
    size_now += cachesize;
    size_back -= cachesize;
  }
  delete[] aux_array;
-#endif
 }
 
 void Tensor::daxpy(const Ref<Tensor>& other, double a){ // add to self
   const blasint unit = 1;
-#ifndef DISK_BASED_SMITH
-  const blasint dsize = file_->localsize() / sizeof(double);
-  MPQC_ASSERT(dsize == other->file()->localsize() / sizeof(double));
-  double* buffer1 = (double *) file_->localdata();
-  const double* buffer2 = (double *) other->file()->localdata();
-  F77_DAXPY(&dsize, &a, buffer2, &unit, buffer1, &unit);
-  sync();
-#else
+  MPQC_ASSERT(storage_ == other->storage_);
+  if (storage_ == MemoryStorage) {
+    const blasint dsize = region_->localsize() / sizeof(double);
+    MPQC_ASSERT(dsize == other->region_->localsize() / sizeof(double));
+    double* buffer1 = (double *) region_->localdata();
+    const double* buffer2 = (double *) other->region_->localdata();
+    F77_DAXPY(&dsize, &a, buffer2, &unit, buffer1, &unit);
+    sync();
+    return;
+  }
+
 // Assuming that this and other point to different Tensor's. Probably OK, right?
 // Otherwise, we need to insert fstream::clear for the last block.
+  flush_cache();
+  other->flush_cache();
   double* aux_array = new double[cachesize];
   double* aux_array2 = new double[cachesize];
-  size_t size_now = 0UL; 
+  size_t size_now = 0UL;
   long size_back = filesize_;
-  this->file_->clear();
-  other->file_->clear();
+  this->stream_->clear();
+  other->stream_->clear();
   while (size_back > 0L) {
     const blasint rsize = min(cachesize, size_back);
     const size_t readsize = rsize * sizeof(double);
-    const size_t position = size_now * sizeof(double); 
+    const size_t position = size_now * sizeof(double);
 
-    this->file_->seekg(position);
-    this->file_->read((char*)aux_array, readsize);
-    other->file_->seekg(position);
-    other->file_->read((char*)aux_array2, readsize);
+    this->stream_->seekg(position);
+    this->stream_->read((char*)aux_array, readsize);
+    other->stream_->seekg(position);
+    other->stream_->read((char*)aux_array2, readsize);
     F77_DAXPY(&rsize, &a, aux_array2, &unit, aux_array, &unit);
 
-    this->file_->seekp(position);
-    this->file_->write((const char*)aux_array, readsize); 
+    this->stream_->seekp(position);
+    this->stream_->write((const char*)aux_array, readsize);
 
     size_now += cachesize;
     size_back -= cachesize;
   }
   delete[] aux_array;
   delete[] aux_array2;
-#endif
 }
 
 
@@ -366,7 +524,7 @@ void Tensor::daxpy(const Ref<Tensor>& other, double a){ // add to self
 static int filecounter = 0;
 
 Ref<Tensor> Tensor::copy() const{
-  stringstream ss; 
+  stringstream ss;
   ss << "temp_file_" << filecounter;
   ++filecounter;
   Ref<Tensor> other = new Tensor(ss.str(), mem_);
@@ -374,35 +532,37 @@ Ref<Tensor> Tensor::copy() const{
   other->filesize_   = filesize_;
   other->createfile();
 
-#ifndef DISK_BASED_SMITH
-  int size = file_->localsize();
-  MPQC_ASSERT(size == other->file()->localsize());
-  double* buffer1 = (double *) file_->localdata();
-  double* buffer2 = (double *) other->file()->localdata();
-  ::memcpy((void*) buffer2, (void*) buffer1, size);
-  sync();
-#else
-  file_->clear();
-  other->file()->clear();
-  file_->seekg(0);
-  other->file()->seekp(0);
+  if (storage_ == MemoryStorage) {
+    int size = region_->localsize();
+    MPQC_ASSERT(size == other->region_->localsize());
+    double* buffer1 = (double *) region_->localdata();
+    double* buffer2 = (double *) other->region_->localdata();
+    ::memcpy((void*) buffer2, (void*) buffer1, size);
+    sync();
+    return other;
+  }
+
+  flush_cache();
+  stream_->clear();
+  other->stream_->clear();
+  stream_->seekg(0);
+  other->stream_->seekp(0);
   char* aux_array = new char[cachesize * sizeof(double)];
-  long size_back = filesize_; 
+  long size_back = filesize_;
   while (size_back > 0L) {
     const size_t readsize = min(cachesize, size_back) * sizeof(double);
-    file_->read(aux_array, readsize);
-    other->file()->write(aux_array, readsize);
+    stream_->read(aux_array, readsize);
+    other->stream_->write(aux_array, readsize);
     size_back -= cachesize;
   }
   delete[] aux_array;
-#endif
 
   return other;
 }
 
 
 Ref<Tensor> Tensor::clone() const {
-  stringstream ss; 
+  stringstream ss;
   ss << "temp_file_" << filecounter;
   ++filecounter;
   Ref<Tensor> other = new Tensor(ss.str(), mem_);
@@ -415,28 +575,29 @@ Ref<Tensor> Tensor::clone() const {
 
 double Tensor::norm() const {
   const blasint unit = 1;
-#ifndef DISK_BASED_SMITH 
-  sync();
-  const double* buffer = (double *) file_->localdata();
-  const blasint dsize = file_->localsize() / sizeof(double);
-  double norm_ = F77_DDOT(&dsize, buffer, &unit, buffer, &unit);
-
-  Ref<MessageGrp> msg_ = MessageGrp::get_default_messagegrp();
-  msg_->sum(norm_);
-#else
-  file_->clear();
-  file_->seekg(0);
-  double* aux_array = new double[cachesize];
   double norm_ = 0.0;
-  long size_back = filesize_;
-  while (size_back > 0L) {
-    const blasint bsize = min(cachesize, size_back);
-    file_->read((char*)aux_array, bsize * sizeof(double));
-    norm_ += F77_DDOT(&bsize, aux_array, &unit, aux_array, &unit);
-    size_back -= cachesize;
+  if (storage_ == MemoryStorage) {
+    sync();
+    const double* buffer = (double *) region_->localdata();
+    const blasint dsize = region_->localsize() / sizeof(double);
+    norm_ = F77_DDOT(&dsize, buffer, &unit, buffer, &unit);
+
+    Ref<MessageGrp> msg_ = MessageGrp::get_default_messagegrp();
+    msg_->sum(norm_);
+  } else {
+    flush_cache();
+    stream_->clear();
+    stream_->seekg(0);
+    double* aux_array = new double[cachesize];
+    long size_back = filesize_;
+    while (size_back > 0L) {
+      const blasint bsize = min(cachesize, size_back);
+      stream_->read((char*)aux_array, bsize * sizeof(double));
+      norm_ += F77_DDOT(&bsize, aux_array, &unit, aux_array, &unit);
+      size_back -= cachesize;
+    }
+    delete[] aux_array;
   }
-  delete[] aux_array;
-#endif
 
   /// sqrt needed?
   norm_ = ::sqrt(norm_);
@@ -446,40 +607,44 @@ double Tensor::norm() const {
 
 double Tensor::ddot(Ref<Tensor>& other) const {
   const blasint unit = 1;
-  #ifndef DISK_BASED_SMITH
-  sync();
-  const double* buffer1 = (double *)        file_->localdata();
-  const double* buffer2 = (double *) other->file()->localdata();
-  const blasint dsize = file_->localsize() / sizeof(double);
-  MPQC_ASSERT(file()->localsize() == other->file()->localsize());
-  double ddotproduct = F77_DDOT(&dsize, buffer1, &unit, buffer2, &unit);
-
-  sync();
-  Ref<MessageGrp> msg_ = MessageGrp::get_default_messagegrp();
-  msg_->sum(ddotproduct);
-#else
-  file_->clear();
-  other->file_->clear();
+  MPQC_ASSERT(storage_ == other->storage_);
+  double ddotproduct = 0.0;
+  if (storage_ == MemoryStorage) {
+    sync();
+    const double* buffer1 = (double *)        region_->localdata();
+    const double* buffer2 = (double *) other->region_->localdata();
+    const blasint dsize = region_->localsize() / sizeof(double);
+    MPQC_ASSERT(region_->localsize() == other->region_->localsize());
+    ddotproduct = F77_DDOT(&dsize, buffer1, &unit, buffer2, &unit);
+
+    sync();
+    Ref<MessageGrp> msg_ = MessageGrp::get_default_messagegrp();
+    msg_->sum(ddotproduct);
+    return ddotproduct;
+  }
+
+  flush_cache();
+  other->flush_cache();
+  stream_->clear();
+  other->stream_->clear();
   double* aux_array = new double[cachesize];
   double* aux_array2 = new double[cachesize];
-  double ddotproduct = 0.0;
-  long size_back = filesize_; 
+  long size_back = filesize_;
   size_t size_now = 0LU;
   while (size_back > 0L) {
     const blasint rsize = min(cachesize, size_back);
     const size_t readsize = rsize * sizeof(double);
     const size_t position = size_now * sizeof(double);
-    file_->seekg(position);
-    file_->read((char*)aux_array, readsize);
-    other->file_->seekg(position);
-    other->file_->read((char*)aux_array2, readsize);
+    stream_->seekg(position);
+    stream_->read((char*)aux_array, readsize);
+    other->stream_->seekg(position);
+    other->stream_->read((char*)aux_array2, readsize);
     ddotproduct += F77_DDOT(&rsize, aux_array, &unit, aux_array2, &unit);
     size_back -= cachesize;
     size_now += cachesize;
   }
   delete[] aux_array;
   delete[] aux_array2;
-#endif
   return ddotproduct;
 }
 
@@ -489,7 +654,8 @@ double sc::RMS(const Tensor& t) {
 
 void Tensor::print(const std::string& label,
                    std::ostream& os) const {
-#ifndef DISK_BASED_SMITH 
+  if (storage_ != MemoryStorage) return;
+
   os << indent << label << " Tensor" << std::endl;
   typedef std::map<long, long>::const_iterator iter_t;
   for(iter_t i = hash_table_.begin();
@@ -502,14 +668,12 @@ void Tensor::print(const std::string& label,
       long dsize   = ii->second-doffset;
       distsize_t offset = (distsize_t)doffset * sizeof(double);
       const int    size =        (int)dsize   * sizeof(double); // in byte
-      double* buffer = (double*) file()->obtain_readonly(offset, size);
+      double* buffer = (double*) region_->obtain_readonly(offset, size);
       os << indent << "tile " << i->first << std::endl;
       for(int k=0; k<dsize; ++k)
         os << indent << "tile[" << k << "] = " << buffer[k] << std::endl;
-      file()->release_readonly(buffer, offset, size);
+      region_->release_readonly(buffer, offset, size);
     }
 
   }
-#endif
 }
-
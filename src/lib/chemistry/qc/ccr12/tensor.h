@@ -30,6 +30,10 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <list>
+#include <fstream>
+#include <unordered_map>
 #include <util/misc/compute.h>
 #include <util/group/memory.h>
 #include <util/group/memregion.h>
@@ -37,16 +41,23 @@
 #include <util/group/thread.h>
 #include <math/distarray4/distarray4.h>
 
-// note disk-based algorithm does not support parallel execution so far.
-#define DISK_BASED_SMITH
+namespace sc {
 
-#ifdef DISK_BASED_SMITH
-#include <fstream>
-#endif
+/** Tensor holds the blocks (tiles) of a SMITH tensor.  Each block is
+    identified by a tag, given with its offset to input_offset().
 
-namespace sc {
+    The blocks are either distributed across the nodes with a MemoryGrp
+    (MemoryStorage) or stored in a file (DiskStorage, serial runs only).
+    With DiskStorage the most recently used blocks are kept in an LRU
+    cache; modified blocks are written back when they are evicted or when
+    the whole tensor is accessed (sync(), norm(), etc.).
 
+    get_block(), put_block(), add_block() and is_this_local() may be called
+    concurrently from several threads; see set_thread_tiles(). */
 class Tensor : virtual public RefCount {
+  public:
+    enum Storage { DiskStorage, MemoryStorage };
+
   protected:
     const Ref<MemoryGrp>& mem_;
 
@@ -59,30 +70,75 @@ class Tensor : virtual public RefCount {
     /// tensor size in double
     long filesize_;
 
-    /// data area
-#ifndef DISK_BASED_SMITH
-    MemoryGrpRegion* file_;
-#else
-    std::fstream* file_;
-#endif
+    /// data area; region_ is used with MemoryStorage, stream_ with DiskStorage
+    Storage storage_;
+    MemoryGrpRegion* region_;
+    std::fstream* stream_;
     bool file_allocated_;
 
+    /// position of each block in offsets_, by tag
+    std::unordered_map<long,long> index_;
+    /// the offsets of the blocks in tag order, followed by filesize_
+    std::vector<long> offsets_;
+    /// builds index_ and offsets_ from hash_table_
+    void build_index();
+    /// gives the offset and size (in doubles) of a block
+    void block_extent(long tag, long& doffset, long& dsize) const;
+
+    /// an entry of the block cache
+    struct CachedBlock {
+      std::vector<double> data;
+      bool dirty;
+      std::list<long>::iterator lru;
+    };
+    mutable std::unordered_map<long,CachedBlock> cache_;
+    mutable std::list<long> lru_;       ///< the most recently used first
+    mutable long cache_used_;           ///< in doubles
+    long cache_limit_;                  ///< in doubles
+    /// returns the cached copy of a block, reading it if needed
+    CachedBlock& cache_entry(long tag);
+    /// writes back all modified blocks and empties the cache
+    void flush_cache() const;
+    void write_back(long tag, CachedBlock& b) const;
+
     /// determines the distribution of blocks to nodes
     std::vector<long> determine_filesizes();
 
+    /// guards stream_ and the cache
+    Ref<ThreadLock> lock_;
+    /// guard the local blocks of region_, selected by tag
+    std::vector<Ref<ThreadLock> > stripes_;
+    ThreadLock* stripe(long tag) const { return stripes_[tag % stripes_.size()].pointer(); }
+    /// guards the calls to MemoryGrp, which need not be thread-safe
+    static Ref<ThreadLock> memgrp_lock_;
+    /// returns the local data of a block, or 0 if it is not local (MemoryStorage only)
+    double* local_block(long doffset, long dsize) const;
+
+    static Storage default_storage_;
+    static long default_cache_size_;
+
   public:
+    /** TileCounter hands out the tiles of a routine that is executed by
+        several threads (see set_thread_tiles()). */
+    class TileCounter {
+        Ref<ThreadLock> lock_;
+        long next_;
+      public:
+        TileCounter(const Ref<ThreadLock>& lock): lock_(lock), next_(0L) {}
+        /// returns the number of the next tile that has not been claimed yet
+        long next() { ThreadLockHolder h(lock_); return next_++; }
+    };
+
     Tensor(std::string filename,const Ref<MemoryGrp>& mem);
     ~Tensor();
 
     /// returns filename_
     std::string filename() const {return filename_;};
 
-    /// returns MemoryGrpRegion for this tensor
-#ifndef DISK_BASED_SMITH
-    MemoryGrpRegion* file() const {return file_;};
-#else
-    std::fstream* file() { return file_; };
-#endif
+    /// returns the storage engine
+    Storage storage() const { return storage_; }
+    /// returns MemoryGrpRegion for this tensor, or 0 with DiskStorage
+    MemoryGrpRegion* region() const { return region_; }
 
     /// set/get the filesize of the tensor
     void set_filesize(long i);
@@ -103,7 +159,9 @@ class Tensor : virtual public RefCount {
     void put_block(long tag, double* data);
     /// does this block exist?
     bool exists(long tag) const;
-    /// returns if a block associated with long tag resides in a local memory or not
+    /** returns if a block associated with long tag resides in a local memory or not.
+        If set_thread_tiles() was called on this thread, returns true only for the
+        local blocks that are claimed by this thread. */
     bool is_this_local(long tag);
 
     /// initialize/clear tensors to zero
@@ -130,15 +188,29 @@ class Tensor : virtual public RefCount {
     /// scale self by a
     void scale(double a);
 
-    /// sync
-#ifndef DISK_BASED_SMITH 
-    void sync() const { const_cast<MemoryGrpRegion*>(file_)->sync();};
-#else
-    void sync() const {}; // disk-based algorithm does not support parallel runs so far
-#endif
+    /// writes back the cached blocks and synchronizes the nodes
+    void sync() const;
 
     /// print
     void print(const std::string& label, std::ostream& os = ExEnv::out0()) const;
+
+    /// the storage used by tensors created after this call; initially MemoryStorage
+    static void set_default_storage(Storage s) { default_storage_ = s; }
+    static Storage default_storage() { return default_storage_; }
+    /// the size (in bytes) of the block cache of tensors created after this call
+    static void set_default_cache_size(long nbytes) { default_cache_size_ = nbytes; }
+    static long default_cache_size() { return default_cache_size_; }
+
+    /** Makes is_this_local() on the calling thread claim the local blocks from
+        counter: the n-th local block that is queried by the thread is reported
+        as local only if the thread obtains n from counter.  Hence the threads
+        that share counter and query the same sequence of blocks process each
+        local block exactly once.  0 restores the default behavior. */
+    static void set_thread_tiles(TileCounter* counter);
+    /** Returns a hash of the sequence of local blocks queried with
+        is_this_local() on the calling thread since set_thread_tiles().  The
+        threads that share a counter must all obtain the same value. */
+    static unsigned long thread_tiles_signature();
 };
 
 /** Computes the ``RMS norm'' of the tensor, defined as tensor->norm() divided by the size of the tensor.
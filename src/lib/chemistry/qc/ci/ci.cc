@@ -103,6 +103,7 @@ CI::CI(const Ref<KeyVal> &kv)
     config_.e_ref = molecule()->nuclear_repulsion_energy();
 
     config_.incore = kv->intvalue("incore", Int(config_.incore));
+    config_.cache = kv->sizevalue("cache", KeyValValuesize(config_.cache));
     config_.hdf5.chunk = kv->intvalue("hdf5.chunk", Int(config_.hdf5.chunk));
     config_.hdf5.compress = kv->intvalue("hdf5.compress", Int(config_.hdf5.compress));
     config_.hdf5.direct = kv->intvalue("hdf5.direct", Bool(config_.hdf5.direct));
@@ -39,6 +39,10 @@ namespace sc {
            is zero, which denotes full CI. This is equivalent to setting rank=number of electrons
            in active orbitals.
 
+           <tr><td><tt>cache</tt><td>memory size<td>256MB<td>The memory used to cache blocks of
+           each CI vector that is stored on disk (see <tt>incore</tt>, default 2, i.e. in core). Blocks are read ahead and
+           written back on a separate thread. Zero disables the cache.
+
            </table>
        */
       CI(const Ref<KeyVal> &kv);
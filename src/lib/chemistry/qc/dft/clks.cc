@@ -232,12 +232,13 @@ CLKS::ao_fock(double accuracy)
       }
       conts[i] = new LocalCLKSContribution(gmats[i], pmat, functional_->a0());
       gblds[i] = new LocalGBuild<LocalCLKSContribution>(*conts[i], tbis_[i],
-        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i
+        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i, gbsched_
         );
 
       threadgrp_->add_thread(i, gblds[i]);
     }
 
+    if (!gbsched_.null()) gbsched_->start();
     tim.enter("start thread");
     if (threadgrp_->start_threads() < 0) {
       ExEnv::err0() << indent
@@ -253,6 +254,7 @@ CLKS::ao_fock(double accuracy)
       abort();
     }
     tim.exit("stop thread");
+    if (!gbsched_.null()) gbsched_->finish();
 
     double tnint=0;
     for (i=0; i < nthread; i++) {
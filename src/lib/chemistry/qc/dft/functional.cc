@@ -25,6 +25,8 @@
 // The U.S. Government is granted a limited license as per AL 91-7.
 //
 
+#include <algorithm>
+
 #include <util/misc/math.h>
 
 #include <util/misc/formio.h>
@@ -96,6 +98,108 @@ PointInputData::compute_derived(int spin_polarized,
     }
 }
 
+///////////////////////////////////////////////////////////////////////////
+// PointBatchInputData and PointBatchOutputData
+
+void
+PointBatchInputData::resize(int n, const SCVector3 *rr, int need_gradient)
+{
+  npoint = n;
+  r = rr;
+  SpinData *spins[2] = { &a, &b };
+  for (int s=0; s<2; s++) {
+      spins[s]->rho.assign(n, 0.0);
+      spins[s]->rho_13.assign(n, 0.0);
+      spins[s]->gamma.assign(n, 0.0);
+      spins[s]->del_rho.assign((need_gradient?3*n:0), 0.0);
+    }
+  gamma_ab.assign(n, 0.0);
+  mask.assign(n, 0.0);
+}
+
+void
+PointBatchInputData::compute_derived(int spin_polarized,
+                                     int need_gradient,
+                                     double min_density)
+{
+  const int n = npoint;
+  for (int i=0; i<n; i++) a.rho_13[i] = pow(a.rho[i], 1.0/3.0);
+  if (need_gradient) {
+      for (int i=0; i<n; i++) a.gamma[i] = dot(&a.del_rho[3*i],&a.del_rho[3*i]);
+    }
+
+  if (spin_polarized) {
+      for (int i=0; i<n; i++) b.rho_13[i] = pow(b.rho[i], 1.0/3.0);
+      if (need_gradient) {
+          for (int i=0; i<n; i++) {
+              b.gamma[i] = dot(&b.del_rho[3*i],&b.del_rho[3*i]);
+              gamma_ab[i] = dot(&a.del_rho[3*i],&b.del_rho[3*i]);
+            }
+        }
+    }
+  else {
+      b = a;
+      if (need_gradient) {
+          gamma_ab = a.gamma;
+        }
+    }
+
+  for (int i=0; i<n; i++) mask[i] = ((a.rho[i] + b.rho[i]) > min_density);
+}
+
+void
+PointBatchInputData::get_point(int i, PointInputData &id) const
+{
+  const SpinData *spins[2] = { &a, &b };
+  PointInputData::SpinData *pspins[2] = { &id.a, &id.b };
+  for (int s=0; s<2; s++) {
+      const SpinData &sd = *spins[s];
+      PointInputData::SpinData &psd = *pspins[s];
+      psd.rho = sd.rho[i];
+      psd.rho_13 = sd.rho_13[i];
+      psd.gamma = sd.gamma[i];
+      for (int j=0; j<3; j++)
+          psd.del_rho[j] = (sd.del_rho.empty() ? 0.0 : sd.del_rho[3*i+j]);
+      for (int j=0; j<6; j++) psd.hes_rho[j] = 0.0;
+      psd.lap_rho = 0.0;
+    }
+  id.gamma_ab = gamma_ab[i];
+}
+
+void
+PointBatchOutputData::resize(int n)
+{
+  energy.resize(n);
+  df_drho_a.resize(n);
+  df_drho_b.resize(n);
+  df_dgamma_aa.resize(n);
+  df_dgamma_bb.resize(n);
+  df_dgamma_ab.resize(n);
+  zero();
+}
+
+void
+PointBatchOutputData::zero()
+{
+  std::fill(energy.begin(), energy.end(), 0.0);
+  std::fill(df_drho_a.begin(), df_drho_a.end(), 0.0);
+  std::fill(df_drho_b.begin(), df_drho_b.end(), 0.0);
+  std::fill(df_dgamma_aa.begin(), df_dgamma_aa.end(), 0.0);
+  std::fill(df_dgamma_bb.begin(), df_dgamma_bb.end(), 0.0);
+  std::fill(df_dgamma_ab.begin(), df_dgamma_ab.end(), 0.0);
+}
+
+void
+PointBatchOutputData::set_point(int i, const PointOutputData &od)
+{
+  energy[i] = od.energy;
+  df_drho_a[i] = od.df_drho_a;
+  df_drho_b[i] = od.df_drho_b;
+  df_dgamma_aa[i] = od.df_dgamma_aa;
+  df_dgamma_bb[i] = od.df_dgamma_bb;
+  df_dgamma_ab[i] = od.df_dgamma_ab;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 // DenFunctional
@@ -169,6 +273,21 @@ DenFunctional::set_compute_potential(int i)
   compute_potential_ = i;
 }
 
+void
+DenFunctional::points(const PointBatchInputData &id,
+                      PointBatchOutputData &od)
+{
+  od.resize(id.npoint);
+  PointOutputData pod;
+  for (int i=0; i<id.npoint; i++) {
+      if (id.mask[i] == 0.0) continue;
+      PointInputData pid(id.r[i]);
+      id.get_point(i, pid);
+      point(pid, pod);
+      od.set_point(i, pod);
+    }
+}
+
 void
 DenFunctional::gradient(const PointInputData& id, PointOutputData& od,
                         double *grad_f, int acenter,
@@ -819,6 +938,30 @@ SumDenFunctional::point(const PointInputData &id,
     }
 }
 
+void
+SumDenFunctional::points(const PointBatchInputData &id,
+                         PointBatchOutputData &od)
+{
+  const int n = id.npoint;
+  od.resize(n);
+  PointBatchOutputData tmpod;
+  for (int i=0; i < n_; i++) {
+      funcs_[i]->points(id, tmpod);
+
+      const double c = coefs_[i];
+      for (int j=0; j<n; j++) od.energy[j] += c * tmpod.energy[j];
+      if (compute_potential_) {
+          for (int j=0; j<n; j++) {
+              od.df_drho_a[j] += c * tmpod.df_drho_a[j];
+              od.df_drho_b[j] += c * tmpod.df_drho_b[j];
+              od.df_dgamma_aa[j] += c * tmpod.df_dgamma_aa[j];
+              od.df_dgamma_ab[j] += c * tmpod.df_dgamma_ab[j];
+              od.df_dgamma_bb[j] += c * tmpod.df_dgamma_bb[j];
+            }
+        }
+    }
+}
+
 void
 SumDenFunctional::print(ostream& o) const
 {
@@ -1148,6 +1291,44 @@ SlaterXFunctional::point(const PointInputData &id,
     }
 }
 
+void
+SlaterXFunctional::points(const PointBatchInputData &id,
+                          PointBatchOutputData &od)
+{
+  const double mcx2rthird = -0.9305257363491; // -1.5*(3/4pi)^1/3
+  const double dmcx2rthird = -1.2407009817988; // 2*(3/4pi)^1/3
+  const int n = id.npoint;
+  od.resize(n);
+
+  const double *mask = &id.mask[0];
+  const double *rho_a = &id.a.rho[0], *rho_13_a = &id.a.rho_13[0];
+  const double *rho_b = &id.b.rho[0], *rho_13_b = &id.b.rho_13[0];
+  double *energy = &od.energy[0];
+  double *df_drho_a = &od.df_drho_a[0], *df_drho_b = &od.df_drho_b[0];
+
+  if (!spin_polarized_) {
+      for (int i=0; i<n; i++)
+          energy[i] = mask[i] * mcx2rthird * 2.0 * rho_a[i] * rho_13_a[i];
+      if (compute_potential_) {
+          for (int i=0; i<n; i++) {
+              df_drho_a[i] = mask[i] * dmcx2rthird * rho_13_a[i];
+              df_drho_b[i] = df_drho_a[i];
+            }
+        }
+    }
+  else {
+      for (int i=0; i<n; i++)
+          energy[i] = mask[i] * mcx2rthird
+                    * (rho_a[i] * rho_13_a[i] + rho_b[i] * rho_13_b[i]);
+      if (compute_potential_) {
+          for (int i=0; i<n; i++) {
+              df_drho_a[i] = mask[i] * dmcx2rthird * rho_13_a[i];
+              df_drho_b[i] = mask[i] * dmcx2rthird * rho_13_b[i];
+            }
+        }
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // PW92LCFunctional
 // Coded by Matt Leininger
@@ -1755,6 +1936,60 @@ VWN1LCFunctional::point_lc(const PointInputData &id, PointOutputData &od,
   }
 }
 
+// The same as point_lc, for a batch of points.  Masked points are
+// evaluated at a safe density and their results discarded.
+void
+VWN1LCFunctional::points(const PointBatchInputData &id,
+                         PointBatchOutputData &od)
+{
+  const int n = id.npoint;
+  od.resize(n);
+
+  const double four_thirds = 4./3.;
+  const double one_third = 1./3.;
+  const double two_thirds = 2./3.;
+  const double sixth = 1./6.;
+  const double fpp0 = 4./9. * 1./(pow(2., (1./3.)) - 1.);
+
+  const double *mask = &id.mask[0];
+  const double *rho_a = &id.a.rho[0], *rho_b = &id.b.rho[0];
+  double *energy = &od.energy[0];
+  double *df_drho_a = &od.df_drho_a[0], *df_drho_b = &od.df_drho_b[0];
+
+  for (int i=0; i<n; i++) {
+      const double m = mask[i];
+      const double rho = (m != 0.0 ? rho_a[i] + rho_b[i] : 1.0);
+      const double zeta = (m != 0.0 ? (rho_a[i] - rho_b[i])/rho : 0.0);
+      const double x = pow(3./(4.*M_PI*rho), sixth);
+      const double rs = x*x;
+
+      const double epc = F(x, Ap_, x0p_, bp_, cp_);
+      const double efc = F(x, Af_, x0f_, bf_, cf_);
+      const double f = 9./8.*fpp0*(pow(1.+zeta, four_thirds)
+                                   +pow(1.-zeta, four_thirds)-2.);
+      const double ec = epc + f * (efc - epc);
+
+      energy[i] = m * ec * rho;
+
+      if (compute_potential_) {
+          if (!spin_polarized_) {
+              const double dec_dr_s = dFdr_s(x, Ap_, x0p_, bp_, cp_);
+              df_drho_a[i] = df_drho_b[i] = m * (ec - (rs/3.)*dec_dr_s);
+            }
+          else {
+              const double depc_dr_s0 = dFdr_s(x, Ap_, x0p_, bp_, cp_);
+              const double defc_dr_s1 = dFdr_s(x, Af_, x0f_, bf_, cf_);
+              const double dec_dr_s = depc_dr_s0 + f * (defc_dr_s1 - depc_dr_s0);
+              const double fp = two_thirds * (pow((1+zeta),one_third)
+                    - pow((1-zeta),one_third))/(pow(2.,one_third)-1);
+              const double dec_dzeta = fp * (efc - epc);
+              df_drho_a[i] = m * (ec - (rs/3.)*dec_dr_s - (zeta-1)*dec_dzeta);
+              df_drho_b[i] = m * (ec - (rs/3.)*dec_dr_s - (zeta+1)*dec_dzeta);
+            }
+        }
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // VWN2LCFunctional
 // Coded by Matt Leininger
@@ -2411,6 +2646,63 @@ Becke88XFunctional::point(const PointInputData &id,
 }
 
 
+// The Becke88 exchange of one spin, written without branches so that
+// the loop in Becke88XFunctional::points can be vectorized.  Densities
+// below MIN_DENSITY give zero.
+static inline void
+becke88_spin(double rho, double gamma, double beta, double beta6,
+             double &ex, double &df_drho, double &df_dgamma)
+{
+  const double on = (rho > MIN_DENSITY);
+  const double r = (rho > MIN_DENSITY ? rho : 1.0);
+  const double g = (rho > MIN_DENSITY ? gamma : 0.0);
+  const double r13 = pow(r,(1./3.));
+  const double r43 = r*r13;
+  const double x = sqrt(g)/r43;
+  const double x2 = x*x;
+  const double denom = 1./(1.+beta6*x*asinh(x));
+  const double F = sqrt(1.+x2);
+  const double H = 1. - 6.*beta*x2/F;
+  ex = -on * r43*beta*x2*denom;
+  df_drho = on * 4./3. * beta * r13 * x2 * denom*denom * H;
+  df_dgamma = -on * beta * denom / (2.*r43) * (1. + denom*H);
+}
+
+void
+Becke88XFunctional::points(const PointBatchInputData &id,
+                           PointBatchOutputData &od)
+{
+  const int n = id.npoint;
+  od.resize(n);
+  const double beta = beta_;
+  const double beta6 = beta6_;
+
+  for (int i=0; i<n; i++) {
+      const double m = id.mask[i];
+      double exa, dra, dga;
+      becke88_spin(id.a.rho[i], id.a.gamma[i], beta, beta6, exa, dra, dga);
+      if (spin_polarized_) {
+          double exb, drb, dgb;
+          becke88_spin(id.b.rho[i], id.b.gamma[i], beta, beta6, exb, drb, dgb);
+          od.energy[i] = m * (exa + exb);
+          if (compute_potential_) {
+              od.df_drho_a[i] = m * dra;
+              od.df_dgamma_aa[i] = m * dga;
+              od.df_drho_b[i] = m * drb;
+              od.df_dgamma_bb[i] = m * dgb;
+            }
+        }
+      else {
+          od.energy[i] = m * 2.0 * exa;
+          if (compute_potential_) {
+              od.df_drho_a[i] = od.df_drho_b[i] = m * dra;
+              od.df_dgamma_aa[i] = od.df_dgamma_bb[i] = m * dga;
+            }
+        }
+    }
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 // LYPCFunctional
 // Coded by Matt Leininger
@@ -2579,6 +2871,101 @@ LYPCFunctional::point(const PointInputData &id,
 
 }
 
+// The same as point, for a batch of points.  Masked points are evaluated
+// at a safe density and their results discarded.
+void
+LYPCFunctional::points(const PointBatchInputData &id,
+                       PointBatchOutputData &od)
+{
+  const int n = id.npoint;
+  od.resize(n);
+
+  const double a = a_;
+  const double b = b_;
+  const double c = c_;
+  const double d = d_;
+  const double ab = a*b;
+  const double cf=0.3*pow(3.* M_PI*M_PI,2./3.);
+  const double cf144 = pow(2.,2./3.)*144.*cf;
+
+  for (int i=0; i<n; i++) {
+      const double m = id.mask[i];
+      const double ra = (m != 0.0 ? id.a.rho[i] : 0.5);
+      const double rb = (m != 0.0 ? id.b.rho[i] : 0.5);
+      const double grad_a2 = (m != 0.0 ? id.a.gamma[i] : 0.0);
+      const double grad_b2 = (m != 0.0 ? id.b.gamma[i] : 0.0);
+      const double grad_ab = (m != 0.0 ? id.gamma_ab[i] : 0.0);
+
+      const double dens = ra+rb;
+      const double dens2 = dens*dens;
+      const double dens1_3 = pow(dens,-1./3.);
+      const double denom = 1.+d*dens1_3;
+      const double expo = exp(-c*dens1_3);
+      const double omega = expo/denom*pow(dens,-11./3.);
+      const double delta = c*dens1_3+d*dens1_3/denom;
+      const double ra_53 = pow(ra,5./3.);
+      const double rb_53 = pow(rb,5./3.);
+
+      const double dens_a2 = ra*ra;
+      const double dens_b2 = rb*rb;
+      const double dens_ab = ra*rb;
+      const double grad_aabb = grad_a2+grad_b2;
+      const double rgrad = ra*grad_a2 + rb*grad_b2;
+
+      const double eflyp_1 = -4.*a*dens_ab/(dens*denom);
+      const double intermediate_1 = cf144*(ra*ra_53+rb*rb_53)
+               + (47.-7.*delta)*(grad_aabb+2.*grad_ab)-(45.-delta)*grad_aabb
+               + 2.*(11.-delta)/dens*rgrad;
+      const double intermediate_2 = -4./3.*dens2*grad_ab
+                                    - (dens_a2*grad_b2+dens_b2*grad_a2);
+      const double intermediate_3 = dens_ab/18.* intermediate_1 + intermediate_2;
+      od.energy[i] = m * (eflyp_1 - omega*ab*intermediate_3);
+
+      if (!compute_potential_) continue;
+
+      const double dens4_3 = pow(dens,-4./3.);
+      const double ddelta_drho = 1./3* (d*d*dens4_3*dens1_3/(denom*denom)
+                                        - delta/dens);
+      const double domega_drho = -1./3.*omega*dens4_3*(11./dens1_3 - c - d/denom);
+      // the terms that are the same for both spins
+      const double common = -domega_drho*ab*intermediate_3;
+      const double common_2 =
+                  - 2./dens*ddelta_drho*rgrad
+                  - 2.*(11.-delta)/dens2*rgrad
+                  - 7.*ddelta_drho*(grad_aabb+2.*grad_ab)
+                  + ddelta_drho*grad_aabb;
+
+      const double df1_drho_a = -4.*a*rb/(dens*denom) *
+                                (ra/3.*d*dens4_3/denom + 1. - ra/dens);
+      const double df2_drho_a = common
+                  - omega*ab*( rb/18.* intermediate_1
+                  + dens_ab/18.*(cf144*8./3.*ra_53
+                  +  2.*(11.-delta)*grad_a2/dens + common_2)
+                  - 8./3.*dens*grad_ab - 2.*ra*grad_b2 );
+      od.df_drho_a[i] = m * (df1_drho_a + df2_drho_a);
+      od.df_dgamma_aa[i] = -m*omega*ab
+               * (dens_ab/9.*(1.-3.*delta + ra*(11.-delta)/dens) - dens_b2);
+      od.df_dgamma_ab[i] = -m*omega*ab*(dens_ab/9.*(47.-7.*delta) - 4./3.*dens2);
+
+      if (spin_polarized_) {
+          const double df1_drho_b = -4.*a*ra/(dens*denom) *
+                                    (rb/3.*d*dens4_3/denom + 1. - rb/dens);
+          const double df2_drho_b = common
+                  - omega*ab*( ra/18.* intermediate_1
+                  + dens_ab/18.*(cf144*8./3.*rb_53
+                  +  2.*(11.-delta)*grad_b2/dens + common_2)
+                  - 8./3.*dens*grad_ab - 2.*rb*grad_a2 );
+          od.df_drho_b[i] = m * (df1_drho_b + df2_drho_b);
+          od.df_dgamma_bb[i] = -m*omega*ab
+                   * (dens_ab/9.*(1.-3.*delta + rb*(11.-delta)/dens) - dens_a2);
+        }
+      else {
+          od.df_drho_b[i] = od.df_drho_a[i];
+          od.df_dgamma_bb[i] = od.df_dgamma_aa[i];
+        }
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // Perdew 1986 (P86) Correlation Functional
 // J. P. Perdew, PRB, 33, 8822, 1986.
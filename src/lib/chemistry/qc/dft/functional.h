@@ -28,6 +28,7 @@
 #ifndef _chemistry_qc_dft_functional_h
 #define _chemistry_qc_dft_functional_h
 
+#include <vector>
 #include <util/state/state.h>
 #include <math/scmat/vector3.h>
 #include <chemistry/qc/wfn/wfn.h>
@@ -93,6 +94,61 @@ struct PointOutputData {
 
 };
 
+/** Contains data needed by a DenFunctional at a batch of points.  Each
+    quantity is stored as an array with an element per point (three for
+    del_rho), so that functionals can loop over the points. Density hessians
+    are not included. */
+struct PointBatchInputData {
+    struct SpinData {
+        std::vector<double> rho;
+        // rho^(1/3)
+        std::vector<double> rho_13;
+        std::vector<double> del_rho;
+        // gamma = (del rho).(del rho)
+        std::vector<double> gamma;
+    };
+    SpinData a, b;
+
+    // gamma_ab = (del rho_a).(del rho_b)
+    std::vector<double> gamma_ab;
+
+    /** 1.0 for points that are to be evaluated and 0.0 for points where
+        the density is negligible.  Functionals must give zero output for
+        the latter, for example by multiplying their results by mask. */
+    std::vector<double> mask;
+
+    int npoint;
+    const SCVector3 *r;
+
+    PointBatchInputData(): npoint(0), r(0) {}
+
+    /// Allocates the arrays for npoint points at r.
+    void resize(int npoint, const SCVector3 *r, int need_gradient);
+    /** Fill in derived quantities, given rho and del_rho.  Points with a
+        total density not greater than min_density are masked. */
+    void compute_derived(int spin_polarized,
+                         int need_gradient,
+                         double min_density);
+    /// Copies the data for point i to id, which must have been created with r[i].
+    void get_point(int i, PointInputData &id) const;
+};
+
+/** Contains data generated at a batch of points by a DenFunctional. */
+struct PointBatchOutputData {
+    std::vector<double> energy;
+    std::vector<double> df_drho_a;
+    std::vector<double> df_drho_b;
+    std::vector<double> df_dgamma_aa;
+    std::vector<double> df_dgamma_bb;
+    std::vector<double> df_dgamma_ab;
+
+    /// Allocates the arrays for npoint points and zeros them.
+    void resize(int npoint);
+    void zero();
+    /// Stores od as the output for point i.
+    void set_point(int i, const PointOutputData &od);
+};
+
 /** An abstract base class for density functionals. */
 class DenFunctional: virtual public SavableState {
   protected:
@@ -124,6 +180,9 @@ class DenFunctional: virtual public SavableState {
     virtual int need_density_hessian();
 
     virtual void point(const PointInputData&, PointOutputData&) = 0;
+    /** Evaluates the functional at a batch of points.  The default
+        implementation calls point() for each point that is not masked. */
+    virtual void points(const PointBatchInputData&, PointBatchOutputData&);
     void gradient(const PointInputData&, PointOutputData&,
                   double *gradient, int acenter,
                   GaussianBasisSet *basis,
@@ -201,6 +260,7 @@ class SumDenFunctional: public DenFunctional {
     int need_density_gradient();
 
     void point(const PointInputData&, PointOutputData&);
+    void points(const PointBatchInputData&, PointBatchOutputData&);
 
     void print(std::ostream& =ExEnv::out0()) const;
 
@@ -451,6 +511,7 @@ class SlaterXFunctional: public DenFunctional {
     ~SlaterXFunctional();
     void save_data_state(StateOut &);
     void point(const PointInputData&, PointOutputData&);
+    void points(const PointBatchInputData&, PointBatchOutputData&);
 };
 
 /** An abstract base class from which the various VWN (Vosko, Wilk and
@@ -504,6 +565,7 @@ class VWN1LCFunctional: public VWNLCFunctional {
 
     void point_lc(const PointInputData&, PointOutputData&,
                   double &, double &, double &);
+    void points(const PointBatchInputData&, PointBatchOutputData&);
 };
 
 /** The VWN2LCFunctional computes energies and densities using the
@@ -647,6 +709,7 @@ class Becke88XFunctional: public DenFunctional {
     int need_density_gradient();
 
     void point(const PointInputData&, PointOutputData&);
+    void points(const PointBatchInputData&, PointBatchOutputData&);
 };
 
 /** Implements the Lee, Yang, and Parr functional.
@@ -674,6 +737,7 @@ class LYPCFunctional: public DenFunctional {
     int need_density_gradient();
 
     void point(const PointInputData&, PointOutputData&);
+    void points(const PointBatchInputData&, PointBatchOutputData&);
 };
 
 /** Implements the Perdew-Wang 1986 (PW86) Exchange functional.
@@ -276,12 +276,13 @@ HSOSKS::ao_fock(double accuracy)
       conts[i] = new LocalHSOSKSContribution(gmats[i], pmat, gmatos[i], pmato,
                                              functional_->a0());
       gblds[i] = new LocalGBuild<LocalHSOSKSContribution>(*conts[i], tbis_[i],
-        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i
+        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i, gbsched_
         );
 
       threadgrp_->add_thread(i, gblds[i]);
     }
 
+    if (!gbsched_.null()) gbsched_->start();
     Timer tim("start thread");
     if (threadgrp_->start_threads() < 0) {
       ExEnv::err0() << indent
@@ -297,6 +298,7 @@ HSOSKS::ao_fock(double accuracy)
       abort();
     }
     tim.exit("stop thread");
+    if (!gbsched_.null()) gbsched_->finish();
       
     double tnint=0;
     for (i=0; i < nthread; i++) {
@@ -31,8 +31,10 @@
 #include <util/misc/formio.h>
 #include <util/state/stateio.h>
 #include <util/container/carray.h>
+#include <math/scmat/blas.h>
 #include <chemistry/qc/dft/integrator.h>
 
+#include <algorithm>
 #include <vector>
 #include <limits>
 #include <cmath>
@@ -139,6 +141,23 @@ protected:
 	double *w_gradient_;
 	double *f_gradient_;
 
+	// batched evaluation
+	int batch_size_;
+	int *batch_col_;                  // column of each basis function in the batch, or -1
+	std::vector<int> batch_bf_;       // basis function of each column
+	std::vector<double> batch_phi_;   // basis function values, a row per point
+	std::vector<double> batch_phig_;  // x, y, and z gradients of the basis functions
+	std::vector<double> batch_dmat_;  // density matrix block of the batch's functions
+	std::vector<double> batch_tmp_;   // phi*D, and the potential weighted values
+	std::vector<double> batch_vmat_;  // potential integrals of the batch's functions
+	void do_batch(int npoint, const SCVector3 *r,
+	              pair<double,double> *result,
+	              const std::vector<int> *shells);
+	void batch_density(int npoint, int ncol, const double *dmat,
+	                   double *rho, double *grad);
+	void batch_potential(int npoint, int ncol, const double *drho,
+	                     const double *grads, double *vmat);
+
 public:
 	DenIntegratorThread(int ithread, int nthread,
 	                    DenIntegrator *integrator,
@@ -151,6 +170,13 @@ public:
 	                    int need_nuclear_gradient);
 	virtual ~DenIntegratorThread();
 	pair<double,double> do_point(const SCVector3 &r);
+	/** Evaluates npoint points, equivalent to calling do_point(r[i]) for each
+	    point.  Compact batches of points are evaluated together.  If shells
+	    is given and not empty, only those shells are evaluated at the
+	    points. */
+	void do_points(int npoint, const SCVector3 *r,
+	               pair<double,double> *result,
+	               const std::vector<int> *shells = 0);
 	double do_point(int iatom, const SCVector3 &r,
 	                double weight, double multiplier,
 	                double *nuclear_gradient,
@@ -228,6 +254,10 @@ DenIntegratorThread::DenIntegratorThread(int ithread, int nthread,
 		w_gradient_ = new double[n_integration_center_*3];
 		f_gradient_ = new double[natom_*3];
 	}
+
+	batch_size_ = integrator->batch_size();
+	batch_col_ = new int[nbasis_];
+	for (int i=0; i<nbasis_; i++) batch_col_[i] = -1;
 }
 
 DenIntegratorThread::~DenIntegratorThread()
@@ -237,13 +267,14 @@ DenIntegratorThread::~DenIntegratorThread()
 	delete[] nuclear_gradient_;
 	delete[] f_gradient_;
 	delete[] w_gradient_;
+	delete[] batch_col_;
 }
 
 ///////////////////////////////////////////////////////////////////////////
 // DenIntegrator
 
 static ClassDesc DenIntegrator_cd(
-    typeid(DenIntegrator),"DenIntegrator",1,"public SavableState",
+    typeid(DenIntegrator),"DenIntegrator",2,"public SavableState",
     0, 0, 0);
 
 DenIntegrator::DenIntegrator(StateIn& s):
@@ -252,6 +283,9 @@ DenIntegrator::DenIntegrator(StateIn& s):
 	init_object();
 	s.get(linear_scaling_);
 	s.get(use_dmat_bound_);
+	if (s.version(::class_desc<DenIntegrator>()) >= 2) {
+		s.get(batch_size_);
+	}
 }
 
 DenIntegrator::DenIntegrator()
@@ -267,6 +301,8 @@ DenIntegrator::DenIntegrator(const Ref<KeyVal>& keyval)
 	                                       KeyValValueboolean(linear_scaling_));
 	use_dmat_bound_ = keyval->booleanvalue("use_dmat_bound",
 	                                       KeyValValueboolean(use_dmat_bound_));
+	batch_size_ = keyval->intvalue("batch_size",
+	                               KeyValValueint(batch_size_));
 }
 
 DenIntegrator::~DenIntegrator()
@@ -278,6 +314,7 @@ DenIntegrator::save_data_state(StateOut& s)
 {
 	s.put(linear_scaling_);
 	s.put(use_dmat_bound_);
+	s.put(batch_size_);
 }
 
 void
@@ -289,6 +326,7 @@ DenIntegrator::init_object()
 	accuracy_ = DBL_EPSILON;
 	linear_scaling_ = 1;
 	use_dmat_bound_ = 1;
+	batch_size_ = 128;
 	alpha_vmat_ = 0;
 	beta_vmat_ = 0;
 }
@@ -537,6 +575,198 @@ DenIntegratorThread::do_point(const SCVector3 &r)
 	return pair<double,double>(id.a.rho + id.b.rho, od.energy);
 }
 
+void
+DenIntegratorThread::do_points(int npoint, const SCVector3 *r,
+                               pair<double,double> *result,
+                               const std::vector<int> *shells)
+{
+	// the batched code does not handle density hessians
+	if (batch_size_ <= 1 || need_hessian_) {
+		for (int i=0; i<npoint; i++) result[i] = do_point(r[i]);
+		return;
+	}
+
+	for (int first=0; first<npoint; first+=batch_size_) {
+		int n = std::min(batch_size_, npoint-first);
+		do_batch(n, r+first, result+first, shells);
+	}
+}
+
+// Computes the density (and its gradient) at each point of the batch from
+// the basis function values in batch_phi_ (batch_phig_):
+// rho = sum_ij D_ij phi_i phi_j and grad rho = 2 sum_ij D_ij phi_i grad phi_j.
+void
+DenIntegratorThread::batch_density(int npoint, int ncol, const double *dmat,
+                                   double *rho, double *grad)
+{
+	const int ld = nbasis_;
+
+	// the block of the lower triangle packed density for the batch's functions
+	double *d = &batch_dmat_[0];
+	for (int c=0; c<ncol; c++) {
+		int ibf = batch_bf_[c];
+		for (int e=0; e<=c; e++) {
+			int jbf = batch_bf_[e];
+			double dij = (ibf>=jbf ? dmat[((ibf*(ibf+1))>>1) + jbf]
+			                       : dmat[((jbf*(jbf+1))>>1) + ibf]);
+			d[c*ncol+e] = d[e*ncol+c] = dij;
+		}
+	}
+
+	// X = phi D
+	double *x = &batch_tmp_[0];
+	C_DGEMM('n', 'n', npoint, ncol, ncol, 1.0, &batch_phi_[0], ld,
+	        d, ncol, 0.0, x, ld);
+
+	const double *phi = &batch_phi_[0];
+	for (int p=0; p<npoint; p++) {
+		const double *xp = &x[p*ld];
+		const double *phip = &phi[p*ld];
+		double r = 0.0;
+		for (int c=0; c<ncol; c++) r += xp[c] * phip[c];
+		rho[p] = r;
+		if (need_gradient_) {
+			for (int ixyz=0; ixyz<3; ixyz++) {
+				const double *phigp = &batch_phig_[(ixyz*npoint+p)*ld];
+				double g = 0.0;
+				for (int c=0; c<ncol; c++) g += xp[c] * phigp[c];
+				grad[p*3+ixyz] = 2.0 * g;
+			}
+		}
+	}
+}
+
+// Adds the batch's contribution to the lower triangle packed potential
+// integrals. With B_pi = 1/2 drho_p phi_pi + grads_p . grad phi_pi the
+// contribution is phi^T B + B^T phi.
+void
+DenIntegratorThread::batch_potential(int npoint, int ncol, const double *drho,
+                                     const double *grads, double *vmat)
+{
+	const int ld = nbasis_;
+
+	const double *phi = &batch_phi_[0];
+	double *b = &batch_tmp_[0];
+	for (int p=0; p<npoint; p++) {
+		const double *phip = &phi[p*ld];
+		double *bp = &b[p*ld];
+		double hdrho = 0.5 * drho[p];
+		for (int c=0; c<ncol; c++) bp[c] = hdrho * phip[c];
+		if (need_gradient_) {
+			for (int ixyz=0; ixyz<3; ixyz++) {
+				const double *phigp = &batch_phig_[(ixyz*npoint+p)*ld];
+				double g = grads[p*3+ixyz];
+				for (int c=0; c<ncol; c++) bp[c] += g * phigp[c];
+			}
+		}
+	}
+
+	double *m = &batch_vmat_[0];
+	C_DGEMM('t', 'n', ncol, ncol, npoint, 1.0, phi, ld, b, ld, 0.0, m, ncol);
+
+	for (int c=0; c<ncol; c++) {
+		int ibf = batch_bf_[c];
+		int ioff = (ibf*(ibf+1))>>1;
+		for (int e=0; e<ncol; e++) {
+			int jbf = batch_bf_[e];
+			if (jbf < ibf) vmat[ioff + jbf] += m[c*ncol+e] + m[e*ncol+c];
+			else if (jbf == ibf) vmat[ioff + jbf] += 2.0 * m[c*ncol+c];
+		}
+	}
+}
+
+// Evaluates a batch of at most batch_size_ points. The basis function
+// values at all points are gathered into dense blocks over the union of the
+// functions contributing at any point, so that the density and the
+// potential integrals can be formed with matrix multiplies.
+void
+DenIntegratorThread::do_batch(int npoint, const SCVector3 *r,
+                              pair<double,double> *result,
+                              const std::vector<int> *shells)
+{
+	const int ld = nbasis_;
+
+	batch_phi_.resize(npoint*ld);
+	std::fill(batch_phi_.begin(), batch_phi_.end(), 0.0);
+	if (need_gradient_) {
+		batch_phig_.resize(3*npoint*ld);
+		std::fill(batch_phig_.begin(), batch_phig_.end(), 0.0);
+	}
+	batch_bf_.resize(nbasis_);
+
+	int ncol = 0;
+	for (int p=0; p<npoint; p++) {
+		if (shells != 0 && !shells->empty())
+			den_->compute_basis_values(r[p], need_gradient_,
+			                           shells->size(), &(*shells)[0]);
+		else
+			den_->compute_basis_values(r[p], need_gradient_);
+		int ncontrib_bf = den_->ncontrib_bf();
+		const int *contrib_bf = den_->contrib_bf();
+		const double *bs_values = den_->bs_values();
+		const double *bsg_values = den_->bsg_values();
+		for (int j=0; j<ncontrib_bf; j++) {
+			int jt = contrib_bf[j];
+			int c = batch_col_[jt];
+			if (c < 0) {
+				c = batch_col_[jt] = ncol;
+				batch_bf_[ncol++] = jt;
+			}
+			batch_phi_[p*ld+c] = bs_values[j];
+			if (need_gradient_) {
+				for (int ixyz=0; ixyz<3; ixyz++)
+					batch_phig_[(ixyz*npoint+p)*ld+c] = bsg_values[j*3+ixyz];
+			}
+		}
+	}
+	for (int c=0; c<ncol; c++) batch_col_[batch_bf_[c]] = -1;
+
+	batch_dmat_.resize(ncol*ncol);
+	batch_tmp_.resize(npoint*ld);
+	batch_vmat_.resize(ncol*ncol);
+
+	// the densities, which are computed as in BatchElectronDensity
+	PointBatchInputData in;
+	in.resize(npoint, r, need_gradient_);
+	batch_density(npoint, ncol, den_->alpha_density_matrix(),
+	              &in.a.rho[0], (need_gradient_?&in.a.del_rho[0]:0));
+	if (spin_polarized_) {
+		batch_density(npoint, ncol, den_->beta_density_matrix(),
+		              &in.b.rho[0], (need_gradient_?&in.b.del_rho[0]:0));
+	}
+	in.compute_derived(spin_polarized_, need_gradient_, 1e2*DBL_EPSILON);
+
+	// evaluate the functional; points with negligible density are masked
+	// and give zero energy and potential
+	PointBatchOutputData out;
+	func_->points(in, out);
+
+	const std::vector<double> &drho_a = out.df_drho_a;
+	const std::vector<double> &drho_b = out.df_drho_b;
+	std::vector<double> grads_a(need_gradient_?3*npoint:0, 0.0);
+	std::vector<double> grads_b(need_gradient_?3*npoint:0, 0.0);
+	for (int p=0; p<npoint; p++) {
+		result[p] = pair<double,double>(in.a.rho[p] + in.b.rho[p],
+		                                 out.energy[p]);
+		if (need_gradient_) {
+			for (int ixyz=0; ixyz<3; ixyz++) {
+				grads_a[p*3+ixyz] = 2.0*out.df_dgamma_aa[p]*in.a.del_rho[p*3+ixyz]
+				                    + out.df_dgamma_ab[p]*in.b.del_rho[p*3+ixyz];
+				grads_b[p*3+ixyz] = 2.0*out.df_dgamma_bb[p]*in.b.del_rho[p*3+ixyz]
+				                    + out.df_dgamma_ab[p]*in.a.del_rho[p*3+ixyz];
+			}
+		}
+	}
+
+	if (compute_potential_integrals_) {
+		batch_potential(npoint, ncol, &drho_a[0],
+		                (need_gradient_?&grads_a[0]:0), alpha_vmat_);
+		if (spin_polarized_)
+			batch_potential(npoint, ncol, &drho_b[0],
+			                (need_gradient_?&grads_b[0]:0), beta_vmat_);
+	}
+}
+
 //Original
 double
 DenIntegratorThread::do_point(int iatom, const SCVector3 &r,
@@ -1633,6 +1863,8 @@ private:
 	//miser state variables
 	int estimate_calls_;
 	const static int n_dim_ = 3;
+	// if nonnull, the points and weights of the final boxes are added here
+	vector<IntegrationGridCache::Block> *blocks_;
 	
 	//miser
 	void miser_spray(double *ubounds, double *lbounds, int calls, vector<pair<double,double> > &values, vector<SCVector3> &coords);
@@ -1655,10 +1887,13 @@ public:
 	MCResults miser_integrate(int calls, int max_depth, int estimate_calls, double bounds);
 	MCResults mc_integrate();
 
+	/// Records the points and weights used by miser_integrate in blocks.
+	void set_record(vector<IntegrationGridCache::Block> *blocks) { blocks_ = blocks; }
+
 };
 
 MonteCarloIntegrator::MonteCarloIntegrator(Molecule* mol, DenIntegratorThread* rait, int rstate)
-																	: mol_(mol), rait_(rait)
+																	: mol_(mol), rait_(rait), blocks_(0)
 {
 	rand_init(rstate);
 	init_ofs();
@@ -1927,6 +2162,13 @@ MonteCarloIntegrator::miser_recurse(double* ubounds, double* lbounds, int calls,
 		sum.charge *= w / values.size();
 		sum.energy *= w / values.size();
 		sum.point_count = values.size();
+
+		if (blocks_ != 0 && !coords.empty()) {
+			blocks_->push_back(IntegrationGridCache::Block());
+			IntegrationGridCache::Block &block = blocks_->back();
+			block.points = coords;
+			block.weight = w / values.size();
+		}
 		
 	}
 	
@@ -1941,27 +2183,30 @@ MonteCarloIntegrator::miser_spray(double* ubounds, double* lbounds, int calls,
 	if(0 > calls)
 		throw runtime_error("calls < 0");
 
+	// all points lie in the same box, so they are evaluated as a batch
+	vector<SCVector3> points(calls);
 	for(int i = 0;i < calls; ++i)
 	{
-		const double bohr = 0.5291845266444409;
-		SCVector3 integration_point;
-		pair<double,double> q_e_pair;
+		SCVector3 &integration_point = points[i];
 		
-		SCVector3 atom_r(mol_->r(0));
-		
-		//do{
-			integration_point.x() = randd(lbounds[0],ubounds[0],&rstate_);
-			integration_point.y() = randd(lbounds[1],ubounds[1],&rstate_);
-			integration_point.z() = randd(lbounds[2],ubounds[2],&rstate_);
-		//}while(integration_point.dist(atom_r) < bohr);
+		integration_point.x() = randd(lbounds[0],ubounds[0],&rstate_);
+		integration_point.y() = randd(lbounds[1],ubounds[1],&rstate_);
+		integration_point.z() = randd(lbounds[2],ubounds[2],&rstate_);
+	}
+
+	vector<pair<double,double> > q_e_pairs(calls);
+	if (calls > 0)
+		rait_->do_points(calls, &points[0], &q_e_pairs[0]);
+
+	for(int i = 0;i < calls; ++i)
+	{
+		const SCVector3 &integration_point = points[i];
+		const pair<double,double> &q_e_pair = q_e_pairs[i];
 
 		ofs_ << setw(14) << integration_point.x() << " "
 		    << setw(14) << integration_point.y() << " "
 		    << setw(14) << integration_point.z() << " ";
 
-		q_e_pair = rait_->do_point(integration_point);
-		//q_e_pair = pair<double,double>(1,1);
-
 		ofs_ << setw(14) << q_e_pair.first << endl;
 		
 		values.push_back(q_e_pair);
@@ -2060,6 +2305,11 @@ protected:
 	IntegrationWeight *weight_;
 	int point_count_total_;
 	double total_density_;
+	// the cached grid of this thread, or null
+	vector<IntegrationGridCache::Block> *grid_;
+
+	void find_block_shells(IntegrationGridCache::Block &block);
+	void run_cached_grid();
 
 public:
 	RadialAngularIntegratorThread(int ithread, int nthread,
@@ -2069,7 +2319,8 @@ public:
 	                              int linear_scaling, int use_dmat_bound,
 	                              double accuracy,
 	                              int compute_potential_integrals,
-	                              int need_nuclear_gradient);
+	                              int need_nuclear_gradient,
+	                              vector<IntegrationGridCache::Block> *grid = 0);
 	~RadialAngularIntegratorThread();
 	void run();
 	double total_density() {
@@ -2088,7 +2339,8 @@ RadialAngularIntegratorThread
                                 int linear_scaling, int use_dmat_bound,
                                 double accuracy,
                                 int compute_potential_integrals,
-                                int need_nuclear_gradient):
+                                int need_nuclear_gradient,
+                                vector<IntegrationGridCache::Block> *grid):
 	DenIntegratorThread(ithread,nthread,
 	                    integrator, func,
 	                    den,
@@ -2129,6 +2381,7 @@ RadialAngularIntegratorThread
 
 	point_count_total_ = 0;
 	total_density_ = 0.0;
+	grid_ = grid;
 }
 
 RadialAngularIntegratorThread::~RadialAngularIntegratorThread()
@@ -2138,26 +2391,173 @@ RadialAngularIntegratorThread::~RadialAngularIntegratorThread()
 	delete[] nr_;
 }
 
+// the parameters of the MISER integration
+static const int miser_calls = 16000;
+static const int miser_max_depth = 7;
+static const int miser_estimate_calls = 32;
+static const double miser_bounds = 10.0;
+
 void
 RadialAngularIntegratorThread::run()
 {
+	if (grid_ != 0 && !grid_->empty()) {
+		run_cached_grid();
+		return;
+	}
+
 	MonteCarloIntegrator mc_integrator(mol_, this);
+	mc_integrator.set_record(grid_);
 	
-	mol_->move_to_coc();
-	mol_->transform_to_charge_principal_axes();
-	
-	MCResults results = mc_integrator.miser_integrate(16000, 7, 32, 10);
+	MCResults results = mc_integrator.miser_integrate(miser_calls,
+	                                                  miser_max_depth,
+	                                                  miser_estimate_calls,
+	                                                  miser_bounds);
 	
 	total_density_ = results.charge;
 	value_ = results.energy;
 	point_count_total_ = results.point_count;
+
+	if (grid_ != 0) {
+		for (int i=0; i<grid_->size(); i++) find_block_shells((*grid_)[i]);
+	}
+}
+
+// The shells that the shell extents select anywhere in the block.  When
+// the density matrix bound is used the screening depends on the density,
+// so the shells are left to be selected at each point.
+void
+RadialAngularIntegratorThread::find_block_shells(IntegrationGridCache::Block &block)
+{
+	block.shells.clear();
+	if (!linear_scaling_ || use_dmat_bound_) return;
+
+	vector<bool> contributes(nshell_, false);
+	for (int i=0; i<block.points.size(); i++) {
+		if (!den_->mark_contributing_shells(block.points[i], contributes))
+			return;
+	}
+	for (int i=0; i<nshell_; i++) {
+		if (contributes[i]) block.shells.push_back(i);
+	}
+}
+
+// Integrates over the points of grid_, which were generated by an earlier
+// MISER integration.
+void
+RadialAngularIntegratorThread::run_cached_grid()
+{
+	vector<pair<double,double> > q_e_pairs;
+	for (int i=0; i<grid_->size(); i++) {
+		const IntegrationGridCache::Block &block = (*grid_)[i];
+		int npoint = block.points.size();
+		q_e_pairs.resize(npoint);
+		do_points(npoint, &block.points[0], &q_e_pairs[0], &block.shells);
+
+		double charge = 0.0, energy = 0.0;
+		for (int j=0; j<npoint; j++) {
+			charge += q_e_pairs[j].first;
+			energy += q_e_pairs[j].second;
+		}
+		total_density_ += charge * block.weight;
+		value_ += energy * block.weight;
+		point_count_total_ += npoint;
+	}
+}
+
+//////////////////////////////////////////////
+//  IntegrationGridCache
+
+static ClassDesc IntegrationGridCache_cd(
+    typeid(IntegrationGridCache),"IntegrationGridCache",1,"public SavableState",
+    0, 0, create<IntegrationGridCache>);
+
+IntegrationGridCache::IntegrationGridCache()
+{
+}
+
+IntegrationGridCache::IntegrationGridCache(StateIn& s):
+	SavableState(s)
+{
+	s.get(key_);
+	int ngrid;
+	s.get(ngrid);
+	grids_.resize(ngrid);
+	for (int i=0; i<ngrid; i++) {
+		int nblock;
+		s.get(nblock);
+		grids_[i].resize(nblock);
+		for (int j=0; j<nblock; j++) {
+			Block &block = grids_[i][j];
+			std::vector<double> xyz;
+			s.get(xyz);
+			block.points.resize(xyz.size()/3);
+			for (int k=0; k<block.points.size(); k++) {
+				block.points[k] = SCVector3(xyz[3*k], xyz[3*k+1], xyz[3*k+2]);
+			}
+			s.get(block.weight);
+			s.get(block.shells);
+		}
+	}
+}
+
+IntegrationGridCache::~IntegrationGridCache()
+{
+}
+
+void
+IntegrationGridCache::save_data_state(StateOut& s)
+{
+	s.put(key_);
+	s.put(ngrid());
+	for (int i=0; i<ngrid(); i++) {
+		s.put(int(grids_[i].size()));
+		for (int j=0; j<grids_[i].size(); j++) {
+			const Block &block = grids_[i][j];
+			std::vector<double> xyz(3*block.points.size());
+			for (int k=0; k<block.points.size(); k++) {
+				for (int l=0; l<3; l++) xyz[3*k+l] = block.points[k][l];
+			}
+			s.put(xyz);
+			s.put(block.weight);
+			s.put(block.shells);
+		}
+	}
+}
+
+bool
+IntegrationGridCache::valid(const std::vector<double> &key) const
+{
+	if (key_.empty() || key_.size() != key.size()) return false;
+	for (int i=0; i<key.size(); i++) {
+		if (fabs(key_[i] - key[i]) > 1.0e-10 * std::max(1.0, fabs(key[i])))
+			return false;
+	}
+	return true;
+}
+
+void
+IntegrationGridCache::reset(int ngrid)
+{
+	key_.clear();
+	grids_.clear();
+	grids_.resize(ngrid);
+}
+
+size_t
+IntegrationGridCache::npoint() const
+{
+	size_t n = 0;
+	for (int i=0; i<ngrid(); i++) {
+		for (int j=0; j<grids_[i].size(); j++) n += grids_[i][j].points.size();
+	}
+	return n;
 }
 
 //////////////////////////////////////////////
 //  RadialAngularIntegrator
 
 static ClassDesc RadialAngularIntegrator_cd(
-    typeid(RadialAngularIntegrator),"RadialAngularIntegrator",1,"public DenIntegrator",
+    typeid(RadialAngularIntegrator),"RadialAngularIntegrator",2,"public DenIntegrator",
     0, create<RadialAngularIntegrator>, create<RadialAngularIntegrator>);
 
 RadialAngularIntegrator::RadialAngularIntegrator(StateIn& s):
@@ -2194,6 +2594,16 @@ RadialAngularIntegrator::RadialAngularIntegrator(StateIn& s):
 	radial_user_ << SavableState::restore_state(s);
 	angular_user_ << SavableState::restore_state(s);
 
+	cache_grid_ = 1;
+	save_grid_ = 0;
+	if (s.version(::class_desc<RadialAngularIntegrator>()) >= 2) {
+		s.get(cache_grid_);
+		s.get(save_grid_);
+		grid_cache_ << SavableState::restore_state(s);
+	}
+	if (!cache_grid_) grid_cache_ = 0;
+	else if (grid_cache_.null()) grid_cache_ = new IntegrationGridCache;
+
 	init_default_grids();
 	set_grids();
 
@@ -2203,6 +2613,10 @@ RadialAngularIntegrator::RadialAngularIntegrator()
 {
 	weight_  = new BeckeIntegrationWeight;
 
+	cache_grid_ = 1;
+	save_grid_ = 0;
+	grid_cache_ = new IntegrationGridCache;
+
 	init_parameters();
 	init_default_grids();
 	set_grids();
@@ -2220,6 +2634,10 @@ RadialAngularIntegrator::RadialAngularIntegrator(const Ref<KeyVal>& keyval):
 	if (weight_.null()) weight_ = new BeckeIntegrationWeight;
 //  ExEnv::outn() << "In Ref<KeyVal> Constructor" << endl;
 
+	cache_grid_ = keyval->booleanvalue("cache_grid", KeyValValueboolean(1));
+	save_grid_ = keyval->booleanvalue("save_grid", KeyValValueboolean(0));
+	if (cache_grid_) grid_cache_ = new IntegrationGridCache;
+
 	init_parameters(keyval);
 	init_default_grids();
 	set_grids();
@@ -2259,6 +2677,37 @@ RadialAngularIntegrator::save_data_state(StateOut& s)
 
 	SavableState::save_state(radial_user_.pointer(),s);
 	SavableState::save_state(angular_user_.pointer(),s);
+
+	s.put(cache_grid_);
+	s.put(save_grid_);
+	SavableState::save_state((save_grid_?grid_cache_.pointer():0),s);
+}
+
+std::vector<double>
+RadialAngularIntegrator::grid_key(int ithread_overall, int nthread,
+                                  int nthread_overall)
+{
+	std::vector<double> key;
+	key.push_back(ithread_overall);
+	key.push_back(nthread);
+	key.push_back(nthread_overall);
+	key.push_back(miser_calls);
+	key.push_back(miser_max_depth);
+	key.push_back(miser_estimate_calls);
+	key.push_back(miser_bounds);
+	// these determine the significant shells of the blocks
+	key.push_back(linear_scaling_);
+	key.push_back(use_dmat_bound_);
+	key.push_back(basis()->nshell());
+	key.push_back(basis()->nbasis());
+
+	Ref<Molecule> mol = basis()->molecule();
+	key.push_back(mol->natom());
+	for (int i=0; i<mol->natom(); i++) {
+		key.push_back(mol->Z(i));
+		for (int j=0; j<3; j++) key.push_back(mol->r(i,j));
+	}
+	return key;
 }
 
 void
@@ -2664,6 +3113,10 @@ RadialAngularIntegrator::integrate(const Ref<DenFunctional> &denfunc,
 
 	init_integration(denfunc, densa, densb, nuclear_gradient);
 
+	// the MISER integration is done in this frame
+	basis()->molecule()->move_to_coc();
+	basis()->molecule()->transform_to_charge_principal_axes();
+
 	weight_->init(basis()->molecule(), DBL_EPSILON);
 
 	int me = messagegrp_->me();
@@ -2679,6 +3132,16 @@ RadialAngularIntegrator::integrate(const Ref<DenFunctional> &denfunc,
 		messagegrp_->send(me + 1, ithread_overall_next);
 	}
 
+	// reuse the grid of the previous integration if it is still valid,
+	// otherwise the threads will store the grid they generate
+	std::vector<double> grid_key;
+	bool grid_cached = false;
+	if (!grid_cache_.null()) {
+		grid_key = this->grid_key(ithread_overall, nthread, nthread_overall);
+		grid_cached = grid_cache_->valid(grid_key);
+		if (!grid_cached) grid_cache_->reset(nthread);
+	}
+
 	// create threads
 	//cout << "creating test lock" << endl;
 	//Ref<ThreadLock> reflock = threadgrp_->new_lock();
@@ -2697,7 +3160,8 @@ RadialAngularIntegrator::integrate(const Ref<DenFunctional> &denfunc,
 		    bed,
 		    linear_scaling_, use_dmat_bound_,
 		    accuracy_, compute_potential_integrals_,
-		    nuclear_gradient != 0);
+		    nuclear_gradient != 0,
+		    (!grid_cache_.null()?&grid_cache_->grid(i):0));
 		threadgrp_->add_thread(i, threads[i]);
 	}
 
@@ -2751,13 +3215,16 @@ RadialAngularIntegrator::integrate(const Ref<DenFunctional> &denfunc,
 	threadgrp_->delete_threads();
 	delete[] threads;
 
+	if (!grid_cache_.null() && !grid_cached) grid_cache_->set_key(grid_key);
+
 	messagegrp_->sum(point_count_total);
 	messagegrp_->sum(total_density);
 	done_integration();
 	weight_->done();
 
 	ExEnv::out0() << indent
-	              << "Total integration points = " << point_count_total << endl;
+	              << "Total integration points = " << point_count_total
+	              << (grid_cached?" (cached grid)":"") << endl;
 	ExEnv::out0() << indent
 	              << "Integrated electron density = "
 	              << scprintf("%16.12f", total_density)
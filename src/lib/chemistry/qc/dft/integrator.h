@@ -70,6 +70,7 @@ class DenIntegrator: virtual public SavableState {
 
     int linear_scaling_;
     int use_dmat_bound_;
+    int batch_size_;
 
     void init_integration(const Ref<DenFunctional> &func,
                           const RefSymmSCMatrix& densa,
@@ -81,7 +82,23 @@ class DenIntegrator: virtual public SavableState {
   public:
     /// Construct a new DenIntegrator.
     DenIntegrator();
-    /// Construct a new DenIntegrator given the KeyVal input.
+    /** Construct a new DenIntegrator given the KeyVal input.
+        <dl>
+
+        <dt><tt>linear_scaling</tt><dd>If true, only basis functions
+        that are significant at a point are evaluated there.  The default
+        is true.
+
+        <dt><tt>use_dmat_bound</tt><dd>If true, bounds on the density
+        matrix are used to further reduce the number of basis functions.
+        The default is true.
+
+        <dt><tt>batch_size</tt><dd>Points are evaluated in batches of up
+        to this many points, where the densities and potential integrals
+        are formed with matrix multiplies.  A value of 1 evaluates points
+        one at a time.  The default is 128.
+
+        </dl> */
     DenIntegrator(const Ref<KeyVal> &);
     /// Construct a new DenIntegrator given the StateIn data.
     DenIntegrator(StateIn &);
@@ -95,6 +112,8 @@ class DenIntegrator: virtual public SavableState {
     const Ref<Integral> &integral() const { return integral_; }
     /// Returns the result of the integration.
     double value() const { return value_; }
+    /// Returns the maximum number of points evaluated as a batch.
+    int batch_size() const { return batch_size_; }
 
     /// Sets the accuracy to use in the integration.
     void set_accuracy(double a);
@@ -365,6 +384,45 @@ class GaussLegendreAngularIntegrator: public AngularIntegrator {
     void print(std::ostream & =ExEnv::out0()) const;
 };
 
+/** IntegrationGridCache holds the integration points and weights
+    generated by a RadialAngularIntegrator, so that they can be reused
+    while the geometry and the grid parameters do not change.  There is
+    one grid for each integration thread.  The points of a grid are
+    grouped into blocks of nearby points, and each block also records the
+    shells that are significant anywhere in it. */
+class IntegrationGridCache: public SavableState {
+  public:
+    /// A group of nearby points that share a weight.
+    struct Block {
+      std::vector<SCVector3> points;
+      /// The weight of each point.
+      double weight;
+      /// The significant shells.  If empty, all shells are used.
+      std::vector<int> shells;
+    };
+  private:
+    std::vector<double> key_;
+    std::vector< std::vector<Block> > grids_;
+  public:
+    IntegrationGridCache();
+    IntegrationGridCache(StateIn &);
+    ~IntegrationGridCache();
+    void save_data_state(StateOut &);
+
+    /// Returns true if the grids were generated for key.
+    bool valid(const std::vector<double> &key) const;
+    /** Discards the grids and prepares ngrid empty grids.  The cache
+        is not valid until set_key is called. */
+    void reset(int ngrid);
+    /// Marks the grids as generated for key.
+    void set_key(const std::vector<double> &key) { key_ = key; }
+
+    int ngrid() const { return grids_.size(); }
+    std::vector<Block> &grid(int i) { return grids_[i]; }
+    /// Returns the total number of points.
+    size_t npoint() const;
+};
+
 /** An implementation of an integrator using any combination of
     a RadialIntegrator and an AngularIntegrator. */
 class RadialAngularIntegrator: public DenIntegrator {
@@ -378,6 +436,9 @@ class RadialAngularIntegrator: public DenIntegrator {
     int dynamic_grids_;
     int natomic_rows_;
     int max_gridtype_;
+    int cache_grid_;
+    int save_grid_;
+    Ref<IntegrationGridCache> grid_cache_;
   protected:
     Ref<IntegrationWeight> weight_;
     Ref<RadialIntegrator> radial_user_;
@@ -424,6 +485,14 @@ class RadialAngularIntegrator: public DenIntegrator {
         <dt><tt>weight</tt><dd>Specifies the IntegrationWeight object.
         The default is BeckeIntegrationWeight.
 
+        <dt><tt>cache_grid</tt><dd>If true, the integration points and
+        weights are kept and reused by later integrations, until the
+        geometry or the grid parameters change.  The default is true.
+
+        <dt><tt>save_grid</tt><dd>If true, the cached grid is saved with
+        the state of this object, so that restarted calculations need not
+        generate it again.  The default is false.
+
         </dl>
      */
     RadialAngularIntegrator(const Ref<KeyVal> &);
@@ -449,7 +518,14 @@ class RadialAngularIntegrator: public DenIntegrator {
     void init_pruning_coefficients(void);
     void init_alpha_coefficients(void);
     int select_dynamic_grid(void);
+    /** Returns the values that determine the grid of the threads
+        ithread_overall to ithread_overall+nthread-1, out of
+        nthread_overall threads. */
+    std::vector<double> grid_key(int ithread_overall, int nthread,
+                                 int nthread_overall);
     Ref<IntegrationWeight> weight() { return weight_; }
+    /// Returns the grid cache, which is null if grids are not cached.
+    const Ref<IntegrationGridCache> &grid_cache() const { return grid_cache_; }
 };
 
 }
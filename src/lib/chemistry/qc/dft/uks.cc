@@ -274,12 +274,13 @@ UKS::ao_fock(double accuracy)
       conts[i] = new LocalUKSContribution(gmats[i], pmat, gmatos[i], pmato,
                                           functional_->a0());
       gblds[i] = new LocalGBuild<LocalUKSContribution>(*conts[i], tbis_[i],
-        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i
+        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i, gbsched_
         );
 
       threadgrp_->add_thread(i, gblds[i]);
     }
 
+    if (!gbsched_.null()) gbsched_->start();
     Timer tim("start thread");
     if (threadgrp_->start_threads() < 0) {
       ExEnv::err0() << indent
@@ -295,6 +296,7 @@ UKS::ao_fock(double accuracy)
       abort();
     }
     tim.exit("stop thread");
+    if (!gbsched_.null()) gbsched_->finish();
       
     double tnint=0;
     for (i=0; i < nthread; i++) {
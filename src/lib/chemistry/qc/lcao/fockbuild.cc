@@ -1628,19 +1628,23 @@ GenericFockContribution::GenericFockContribution(
   f_b1_(f_b1),
   f_b2_(f_b2),
   p_b_(p_b),
-  fockbuildmatrixtype_(fockbuildmatrixtype)
+  fockbuildmatrixtype_(fockbuildmatrixtype),
+  nscratch_(0)
 {
   f_b1_equiv_f_b2 = f_b1_->equiv(f_b2);
 
   use_shell_blocks_
       = (fockbuildmatrixtype_ == "prefetched_distributed"?false:true);
 
-  nlocks_ = 23;
-  locks_.resize(nlocks_);
-
   Ref<MessageGrp> msg = MessageGrp::get_default_messagegrp();
   Ref<ThreadGrp>  thr = ThreadGrp::get_default_threadgrp();
 
+  // all threads update the same matrices, so use enough locks that two
+  // threads rarely need the same one at the same time
+  nlocks_ = 23;
+  while (nlocks_ < 8*thr->nthread()) nlocks_ = 2*nlocks_ + 1;
+  locks_.resize(nlocks_);
+
   // FIXME: fbamg is holding a reference to this, making
   // the reference circular.
   Ref<FockBuildAMG> fbamg;
@@ -1664,6 +1668,28 @@ GenericFockContribution::GenericFockContribution(
 }
 
 
+GenericFockContribution::GenericFockContribution(
+    const GenericFockContribution &c):
+  FockContribution(c),
+  nfmat_(c.nfmat_),
+  jmats_(c.jmats_),
+  kmats_(c.kmats_),
+  k_is_j_(c.k_is_j_),
+  npmat_(c.npmat_),
+  pmats_(c.pmats_),
+  f_b1_(c.f_b1_),
+  f_b2_(c.f_b2_),
+  p_b_(c.p_b_),
+  f_b1_equiv_f_b2(c.f_b1_equiv_f_b2),
+  nlocks_(c.nlocks_),
+  locks_(c.locks_),
+  fockbuildmatrixtype_(c.fockbuildmatrixtype_),
+  use_shell_blocks_(c.use_shell_blocks_),
+  fbamg_(c.fbamg_),
+  nscratch_(0)
+{
+}
+
 FockBuildMatrix *
 GenericFockContribution::fockbuildmatrix(int matrix,
                                          const std::string &type,
@@ -1852,6 +1878,9 @@ GenericFockContribution::accum(const Ref<FockContribution> &c_abs)
 
 GenericFockContribution::~GenericFockContribution()
 {
+  for (int i=0; i<scratch_.size(); i++) {
+      delete[] scratch_[i].first;
+    }
 }
 
 signed char *
@@ -2049,6 +2078,12 @@ FockBuildThread_F11_P11::FockBuildThread_F11_P11(
   eri_->set_integral_storage(integral_->storage_unused()/nthread);
 }
 
+void
+FockBuildThread_F11_P11::set_integral_precision(double precision)
+{
+  eri_->set_integral_precision(precision);
+}
+
 void
 FockBuildThread_F11_P11::prefetch_blocks(const Ref<FockDist> &dist,
                                          int iblock, int jblock, int kblock, int lblock)
@@ -2364,6 +2399,13 @@ FockBuildThread_F12_P33::FockBuildThread_F12_P33(
   eri_K_->set_integral_storage(integral_->storage_unused()/nthread/2);
 }
 
+void
+FockBuildThread_F12_P33::set_integral_precision(double precision)
+{
+  eri_J_->set_integral_precision(precision);
+  eri_K_->set_integral_precision(precision);
+}
+
 void
 FockBuildThread_F12_P33::run()
 {
@@ -2628,6 +2670,15 @@ FockBuild::build()
   contrib_->update();
 }
 
+void
+FockBuild::set_integral_precision(double precision)
+{
+  int nthread = thr_->nthread();
+  for (int i=0; i<nthread; i++) {
+      thread_[i]->set_integral_precision(precision);
+    }
+}
+
 void
 FockBuild::done_threads()
 {
@@ -29,6 +29,8 @@
 #ifndef _chemistry_qc_lcao_fockbuild_h
 #define _chemistry_qc_lcao_fockbuild_h
 
+#include <vector>
+#include <utility>
 #include <mpqc_config.h>
 #include <util/misc/regtime.h>
 #include <util/group/thread.h>
@@ -505,6 +507,12 @@ class GenericFockContribution: public FockContribution {
 
     Ref<FockBuildAMG> fbamg_;
 
+    /// Scratch buffers used by JKBlock's and their sizes.  These are not
+    /// shared with clones, so each thread reuses its own buffers.
+    std::vector<std::pair<double*,int> > scratch_;
+    /// The number of scratch buffers in use.
+    int nscratch_;
+
     FockBuildMatrix *fockbuildmatrix(int matrix,
                                      const std::string &type,
                                      const Ref<MessageGrp> &msg,
@@ -599,6 +607,9 @@ class GenericFockContribution: public FockContribution {
                             const Ref<GaussianBasisSet> &f_b2,
                             const Ref<GaussianBasisSet> &p_b,
                             const std::string &fockbuildmatrixtype);
+    /** The copy shares the matrices and locks, but has its own scratch
+        buffers. */
+    GenericFockContribution(const GenericFockContribution &);
 
     void pmax_contrib(const Ref<FockBuildMatrix> &mat,
                       signed char *pmax) const;
@@ -627,18 +638,34 @@ class GenericFockContribution: public FockContribution {
     }
 
     Ref<ThreadLock> &get_lock(int i, int Ish, int Jsh) {
-      int hash = (i+(Ish+1)*(Jsh+1))%nlocks_;
-      return locks_[hash];
+      unsigned int hash = (unsigned int)Ish*2654435761u
+                        + (unsigned int)Jsh*40503u + (unsigned int)i;
+      return locks_[hash%nlocks_];
     }
 
     double *alloc_scratch(int size) {
-      double *data = new double[size];
-      memset(data,0,sizeof(double)*size);
-      return data;
+      if (nscratch_ == scratch_.size())
+          scratch_.push_back(std::make_pair((double*)0, 0));
+      std::pair<double*,int> &buf = scratch_[nscratch_++];
+      if (buf.second < size) {
+          delete[] buf.first;
+          buf.first = new double[size];
+          buf.second = size;
+        }
+      memset(buf.first,0,sizeof(double)*size);
+      return buf.first;
     }
 
     void free_scratch(double *data) {
-      delete[] data;
+      // JKBlock's are usually freed in the reverse order of allocation,
+      // so the search starts with the last buffer handed out
+      for (int i=nscratch_-1; i>=0; i--) {
+          if (scratch_[i].first == data) {
+              nscratch_--;
+              std::swap(scratch_[i], scratch_[nscratch_]);
+              return;
+            }
+        }
     }
 
     void set_fmat(int i, const RefSCMatrix &);
@@ -707,7 +734,10 @@ class FockBuildThread : public Thread {
       else      { return can_sym_offset(j,i); }
     }
   public:
-    /// Each thread must be given a unique contribution, c.
+    /** Each thread must be given a unique contribution, c.  The
+        contributions of all threads share the storage for the Fock
+        matrices, so memory use does not grow with the number of
+        threads. */
     FockBuildThread(const Ref<FockDistribution> &fockdist,
                     const Ref<MessageGrp> &msg,
                     int nthread,
@@ -724,6 +754,8 @@ class FockBuildThread : public Thread {
     void set_compute_K(bool compute_K) { compute_K_ = compute_K; }
     void set_coef_K(double coef_K) { coef_K_ = coef_K; }
     void set_pmax(const signed char *pmax) { pmax_ = pmax; }
+    /// Sets the precision of the integrals cached by the evaluators.
+    virtual void set_integral_precision(double precision) = 0;
     const Ref<RegionTimer> get_timer() const { return timer_; }
 };
 
@@ -756,6 +788,7 @@ class FockBuildThread_F11_P11 : public FockBuildThread {
                             bool compute_J,
                             bool compute_K,
                             double coef_K);
+    void set_integral_precision(double precision);
     void run();
 };
 
@@ -793,6 +826,7 @@ class FockBuildThread_F12_P33 : public FockBuildThread {
                             bool compute_J,
                             bool compute_K,
                             double coef_K);
+    void set_integral_precision(double precision);
     void run();
 };
 
@@ -801,6 +835,12 @@ class FockBuildThread_F12_P33 : public FockBuildThread {
     helper class, FockContribution, to do the work of forming
     contributions from the density matrices and integrals and placing these
     into the partial Fock matrices (the G matrices).
+
+    Each thread uses a clone of the FockContribution that refers to the
+    same Fock matrix data.  A thread sums the contributions to a shell
+    block into a scratch buffer of its own, and adds the buffer to the
+    shared block under one of a set of locks that is striped over the
+    blocks and sized with the number of threads.
 */
 class FockBuild: public RefCount {
     Ref<FockDistribution> fockdist_;
@@ -873,6 +913,10 @@ class FockBuild: public RefCount {
 
     const Ref<FockContribution> &contrib() const { return contrib_; }
     void set_accuracy(double acc) { accuracy_ = acc; }
+    /** Cached integrals may differ from the computed ones by up to
+        precision.  This should not exceed the smallest accuracy given to
+        set_accuracy(). */
+    void set_integral_precision(double precision);
 
     void set_compute_J(bool compute_J) { compute_J_ = compute_J; }
     void set_compute_K(bool compute_K) { compute_K_ = compute_K; }
@@ -376,6 +376,7 @@ namespace sc {
         Ref<FockDistribution> fd = new FockDistribution;
         fb_ = new FockBuild(fd, fc, prefetch_blocks, brabasis, ketbasis, densitybasis, msg, thr, localints);
         fb_->set_accuracy(accuracy);
+        fb_->set_integral_precision(accuracy);
         fb_->set_compute_J(really_compute_J);
         fb_->set_compute_K(really_compute_K);
         fb_->build();
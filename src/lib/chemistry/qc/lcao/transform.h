@@ -35,7 +35,7 @@ namespace sc {
 
     /// Describes the method of storing transformed MO integrals.
     struct StoreMethod {
-      enum type { mem_posix = 0, posix = 1, mem_mpi = 2, mpi = 3, mem_only = 4 };
+      enum type { mem_posix = 0, posix = 1, mem_mpi = 2, mpi = 3, mem_only = 4, mmap = 5 };
     };
     /// How integrals are stored. Type_13 means (ix|jy) integrals are stored as (ij|xy)
     enum StorageType {StorageType_First=0, StorageType_Last=1,
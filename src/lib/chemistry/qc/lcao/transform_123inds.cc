@@ -189,6 +189,7 @@ TwoBodyMOIntsTransform_123Inds::run()
   DistShellPair shellpairs(msg,nthread_,mythread_,lock_,bs4,bs3,dynamic,
                            tform_->shell_pair_data());
   shellpairs.set_debug(debug_);
+  shellpairs.set_schwarz_bounds(tbint_, (int)tol_);
   if (debug_) shellpairs.set_print_percent(print_percent/10.0);
   else shellpairs.set_print_percent(print_percent);
   int work_per_thread = bs3_eq_bs4 ?
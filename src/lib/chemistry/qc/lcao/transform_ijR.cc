@@ -29,6 +29,9 @@
 #include<chemistry/qc/lcao/transform_ijR.h>
 #include <math/distarray4/distarray4_memgrp.h>
 #include <math/distarray4/distarray4_node0file.h>
+#ifdef HAVE_SYS_MMAN_H
+#  include <math/distarray4/distarray4_mmapfile.h>
+#endif
 #ifdef HAVE_MPIIO
 #  include <math/distarray4/distarray4_mpiiofile.h>
 #endif
@@ -182,6 +185,13 @@ TwoBodyThreeCenterMOIntsTransform_ijR::init_acc() {
                                          1, space1()->rank(), space2()->rank(), space3()->rank());
     break;
 
+#ifdef HAVE_SYS_MMAN_H
+  case MOIntsTransform::StoreMethod::mmap:
+    ints_acc_ = new DistArray4_MMapFile((file_prefix_+"."+name_).c_str(), num_te_types(),
+                                        1, space1()->rank(), space2()->rank(), space3()->rank());
+    break;
+#endif
+
 #ifdef HAVE_MPIIO
   case MOIntsTransform::StoreMethod::mem_mpi:
     // if can do in one pass, use the factory hints about how data will be used
@@ -44,6 +44,9 @@
 #include <cassert>
 
 #include <math/distarray4/distarray4_node0file.h>
+#ifdef HAVE_SYS_MMAN_H
+#  include <math/distarray4/distarray4_mmapfile.h>
+#endif
 
 // set to 1 when finished rewriting DistArray4_MPIIO
 #define HAVE_R12IA_MPIIO 1
@@ -192,6 +195,13 @@ TwoBodyMOIntsTransform_ixjy::init_acc()
                                          space1_->rank(), space3_->rank(), space2_->rank(), space4_->rank());
     break;
 
+#ifdef HAVE_SYS_MMAN_H
+  case MOIntsTransform::StoreMethod::mmap:
+    ints_acc_ = new DistArray4_MMapFile((file_prefix_+"."+name_).c_str(), num_te_types(),
+                                        space1_->rank(), space3_->rank(), space2_->rank(), space4_->rank());
+    break;
+#endif
+
 #ifdef HAVE_MPIIO
   case MOIntsTransform::StoreMethod::mem_mpi:
     try {
@@ -49,6 +49,9 @@
 #include <cassert>
 
 #include <math/distarray4/distarray4_node0file.h>
+#ifdef HAVE_SYS_MMAN_H
+#  include <math/distarray4/distarray4_mmapfile.h>
+#endif
 #ifdef HAVE_MPIIO
 #  include <math/distarray4/distarray4_mpiiofile.h>
 #endif
@@ -118,7 +121,8 @@ distsize_t
 TwoBodyMOIntsTransform_ixjy_df::compute_transform_dynamic_memory_(int ni) const
 {
   const bool ints_held_on_disk = (this->ints_method_ == MOIntsTransform::StoreMethod::posix) ||
-                                 (this->ints_method_ == MOIntsTransform::StoreMethod::mpi);
+                                 (this->ints_method_ == MOIntsTransform::StoreMethod::mpi) ||
+                                 (this->ints_method_ == MOIntsTransform::StoreMethod::mmap);
 
   TwoBodyOperSet::type oset = intdescr()->operset();
   const bool coulomb_only = (oset == TwoBodyOperSet::ERI);
@@ -211,6 +215,13 @@ TwoBodyMOIntsTransform_ixjy_df::init_acc()
                                          space1_->rank(), space3_->rank(), space2_->rank(), space4_->rank());
     break;
 
+#ifdef HAVE_SYS_MMAN_H
+  case MOIntsTransform::StoreMethod::mmap:
+    ints_acc_ = new DistArray4_MMapFile((file_prefix_+"."+name_).c_str(), num_te_types(),
+                                        space1_->rank(), space3_->rank(), space2_->rank(), space4_->rank());
+    break;
+#endif
+
 #ifdef HAVE_MPIIO
   case MOIntsTransform::StoreMethod::mem_mpi:
     try {
@@ -115,6 +115,13 @@ WavefunctionWorld::WavefunctionWorld(const Ref<KeyVal>& keyval)
   else if (ints_str == std::string("mem-posix")) {
     ints_method_ = StoreMethod::mem_posix;
   }
+  else if (ints_str == std::string("mmap")) {
+#ifdef HAVE_SYS_MMAN_H
+    ints_method_ = StoreMethod::mmap;
+#else
+    throw std::runtime_error("WavefunctionWorld::WavefunctionWorld -- store_ints=mmap is not valid in this environment (no mmap detected)");
+#endif
+  }
   else if (ints_str == std::string("mpi")) {
 #ifdef HAVE_MPIIO
     ints_method_ = StoreMethod::mpi;
@@ -372,6 +379,8 @@ WavefunctionWorld::print(std::ostream& o) const {
     ints_str = std::string("mem-posix"); break;
   case WavefunctionWorld::StoreMethod::posix:
     ints_str = std::string("posix"); break;
+  case WavefunctionWorld::StoreMethod::mmap:
+    ints_str = std::string("mmap"); break;
 #ifdef HAVE_MPIIO
   case WavefunctionWorld::StoreMethod::mem_mpi:
     ints_str = std::string("mem-mpi"); break;
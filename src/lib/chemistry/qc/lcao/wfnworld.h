@@ -59,6 +59,10 @@ public:
       <dt><tt>posix</tt><dd> Store integrals in a binary file on task 0's node using POSIX I/O.
       This method does not allow all steps to be parallelized but it is most likely to work in all environments.
 
+      <dt><tt>mmap</tt><dd> Store integrals in a binary file on task 0's node, like <tt>posix</tt>,
+      but access the file through a memory mapping. Blocks of integrals are then read directly from the
+      page cache without copying, which makes repeated reads of the same blocks cheap.
+
       <dt><tt>mpi</tt><dd> Store integrals in a binary file using MPI-I/O. This method allows
       parallelization of all steps, but requires MPI-I/O capability (including MPI-I/O capable file system;
       see keyword <tt>ints_file</tt>)
@@ -76,7 +80,7 @@ public:
     The default is <tt>posix</tt>.
 
     <dt><tt>ints_file</tt><dd> This specifies the prefix for the transformed
-    MO integrals file if <tt>ints</tt> is set to <tt>posix</tt> or <tt>mpi</tt>.
+    MO integrals file if <tt>ints</tt> is set to <tt>posix</tt>, <tt>mmap</tt>, or <tt>mpi</tt>.
     If the prefix ends in '/' (slash character) then <i>basename</i><tt>.moints</tt>
     is appended to it where <i>basename</i> is the basename as defined in SCFormIO.
     The default value for the prefix is "./".
@@ -0,0 +1,208 @@
+//
+// intcache.cc
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+#include <util/misc/formio.h>
+#include <util/misc/consumableresources.h>
+#include <chemistry/qc/libint2/intcache.h>
+
+using namespace std;
+using namespace sc;
+
+namespace {
+  template <typename T>
+  void quantize(const double* src, size_t n, double scale, T* dst) {
+    const double oscale = scale > 0.0 ? 1.0 / scale : 0.0;
+    for(size_t i=0; i<n; ++i)
+      dst[i] = static_cast<T>(floor(src[i] * oscale + 0.5));
+  }
+  template <typename T>
+  void dequantize(const T* src, size_t n, double scale, double* dst) {
+    for(size_t i=0; i<n; ++i)
+      dst[i] = src[i] * scale;
+  }
+}
+
+IntegralCacheLibint2::IntegralCacheLibint2(size_t budget, double precision) :
+  used_(0), precision_(precision),
+  nhit_(0), nmiss_(0), nstored_(0), nevicted_(0)
+{
+  const Ref<ConsumableResources>& r = ConsumableResources::get_default_instance();
+  budget_ = std::min(budget, r->memory());
+  r->consume_memory(budget_);
+}
+
+IntegralCacheLibint2::~IntegralCacheLibint2()
+{
+  ConsumableResources::get_default_instance()->release_memory(budget_);
+}
+
+IntegralCacheLibint2::Key
+IntegralCacheLibint2::make_key(int s1, int s2, int s3, int s4, bool redundant)
+{
+  Key key;
+  key.s[0] = s1;
+  key.s[1] = s2;
+  key.s[2] = s3;
+  key.s[3] = s4;
+  key.redundant = redundant;
+  return key;
+}
+
+bool
+IntegralCacheLibint2::find(int s1, int s2, int s3, int s4, bool redundant,
+                           unsigned int ntypes, double* const* buffers, size_t n)
+{
+  EntryMap::const_iterator e = entries_.find(make_key(s1,s2,s3,s4,redundant));
+  if (e == entries_.end() || e->second.error() > precision_) {
+    ++nmiss_;
+    return false;
+  }
+  ++nhit_;
+
+  const Entry& entry = e->second;
+  const double scale = entry.scale;
+  for(unsigned int t=0; t<ntypes; ++t) {
+    const char* data = &entry.data[t * n * entry.width];
+    switch (entry.width) {
+      case 2:
+        dequantize(reinterpret_cast<const short*>(data), n, scale, buffers[t]);
+        break;
+      case 4:
+        dequantize(reinterpret_cast<const int*>(data), n, scale, buffers[t]);
+        break;
+      default:
+        memcpy(buffers[t], data, n * sizeof(double));
+    }
+  }
+  return true;
+}
+
+void
+IntegralCacheLibint2::store(int s1, int s2, int s3, int s4, bool redundant,
+                            unsigned int ntypes, double* const* buffers, size_t n,
+                            double cost)
+{
+  if (budget_ == 0 || n == 0) return;
+  const Key key = make_key(s1,s2,s3,s4,redundant);
+  EntryMap::iterator e = entries_.find(key);
+  if (e != entries_.end()) {
+    // replace quartets cached before the precision was tightened
+    if (e->second.error() <= precision_) return;
+    evict(e);
+  }
+
+  // pick the narrowest integer whose scale, chosen to fit the largest
+  // integral, rounds every integral to within the precision
+  double maxabs = 0.0;
+  for(unsigned int t=0; t<ntypes; ++t)
+    for(size_t i=0; i<n; ++i)
+      maxabs = std::max(maxabs, fabs(buffers[t][i]));
+  unsigned char width = sizeof(double);
+  double scale = 0.0;
+  if (maxabs == 0.0) {
+    width = 2;
+  }
+  else if (maxabs / 32767.0 <= 2.0 * precision_) {
+    width = 2;
+    scale = maxabs / 32767.0;
+  }
+  else if (maxabs / 2147483647.0 <= 2.0 * precision_) {
+    width = 4;
+    scale = maxabs / 2147483647.0;
+  }
+
+  const size_t nbytes = ntypes * n * width;
+  const size_t actualsize = nbytes + sizeof(Entry) + sizeof(Key);
+  if (actualsize > budget_) return;
+
+  // make room by evicting the cheapest quartets, if they are cheaper than this one
+  if (used_ + actualsize > budget_) {
+    const size_t needed = used_ + actualsize - budget_;
+    size_t accumsize = 0;
+    double accumcost = 0.0;
+    CostMap::iterator c = costs_.begin();
+    for(; c != costs_.end() && accumsize < needed; ++c) {
+      accumsize += entries_.find(c->second)->second.actualsize();
+      accumcost += c->first;
+      if (accumcost >= cost) return;
+    }
+    while (costs_.begin() != c)
+      evict(entries_.find(costs_.begin()->second));
+  }
+
+  Entry& entry = entries_[key];
+  entry.width = width;
+  entry.scale = scale;
+  entry.data.resize(nbytes);
+  for(unsigned int t=0; t<ntypes; ++t) {
+    char* data = &entry.data[t * n * width];
+    switch (width) {
+      case 2:
+        quantize(buffers[t], n, scale, reinterpret_cast<short*>(data));
+        break;
+      case 4:
+        quantize(buffers[t], n, scale, reinterpret_cast<int*>(data));
+        break;
+      default:
+        memcpy(data, buffers[t], n * sizeof(double));
+    }
+  }
+  entry.cost = costs_.insert(std::make_pair(cost, key));
+  used_ += entry.actualsize();
+  ++nstored_;
+}
+
+void
+IntegralCacheLibint2::evict(EntryMap::iterator e)
+{
+  used_ -= e->second.actualsize();
+  costs_.erase(e->second.cost);
+  entries_.erase(e);
+  ++nevicted_;
+}
+
+void
+IntegralCacheLibint2::print_stats(std::ostream& o) const
+{
+  o << indent << "IntegralCacheLibint2:" << endl;
+  o << incindent;
+  o << indent << scprintf("budget    = %lu bytes", (unsigned long)budget_) << endl;
+  o << indent << scprintf("used      = %lu bytes", (unsigned long)used_) << endl;
+  o << indent << scprintf("precision = %8.2e", precision_) << endl;
+  o << indent << scprintf("quartets  = %lu", (unsigned long)entries_.size()) << endl;
+  o << indent << scprintf("hits      = %lu", (unsigned long)nhit_) << endl;
+  o << indent << scprintf("misses    = %lu", (unsigned long)nmiss_) << endl;
+  o << indent << scprintf("stored    = %lu", (unsigned long)nstored_) << endl;
+  o << indent << scprintf("evicted   = %lu", (unsigned long)nevicted_) << endl;
+  o << decindent;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
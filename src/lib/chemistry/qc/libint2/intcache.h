@@ -0,0 +1,132 @@
+//
+// intcache.h
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#ifndef _chemistry_qc_libint2_intcache_h
+#define _chemistry_qc_libint2_intcache_h
+
+#include <map>
+#include <vector>
+#include <iostream>
+
+#include <util/ref/ref.h>
+#include <util/misc/exenv.h>
+
+namespace sc {
+
+/** IntegralCacheLibint2 keeps compressed shell quartets of two-body
+    integrals for semi-direct evaluation with TwoBodyIntLibint2.
+
+    Each quartet is quantized with its own scale, the largest integral
+    divided by the largest 16 bit integer, and stored in 16 bit integers
+    if that keeps every integral within the precision of the computed one.
+    Otherwise 32 bit integers are tried in the same way, and if those are
+    too coarse as well the quartet is kept in full precision.  A cached
+    quartet that is less accurate than the current precision is
+    recomputed and replaced when it is next requested.  When the budget is
+    exhausted, a new quartet replaces the cheapest cached quartets only if
+    it is more expensive than all of them together, so that the cache
+    converges to the most expensive quartets that fit.  The budget is
+    taken from the default ConsumableResources for the lifetime of the
+    cache.
+ */
+class IntegralCacheLibint2: public RefCount {
+  public:
+    /** budget is the memory in bytes the cache may use; it is reduced to
+        what is available in the default ConsumableResources. */
+    IntegralCacheLibint2(size_t budget, double precision);
+    ~IntegralCacheLibint2();
+
+    /** If quartet (s1 s2|s3 s4) is cached, decompresses its n integrals
+        of each of the ntypes operator types into buffers[t] and returns
+        true. */
+    bool find(int s1, int s2, int s3, int s4, bool redundant,
+              unsigned int ntypes, double* const* buffers, size_t n);
+    /** Offers the n integrals of each of the ntypes operator types of
+        quartet (s1 s2|s3 s4) to the cache; cost estimates the work to
+        recompute them. */
+    void store(int s1, int s2, int s3, int s4, bool redundant,
+               unsigned int ntypes, double* const* buffers, size_t n,
+               double cost);
+
+    /// the memory budget in bytes
+    size_t budget() const { return budget_; }
+    /// the memory used by the cached quartets in bytes
+    size_t used() const { return used_; }
+    /// the absolute error bound of the cached integrals
+    double precision() const { return precision_; }
+    /// changes the error bound; quartets cached less accurately are replaced
+    void set_precision(double precision) { precision_ = precision; }
+
+    size_t nhit() const { return nhit_; }
+    size_t nmiss() const { return nmiss_; }
+    size_t nstored() const { return nstored_; }
+    size_t nevicted() const { return nevicted_; }
+
+    void print_stats(std::ostream& o = ExEnv::out0()) const;
+
+  private:
+    struct Key {
+        int s[4];
+        bool redundant;
+        bool operator<(const Key& k) const {
+          for(int i=0; i<4; ++i) {
+            if (s[i] != k.s[i]) return s[i] < k.s[i];
+          }
+          return redundant < k.redundant;
+        }
+    };
+    typedef std::multimap<double, Key> CostMap;
+    struct Entry {
+        // bytes per integral: 2, 4, or 8 (unquantized)
+        unsigned char width;
+        // the integrals are the stored integers times scale
+        double scale;
+        std::vector<char> data;
+        CostMap::iterator cost;
+        size_t actualsize() const { return data.size() + sizeof(Entry) + sizeof(Key); }
+        double error() const { return width == sizeof(double) ? 0.0 : 0.5 * scale; }
+    };
+    typedef std::map<Key, Entry> EntryMap;
+
+    size_t budget_;
+    size_t used_;
+    double precision_;
+    EntryMap entries_;
+    CostMap costs_;
+
+    size_t nhit_;
+    size_t nmiss_;
+    size_t nstored_;
+    size_t nevicted_;
+
+    static Key make_key(int s1, int s2, int s3, int s4, bool redundant);
+    void evict(EntryMap::iterator e);
+};
+
+}
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
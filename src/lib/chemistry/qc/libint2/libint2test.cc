@@ -27,6 +27,8 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
+#include <algorithm>
 
 #include <util/misc/formio.h>
 #include <util/misc/regtime.h>
@@ -46,6 +48,7 @@
 #include <chemistry/qc/basis/cartit_cca.h>
 #include <chemistry/qc/libint2/libint2.h>
 #include <chemistry/qc/libint2/int2e.h>
+#include <chemistry/qc/libint2/tbintbatchlibint2.h>
 
 #include <chemistry/qc/scf/linkage.h>
 #include <chemistry/qc/libint2/linkage.h>
@@ -73,6 +76,8 @@ void compare_2e_bufsum_libint2_vs_v3(Ref<TwoBodyInt>& tblibint2,
                                      Ref<TwoBodyInt>& tbv3);
 void compare_2e_unique_bufsum_libint2_vs_v3(Ref<TwoBodyInt>& tblibint2, Ref<
     TwoBodyInt>& tbv3);
+void compare_2e_batch_libint2(Ref<TwoBodyInt>& tblibint2);
+void compare_2e_cache_libint2(Ref<TwoBodyInt>& tblibint2);
 void compare_2e(Ref<TwoBodyInt>& tb1,
                 Ref<TwoBodyInt>& tb2,
                 TwoBodyOper::type otype,
@@ -354,6 +359,12 @@ int main(int argc, char **argv) {
   compare_2e_unique_bufsum_libint2_vs_v3(ereplibint2, erepv3);
   erepv3->set_redundant(1);
   ereplibint2->set_redundant(1);
+
+  cout << "Testing batched Libint2' ERIs against per-quartet Libint2' ERIs" << endl;
+  compare_2e_batch_libint2(ereplibint2);
+
+  cout << "Testing cached Libint2' ERIs against computed Libint2' ERIs" << endl;
+  compare_2e_cache_libint2(ereplibint2);
   cout << "Printing ERI integrals" << endl;
   print_all_ints(ereplibint2, 1, "eri");
 #if LIBINT2_SUPPORT_G12
@@ -858,6 +869,114 @@ void compare_2e(Ref<TwoBodyInt>& tb1,
         }
 }
 
+void compare_2e_cache_libint2(Ref<TwoBodyInt>& tblibint2) {
+  Ref<TwoBodyIntLibint2> tbcached;
+  tbcached << tblibint2->clone();
+  tbcached->set_integral_storage(32*1024*1024);
+  const double precision = tbcached->integral_precision();
+  Ref<GaussianBasisSet> basis = tblibint2->basis();
+  const int nshell = basis->nshell();
+  const double *buffer = tblibint2->buffer();
+  const double *cached = tbcached->buffer();
+
+  // the second pass is served from the cache
+  for (int pass = 0; pass < 2; pass++)
+    for (int sh1 = 0; sh1 < nshell; sh1++)
+      for (int sh2 = 0; sh2 < nshell; sh2++)
+        for (int sh3 = 0; sh3 < nshell; sh3++)
+          for (int sh4 = 0; sh4 < nshell; sh4++) {
+            tblibint2->compute_shell(sh1, sh2, sh3, sh4);
+            tbcached->compute_shell(sh1, sh2, sh3, sh4);
+            const int nbf = basis->shell(sh1).nfunction()
+              * basis->shell(sh2).nfunction()
+              * basis->shell(sh3).nfunction()
+              * basis->shell(sh4).nfunction();
+            for (int f = 0; f < nbf; f++) {
+              if (fabs(buffer[f] - cached[f]) > precision) {
+                cout << scprintf("  (%d %d|%d %d) %d: %20.15f %20.15f",
+                                 sh1, sh2, sh3, sh4, f, buffer[f], cached[f])
+                     << endl;
+                success = 0;
+              }
+            }
+          }
+  tbcached->cache()->print_stats(cout);
+  if (tbcached->cache()->nhit() == 0)
+    success = 0;
+}
+
+void compare_2e_batch_libint2(Ref<TwoBodyInt>& tblibint2) {
+  Ref<TwoBodyIntLibint2> tbint;
+  tbint << tblibint2->clone();
+  Ref<GaussianBasisSet> basis = tblibint2->basis();
+  const int nshell = basis->nshell();
+  const double *buffer = tblibint2->buffer();
+
+  double time0 = RegionTimer::get_wall_time();
+  for (int sh1 = 0; sh1 < nshell; sh1++)
+    for (int sh2 = 0; sh2 < nshell; sh2++)
+      for (int sh3 = 0; sh3 < nshell; sh3++)
+        for (int sh4 = 0; sh4 < nshell; sh4++)
+          tblibint2->compute_shell(sh1, sh2, sh3, sh4);
+  double time_quartet = RegionTimer::get_wall_time() - time0;
+
+  // small batches, so that classes are split over several batches
+  Ref<TwoBodyIntBatchLibint2> batch = new TwoBodyIntBatchLibint2(tbint);
+  batch->set_integral_storage(64*1024);
+  TwoBodyIntBatchLibint2::IntTuple start, fence;
+  for (int c = 0; c < 4; c++) {
+    start[c] = 0;
+    fence[c] = nshell;
+  }
+  int nbatch = 0;
+  time0 = RegionTimer::get_wall_time();
+  batch->init(new TensorIndexRangeIterator<4>(start, fence));
+  while (batch->next())
+    nbatch++;
+  double time_batch = RegionTimer::get_wall_time() - time0;
+
+  cout << scprintf("  per-quartet: %12.6f s", time_quartet) << endl;
+  cout << scprintf("  %6d batches: %12.6f s", nbatch, time_batch) << endl;
+
+  // every quartet must appear once, and its slice of the batch buffer
+  // must hold the integrals of compute_shell
+  std::vector<int> seen(nshell*nshell*nshell*nshell, 0);
+  double maxdiff = 0.0;
+  int nwrong = 0;
+  batch->init(new TensorIndexRangeIterator<4>(start, fence));
+  while (batch->next()) {
+    const double *batchbuf = batch->buffer();
+    const std::vector<TwoBodyIntBatchLibint2::IntTuple>& quartets
+      = batch->current_batch();
+    for (unsigned int q = 0; q < quartets.size(); q++) {
+      const int sh1 = quartets[q][0], sh2 = quartets[q][1];
+      const int sh3 = quartets[q][2], sh4 = quartets[q][3];
+      seen[((sh1*nshell + sh2)*nshell + sh3)*nshell + sh4]++;
+      const size_t nbf = basis->shell(sh1).nfunction()
+        * basis->shell(sh2).nfunction()
+        * basis->shell(sh3).nfunction()
+        * basis->shell(sh4).nfunction();
+      const size_t end = (q+1 < quartets.size()) ? batch->offset(q+1) : batch->size();
+      if (end - batch->offset(q) != nbf) {
+        nwrong++;
+        continue;
+      }
+      tblibint2->compute_shell(sh1, sh2, sh3, sh4);
+      const double *slice = batchbuf + batch->offset(q);
+      for (size_t f = 0; f < nbf; f++)
+        maxdiff = std::max(maxdiff, fabs(slice[f] - buffer[f]));
+    }
+  }
+  for (size_t i = 0; i < seen.size(); i++)
+    if (seen[i] != 1) nwrong++;
+
+  if (nwrong || maxdiff > 1.0E-12) {
+    cout << scprintf("  %d quartets missing, repeated, or of wrong size;"
+                     " max difference %10.3e", nwrong, maxdiff) << endl;
+    success = 0;
+  }
+}
+
 void compare_2e_bufsum_libint2_vs_v3(Ref<TwoBodyInt>& tblibint2,
                                      Ref<TwoBodyInt>& tbv3) {
   Ref<GaussianBasisSet> basis = tblibint2->basis();
@@ -0,0 +1,188 @@
+//
+// tbintbatchlibint2.cc
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#include <limits.h>
+#include <string.h>
+
+#include <chemistry/qc/libint2/tbintbatchlibint2.h>
+
+using namespace std;
+using namespace sc;
+
+TwoBodyIntBatchLibint2::TwoBodyIntBatchLibint2(const Ref<TwoBodyIntLibint2>& tbint) :
+  TwoBodyIntBatch<4>(tbint->integral()),
+  tbint_(tbint),
+  int2e_(tbint->int2elibint2()),
+  log2_precision_(INT_MIN)
+{
+  for(unsigned int c=0; c<4; ++c) {
+    bs_[c] = tbint_->basis(c);
+    const int nshell = bs_[c]->nshell();
+    am_[c].resize(nshell);
+    for(int s=0; s<nshell; ++s)
+      am_[c][s] = bs_[c]->shell(s).max_am();
+    nam_[c] = bs_[c]->max_angular_momentum() + 1;
+  }
+  // 1 MB of integrals per batch by default
+  set_integral_storage(1024*1024);
+  offsets_.push_back(0);
+}
+
+TwoBodyIntBatchLibint2::~TwoBodyIntBatchLibint2()
+{
+}
+
+Ref<TwoBodyIntBatch<4> >
+TwoBodyIntBatchLibint2::clone()
+{
+  Ref<TwoBodyIntLibint2> tbint;
+  tbint << tbint_->clone();
+  Ref<TwoBodyIntBatchLibint2> result = new TwoBodyIntBatchLibint2(tbint);
+  result->set_integral_storage(buf_cap_);
+  result->set_log2_precision(log2_precision_);
+  return result;
+}
+
+void
+TwoBodyIntBatchLibint2::set_integral_storage(size_t storage)
+{
+  buf_cap_ = storage;
+}
+
+unsigned int
+TwoBodyIntBatchLibint2::am_class(const IntTuple& q) const
+{
+  // the bra pair class (l1,l2) and the ket pair class (l3,l4)
+  const unsigned int bra = am_[0][q[0]] * nam_[1] + am_[1][q[1]];
+  const unsigned int ket = am_[2][q[2]] * nam_[3] + am_[3][q[3]];
+  return bra * nam_[2] * nam_[3] + ket;
+}
+
+size_t
+TwoBodyIntBatchLibint2::quartet_size(const IntTuple& q) const
+{
+  size_t result = 1;
+  for(unsigned int c=0; c<4; ++c)
+    result *= bs_[c]->shell(q[c]).nfunction();
+  return result;
+}
+
+void
+TwoBodyIntBatchLibint2::init(const Ref<IndexRangeIterator<4> >& range)
+{
+  range_ = range;
+  range_->init();
+  pending_.clear();
+  shells_in_buffer_.clear();
+  offsets_.resize(1);
+}
+
+bool
+TwoBodyIntBatchLibint2::next()
+{
+  shells_in_buffer_.clear();
+  offsets_.resize(1);
+  if (range_.null())
+    return false;
+
+  const unsigned int ntypes = descr()->size();
+  const size_t capacity = buf_cap_ / (ntypes * sizeof(double));
+
+  // add quartets to their class until one class has a full batch
+  while (range_->in_range()) {
+    const IntTuple q = range_->current();
+    range_->next();
+    if (log2_precision_ != INT_MIN
+        && tbint_->log2_shell_bound(q[0],q[1],q[2],q[3]) < log2_precision_)
+      continue;
+    const size_t size = quartet_size(q);
+    Pending& p = pending_[am_class(q)];
+    const bool full = !p.quartets.empty() && p.size + size > capacity;
+    if (full)
+      compute(p);
+    p.quartets.push_back(q);
+    p.size += size;
+    if (full)
+      return true;
+  }
+
+  // the range is done, compute what is left class by class
+  for(std::map<unsigned int, Pending>::iterator i = pending_.begin();
+      i != pending_.end(); ++i) {
+    if (i->second.quartets.empty())
+      continue;
+    compute(i->second);
+    pending_.erase(i);
+    return true;
+  }
+  pending_.clear();
+  range_ = 0;
+  return false;
+}
+
+void
+TwoBodyIntBatchLibint2::compute(Pending& p)
+{
+  shells_in_buffer_.swap(p.quartets);
+  p.quartets.clear();
+  p.size = 0;
+
+  const size_t nq = shells_in_buffer_.size();
+  offsets_.resize(nq+1);
+  for(size_t b=0; b<nq; ++b)
+    offsets_[b+1] = offsets_[b] + quartet_size(shells_in_buffer_[b]);
+
+  const unsigned int ntypes = descr()->size();
+  const size_t stride = offsets_.back();
+  buffer_.resize(ntypes * stride);
+
+  int2e_->set_redundant(1);
+  for(size_t b=0; b<nq; ++b) {
+    int s[4];
+    for(unsigned int c=0; c<4; ++c)
+      s[c] = shells_in_buffer_[b][c];
+    int2e_->compute_quartet(&s[0], &s[1], &s[2], &s[3]);
+
+    const size_t size = offsets_[b+1] - offsets_[b];
+    for(unsigned int t=0; t<ntypes; ++t)
+      memcpy(&buffer_[t*stride + offsets_[b]], int2e_->buffer(t),
+             size*sizeof(double));
+  }
+}
+
+const double*
+TwoBodyIntBatchLibint2::buffer(TwoBodyOper::type type) const
+{
+  const Ref<TwoBodyOperSetDescr>& d = descr();
+  for(int t=0; t<d->size(); ++t) {
+    if (d->opertype(static_cast<unsigned int>(t)) == type)
+      return buffer_.empty() ? 0 : &buffer_[t * size()];
+  }
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
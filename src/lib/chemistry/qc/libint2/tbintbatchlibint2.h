@@ -0,0 +1,111 @@
+//
+// tbintbatchlibint2.h
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#ifndef _chemistry_qc_libint2_tbintbatchlibint2_h
+#define _chemistry_qc_libint2_tbintbatchlibint2_h
+
+#include <map>
+#include <vector>
+#include <chemistry/qc/basis/tbint_batch.h>
+#include <chemistry/qc/libint2/tbintlibint2.h>
+
+namespace sc {
+
+/** TwoBodyIntBatchLibint2 implements TwoBodyIntBatch<4> for IntegralLibint2.
+
+    next() walks the range lazily, drops quartets whose log2 bound is
+    below log2_precision(), and sorts the rest into pending batches by
+    the angular momentum classes (l1,l2) and (l3,l4) of their bra and
+    ket shell pairs, keeping the range order within a class.  When the
+    pending batch of a class is full, or the range is exhausted, it is
+    evaluated with the Int2eLibint2 engine of a single TwoBodyIntLibint2,
+    so that its primitive pair data (ShellPairsLibint2) and Libint2
+    scratch are reused, and packed into one buffer per operator type.
+    At most one batch per class is held, so the memory does not grow
+    with the size of the range.  The integrals of quartet q of
+    current_batch() begin at offset(q) in each buffer.  A batch holds as
+    many quartets as fit into the integral storage (see
+    set_integral_storage()), but at least one.  The integrals are always
+    redundant.
+ */
+class TwoBodyIntBatchLibint2 : public TwoBodyIntBatch<4> {
+  public:
+    typedef TwoBodyIntBatch<4>::IntTuple IntTuple;
+
+    TwoBodyIntBatchLibint2(const Ref<TwoBodyIntLibint2>& tbint);
+    ~TwoBodyIntBatchLibint2();
+
+    void init(const Ref<IndexRangeIterator<4> >& range);
+    bool next();
+    const std::vector<IntTuple>& current_batch() const { return shells_in_buffer_; }
+    const double* buffer(TwoBodyOper::type type = TwoBodyOper::eri) const;
+    /// the offset of the integrals of quartet q of current_batch() in buffer()
+    size_t offset(unsigned int q) const { return offsets_[q]; }
+    /// the number of integrals per operator type in the current batch
+    size_t size() const { return offsets_.back(); }
+
+    TwoBodyOperSet::type type() const { return tbint_->type(); }
+    const Ref<TwoBodyOperSetDescr>& descr() const { return tbint_->descr(); }
+
+    /// storage is the size of the batch buffers in bytes
+    void set_integral_storage(size_t storage);
+
+    /// quartets with log2 bounds below this are not computed; the default includes all
+    int log2_precision() const { return log2_precision_; }
+    void set_log2_precision(int p) { log2_precision_ = p; }
+
+    bool cloneable() const { return true; }
+    Ref<TwoBodyIntBatch<4> > clone();
+
+  private:
+    Ref<TwoBodyIntLibint2> tbint_;
+    Ref<Int2eLibint2> int2e_;
+    int log2_precision_;
+
+    Ref<IndexRangeIterator<4> > range_;
+    // the quartets taken from range_ but not computed yet, by class
+    struct Pending {
+      std::vector<IntTuple> quartets;
+      size_t size;   // number of integrals per operator type
+      Pending() : size(0) {}
+    };
+    std::map<unsigned int, Pending> pending_;
+    // the angular momentum of each shell, and lmax+1, on each center
+    std::vector<unsigned int> am_[4];
+    unsigned int nam_[4];
+    // offsets_[q] is the start of quartet q in a buffer; offsets_.back() is the size
+    std::vector<size_t> offsets_;
+
+    unsigned int am_class(const IntTuple& q) const;
+    size_t quartet_size(const IntTuple& q) const;
+    /// moves the quartets of p to current_batch() and computes them
+    void compute(Pending& p);
+};
+
+}
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
@@ -133,7 +133,7 @@ TwoBodyIntLibint2::TwoBodyIntLibint2(Integral*integral,
 				     const Ref<IntParams>& params):
     TwoBodyInt(integral,b1,b2,b3,b4), int2etype_(int2etype),
     descr_(TwoBodyOperSetDescr::instance(int2etype)),
-    params_(params)
+    params_(params), cache_precision_(1.0e-12)
 {
     using sc::libint2::Int2eCreator;
   // Which evaluator to use
@@ -239,10 +239,13 @@ TwoBodyIntLibint2::TwoBodyIntLibint2(const TwoBodyIntLibint2& other):
     int2etype_(other.int2etype_),
     descr_(TwoBodyOperSetDescr::instance(other.int2etype_)),
     params_(other.params_),
+    cache_precision_(other.cache_precision_),
     int2elibint2_(other.int2elibint2_->clone())
 {
   buffer_ = int2elibint2_->buffer(TwoBodyOper::eri);
   integral_->adjust_storage(int2elibint2_->storage_used());
+  if (other.cache_.nonnull())
+    set_integral_storage(other.cache_->budget());
 }
 
 TwoBodyIntLibint2::~TwoBodyIntLibint2()
@@ -250,11 +253,49 @@ TwoBodyIntLibint2::~TwoBodyIntLibint2()
   integral_->adjust_storage(-int2elibint2_->storage_used());
 }
 
+void
+TwoBodyIntLibint2::set_integral_storage(size_t storage)
+{
+  cache_ = 0;
+  if (storage > 0)
+    cache_ = new IntegralCacheLibint2(storage, cache_precision_);
+}
+
+void
+TwoBodyIntLibint2::set_integral_precision(double p)
+{
+  cache_precision_ = p;
+  if (cache_.nonnull())
+    cache_->set_precision(p);
+}
+
 void
 TwoBodyIntLibint2::compute_shell(int is, int js, int ks, int ls)
 {
   int2elibint2_->set_redundant(redundant());
+  if (cache_.null() || int2elibint2_->permute()) {
+    int2elibint2_->compute_quartet(&is,&js,&ks,&ls);
+    return;
+  }
+
+  // the cached integrals are decompressed into the engine's buffers
+  const unsigned int ntypes = descr_->size();
+  std::vector<double*> buffers(ntypes);
+  for(unsigned int t=0; t<ntypes; ++t)
+    buffers[t] = int2elibint2_->buffer(t);
+  const GaussianShell& s1 = basis1()->shell(is);
+  const GaussianShell& s2 = basis2()->shell(js);
+  const GaussianShell& s3 = basis3()->shell(ks);
+  const GaussianShell& s4 = basis4()->shell(ls);
+  const size_t n = s1.nfunction() * s2.nfunction()
+                   * s3.nfunction() * s4.nfunction();
+  if (cache_->find(is,js,ks,ls,redundant(),ntypes,&buffers[0],n))
+    return;
+
   int2elibint2_->compute_quartet(&is,&js,&ks,&ls);
+  const double cost = double(n) * s1.nprimitive() * s2.nprimitive()
+                      * s3.nprimitive() * s4.nprimitive();
+  cache_->store(is,js,ks,ls,redundant(),ntypes,&buffers[0],n,cost);
 }
 
 int
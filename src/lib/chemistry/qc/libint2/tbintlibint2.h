@@ -31,15 +31,24 @@
 #include <chemistry/qc/basis/tbint.h>
 #include <chemistry/qc/libint2/int2e.h>
 #include <chemistry/qc/libint2/tbosar.h>
+#include <chemistry/qc/libint2/intcache.h>
 
 namespace sc {
 
-/** This implements 4-center two-electron integrals in the IntLibint2 library. */
+/** This implements 4-center two-electron integrals in the IntLibint2 library.
+
+    If set_integral_storage() is given a nonzero amount of memory,
+    computed shell quartets are kept in an IntegralCacheLibint2 and are
+    not recomputed when requested again, e.g. in later SCF iterations.
+    The cached integrals are accurate to integral_precision().
+*/
 class TwoBodyIntLibint2 : public TwoBodyInt {
 
     TwoBodyOperSet::type int2etype_;
     Ref<TwoBodyOperSetDescr> descr_;
     Ref<IntParams> params_;
+    Ref<IntegralCacheLibint2> cache_;
+    double cache_precision_;
 
   protected:
     Ref<Int2eLibint2> int2elibint2_;
@@ -67,9 +76,21 @@ class TwoBodyIntLibint2 : public TwoBodyInt {
       return int2elibint2_->buffer( descr_->opertype(te_type) );
     }
 
+    /// storage bytes are used to cache computed shell quartets; 0 disables the cache
+    void set_integral_storage(size_t storage);
+    /// the absolute error allowed for cached integrals; the default is 1e-12
+    double integral_precision() const { return cache_precision_; }
+    /// cached quartets less accurate than p are recomputed when requested
+    void set_integral_precision(double p);
+    /// the integral cache, null if caching is disabled
+    const Ref<IntegralCacheLibint2>& cache() const { return cache_; }
+
     bool cloneable() const;
     Ref<TwoBodyInt> clone();
 
+    /// the engine that computes the integrals
+    const Ref<Int2eLibint2>& int2elibint2() const { return int2elibint2_; }
+
   private:
     /// "shallow" copy constructor
 
@@ -0,0 +1,315 @@
+
+/*
+ * Copyright 2009 Sandia Corporation. Under the terms of Contract
+ * DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government
+ * retains certain rights in this software.
+ *
+ * This file is a part of the MPQC LMP2 library.
+ *
+ * The MPQC LMP2 library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+
+#include <util/group/thread.h>
+#include <chemistry/qc/lmp2/sma.h>
+
+// Products with at most this many multiply-adds are packed together
+// into a single product with the other small products of a C block.
+#define CONTRACT_BATCH_MAX_FLOPS 4096
+// Threads are only used when the contraction has at least this many
+// multiply-adds.
+#define CONTRACT_THREAD_MIN_FLOPS 1.0e6
+
+namespace sc {
+
+namespace sma2 {
+
+void
+contract_block(blasint n_extA, blasint n_extB, blasint n_int,
+               const double *Adata, bool tA,
+               const double *Bdata, bool tB,
+               double *Cdata, bool tC,
+               double ABfactor)
+{
+  double one = 1.0;
+
+#ifdef USE_COUNT_DGEMM
+  double t0 = cpu_walltime();
+#endif
+
+  if (n_extA == 1 && n_int == 1) {
+      double tmp = ABfactor * Adata[0];
+      for (int i=0; i<n_extB; i++) {
+          Cdata[i] += tmp*Bdata[i];
+        }
+    }
+  else if (n_extA == 1 && n_extB == 1) {
+      double tmp = 0.0;
+      for (int i=0; i<n_int; i++) {
+          tmp += Adata[i]*Bdata[i];
+        }
+      Cdata[0] += ABfactor*tmp;
+    }
+  else if (n_int == 1 && n_extB == 1) {
+      double tmp = ABfactor*Bdata[0];
+      for (int i=0; i<n_extA; i++) {
+          Cdata[i] += Adata[i]*tmp;
+        }
+    }
+  else if (n_int == 1) {
+      if (tC) {
+          for (int i=0,ij=0; i<n_extB; i++) {
+              for (int j=0; j<n_extA; j++,ij++) {
+                  Cdata[ij] += ABfactor*Adata[j]*Bdata[i];
+                }
+            }
+        }
+      else {
+          for (int i=0,ij=0; i<n_extA; i++) {
+              for (int j=0; j<n_extB; j++,ij++) {
+                  Cdata[ij] += ABfactor*Adata[i]*Bdata[j];
+                }
+            }
+        }
+    }
+  else if (n_extA == 1) {
+      if (tB) {
+          for (int i=0,ij=0; i<n_extB; i++) {
+              double tmp = 0.0;
+              for (int j=0; j<n_int; j++,ij++) {
+                  tmp += Adata[j]*Bdata[ij];
+                }
+              Cdata[i] += tmp * ABfactor;
+            }
+        }
+      else {
+          for (int i=0; i<n_extB; i++) {
+              double tmp = 0.0;
+              for (int j=0,ij=i; j<n_int; j++,ij+=n_extB) {
+                  tmp += Adata[j]*Bdata[ij];
+                }
+              Cdata[i] += tmp * ABfactor;
+            }
+        }
+    }
+  else if (n_extB == 1) {
+      if (tA) {
+          for (int i=0; i<n_extA; i++) {
+              double tmp = 0.0;
+              for (int j=0,ij=i; j<n_int; j++,ij+=n_extA) {
+                  tmp += Bdata[j]*Adata[ij];
+                }
+              Cdata[i] += tmp * ABfactor;
+            }
+        }
+      else {
+          for (int i=0,ij=0; i<n_extA; i++) {
+              double tmp = 0.0;
+              for (int j=0; j<n_int; j++,ij++) {
+                  tmp += Bdata[j]*Adata[ij];
+                }
+              Cdata[i] += tmp * ABfactor;
+            }
+        }
+    }
+  else if (tC) {
+      const char *tAc = "T";
+      blasint lda = n_int;
+      if (tA) { tAc = "N"; lda = n_extA; }
+
+      const char *tBc = "T";
+      blasint ldb = n_extB;
+      if (tB) { tBc = "N"; ldb = n_int; }
+
+      blasint ldc = n_extA;
+
+      F77_DGEMM(tAc, tBc, &n_extA, &n_extB, &n_int,
+                &ABfactor,Adata,&lda,Bdata,&ldb,
+                &one,Cdata,&ldc);
+    }
+  else {
+      const char *tAc = "N";
+      blasint lda = n_int;
+      if (tA) { tAc = "T"; lda = n_extA; }
+
+      const char *tBc = "N";
+      blasint ldb = n_extB;
+      if (tB) { tBc = "T"; ldb = n_int; }
+
+      blasint ldc = n_extB;
+
+      F77_DGEMM(tBc, tAc, &n_extB, &n_extA, &n_int,
+                &ABfactor,Bdata,&ldb,Adata,&lda,
+                &one,Cdata,&ldc);
+    }
+
+#ifdef USE_COUNT_DGEMM
+  count_dgemm(n_extA, n_int, n_extB,
+              cpu_walltime()-t0);
+#endif
+}
+
+namespace {
+
+// Computes the products of one C block.  The small products are copied
+// side by side into Apack (n_extA x K) and Bpack (K x n_extB), so that
+// they are done as one product with the sum K of their internal sizes.
+void
+contract_one_block(const ContractBlock &block,
+                   const std::vector<ContractProduct> &products,
+                   bool tA, bool tB, bool tC, double ABfactor,
+                   std::vector<double> &Apack, std::vector<double> &Bpack)
+{
+  const blasint n_extA = block.n_extA;
+  const blasint n_extB = block.n_extB;
+
+  blasint K = 0;
+  size_t nsmall = 0;
+  for (size_t p=block.begin; p<block.end; p++) {
+      const ContractProduct &prod = products[p];
+      if (double(n_extA)*n_extB*prod.n_int <= CONTRACT_BATCH_MAX_FLOPS) {
+          K += prod.n_int;
+          nsmall++;
+        }
+    }
+  bool pack = (nsmall > 1);
+  if (pack) {
+      Apack.resize(size_t(n_extA)*K);
+      Bpack.resize(size_t(K)*n_extB);
+    }
+
+  blasint k0 = 0;
+  for (size_t p=block.begin; p<block.end; p++) {
+      const ContractProduct &prod = products[p];
+      const blasint n_int = prod.n_int;
+      if (!pack || double(n_extA)*n_extB*n_int > CONTRACT_BATCH_MAX_FLOPS) {
+          contract_block(n_extA, n_extB, n_int, prod.A, tA, prod.B, tB,
+                         block.C, tC, ABfactor);
+          continue;
+        }
+      for (blasint a=0; a<n_extA; a++) {
+          double *Arow = &Apack[size_t(a)*K + k0];
+          for (blasint k=0; k<n_int; k++) {
+              Arow[k] = tA ? prod.A[k*n_extA + a] : prod.A[a*n_int + k];
+            }
+        }
+      for (blasint k=0; k<n_int; k++) {
+          double *Brow = &Bpack[size_t(k0+k)*n_extB];
+          for (blasint b=0; b<n_extB; b++) {
+              Brow[b] = tB ? prod.B[b*n_int + k] : prod.B[k*n_extB + b];
+            }
+        }
+      k0 += n_int;
+    }
+
+  if (pack) {
+      contract_block(n_extA, n_extB, K, &Apack[0], false, &Bpack[0], false,
+                     block.C, tC, ABfactor);
+    }
+}
+
+// orders block indices by decreasing cost
+struct ContractBlockCostGreater {
+    const std::vector<ContractBlock> &blocks;
+    ContractBlockCostGreater(const std::vector<ContractBlock> &b): blocks(b) {}
+    bool operator()(size_t a, size_t b) const {
+      return blocks[a].cost > blocks[b].cost;
+    }
+};
+
+class ContractBlocksThread: public Thread {
+    const std::vector<ContractBlock> &blocks_;
+    const std::vector<ContractProduct> &products_;
+    const std::vector<size_t> &order_;
+    Ref<ThreadLock> lock_;
+    size_t *next_;
+    bool tA_, tB_, tC_;
+    double ABfactor_;
+    std::vector<double> Apack_, Bpack_;
+  public:
+    ContractBlocksThread(const std::vector<ContractBlock> &blocks,
+                         const std::vector<ContractProduct> &products,
+                         const std::vector<size_t> &order,
+                         const Ref<ThreadLock> &lock, size_t *next,
+                         bool tA, bool tB, bool tC, double ABfactor):
+      blocks_(blocks), products_(products), order_(order),
+      lock_(lock), next_(next),
+      tA_(tA), tB_(tB), tC_(tC), ABfactor_(ABfactor) {}
+    void run() {
+      while (true) {
+          lock_->lock();
+          size_t i = (*next_)++;
+          lock_->unlock();
+          if (i >= order_.size()) break;
+          contract_one_block(blocks_[order_[i]], products_,
+                             tA_, tB_, tC_, ABfactor_, Apack_, Bpack_);
+        }
+    }
+};
+
+}
+
+void
+contract_blocks(const std::vector<ContractBlock> &blocks,
+                const std::vector<ContractProduct> &products,
+                bool tA, bool tB, bool tC,
+                double ABfactor)
+{
+  double cost = 0.0;
+  for (size_t i=0; i<blocks.size(); i++) cost += blocks[i].cost;
+
+  ThreadGrp *thr = ThreadGrp::get_default_threadgrp();
+  int nthread = (thr ? thr->nthread() : 1);
+  if (nthread > int(blocks.size())) nthread = blocks.size();
+
+  if (nthread <= 1 || cost < CONTRACT_THREAD_MIN_FLOPS) {
+      std::vector<double> Apack, Bpack;
+      for (size_t i=0; i<blocks.size(); i++) {
+          contract_one_block(blocks[i], products, tA, tB, tC, ABfactor,
+                             Apack, Bpack);
+        }
+      return;
+    }
+
+  // hand out the most expensive C blocks first
+  std::vector<size_t> order(blocks.size());
+  for (size_t i=0; i<order.size(); i++) order[i] = i;
+  std::sort(order.begin(), order.end(), ContractBlockCostGreater(blocks));
+
+  Ref<ThreadLock> lock = thr->new_lock();
+  size_t next = 0;
+  std::vector<ContractBlocksThread*> threads(nthread);
+  for (int i=0; i<thr->nthread(); i++) {
+      if (i < nthread) {
+          threads[i] = new ContractBlocksThread(blocks, products, order,
+                                                lock, &next,
+                                                tA, tB, tC, ABfactor);
+          thr->add_thread(i, threads[i]);
+        }
+      else thr->add_thread(i, 0);
+    }
+  thr->start_threads();
+  thr->wait_threads();
+  for (int i=0; i<nthread; i++) {
+      thr->add_thread(i, 0);
+      delete threads[i];
+    }
+}
+
+}
+
+}
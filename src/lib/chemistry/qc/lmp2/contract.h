@@ -28,6 +28,7 @@
 #include <chemistry/qc/lmp2/dgemminfo.h>
 
 #include <stdexcept>
+#include <vector>
 
 #include <math/scmat/blas.h>
 
@@ -37,6 +38,44 @@ namespace sc {
 
 namespace sma2 {
 
+/// A product of an A block and a B block that contributes to a C block.
+struct ContractProduct {
+    const double *A;
+    const double *B;
+    blasint n_int;
+};
+
+/// The products [begin,end) that contribute to the C block C.
+struct ContractBlock {
+    double *C;
+    blasint n_extA;
+    blasint n_extB;
+    size_t begin;
+    size_t end;
+    /// the number of multiply-adds needed for this block
+    double cost;
+};
+
+/** Computes C += ABfactor * A * B for one block product.  The blocks are
+    stored as chosen by RepackScheme: A is n_extA x n_int, B is n_int x
+    n_extB, and C is n_extA x n_extB, all row major unless transposed by
+    tA, tB, or tC. */
+void contract_block(blasint n_extA, blasint n_extB, blasint n_int,
+                    const double *Adata, bool tA,
+                    const double *Bdata, bool tB,
+                    double *Cdata, bool tC,
+                    double ABfactor);
+
+/** Computes all products in blocks with contract_block.  Since each C
+    block is updated by one thread only, the blocks are distributed over
+    the threads of the default ThreadGrp, largest first, when there is
+    enough work.  The small products of a C block are packed into one
+    larger product. */
+void contract_blocks(const std::vector<ContractBlock> &blocks,
+                     const std::vector<ContractProduct> &products,
+                     bool tA, bool tB, bool tC,
+                     double ABfactor);
+
 /// Returns true if an array needs to be repacked to perform a contraction.
 /// @param A an Array object.
 /// @param row_indices the indices in that form the rows of the contraction matrix.
@@ -574,13 +613,17 @@ contract(
   C_begin = Cbm.lower_bound(Cbi_lb);
   C_end = Cbm.upper_bound(Cbi_ub);
 
+  // Find all products of A and B blocks, grouped by the C block they update
   if (timer) timer->enter("C loop");
+  std::vector<ContractBlock> cblocks;
+  std::vector<ContractProduct> products;
   for (typename Array<NC>::blockmap_t::const_iterator
            Citer = C_begin;
        Citer != C_end;
        Citer++) {
       const BlockInfo<NC> &Cbi = Citer->first;
-      double *Cdata = Citer->second;
+      ContractBlock cblock;
+      cblock.C = Citer->second;
       Abi.assign_blocks(extA, Cbi, extCA);
       std::pair<
           typename Array<NA>::cached_blockmap_t::const_iterator,
@@ -600,20 +643,20 @@ contract(
           firstA = rangeA.first,
           fenceA = rangeA.second;
       Bbi.assign_blocks(extB, Cbi, extCB);
-      blasint n_extB = Cbi.subset_size(C.indices(), extCB);
-      blasint n_extA = Cbi.subset_size(C.indices(), extCA);
+      cblock.n_extB = Cbi.subset_size(C.indices(), extCB);
+      cblock.n_extA = Cbi.subset_size(C.indices(), extCA);
+      cblock.begin = products.size();
+      cblock.cost = 0.0;
 #ifdef USE_HASH
       typename Array<NB>::blockhash_t::const_iterator Biter;
 #else
       typename Array<NB>::blockmap_t::const_iterator Biter = Bbm.begin();
 #endif
-      if (timer) timer->enter("A loop");
       for (typename Array<NA>::cached_blockmap_t::const_iterator
                Aiter = firstA;
            Aiter != fenceA;
            Aiter++) {
           const BlockInfo<NA> &Abi = Aiter->first;
-          double *Adata = Aiter->second;
           Bbi.assign_blocks(intB, Abi, intA);
 #ifdef USE_HASH
           Biter = Bbh.find(Bbi);
@@ -633,139 +676,26 @@ contract(
             }
           if (Biter == Bbm.end()) continue;
 #endif
-          double *Bdata = Biter->second;
-          blasint n_int = Abi.subset_size(A.indices(), intA);
-
-          double one = 1.0;
-          if (timer) timer->enter("dgemm");
-
-          double t0 = cpu_walltime();
-
-          if (n_extA == 1 && n_int == 1) {
-              double tmp = ABfactor * Adata[0];
-              for (int i=0; i<n_extB; i++) {
-                  Cdata[i] += tmp*Bdata[i];
-                }
-            }
-          else if (n_extA == 1 && n_extB == 1) {
-              double tmp = 0.0;
-              for (int i=0; i<n_int; i++) {
-                  tmp += Adata[i]*Bdata[i];
-                }
-              Cdata[0] += ABfactor*tmp;
-            }
-          else if (n_int == 1 && n_extB == 1) {
-              double tmp = ABfactor*Bdata[0];
-              for (int i=0; i<n_extA; i++) {
-                  Cdata[i] += Adata[i]*tmp;
-                }
-            }
-          else if (n_int == 1) {
-              if (repack_scheme.transpose_C()) {
-                  for (int i=0,ij=0; i<n_extB; i++) {
-                      for (int j=0; j<n_extA; j++,ij++) {
-                          Cdata[ij] += ABfactor*Adata[j]*Bdata[i];
-                        }
-                    }
-                }
-              else {
-                  for (int i=0,ij=0; i<n_extA; i++) {
-                      for (int j=0; j<n_extB; j++,ij++) {
-                          Cdata[ij] += ABfactor*Adata[i]*Bdata[j];
-                        }
-                    }
-                }
-            }
-          else if (n_extA == 1) {
-              if (repack_scheme.transpose_B()) {
-                  for (int i=0,ij=0; i<n_extB; i++) {
-                      double tmp = 0.0;
-                      for (int j=0; j<n_int; j++,ij++) {
-                          tmp += Adata[j]*Bdata[ij];
-                        }
-                      Cdata[i] += tmp * ABfactor;
-                    }
-                }
-              else {
-                  for (int i=0; i<n_extB; i++) {
-                      double tmp = 0.0;
-                      for (int j=0,ij=i; j<n_int; j++,ij+=n_extB) {
-                          tmp += Adata[j]*Bdata[ij];
-                        }
-                      Cdata[i] += tmp * ABfactor;
-                    }
-                }
-            }
-          else if (n_extB == 1) {
-              if (repack_scheme.transpose_A()) {
-                  for (int i=0; i<n_extA; i++) {
-                      double tmp = 0.0;
-                      for (int j=0,ij=i; j<n_int; j++,ij+=n_extA) {
-                          tmp += Bdata[j]*Adata[ij];
-                        }
-                      Cdata[i] += tmp * ABfactor;
-                    }
-                }
-              else {
-                  for (int i=0,ij=0; i<n_extA; i++) {
-                      double tmp = 0.0;
-                      for (int j=0; j<n_int; j++,ij++) {
-                          tmp += Bdata[j]*Adata[ij];
-                        }
-                      Cdata[i] += tmp * ABfactor;
-                    }
-                }
-            }
-          else if (repack_scheme.transpose_C()) {
-              const char *tA = "T";
-              blasint lda = n_int;
-              if (repack_scheme.transpose_A()) { tA = "N"; lda = n_extA; }
-
-              const char *tB = "T";
-              blasint ldb = n_extB;
-              if (repack_scheme.transpose_B()) { tB = "N"; ldb = n_int; }
-
-              blasint ldc = n_extA;
-
-//               std::cout << " tA: " << tA
-//                         << " tB: " << tB
-//                         << " nr: " << n_extA
-//                         << " nc: " << n_extB
-//                         << " nl: " << n_int
-//                         << " lda: " << lda
-//                         << " ldb: " << ldb
-//                         << " ldc: " << ldc
-//                         << std::endl;
-
-              F77_DGEMM(tA, tB, &n_extA, &n_extB, &n_int,
-                        &ABfactor,Adata,&lda,Bdata,&ldb,
-                        &one,Cdata,&ldc);
-            }
-          else {
-              const char *tA = "N";
-              blasint lda = n_int;
-              if (repack_scheme.transpose_A()) { tA = "T"; lda = n_extA; }
-
-              const char *tB = "N";
-              blasint ldb = n_extB;
-              if (repack_scheme.transpose_B()) { tB = "T"; ldb = n_int; }
-
-              blasint ldc = n_extB;
-
-              F77_DGEMM(tB, tA, &n_extB, &n_extA, &n_int,
-                        &ABfactor,Bdata,&ldb,Adata,&lda,
-                        &one,Cdata,&ldc);
-            }
-#ifdef USE_COUNT_DGEMM
-          count_dgemm(n_extA, n_int, n_extB,
-                      cpu_walltime()-t0);
-#endif
-          if (timer) timer->exit();
+          ContractProduct product;
+          product.A = Aiter->second;
+          product.B = Biter->second;
+          product.n_int = Abi.subset_size(A.indices(), intA);
+          products.push_back(product);
+          cblock.cost += double(cblock.n_extA) * cblock.n_extB * product.n_int;
         }
-      if (timer) timer->exit();
+      cblock.end = products.size();
+      if (cblock.end > cblock.begin) cblocks.push_back(cblock);
     }
   if (timer) timer->exit();
-  
+
+  if (timer) timer->enter("dgemm");
+  contract_blocks(cblocks, products,
+                  repack_scheme.transpose_A(),
+                  repack_scheme.transpose_B(),
+                  repack_scheme.transpose_C(),
+                  ABfactor);
+  if (timer) timer->exit();
+
   // Repack the data of A, B, and C to the orginal data layout
   if (timer) timer->enter("repack2");
   if (clear_A_after_use) A.clear();
@@ -1719,6 +1719,7 @@ LMP2::compute_lmp2_energy()
   double ecorr = 0.0;
 
   ecorr = iterate_LMP2_equations(tolerance/10.0, tolerance);
+  sma2::Data::print_memory_stats();
 
   // need to check that it actually converged
   set_actual_value_accuracy(tolerance);
@@ -21,6 +21,7 @@
  *
  */
 
+#include <string.h>
 #include <algorithm>
 
 #include <chemistry/qc/lmp2/sma.h>
@@ -29,52 +30,181 @@ namespace sc {
 
 namespace sma2 {
 
+    size_t Data::bytes_used_ = 0;
+    size_t Data::bytes_reserved_ = 0;
+    size_t Data::max_bytes_used_ = 0;
+    size_t Data::max_bytes_reserved_ = 0;
+
     Data::Data():
-      ndata_(0)
+      ndata_(0),
+      nalloc_(0)
     {
       default_chunksize_ = 4096;
+      for (int i=0; i<nclass; i++) free_[i] = 0;
     }
 
     Data::~Data()
     {
-      for (memmap_t::iterator iter = memmap_.begin();
-           iter != memmap_.end(); iter++) {
-          delete[] iter->second.first;
+      for (int c=0; c<nclass; c++) {
+          int slotsize = (1<<c) + 1;
+          for (size_t i=0; i<slabs_[c].size(); i++) {
+              delete[] slabs_[c][i].first;
+              add_reserved(-long(slotsize)*slabs_[c][i].second);
+            }
+        }
+      for (std::map<double*,size_t>::iterator iter = large_.begin();
+           iter != large_.end(); iter++) {
+          delete[] (iter->first - 1);
+          add_reserved(-long(iter->second + 1));
+        }
+      add_used(-long(ndata_));
+    }
+
+    void
+    Data::read_header(const double *dat, Header &h)
+    {
+      memcpy(&h, dat - 1, sizeof(Header));
+    }
+
+    void
+    Data::write_header(double *dat, int sizeclass, int size)
+    {
+      Header h;
+      h.sizeclass = sizeclass;
+      h.size = size;
+      memcpy(dat - 1, &h, sizeof(Header));
+    }
+
+    void
+    Data::add_used(long size)
+    {
+      bytes_used_ += size*sizeof(double);
+      if (bytes_used_ > max_bytes_used_) max_bytes_used_ = bytes_used_;
+    }
+
+    void
+    Data::add_reserved(long size)
+    {
+      bytes_reserved_ += size*sizeof(double);
+      if (bytes_reserved_ > max_bytes_reserved_)
+          max_bytes_reserved_ = bytes_reserved_;
+    }
+
+    void
+    Data::new_slab(int sizeclass)
+    {
+      // slabs grow geometrically so arrays with few blocks stay small
+      int slotsize = (1<<sizeclass) + 1;
+      int capacity = 64 << std::min(slabs_[sizeclass].size(), size_t(16));
+      if (capacity > default_chunksize_) capacity = default_chunksize_;
+      int nslot = std::max(1, capacity/slotsize);
+
+      double *slab = new double[size_t(nslot)*slotsize];
+      slabs_[sizeclass].push_back(std::make_pair(slab,nslot));
+      add_reserved(long(nslot)*slotsize);
+
+      // thread the slots onto the free list, first slot at the head
+      for (int i=nslot-1; i>=0; i--) {
+          double *dat = slab + size_t(i)*slotsize + 1;
+          write_header(dat, sizeclass, -1);
+          memcpy(dat, &free_[sizeclass], sizeof(double*));
+          free_[sizeclass] = dat;
         }
     }
 
     double *
     Data::allocate(long size)
     {
-      double *data = new double[size];
-      memitermap_[data]
-          = memmap_.insert(std::make_pair(0,std::make_pair(data,size)));
+      double *data;
+      if (size > max_small_size()) {
+          data = new double[size+1] + 1;
+          write_header(data, -1, -1);
+          large_[data] = size;
+          add_reserved(size+1);
+        }
+      else {
+          int sizeclass = 0;
+          while ((1<<sizeclass) < size) sizeclass++;
+          if (free_[sizeclass] == 0) new_slab(sizeclass);
+          data = free_[sizeclass];
+          memcpy(&free_[sizeclass], data, sizeof(double*));
+          write_header(data, sizeclass, size);
+        }
       ndata_ += size;
+      nalloc_++;
+      add_used(size);
       return data;
     }
 
     void
     Data::deallocate(double *dat)
     {
-      memitermap_t::iterator memiter = memitermap_.find(dat);
-      if (memiter == memitermap_.end()) {
-          throw std::runtime_error("Data::deallocate: data not found");
+      Header h;
+      read_header(dat, h);
+      long size;
+      if (h.sizeclass == -1) {
+          std::map<double*,size_t>::iterator iter = large_.find(dat);
+          if (iter == large_.end()) {
+              throw std::runtime_error("Data::deallocate: data not found");
+            }
+          size = iter->second;
+          large_.erase(iter);
+          delete[] (dat - 1);
+          add_reserved(-(size+1));
+        }
+      else {
+          if (h.sizeclass < 0 || h.sizeclass >= nclass || h.size < 0) {
+              throw std::runtime_error("Data::deallocate: data not found");
+            }
+          size = h.size;
+          write_header(dat, h.sizeclass, -1);
+          memcpy(dat, &free_[h.sizeclass], sizeof(double*));
+          free_[h.sizeclass] = dat;
         }
-      ndata_ -= memiter->second->second.second;
-      memmap_.erase(memiter->second);
-      memitermap_.erase(memiter);
-      delete[] dat;
+      ndata_ -= size;
+      nalloc_--;
+      add_used(-size);
     }
 
     double *
     Data::data() const
     {
-      if (memmap_.size() == 1) {
-          return memmap_.begin()->second.first;
+      if (nalloc_ == 1) {
+          if (large_.size() == 1) return large_.begin()->first;
+          for (int c=0; c<nclass; c++) {
+              int slotsize = (1<<c) + 1;
+              for (size_t i=0; i<slabs_[c].size(); i++) {
+                  for (int j=0; j<slabs_[c][i].second; j++) {
+                      double *dat = slabs_[c][i].first + size_t(j)*slotsize + 1;
+                      Header h;
+                      read_header(dat, h);
+                      if (h.size >= 0) return dat;
+                    }
+                }
+            }
         }
       throw std::runtime_error("Data::data not implemented");
     }
 
+    void
+    Data::print_memory_stats(std::ostream &o)
+    {
+      double frag = (bytes_reserved_?1.0-double(bytes_used_)/bytes_reserved_:0.0);
+      o << sc::indent << "sma2 block memory:" << std::endl;
+      o << sc::incindent;
+      o << sc::indent << sc::scprintf("used          = %lu bytes",
+                                      (unsigned long)bytes_used_) << std::endl;
+      o << sc::indent << sc::scprintf("reserved      = %lu bytes",
+                                      (unsigned long)bytes_reserved_) << std::endl;
+      o << sc::indent << sc::scprintf("fragmentation = %5.1f%%",
+                                      100.0*frag) << std::endl;
+      o << sc::indent << sc::scprintf("peak used     = %lu bytes",
+                                      (unsigned long)max_bytes_used_) << std::endl;
+      o << sc::indent << sc::scprintf("peak reserved = %lu bytes",
+                                      (unsigned long)max_bytes_reserved_) << std::endl;
+      o << sc::decindent;
+    }
+
     //////////////////////////////////////////////////////////
 
     IndexList::IndexList(): indices_(0)
@@ -1022,25 +1022,66 @@ namespace sma2 {
         }
     };
 
-    /** \brief Data holds the values for each block. */
+    /** \brief Data holds the values for each block.
+
+        Allocations of up to max_small_size() doubles are carved from
+        slabs, one list of slabs per power of two size class, and are
+        recycled through a free list for their class, so both allocate()
+        and deallocate() take constant time.  Each allocation is preceded
+        by a one double header giving its class and size.  Larger
+        allocations are made individually.  All memory is released at
+        once when the Data is destroyed, which happens when an Array is
+        cleared.  Memory usage summed over all Data objects is reported
+        by print_memory_stats(). */
     class Data: public sc::RefCount {
       private:
-//         double *data_;
+        // the size classes hold 1, 2, 4, ..., 2^(nclass-1) doubles
+        enum { nclass = 10 };
+        // header of each allocation
+        struct Header {
+            int sizeclass; // -1 for large allocations
+            int size; // the size requested, or -1 if free
+        };
+
         size_t ndata_;
+        // the number of live allocations
+        size_t nalloc_;
 
+        // the capacity in doubles of the largest slab
         int default_chunksize_;
-        // maps n_data available to the pointer and n_data used.
-        typedef std::multimap<size_t, std::pair<double *, size_t> > memmap_t;
-        memmap_t memmap_;
-        typedef std::map<double*,memmap_t::iterator> memitermap_t;
-        memitermap_t memitermap_;
+        // the slabs of each class, with the number of slots in each
+        std::vector<std::pair<double*,int> > slabs_[nclass];
+        // the head of the free list of each class
+        double *free_[nclass];
+        // the allocations larger than max_small_size() and their sizes
+        std::map<double*,size_t> large_;
+
+        static size_t bytes_used_;
+        static size_t bytes_reserved_;
+        static size_t max_bytes_used_;
+        static size_t max_bytes_reserved_;
+
+        static void read_header(const double *dat, Header &h);
+        static void write_header(double *dat, int sizeclass, int size);
+        static void add_used(long size);
+        static void add_reserved(long size);
+        void new_slab(int sizeclass);
       public:
         Data();
         ~Data();
         virtual double *allocate(long size);
         virtual void deallocate(double *);
+        /** Returns the data if exactly one allocation is live.  This is
+            the case after Array::allocate_blocks(). */
         double *data() const;
         long ndata() const { return ndata_; }
+
+        /// The largest allocation, in doubles, carved from a slab.
+        static int max_small_size() { return 1<<(nclass-1); }
+        /** Prints the current and peak memory used by the blocks and
+            reserved for them, summed over all Data objects, and the
+            fraction of the reserved memory that is currently unused. */
+        static void print_memory_stats(std::ostream &o = sc::ExEnv::out0());
     };
 
     /** \brief An Index is used in the symbolic notation for contractions. */
@@ -22,6 +22,7 @@
  *
  */
 
+#include <cmath>
 #include <iostream>
 #include <map>
 #include <vector>
@@ -29,6 +30,7 @@
 
 #include <math/scmat/matrix.h>
 #include <math/scmat/local.h>
+#include <util/group/thread.h>
 
 #include <chemistry/qc/lmp2/sma.h>
 
@@ -923,6 +925,167 @@ test_contract_bigblock_fixed2()
   C_correct.print();
 }
 
+// the value of element (i,j) of the matrices in test_contract_dense
+double
+dense_value(int i, int j, int seed)
+{
+  return std::sin(0.37*i + 0.71*j + 1.3*seed);
+}
+
+// fills array with dense_value(i,j,seed), or with dense_value(j,i,seed)
+// to store the transpose
+void
+initialize_dense_values(sma2::Array<2> &array, int seed, bool transpose)
+{
+  array.add_all_unallocated_blocks();
+  array.allocate_blocks();
+  const sma2::Range &r0 = array.index(0);
+  const sma2::Range &r1 = array.index(1);
+  for (sma2::Array<2>::blockmap_t::const_iterator
+           iter = array.blockmap().begin();
+       iter != array.blockmap().end();
+       iter++) {
+      const sma2::BlockInfo<2> &bi = iter->first;
+      double *data = iter->second;
+      int off0 = r0.block_offset(bi.block(0));
+      int off1 = r1.block_offset(bi.block(1));
+      for (int i=0; i<r0.block_size(bi.block(0)); i++) {
+          for (int j=0; j<r1.block_size(bi.block(1)); j++) {
+              *data++ = transpose ? dense_value(off1+j, off0+i, seed)
+                                  : dense_value(off0+i, off1+j, seed);
+            }
+        }
+    }
+}
+
+// returns the largest difference between array and the row major n x n
+// matrix ref, or its transpose
+double
+dense_difference(const sma2::Array<2> &array, const std::vector<double> &ref,
+                 bool transpose)
+{
+  const sma2::Range &r0 = array.index(0);
+  const sma2::Range &r1 = array.index(1);
+  const int n = r0.nindex();
+  double maxdiff = 0.0;
+  int nelem = 0;
+  for (sma2::Array<2>::blockmap_t::const_iterator
+           iter = array.blockmap().begin();
+       iter != array.blockmap().end();
+       iter++) {
+      const sma2::BlockInfo<2> &bi = iter->first;
+      const double *data = iter->second;
+      int off0 = r0.block_offset(bi.block(0));
+      int off1 = r1.block_offset(bi.block(1));
+      for (int i=0; i<r0.block_size(bi.block(0)); i++) {
+          for (int j=0; j<r1.block_size(bi.block(1)); j++) {
+              double val = transpose ? ref[(off1+j)*n + off0+i]
+                                     : ref[(off0+i)*n + off1+j];
+              maxdiff = std::max(maxdiff, std::fabs(*data++ - val));
+              nelem++;
+            }
+        }
+    }
+  // every element of C must be present
+  if (nelem != n*n) return HUGE_VAL;
+  return maxdiff;
+}
+
+// Compares C = A * B against a dense reference for every way of storing
+// A, B, and C, so that contract() runs with tA, tB, and tC true and
+// false.  r is the external and k the internal range.
+void
+test_contract_dense(const char *name, const sma2::Range &r,
+                    const sma2::Range &k)
+{
+  std::cout << "entered " << name << std::endl;
+
+  const int n = r.nindex();
+  const int nk = k.nindex();
+
+  sma2::Array<2> A(r,k), At(k,r), B(k,r), Bt(r,k), C(r,r);
+  initialize_dense_values(A, 1, false);
+  initialize_dense_values(At, 1, true);
+  initialize_dense_values(B, 2, false);
+  initialize_dense_values(Bt, 2, true);
+
+  std::vector<double> Cref(n*n, 0.0);
+  for (int i=0; i<n; i++) {
+      for (int j=0; j<n; j++) {
+          double tmp = 0.0;
+          for (int l=0; l<nk; l++) {
+              tmp += dense_value(i,l,1) * dense_value(l,j,2);
+            }
+          Cref[i*n+j] = tmp;
+        }
+    }
+
+  sma2::Index I("i"),J("j"),K("k");
+
+  int nerror = 0;
+  const double tol = 1.0e-10 * nk;
+  for (int transpose_C=0; transpose_C<2; transpose_C++) {
+      for (int layout=0; layout<4; layout++) {
+          C.clear();
+          sma2::Array<2> &Aused = (layout&1) ? At : A;
+          sma2::Array<2> &Bused = (layout&2) ? Bt : B;
+          sma2::Index &IA = (layout&1) ? K : I;
+          sma2::Index &KA = (layout&1) ? I : K;
+          sma2::Index &KB = (layout&2) ? J : K;
+          sma2::Index &JB = (layout&2) ? K : J;
+          if (transpose_C) {
+              C(J,I) |= Aused(IA,KA) * Bused(KB,JB);
+              C(J,I) = Aused(IA,KA) * Bused(KB,JB);
+            }
+          else {
+              C(I,J) |= Aused(IA,KA) * Bused(KB,JB);
+              C(I,J) = Aused(IA,KA) * Bused(KB,JB);
+            }
+          double diff = dense_difference(C, Cref, transpose_C);
+          if (diff > tol) {
+              std::cout << name << ": "
+                        << (transpose_C ? "C(J,I)" : "C(I,J)") << " = "
+                        << ((layout&1) ? "At(K,I)" : "A(I,K)") << " * "
+                        << ((layout&2) ? "Bt(J,K)" : "B(K,J)")
+                        << " differs from the dense result by " << diff
+                        << std::endl;
+              nerror++;
+            }
+        }
+    }
+
+  std::cout << name << ": nerror = " << nerror << std::endl;
+  if (nerror) throw std::runtime_error("test_contract_dense failed");
+}
+
+// a contraction large enough for contract_blocks to use the threads of
+// the default ThreadGrp
+void
+test_contract_threaded()
+{
+  Ref<ThreadGrp> default_thr = ThreadGrp::get_default_threadgrp();
+  Ref<ThreadGrp> thr = default_thr->clone(4);
+  ThreadGrp::set_default_threadgrp(thr);
+
+  sma2::Range r(128, 32);
+  test_contract_dense("test_contract_threaded", r, r);
+
+  ThreadGrp::set_default_threadgrp(default_thr);
+}
+
+// each C block receives many products small enough to be packed into one,
+// some of them of different internal sizes
+void
+test_contract_packed()
+{
+  std::vector<int> kblocks;
+  for (int i=0; i<40; i++) kblocks.push_back(1 + i%4);
+
+  sma2::Range r(16, 8);
+  sma2::Range k(kblocks);
+  test_contract_dense("test_contract_packed", r, k);
+}
+
 void
 test_scalar()
 {
@@ -945,6 +1108,58 @@ test_scalar()
   std::cout << "C                = " << C.value() << std::endl;
 }
 
+void
+test_data()
+{
+  std::cout << "entered test_data" << std::endl;
+
+  // allocate blocks of sizes around each size class and beyond
+  std::vector<double*> blocks;
+  std::vector<long> sizes;
+  sc::Ref<sma2::Data> data = new sma2::Data;
+  long ndata = 0;
+  for (int i=0; i<2000; i++) {
+      long size = (i*37)%(2*sma2::Data::max_small_size()+3);
+      double *d = data->allocate(size);
+      for (long j=0; j<size; j++) d[j] = i + j*1.0e-4;
+      blocks.push_back(d);
+      sizes.push_back(size);
+      ndata += size;
+    }
+
+  // free every other block and reuse the slots
+  for (int i=0; i<2000; i+=2) {
+      data->deallocate(blocks[i]);
+      ndata -= sizes[i];
+    }
+  for (int i=0; i<2000; i+=2) {
+      long size = sizes[(i*7)%2000];
+      double *d = data->allocate(size);
+      for (long j=0; j<size; j++) d[j] = i + j*1.0e-4;
+      blocks[i] = d;
+      sizes[i] = size;
+      ndata += size;
+    }
+
+  int nerror = 0;
+  for (int i=0; i<2000; i++) {
+      for (long j=0; j<sizes[i]; j++) {
+          if (blocks[i][j] != i + j*1.0e-4) nerror++;
+        }
+    }
+  if (data->ndata() != ndata) nerror++;
+
+  for (int i=0; i<2000; i++) data->deallocate(blocks[i]);
+  if (data->ndata() != 0) nerror++;
+
+  // a single allocation is returned by data()
+  double *d = data->allocate(5);
+  if (data->data() != d) nerror++;
+
+  std::cout << "test_data: nerror = " << nerror << std::endl;
+  if (nerror) throw std::runtime_error("test_data failed");
+}
+
 void
 try_main(int argc, char *argv[])
 {
@@ -972,7 +1187,10 @@ try_main(int argc, char *argv[])
   test_all_bigblock_fixed_reversed();
   test_contract_bigblock_fixed1();
   test_contract_bigblock_fixed2();
+  test_contract_threaded();
+  test_contract_packed();
   test_scalar();
+  test_data();
 
   std::cout << "---- all tests ran to completion ----" << std::endl;
 }
@@ -159,6 +159,7 @@ CSGrad34Qbtr::run()
                            shellpair_shared_data_);
   shellpairs.set_print_percent(print_percent_);
   shellpairs.set_debug(debug);
+  shellpairs.set_schwarz_bounds(tbint, (int)tol);
   if (debug) shellpairs.set_print_percent(1);
   S = 0;
   R = 0;
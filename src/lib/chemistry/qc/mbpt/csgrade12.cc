@@ -135,6 +135,7 @@ CSGradErep12Qtr::run()
                            shellpair_shared_data_);
   shellpairs.set_print_percent(print_percent_);
   shellpairs.set_debug(debug);
+  shellpairs.set_schwarz_bounds(tbint, (int)tol);
   if (debug) shellpairs.set_print_percent(1);
   S = 0;
   R = 0;
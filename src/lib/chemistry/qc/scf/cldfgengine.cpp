@@ -40,8 +40,42 @@ using namespace mpqc::TA;
 using namespace sc;
 
 using TAMatrix = ClDFGEngine::TAMatrix;
+using SparseMatrix = ClDFGEngine::SparseMatrix;
 using EMatrix = elem::DistMatrix<double>;
 
+namespace {
+
+  // Copies a dense matrix into a block-sparse one. Tiles whose norm is
+  // below the threshold of the sparse shape are dropped.
+  SparseMatrix to_sparse(const TAMatrix &dense) {
+    madness::World &world = dense.get_world();
+    TiledArray::Tensor<float> norms(dense.trange().tiles(), 0.0f);
+    for (auto it = dense.get_pmap()->begin(); it != dense.get_pmap()->end(); ++it)
+      norms[*it] = dense.find(*it).get().norm();
+
+    TiledArray::SparseShape<float> shape(world, norms, dense.trange());
+    SparseMatrix sparse(world, dense.trange(), shape);
+    for (auto it = sparse.get_pmap()->begin(); it != sparse.get_pmap()->end(); ++it) {
+      if (!sparse.is_zero(*it))
+        sparse.set(*it, dense.find(*it));
+    }
+    return sparse;
+  }
+
+  // Copies a block-sparse matrix into a dense one.
+  TAMatrix to_dense(const SparseMatrix &sparse) {
+    TAMatrix dense(sparse.get_world(), sparse.trange());
+    for (auto it = dense.get_pmap()->begin(); it != dense.get_pmap()->end(); ++it) {
+      if (sparse.is_zero(*it))
+        dense.set(*it, TAMatrix::value_type(dense.trange().make_tile_range(*it), 0.0));
+      else
+        dense.set(*it, sparse.find(*it));
+    }
+    return dense;
+  }
+
+} // namespace
+
 sc::ClassDesc ClDFGEngine::class_desc_(
                 typeid(mpqc::TA::ClDFGEngine),
                 "TA.ClDFGEngine", 1, "public GEngineBase",
@@ -64,6 +98,8 @@ mpqc::TA::ClDFGEngine::ClDFGEngine(const sc::Ref<sc::KeyVal> &kv) : integral_(),
   basis_ << kv->describedclassvalue("basis");
   dfbasis_ << kv->describedclassvalue("dfbasis");
   integral_ << kv->describedclassvalue("integrals");
+  screen_threshold_ = kv->doublevalue("screen_threshold",
+                                      sc::KeyValValuedouble(screen_threshold_));
 
   if(world_.null()){
     world_ = new World;
@@ -165,13 +201,13 @@ mpqc::TA::ClDFGEngine::density_contraction(
   const std::string nC("mpqc_TA_ClDfGFactory_n_coeff");
   const std::string mC(",mpqc_TA_ClDfGFactory_m_coeff");
 
-  // just for conveience
-  const TAMatrix &D = *density_;
+  // The integrals are block-sparse, so the density must be too
+  const SparseMatrix D = to_sparse(*density_);
 
-  TAMatrix expr; 
+  SparseMatrix expr;
   expr(i+j) = 2 * (df_ints_(i+j+X) * ( D(m+n) * df_ints_(m+n+X) ) )
                 - (df_ints_(i+n+X) * ( D(nC+mC) * df_ints_(m+j+X) ) );
-  return expr;
+  return to_dense(expr);
 }
 
 // Do contraction with coefficients
@@ -198,16 +234,16 @@ mpqc::TA::ClDFGEngine::coefficient_contraction(
   // Term where comma's need to removed
   const std::string jE = input.at(1);
 
-  // just for conveience
-  const TAMatrix &C = *coeff_;
+  // The integrals are block-sparse, so the coefficients must be too
+  const SparseMatrix C = to_sparse(*coeff_);
 
   // Precompute Exch Term
   df_K_("j,Z,X") = C("m,Z") * df_ints_("m,j,X");
 
-  TAMatrix expr; 
+  SparseMatrix expr;
   expr(i+j) = 2 * (df_ints_(i+j+X) * (C(m+Z) * df_K_(m+Z+X) ) )
                 - (df_K_(i+Z+X) * df_K_(jE+Z+X) );
-  return expr;
+  return to_dense(expr);
 }
 
 void
@@ -257,7 +293,8 @@ mpqc::TA::ClDFGEngine::compute_symetric_df_ints() {
   auto eri3_ptr = std::make_shared<eri3pool>(eri3_clone);
 
   // Using the df_ints as temporary storage for the twobody three center ints
-  df_ints_ =  Integrals(*world_->madworld(), eri3_ptr, basis_, dfbasis_);
+  df_ints_ =  SparseIntegrals(*world_->madworld(), eri3_ptr, basis_, dfbasis_,
+                              screen_threshold_);
   world_->madworld()->gop.fence();
   tim.exit("Computing Eri3 Integrals");
 
@@ -295,7 +332,8 @@ mpqc::TA::ClDFGEngine::compute_symetric_df_ints() {
 
   tim.enter("Eri3 * Eri2^{-1} Contraction");
   // Create df_ints_ tensor from eri3(i,j,P) * U_{eri2}^{-1}(P,X)
-  df_ints_("i,j,X") = df_ints_("i,j,P") * eri2_ints("P,X");
+  const SparseMatrix eri2_inv = to_sparse(eri2_ints);
+  df_ints_("i,j,X") = df_ints_("i,j,P") * eri2_inv("P,X");
   world_->madworld()->gop.fence(); // so eri2_ints doesn't go out of scope.
   tim.exit("Eri3 * Eri2^{-1} Contraction");
 
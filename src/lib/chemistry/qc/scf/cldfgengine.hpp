@@ -54,6 +54,10 @@ namespace mpqc {
     class ClDFGEngine: public GEngineBase {
     public:
       typedef GEngineBase::TAMatrix TAMatrix;
+      typedef TiledArray::Array<double, 2, TiledArray::Tensor<double>,
+                                TiledArray::SparsePolicy> SparseMatrix;
+      typedef TiledArray::Array<double, 3, TiledArray::Tensor<double>,
+                                TiledArray::SparsePolicy> SparseArray3;
 
       ClDFGEngine(sc::Ref<sc::IntegralLibint2> integral,
                    sc::Ref<TiledBasisSet> basis,
@@ -61,6 +65,13 @@ namespace mpqc {
                    TAMatrix *density,
                    sc::Ref<World> world);
 
+      /** The KeyVal constructor.
+          <dl>
+          <dt><tt>screen_threshold</tt><dd> Tiles and blocks of three
+          center integrals whose Schwarz estimate is smaller than this are
+          neglected, and the three center tensors are stored block-sparse.
+          The default is 1e-12.
+          </dl> */
       ClDFGEngine(const sc::Ref<sc::KeyVal> &kv);
 
       // No defaults copies or assignments.
@@ -115,14 +126,19 @@ namespace mpqc {
       TAMatrix *coeff_ = nullptr;
       sc::Ref<World> world_;
 
+      // Tiles and shell blocks of the three center integrals whose Schwarz
+      // estimate is below this threshold are not computed
+      double screen_threshold_ = 1.0e-12;
+
       // Bools for which method we are using
       bool density_set_ = false;
       bool coeff_set_ = false;
 
       // Tensor that holds the integrals which have been combined with the
-      // sqrt inverse of the two body two center integrals.
-      TiledArray::Array<double, 3> df_ints_;
-      TiledArray::Array<double, 3> df_K_; // Holds exchange intermediate
+      // sqrt inverse of the two body two center integrals. It is zero
+      // for the tiles of negligible basis function pairs.
+      SparseArray3 df_ints_;
+      SparseArray3 df_K_; // Holds exchange intermediate
 
       static sc::ClassDesc class_desc_;
     };
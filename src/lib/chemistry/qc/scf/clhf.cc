@@ -150,12 +150,13 @@ CLHF::ao_fock(double accuracy)
       }
       conts[i] = new LocalCLHFContribution(gmats[i], pmat);
       gblds[i] = new LocalGBuild<LocalCLHFContribution>(*conts[i], tbis_[i],
-               pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i
+               pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i, gbsched_
         );
 
       threadgrp_->add_thread(i, gblds[i]);
     }
 
+    if (!gbsched_.null()) gbsched_->start();
     tim.enter("start thread");
     if (threadgrp_->start_threads() < 0) {
       ExEnv::err0() << indent
@@ -171,6 +172,7 @@ CLHF::ao_fock(double accuracy)
       abort();
     }
     tim.exit("stop thread");
+    if (!gbsched_.null()) gbsched_->finish();
       
     double tnint=0;
     for (i=0; i < nthread; i++) {
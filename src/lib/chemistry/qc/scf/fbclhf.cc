@@ -83,6 +83,7 @@ FockBuildCLHF::init_threads()
                       prefetch_blocks_,
                       gbs, gbs, gbs,
                       scf_grp_, threadgrp_, integral());
+  fb_->set_integral_precision(integral_precision());
 }
 
 void
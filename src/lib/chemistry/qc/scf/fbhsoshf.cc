@@ -0,0 +1,352 @@
+//
+// fbhsoshf.cc --- implementation of the FockBuild based high-spin open shell Hartree-Fock SCF classes
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#include <util/misc/scexception.h>
+#include <util/misc/regtime.h>
+#include <util/misc/formio.h>
+#include <util/state/stateio.h>
+
+#include <chemistry/qc/basis/petite.h>
+
+#include <chemistry/qc/scf/fbhsoshf.h>
+#include <chemistry/qc/lcao/fockbuild.h>
+#include <chemistry/qc/lcao/fockbuild_runtime.h>
+#include <chemistry/qc/lcao/hsoshfcontrib.h>
+
+using namespace std;
+using namespace sc;
+
+static ClassDesc FockBuildHSOSHF_cd(
+  typeid(FockBuildHSOSHF),"FockBuildHSOSHF",1,"public HSOSHF",
+  0, create<FockBuildHSOSHF>, create<FockBuildHSOSHF>);
+
+FockBuildHSOSHF::FockBuildHSOSHF(StateIn& s) :
+  SavableState(s),
+  HSOSHF(s)
+{
+  fockdist_ << SavableState::restore_state(s);
+  s.get(fockbuildmatrixtype_);
+  s.get(prefetch_blocks_);
+}
+
+FockBuildHSOSHF::FockBuildHSOSHF(const Ref<KeyVal>& keyval) :
+  HSOSHF(keyval)
+{
+  fockdist_ << keyval->describedclassvalue("fockdist");
+  if (fockdist_.null()) {
+      fockdist_ = new FockDistribution;
+    }
+  KeyValValuestring deffbm("replicated");
+  fockbuildmatrixtype_ = keyval->stringvalue("fockbuildmatrixtype",deffbm);
+  if (fockbuildmatrixtype_ != "replicated"
+      && fockbuildmatrixtype_ != "distributed"
+      && fockbuildmatrixtype_ != "prefetched_distributed") {
+      throw InputError("fockbuildmatrixtype must be \"replicated\","
+                           "\"distributed\", or \"prefetched_distributed\".",
+                           __FILE__,
+                           __LINE__,
+                           "fockbuildmatrixtype",
+                           fockbuildmatrixtype_.c_str(),
+                           class_desc());
+    }
+  prefetch_blocks_ = (fockbuildmatrixtype_ == "prefetched_distributed");
+}
+
+FockBuildHSOSHF::~FockBuildHSOSHF()
+{
+}
+
+void
+FockBuildHSOSHF::save_data_state(StateOut& s)
+{
+  HSOSHF::save_data_state(s);
+  SavableState::save_state(fockdist_.pointer(),s);
+  s.put(fockbuildmatrixtype_);
+  s.put(prefetch_blocks_);
+}
+
+void
+FockBuildHSOSHF::init_threads()
+{
+  Ref<GaussianBasisSet> gbs(basis());
+  Ref<FockContribution> fc
+      = new HSOSHFContribution(gbs,gbs,gbs,fockbuildmatrixtype_);
+  fb_ = new FockBuild(fockdist_,
+                      fc,
+                      prefetch_blocks_,
+                      gbs, gbs, gbs,
+                      scf_grp_, threadgrp_, integral());
+  fb_->set_integral_precision(integral_precision());
+}
+
+void
+FockBuildHSOSHF::done_threads()
+{
+  fb_ = 0;
+}
+
+void
+FockBuildHSOSHF::ao_fock(double accuracy)
+{
+  Timer routine_tim("ao_fock");
+  Timer step_tim("misc");
+
+  Ref<GaussianBasisSet> gbs = basis();
+  Ref<PetiteList> pl = integral()->petite_list(gbs);
+
+  // transform the density differences to the AO basis
+  RefSymmSCMatrix dd = cl_dens_diff_;
+  cl_dens_diff_ = pl->to_AO_basis(dd);
+  RefSymmSCMatrix ddo = op_dens_diff_;
+  op_dens_diff_ = pl->to_AO_basis(ddo);
+
+  double gmat_accuracy = accuracy;
+  if (min_orthog_res() < 1.0) { gmat_accuracy *= min_orthog_res(); }
+
+  // G(0) = J - 1/2 K is accumulated directly into the closed shell G;
+  // G(1) = -1/2 K(o) is the negative of the open shell G
+  RefSymmSCMatrix g1 = op_gmat_.clone();
+  g1.assign(0.0);
+
+  fb_->contrib()->set_fmat(0, cl_gmat_);
+  fb_->contrib()->set_fmat(1, g1);
+  fb_->contrib()->set_pmat(0, cl_dens_diff_);
+  fb_->contrib()->set_pmat(1, op_dens_diff_);
+  fb_->set_accuracy(gmat_accuracy);
+
+  step_tim.change("build");
+  fb_->build();
+
+  ExEnv::out0() << indent << scprintf("%20.0f integrals\n",
+                                      fb_->contrib()->nint());
+
+  step_tim.change("misc");
+
+  g1.scale(-1.0);
+  op_gmat_.accumulate(g1);
+  g1 = 0;
+
+  // get rid of the AO basis density differences
+  cl_dens_diff_ = dd;
+  dd = cl_dens_diff_.clone();
+  op_dens_diff_ = ddo;
+  ddo = op_dens_diff_.clone();
+
+  // now symmetrize the skeleton G matrices
+  RefSymmSCMatrix skel_gmat = cl_gmat_.copy();
+  skel_gmat.scale(1.0/(double)pl->order());
+  pl->symmetrize(skel_gmat,dd);
+
+  skel_gmat = op_gmat_.copy();
+  skel_gmat.scale(1.0/(double)pl->order());
+  pl->symmetrize(skel_gmat,ddo);
+
+  // F = H+G
+  cl_fock_.result_noupdate().assign(hcore_);
+  cl_fock_.result_noupdate().accumulate(dd);
+
+  // Fo = H+G-Go
+  op_fock_.result_noupdate().assign(cl_fock_.result_noupdate());
+  ddo.scale(-1.0);
+  op_fock_.result_noupdate().accumulate(ddo);
+  ddo=0;
+
+  dd.assign(0.0);
+  accumddh_->accum(dd);
+  cl_fock_.result_noupdate().accumulate(dd);
+  op_fock_.result_noupdate().accumulate(dd);
+  dd=0;
+
+  cl_fock_.computed()=1;
+  op_fock_.computed()=1;
+}
+
+void
+FockBuildHSOSHF::print(std::ostream&o) const
+{
+  HSOSHF::print(o);
+  ExEnv::out0() << indent
+                << "fockbuildmatrixtype = " << fockbuildmatrixtype_
+                << std::endl;
+  fockdist_->print(o);
+}
+
+////////////////////////////////////////////////////////
+
+ClassDesc DFHSOSHF::cd_(
+  typeid(DFHSOSHF),"DFHSOSHF",1,"public HSOSHF",
+  0, create<DFHSOSHF>, create<DFHSOSHF>);
+
+DFHSOSHF::DFHSOSHF(StateIn& s) :
+  SavableState(s),
+  HSOSHF(s)
+{
+  world_ << SavableState::restore_state(s);
+  Ref<PetiteList> pl = integral()->petite_list();
+  cl_gmat_so_ = basis()->so_matrixkit()->symmmatrix(pl->SO_basisdim());
+  cl_gmat_so_.assign(0.0);
+  op_gmat_so_ = cl_gmat_so_.clone();
+  op_gmat_so_.assign(0.0);
+}
+
+DFHSOSHF::DFHSOSHF(const Ref<KeyVal>& keyval) :
+  HSOSHF(keyval)
+{
+  dens_reset_freq_ = 1;
+
+  // if world not given, make this the center of a new World
+  world_ << keyval->describedclassvalue("world", KeyValValueRefDescribedClass(0));
+  if (world_.null())
+    world_ = new WavefunctionWorld(keyval);
+  if (world_.null())
+    throw InputError("DFHSOSHF requires a WavefunctionWorld; input did not specify it, neither could it be constructed",
+                     __FILE__, __LINE__, "world");
+  if (world_->wfn() == 0) world_->set_wfn(this);
+
+  // G matrices in the SO basis
+  Ref<PetiteList> pl = integral()->petite_list();
+  cl_gmat_so_ = basis()->so_matrixkit()->symmmatrix(pl->SO_basisdim());
+  cl_gmat_so_.assign(0.0);
+  op_gmat_so_ = cl_gmat_so_.clone();
+  op_gmat_so_.assign(0.0);
+}
+
+DFHSOSHF::~DFHSOSHF()
+{
+}
+
+void
+DFHSOSHF::save_data_state(StateOut& s)
+{
+  HSOSHF::save_data_state(s);
+  SavableState::save_state(world_.pointer(),s);
+}
+
+void
+DFHSOSHF::ao_fock(double accuracy)
+{
+  Timer routine_tim("ao_fock");
+  Timer step_tim("misc");
+
+  // the spin densities in the AO basis: Pa = (P + Po)/2, Pb = (P - Po)/2
+  Ref<PetiteList> pl = integral()->petite_list();
+  RefSymmSCMatrix P = pl->to_AO_basis(cl_dens_diff_);
+  RefSymmSCMatrix Po = pl->to_AO_basis(op_dens_diff_);
+  RefSymmSCMatrix Pa = P.copy();
+  Pa.accumulate(Po);
+  Pa.scale(0.5);
+  RefSymmSCMatrix Pb = Po.copy();
+  Pb.scale(-1.0);
+  Pb.accumulate(P);
+  Pb.scale(0.5);
+  P = 0;
+  Po = 0;
+
+  Ref<OrbitalSpaceRegistry> oreg = world_->moints_runtime()->factory()->orbital_registry();
+  Ref<AOSpaceRegistry> aoreg = world_->moints_runtime()->factory()->ao_registry();
+  std::string aospace_id = new_unique_key(oreg);
+  if (aoreg->key_exists(basis()) == false) {
+    Ref<OrbitalSpace> aospace = new AtomicOrbitalSpace(aospace_id, "DFHSOSHF AO basis set", basis(), integral());
+    aoreg->add(basis(), aospace);
+    MPQC_ASSERT(oreg->key_exists(aospace_id) == false); // should be ensured by using new_unique_key
+    oreg->add(make_keyspace_pair(aospace));
+  }
+  Ref<FockBuildRuntime> fb_rtime = world_->fockbuild_runtime();
+  fb_rtime->set_densities(Pa, Pb);
+  Pa = 0;
+  Pb = 0;
+
+  step_tim.change("build");
+  Ref<OrbitalSpace> aospace = aoreg->value(basis());
+  // Gc = J - 1/2 (Ka + Kb), Go = 1/2 (Ka - Kb)
+  RefSCMatrix Gc, Go;
+  {
+    const std::string jkey = ParsedOneBodyIntKey::key(aospace->id(),aospace->id(),std::string("J"));
+    Gc = fb_rtime->get(jkey).copy();
+  }
+  {
+    const std::string kkey = ParsedOneBodyIntKey::key(aospace->id(),aospace->id(),std::string("K"),Alpha);
+    RefSCMatrix Ka = fb_rtime->get(kkey);
+    Gc.accumulate( -0.5 * Ka);
+    Go = 0.5 * Ka;
+  }
+  {
+    const std::string kkey = ParsedOneBodyIntKey::key(aospace->id(),aospace->id(),std::string("K"),Beta);
+    RefSCMatrix Kb = fb_rtime->get(kkey);
+    Gc.accumulate( -0.5 * Kb);
+    Go.accumulate( -0.5 * Kb);
+  }
+  RefSCMatrix* G[2] = { &Gc, &Go };
+  RefSymmSCMatrix* gmat_so[2] = { &cl_gmat_so_, &op_gmat_so_ };
+  for (int g=0; g<2; g++) {
+    Ref<SCElementOp> accum_G_op = new SCElementAccumulateSCMatrix(G[g]->pointer());
+    RefSymmSCMatrix G_symm = G[g]->kit()->symmmatrix(G[g]->coldim()); G_symm.assign(0.0);
+    G_symm.element_op(accum_G_op); *G[g] = 0;
+    G_symm = pl->to_SO_basis(G_symm);
+    gmat_so[g]->accumulate(G_symm);
+  }
+  step_tim.change("misc");
+
+  // F = H+G
+  cl_fock_.result_noupdate().assign(hcore_);
+  cl_fock_.result_noupdate().accumulate(cl_gmat_so_);
+
+  // Fo = H+G-Go
+  op_fock_.result_noupdate().assign(cl_fock_.result_noupdate());
+  op_fock_.result_noupdate().accumulate(-1.0 * op_gmat_so_);
+
+  RefSymmSCMatrix dd = cl_gmat_so_.clone();
+  dd.assign(0.0);
+  accumddh_->accum(dd);
+  cl_fock_.result_noupdate().accumulate(dd);
+  op_fock_.result_noupdate().accumulate(dd);
+
+  cl_fock_.computed()=1;
+  op_fock_.computed()=1;
+}
+
+void
+DFHSOSHF::reset_density() {
+  HSOSHF::reset_density();
+  cl_gmat_so_.assign(0.0);
+  op_gmat_so_.assign(0.0);
+}
+
+void
+DFHSOSHF::print(std::ostream&o) const
+{
+  HSOSHF::print(o);
+  world_->print(o);
+}
+
+Ref<DensityFittingInfo>
+DFHSOSHF::dfinfo() const {
+  Ref<DensityFittingInfo> result = const_cast<DensityFittingInfo*>(world_->tfactory()->df_info());
+  return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+// Local Variables:
+// mode: c++
+// c-file-style: "ETS"
+// End:
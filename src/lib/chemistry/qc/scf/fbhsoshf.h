@@ -0,0 +1,98 @@
+//
+// fbhsoshf.h --- definition of the FockBuild based high-spin open shell Hartree-Fock SCF classes
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#ifndef _chemistry_qc_scf_fbhsoshf_h
+#define _chemistry_qc_scf_fbhsoshf_h
+
+#include <string>
+
+#include <chemistry/qc/scf/hsoshf.h>
+#include <chemistry/qc/lcao/fockbuild.h>
+#include <chemistry/qc/lcao/wfnworld.h>
+#include <chemistry/qc/lcao/df.h>
+
+namespace sc {
+
+// //////////////////////////////////////////////////////////////////////////
+
+/** FockBuildHSOSHF is a specialization of HSOSHF that uses FockBuild class
+    for computing fock matrices.  The closed and open shell density
+    differences are contracted with the integrals in a single pass using
+    HSOSHFContribution.  It accepts the <tt>fockdist</tt> and
+    <tt>fockbuildmatrixtype</tt> keywords of FockBuildCLHF. */
+class FockBuildHSOSHF: public HSOSHF {
+  protected:
+    Ref<FockDistribution> fockdist_;
+    Ref<FockBuild> fb_;
+    std::string fockbuildmatrixtype_;
+    void ao_fock(double accuracy);
+    bool prefetch_blocks_;
+  public:
+    FockBuildHSOSHF(StateIn&);
+    FockBuildHSOSHF(const Ref<KeyVal>&);
+    ~FockBuildHSOSHF();
+    void save_data_state(StateOut&);
+    void init_threads();
+    void done_threads();
+    void print(std::ostream&o=ExEnv::out0()) const;
+};
+
+/// DFHSOSHF is a specialization of HSOSHF that uses a density-fitting FockBuild class for computing fock matrices
+class DFHSOSHF: public HSOSHF {
+  protected:
+    void ao_fock(double accuracy);
+    void reset_density();
+  public:
+    DFHSOSHF(StateIn&);
+    /** Accepts all keywords of HSOSHF class + the following keywords:
+        <table border="1">
+
+          <tr><td>%Keyword<td>Type<td>Default<td>Description
+
+          <tr><td><tt>world</tt><td>WavefunctionWorld<td>see notes<td>the WavefunctionWorld object that
+          this wave function belongs to. If not given, this object will live in its own WavefunctionWorld.
+
+          </table>
+
+     * N.B. <tt>density_reset_freq</tt> is ignored by this method -- full Fock matrices are always constructed.
+     */
+    DFHSOSHF(const Ref<KeyVal>&);
+    ~DFHSOSHF();
+    void save_data_state(StateOut&);
+    void print(std::ostream&o=ExEnv::out0()) const;
+    const Ref<WavefunctionWorld>& world() const { return world_; }
+    Ref<DensityFittingInfo> dfinfo() const;
+  private:
+    RefSymmSCMatrix cl_gmat_so_;
+    RefSymmSCMatrix op_gmat_so_;
+    Ref<WavefunctionWorld> world_;
+    static ClassDesc cd_;
+};
+
+}
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-file-style: "ETS"
+// End:
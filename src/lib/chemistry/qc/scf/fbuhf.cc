@@ -0,0 +1,340 @@
+//
+// fbuhf.cc --- implementation of the FockBuild based unrestricted Hartree-Fock SCF classes
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#include <util/misc/scexception.h>
+#include <util/misc/regtime.h>
+#include <util/misc/formio.h>
+#include <util/state/stateio.h>
+
+#include <chemistry/qc/basis/petite.h>
+
+#include <chemistry/qc/scf/fbuhf.h>
+#include <chemistry/qc/lcao/fockbuild.h>
+#include <chemistry/qc/lcao/fockbuild_runtime.h>
+#include <chemistry/qc/lcao/hsoshfcontrib.h>
+
+using namespace std;
+using namespace sc;
+
+static ClassDesc FockBuildUHF_cd(
+  typeid(FockBuildUHF),"FockBuildUHF",1,"public UHF",
+  0, create<FockBuildUHF>, create<FockBuildUHF>);
+
+FockBuildUHF::FockBuildUHF(StateIn& s) :
+  SavableState(s),
+  UHF(s)
+{
+  fockdist_ << SavableState::restore_state(s);
+  s.get(fockbuildmatrixtype_);
+  s.get(prefetch_blocks_);
+}
+
+FockBuildUHF::FockBuildUHF(const Ref<KeyVal>& keyval) :
+  UHF(keyval)
+{
+  fockdist_ << keyval->describedclassvalue("fockdist");
+  if (fockdist_.null()) {
+      fockdist_ = new FockDistribution;
+    }
+  KeyValValuestring deffbm("replicated");
+  fockbuildmatrixtype_ = keyval->stringvalue("fockbuildmatrixtype",deffbm);
+  if (fockbuildmatrixtype_ != "replicated"
+      && fockbuildmatrixtype_ != "distributed"
+      && fockbuildmatrixtype_ != "prefetched_distributed") {
+      throw InputError("fockbuildmatrixtype must be \"replicated\","
+                           "\"distributed\", or \"prefetched_distributed\".",
+                           __FILE__,
+                           __LINE__,
+                           "fockbuildmatrixtype",
+                           fockbuildmatrixtype_.c_str(),
+                           class_desc());
+    }
+  prefetch_blocks_ = (fockbuildmatrixtype_ == "prefetched_distributed");
+}
+
+FockBuildUHF::~FockBuildUHF()
+{
+}
+
+void
+FockBuildUHF::save_data_state(StateOut& s)
+{
+  UHF::save_data_state(s);
+  SavableState::save_state(fockdist_.pointer(),s);
+  s.put(fockbuildmatrixtype_);
+  s.put(prefetch_blocks_);
+}
+
+void
+FockBuildUHF::init_threads()
+{
+  Ref<GaussianBasisSet> gbs(basis());
+  Ref<FockContribution> fc
+      = new HSOSHFContribution(gbs,gbs,gbs,fockbuildmatrixtype_);
+  fb_ = new FockBuild(fockdist_,
+                      fc,
+                      prefetch_blocks_,
+                      gbs, gbs, gbs,
+                      scf_grp_, threadgrp_, integral());
+  fb_->set_integral_precision(integral_precision());
+}
+
+void
+FockBuildUHF::done_threads()
+{
+  fb_ = 0;
+}
+
+void
+FockBuildUHF::ao_fock(double accuracy)
+{
+  Timer routine_tim("ao_fock");
+  Timer step_tim("misc");
+
+  Ref<GaussianBasisSet> gbs = basis();
+  Ref<PetiteList> pl = integral()->petite_list(gbs);
+
+  // the total and spin density differences in the AO basis
+  RefSymmSCMatrix dda = pl->to_AO_basis(diff_densa_);
+  RefSymmSCMatrix ddb = pl->to_AO_basis(diff_densb_);
+  RefSymmSCMatrix ddt = dda.copy();
+  ddt.accumulate(ddb);
+  RefSymmSCMatrix dds = ddb.copy();
+  dds.scale(-1.0);
+  dds.accumulate(dda);
+  dda = 0;
+  ddb = 0;
+
+  double gmat_accuracy = accuracy;
+  if (min_orthog_res() < 1.0) { gmat_accuracy *= min_orthog_res(); }
+
+  // G(0) = J(t) - 1/2 K(t) and G(1) = -1/2 K(s), so that
+  // Ga = G(0) + G(1) and Gb = G(0) - G(1)
+  RefSymmSCMatrix g0 = gmata_.clone();
+  g0.assign(0.0);
+  RefSymmSCMatrix g1 = gmata_.clone();
+  g1.assign(0.0);
+
+  fb_->contrib()->set_fmat(0, g0);
+  fb_->contrib()->set_fmat(1, g1);
+  fb_->contrib()->set_pmat(0, ddt);
+  fb_->contrib()->set_pmat(1, dds);
+  fb_->set_accuracy(gmat_accuracy);
+
+  step_tim.change("build");
+  fb_->build();
+
+  ExEnv::out0() << indent << scprintf("%20.0f integrals\n",
+                                      fb_->contrib()->nint());
+
+  step_tim.change("misc");
+  ddt = 0;
+  dds = 0;
+
+  gmata_.accumulate(g0);
+  gmata_.accumulate(g1);
+  gmatb_.accumulate(g0);
+  g1.scale(-1.0);
+  gmatb_.accumulate(g1);
+  g0 = 0;
+  g1 = 0;
+
+  // now symmetrize the skeleton G matrices
+  RefSymmSCMatrix ga = diff_densa_.clone();
+  RefSymmSCMatrix skel_gmat = gmata_.copy();
+  skel_gmat.scale(1.0/(double)pl->order());
+  pl->symmetrize(skel_gmat,ga);
+
+  RefSymmSCMatrix gb = diff_densb_.clone();
+  skel_gmat = gmatb_.copy();
+  skel_gmat.scale(1.0/(double)pl->order());
+  pl->symmetrize(skel_gmat,gb);
+
+  // Fa = H+Ga
+  focka_.result_noupdate().assign(hcore_);
+  focka_.result_noupdate().accumulate(ga);
+
+  // Fb = H+Gb
+  fockb_.result_noupdate().assign(hcore_);
+  fockb_.result_noupdate().accumulate(gb);
+
+  ga.assign(0.0);
+  accumddh_->accum(ga);
+  focka_.result_noupdate().accumulate(ga);
+  fockb_.result_noupdate().accumulate(ga);
+
+  focka_.computed()=1;
+  fockb_.computed()=1;
+}
+
+void
+FockBuildUHF::print(std::ostream&o) const
+{
+  UHF::print(o);
+  ExEnv::out0() << indent
+                << "fockbuildmatrixtype = " << fockbuildmatrixtype_
+                << std::endl;
+  fockdist_->print(o);
+}
+
+////////////////////////////////////////////////////////
+
+ClassDesc DFUHF::cd_(
+  typeid(DFUHF),"DFUHF",1,"public UHF",
+  0, create<DFUHF>, create<DFUHF>);
+
+DFUHF::DFUHF(StateIn& s) :
+  SavableState(s),
+  UHF(s)
+{
+  world_ << SavableState::restore_state(s);
+  Ref<PetiteList> pl = integral()->petite_list();
+  gmata_so_ = basis()->so_matrixkit()->symmmatrix(pl->SO_basisdim());
+  gmata_so_.assign(0.0);
+  gmatb_so_ = gmata_so_.clone();
+  gmatb_so_.assign(0.0);
+}
+
+DFUHF::DFUHF(const Ref<KeyVal>& keyval) :
+  UHF(keyval)
+{
+  dens_reset_freq_ = 1;
+
+  // if world not given, make this the center of a new World
+  world_ << keyval->describedclassvalue("world", KeyValValueRefDescribedClass(0));
+  if (world_.null())
+    world_ = new WavefunctionWorld(keyval);
+  if (world_.null())
+    throw InputError("DFUHF requires a WavefunctionWorld; input did not specify it, neither could it be constructed",
+                     __FILE__, __LINE__, "world");
+  if (world_->wfn() == 0) world_->set_wfn(this);
+
+  // G matrices in the SO basis
+  Ref<PetiteList> pl = integral()->petite_list();
+  gmata_so_ = basis()->so_matrixkit()->symmmatrix(pl->SO_basisdim());
+  gmata_so_.assign(0.0);
+  gmatb_so_ = gmata_so_.clone();
+  gmatb_so_.assign(0.0);
+}
+
+DFUHF::~DFUHF()
+{
+}
+
+void
+DFUHF::save_data_state(StateOut& s)
+{
+  UHF::save_data_state(s);
+  SavableState::save_state(world_.pointer(),s);
+}
+
+void
+DFUHF::ao_fock(double accuracy)
+{
+  Timer routine_tim("ao_fock");
+  Timer step_tim("misc");
+
+  // the spin densities in the AO basis
+  Ref<PetiteList> pl = integral()->petite_list();
+  RefSymmSCMatrix Pa = pl->to_AO_basis(diff_densa_);
+  RefSymmSCMatrix Pb = pl->to_AO_basis(diff_densb_);
+
+  Ref<OrbitalSpaceRegistry> oreg = world_->moints_runtime()->factory()->orbital_registry();
+  Ref<AOSpaceRegistry> aoreg = world_->moints_runtime()->factory()->ao_registry();
+  std::string aospace_id = new_unique_key(oreg);
+  if (aoreg->key_exists(basis()) == false) {
+    Ref<OrbitalSpace> aospace = new AtomicOrbitalSpace(aospace_id, "DFUHF AO basis set", basis(), integral());
+    aoreg->add(basis(), aospace);
+    MPQC_ASSERT(oreg->key_exists(aospace_id) == false); // should be ensured by using new_unique_key
+    oreg->add(make_keyspace_pair(aospace));
+  }
+  Ref<FockBuildRuntime> fb_rtime = world_->fockbuild_runtime();
+  fb_rtime->set_densities(Pa, Pb);
+  Pa = 0;
+  Pb = 0;
+
+  step_tim.change("build");
+  Ref<OrbitalSpace> aospace = aoreg->value(basis());
+  RefSCMatrix J;
+  {
+    const std::string jkey = ParsedOneBodyIntKey::key(aospace->id(),aospace->id(),std::string("J"));
+    J = fb_rtime->get(jkey);
+  }
+  RefSymmSCMatrix* gmat_so[2] = { &gmata_so_, &gmatb_so_ };
+  const SpinCase1 spins[2] = { Alpha, Beta };
+  for (int s=0; s<2; s++) {
+    const std::string kkey = ParsedOneBodyIntKey::key(aospace->id(),aospace->id(),std::string("K"),spins[s]);
+    RefSCMatrix G = J.copy();
+    G.accumulate( -1.0 * fb_rtime->get(kkey));
+    Ref<SCElementOp> accum_G_op = new SCElementAccumulateSCMatrix(G.pointer());
+    RefSymmSCMatrix G_symm = G.kit()->symmmatrix(G.coldim()); G_symm.assign(0.0);
+    G_symm.element_op(accum_G_op); G = 0;
+    G_symm = pl->to_SO_basis(G_symm);
+    gmat_so[s]->accumulate(G_symm);
+  }
+  J = 0;
+  step_tim.change("misc");
+
+  // Fa = H+Ga
+  focka_.result_noupdate().assign(hcore_);
+  focka_.result_noupdate().accumulate(gmata_so_);
+
+  // Fb = H+Gb
+  fockb_.result_noupdate().assign(hcore_);
+  fockb_.result_noupdate().accumulate(gmatb_so_);
+
+  RefSymmSCMatrix dd = gmata_so_.clone();
+  dd.assign(0.0);
+  accumddh_->accum(dd);
+  focka_.result_noupdate().accumulate(dd);
+  fockb_.result_noupdate().accumulate(dd);
+
+  focka_.computed()=1;
+  fockb_.computed()=1;
+}
+
+void
+DFUHF::reset_density() {
+  UHF::reset_density();
+  gmata_so_.assign(0.0);
+  gmatb_so_.assign(0.0);
+}
+
+void
+DFUHF::print(std::ostream&o) const
+{
+  UHF::print(o);
+  world_->print(o);
+}
+
+Ref<DensityFittingInfo>
+DFUHF::dfinfo() const {
+  Ref<DensityFittingInfo> result = const_cast<DensityFittingInfo*>(world_->tfactory()->df_info());
+  return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+// Local Variables:
+// mode: c++
+// c-file-style: "ETS"
+// End:
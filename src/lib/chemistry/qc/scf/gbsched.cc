@@ -0,0 +1,259 @@
+//
+// gbsched.cc --- implementation of the G matrix build task scheduler
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <util/misc/scexception.h>
+#include <chemistry/qc/scf/gbsched.h>
+
+using namespace sc;
+
+namespace {
+  struct CostCompare {
+    const std::vector<double>& cost;
+    CostCompare(const std::vector<double>& c) : cost(c) {}
+    bool operator()(int a, int b) const {
+      return cost[a] > cost[b];
+    }
+  };
+}
+
+GBuildScheduler::GBuildScheduler(const Ref<GaussianBasisSet>& bs,
+                                 const Ref<PetiteList>& pl,
+                                 const Ref<MessageGrp>& grp,
+                                 const Ref<ThreadGrp>& thr) :
+  grp_(grp), nstolen_thread_(0), nstolen_proc_(0)
+{
+  me_ = grp_->me();
+  nproc_ = grp_->n();
+  nqueue_ = thr->nthread();
+  grp_->max(&nqueue_, 1);
+  lock_ = thr->new_lock();
+  memlock_ = thr->new_lock();
+  qlock_.resize(nqueue_);
+  for (int q=0; q < nqueue_; q++) qlock_[q] = thr->new_lock();
+
+  if (nproc_ > 1) {
+    // every process gets the same result, so all or none steal remotely
+    try {
+      mem_ = MemoryGrp::get_default_memorygrp()->clone();
+    }
+    catch (FeatureNotImplemented&) {
+      mem_ = 0;
+    }
+    if (!mem_.null() && mem_->n() != nproc_) mem_ = 0;
+    if (!mem_.null()) mem_->set_localsize(2*nqueue_*sizeof(int));
+  }
+
+  init_tasks(bs, pl);
+  front_.resize(nqueue_);
+  split_.resize(nqueue_);
+  cursor_.resize(nqueue_);
+}
+
+GBuildScheduler::~GBuildScheduler()
+{
+  if (!mem_.null()) mem_->set_localsize(0);
+}
+
+void
+GBuildScheduler::init_tasks(const Ref<GaussianBasisSet>& bs,
+                            const Ref<PetiteList>& pl)
+{
+  GaussianBasisSet& gbs = *bs.pointer();
+
+  std::vector<Task> tasks;
+  std::vector<double> cost;
+  for (int i=0; i < gbs.nshell(); i++) {
+    if (!pl->in_p1(i))
+      continue;
+    int ni = gbs(i).nfunction();
+    // the number of basis function pairs kl in shells k <= i
+    double nkl = gbs.shell_to_function(i) + ni;
+    nkl = 0.5*nkl*(nkl+1);
+    for (int j=0; j <= i; j++) {
+      if (!pl->in_p2(i_offset(i)+j))
+        continue;
+      Task t;
+      t.i = i;
+      t.j = j;
+      tasks.push_back(t);
+      cost.push_back(ni*gbs(j).nfunction()*nkl);
+    }
+  }
+
+  std::vector<int> order(tasks.size());
+  for (int t=0; t < order.size(); t++) order[t] = t;
+  std::stable_sort(order.begin(), order.end(), CostCompare(cost));
+
+  // assign the tasks, largest first, to the least loaded queue
+  const int nq = nproc_*nqueue_;
+  typedef std::pair<double,int> Load;
+  std::priority_queue<Load, std::vector<Load>, std::greater<Load> > loads;
+  for (int q=0; q < nq; q++) loads.push(Load(0.0, q));
+  std::vector< std::vector<int> > queues(nq);
+  for (int t=0; t < order.size(); t++) {
+    Load l = loads.top();
+    loads.pop();
+    queues[l.second].push_back(order[t]);
+    l.first += cost[order[t]];
+    loads.push(l);
+  }
+
+  tasks_.clear();
+  tasks_.reserve(tasks.size());
+  qbegin_.resize(nq+1);
+  for (int q=0; q < nq; q++) {
+    qbegin_[q] = tasks_.size();
+    for (int t=0; t < queues[q].size(); t++)
+      tasks_.push_back(tasks[queues[q][t]]);
+  }
+  qbegin_[nq] = tasks_.size();
+}
+
+void
+GBuildScheduler::start()
+{
+  for (int q=0; q < nqueue_; q++) {
+    int begin = qbegin_[me_*nqueue_+q];
+    int end = qbegin_[me_*nqueue_+q+1];
+    front_[q] = begin;
+    if (mem_.null()) {
+      split_[q] = end;
+      continue;
+    }
+    // the first half is private, the rest can be stolen by other processes
+    split_[q] = begin + (end - begin + 1)/2;
+    int *counters = (int*) mem_->localdata() + 2*q;
+    counters[0] = split_[q];
+    counters[1] = end;
+  }
+  std::fill(cursor_.begin(), cursor_.end(), 0);
+  nstolen_thread_ = nstolen_proc_ = 0;
+
+  if (!mem_.null()) {
+    mem_->activate();
+    // no process may steal before all counters are initialized
+    grp_->sync();
+  }
+}
+
+void
+GBuildScheduler::finish()
+{
+  if (!mem_.null()) {
+    mem_->sync();
+    mem_->deactivate();
+  }
+}
+
+int
+GBuildScheduler::victim(int thread, int s) const
+{
+  // first the other threads of this process
+  if (s < nqueue_ - 1)
+    return me_*nqueue_ + (thread + 1 + s)%nqueue_;
+  if (mem_.null()) return -1;
+
+  // then all threads of the following processes
+  s -= nqueue_ - 1;
+  int p = s/nqueue_ + 1;
+  if (p >= nproc_) return -1;
+  return ((me_ + p)%nproc_)*nqueue_ + (thread + s)%nqueue_;
+}
+
+bool
+GBuildScheduler::take(int lq, bool front, int& task)
+{
+  ThreadLockHolder lock(qlock_[lq]);
+  if (front_[lq] == split_[lq] && !reacquire(lq)) return false;
+  if (front) task = front_[lq]++;
+  else task = --split_[lq];
+  return true;
+}
+
+bool
+GBuildScheduler::reacquire(int lq)
+{
+  if (mem_.null()) return false;
+
+  ThreadLockHolder lock(memlock_);
+  distsize_t offset = mem_->offset(me_) + 2*lq*sizeof(int);
+  int *counters = (int*) mem_->obtain_readwrite(offset, 2*sizeof(int));
+  int n = counters[1] - counters[0];
+  if (n > 0) {
+    front_[lq] = counters[0];
+    counters[0] += (n+1)/2;
+    split_[lq] = counters[0];
+  }
+  mem_->release_readwrite(counters, offset, 2*sizeof(int));
+  return n > 0;
+}
+
+bool
+GBuildScheduler::steal(int q, int& task)
+{
+  int proc = q/nqueue_;
+  int lq = q%nqueue_;
+
+  ThreadLockHolder lock(memlock_);
+  distsize_t offset = mem_->offset(proc) + 2*lq*sizeof(int);
+  int *counters = (int*) mem_->obtain_readwrite(offset, 2*sizeof(int));
+  bool stolen = (counters[0] < counters[1]);
+  if (stolen) task = --counters[1];
+  mem_->release_readwrite(counters, offset, 2*sizeof(int));
+  return stolen;
+}
+
+bool
+GBuildScheduler::next(int thread, int& i, int& j)
+{
+  int task;
+  bool found = take(thread, true, task);
+
+  // queues never grow, so a queue found empty is never visited again
+  while (!found) {
+    int q = victim(thread, cursor_[thread]);
+    if (q < 0) return false;
+    bool local = (q/nqueue_ == me_);
+    found = local ? take(q%nqueue_, false, task) : steal(q, task);
+    if (!found) {
+      cursor_[thread]++;
+      continue;
+    }
+    ThreadLockHolder lock(lock_);
+    if (local) nstolen_thread_++;
+    else nstolen_proc_++;
+  }
+
+  i = tasks_[task].i;
+  j = tasks_[task].j;
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+// Local Variables:
+// mode: c++
+// c-file-style: "ETS"
+// End:
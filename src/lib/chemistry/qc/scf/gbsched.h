@@ -0,0 +1,126 @@
+//
+// gbsched.h --- definition of the G matrix build task scheduler
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#ifndef _chemistry_qc_scf_gbsched_h
+#define _chemistry_qc_scf_gbsched_h
+
+#include <vector>
+#include <util/ref/ref.h>
+#include <util/group/message.h>
+#include <util/group/memory.h>
+#include <util/group/thread.h>
+#include <chemistry/qc/basis/basis.h>
+#include <chemistry/qc/basis/petite.h>
+
+namespace sc {
+
+/** GBuildScheduler distributes the shell pair tasks (ij) of a G matrix
+    build (see LocalGBuild) over the threads of all processes without a
+    master process.
+
+    The tasks that survive the petite list are sorted by their estimated
+    cost (the number of integrals (ij|kl) with k <= i) and partitioned
+    statically, largest first, into one queue per thread of each process.
+    A thread takes tasks from the front of its own queue; when it is
+    empty it steals from the back of the queues of the other threads of
+    its process, and then of other processes.
+
+    Each queue is split in a private front part, which only the threads
+    of its process use and which is guarded by a lock per queue, and a
+    shared back part that other processes steal from.  The counters of
+    the shared parts live in a clone of the default MemoryGrp.  When the
+    private part of a queue runs out, half of what is left in the shared
+    part is moved to it, so a process accesses its own counters in the
+    MemoryGrp only a logarithmic number of times per queue.  If the
+    MemoryGrp cannot be cloned, the queues are private and each process
+    only processes its own queues.
+
+    A build is bracketed by start() and finish(), which are collective
+    over the MessageGrp.  next() can be called concurrently by the threads.
+*/
+class GBuildScheduler: public RefCount {
+  public:
+    GBuildScheduler(const Ref<GaussianBasisSet>& bs, const Ref<PetiteList>& pl,
+                    const Ref<MessageGrp>& grp, const Ref<ThreadGrp>& thr);
+    ~GBuildScheduler();
+
+    /// Prepares the queues for a build. Collective.
+    void start();
+    /** Obtains the next shell pair for thread, which must be less than the
+        number of threads of the ThreadGrp.  Returns false when no
+        tasks are left. */
+    bool next(int thread, int& i, int& j);
+    /// Ends the build. Collective.
+    void finish();
+
+    /// The number of tasks.
+    int ntask() const { return tasks_.size(); }
+    /// The number of tasks this process stole from other threads in the last build.
+    int nstolen_thread() const { return nstolen_thread_; }
+    /// The number of tasks this process stole from other processes in the last build.
+    int nstolen_proc() const { return nstolen_proc_; }
+
+  private:
+    struct Task {
+      int i, j;
+    };
+
+    Ref<MessageGrp> grp_;
+    Ref<MemoryGrp> mem_;         // null if other processes cannot be stolen from
+    Ref<ThreadLock> lock_;       // guards the steal counts
+    Ref<ThreadLock> memlock_;    // one obtain_readwrite at a time
+    int me_;
+    int nproc_;
+    int nqueue_;                 // queues per process
+
+    std::vector<Task> tasks_;    // the queues, one after another
+    std::vector<int> qbegin_;    // queue q is [qbegin_[q],qbegin_[q+1])
+
+    // the private parts of the queues of this process: [front_,split_)
+    // is left, guarded by qlock_.  The shared part [split,back) is in
+    // the MemoryGrp.
+    std::vector<int> front_;
+    std::vector<int> split_;
+    std::vector<Ref<ThreadLock> > qlock_;
+    std::vector<int> cursor_;    // for each thread, the next queue to steal from
+    int nstolen_thread_;
+    int nstolen_proc_;
+
+    void init_tasks(const Ref<GaussianBasisSet>& bs, const Ref<PetiteList>& pl);
+    /// the queue thread steals from at step s, or -1 if there are no more
+    int victim(int thread, int s) const;
+    /// takes a task from the front or back of queue lq of this process
+    bool take(int lq, bool front, int& task);
+    /// moves tasks of the shared part of queue lq to its private part
+    bool reacquire(int lq);
+    /// steals a task from the back of the shared part of queue q of another process
+    bool steal(int q, int& task);
+};
+
+}
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-file-style: "ETS"
+// End:
@@ -32,6 +32,8 @@
 
 #include <chemistry/qc/scf/clhf.h>
 #include <chemistry/qc/scf/fbclhf.h>
+#include <chemistry/qc/scf/fbhsoshf.h>
+#include <chemistry/qc/scf/fbuhf.h>
 #include <chemistry/qc/scf/hsoshf.h>
 #include <chemistry/qc/scf/osshf.h>
 #include <chemistry/qc/scf/tchf.h>
@@ -57,6 +59,8 @@ ForceLink<OSSHF> scf_force_link_c_;
 ForceLink<TCHF> scf_force_link_d_;
 ForceLink<UHF> scf_force_link_e_;
 ForceLink<FockBuildCLHF> scf_force_link_f_;
+ForceLink<FockBuildUHF> scf_force_link_fu_;
+ForceLink<FockBuildHSOSHF> scf_force_link_fh_;
 
 #if MPQC_NEW_FEATURES && MPQC_HAS_ELEMENTAL
   ForceLink<mpqc::TA::CLHF> scf_force_link_g_;
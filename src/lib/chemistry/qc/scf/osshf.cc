@@ -163,12 +163,13 @@ OSSHF::ao_fock(double accuracy)
       conts[i] = new LocalOSSContribution(gmats[i], pmat,
                                           gmatas[i], pmata, gmatbs[i], pmatb);
       gblds[i] = new LocalGBuild<LocalOSSContribution>(*conts[i], tbis_[i],
-        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i
+        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i, gbsched_
         );
 
       threadgrp_->add_thread(i, gblds[i]);
     }
 
+    if (!gbsched_.null()) gbsched_->start();
     Timer tim("start thread");
     if (threadgrp_->start_threads() < 0) {
       ExEnv::err0() << indent
@@ -184,6 +185,7 @@ OSSHF::ao_fock(double accuracy)
       abort();
     }
     tim.exit("stop thread");
+    if (!gbsched_.null()) gbsched_->finish();
       
     double tnint=0;
     for (i=0; i < nthread; i++) {
@@ -54,7 +54,7 @@ using namespace sc;
 // SCF
 
 static ClassDesc SCF_cd(
-  typeid(SCF),"SCF",7,"public OneBodyWavefunction",
+  typeid(SCF),"SCF",8,"public OneBodyWavefunction",
   0, 0, 0);
 
 SCF::SCF(StateIn& s) :
@@ -101,6 +101,10 @@ SCF::SCF(StateIn& s) :
     s.get(always_use_guess_wfn_);
   }
   else always_use_guess_wfn_ = 0;
+  if (s.version(::class_desc<SCF>()) >= 8) {
+    s.get(gbuild_sched_);
+  }
+  else gbuild_sched_ = 1;
 
   extrap_ << SavableState::restore_state(s);
   accumdih_ << SavableState::restore_state(s);
@@ -119,7 +123,8 @@ SCF::SCF(const Ref<KeyVal>& keyval) :
   reset_occ_(0),
   local_dens_(1),
   storage_(0),
-  level_shift_(0)
+  level_shift_(0),
+  gbuild_sched_(1)
 {
   if (keyval->exists("maxiter"))
     maxiter_ = keyval->intvalue("maxiter");
@@ -154,6 +159,9 @@ SCF::SCF(const Ref<KeyVal>& keyval) :
   if (keyval->exists("local_density"))
     local_dens_ = keyval->booleanvalue("local_density");
 
+  if (keyval->exists("gbuild_scheduler"))
+    gbuild_sched_ = keyval->booleanvalue("gbuild_scheduler");
+
   print_all_evals_ = keyval->booleanvalue("print_evals");
   print_occ_evals_ = keyval->booleanvalue("print_occupied_evals");
 
@@ -214,6 +222,7 @@ SCF::save_data_state(StateOut& s)
   s.put(keep_guess_wfn_);
   SavableState::save_state(guess_wfn_.pointer(),s);
   s.put(always_use_guess_wfn_);
+  s.put(gbuild_sched_);
   SavableState::save_state(extrap_.pointer(),s);
   SavableState::save_state(accumdih_.pointer(),s);
   SavableState::save_state(accumddh_.pointer(),s);
@@ -730,14 +739,30 @@ SCF::init_threads()
 {
   int nthread = threadgrp_->nthread();
   size_t int_store = integral()->storage_unused()/nthread;
+  double int_precision = integral_precision();
 
   // initialize the two electron integral classes
   tbis_ = new Ref<TwoBodyInt>[nthread];
   for (int i=0; i < nthread; i++) {
     tbis_[i] = integral()->electron_repulsion();
+    tbis_[i]->set_integral_precision(int_precision);
     tbis_[i]->set_integral_storage(int_store);
   }
 
+  // without the scheduler LocalGBuild distributes the shell pairs round-robin
+  if (gbuild_sched_)
+    gbsched_ = new GBuildScheduler(basis(), integral()->petite_list(),
+                                   scf_grp_, threadgrp_);
+}
+
+double
+SCF::integral_precision()
+{
+  // compute_vector tightens the accuracy down to a thousandth of the
+  // desired value accuracy, and ao_fock scales it by min_orthog_res()
+  double precision = 0.001 * desired_value_accuracy();
+  if (min_orthog_res() < 1.0) precision *= min_orthog_res();
+  return precision;
 }
 
 void
@@ -746,6 +771,7 @@ SCF::done_threads()
   for (int i=0; i < threadgrp_->nthread(); i++) tbis_[i] = 0;
   delete[] tbis_;
   tbis_ = 0;
+  gbsched_ = 0;
 }
 
 int *
@@ -35,6 +35,7 @@
 #include <chemistry/qc/basis/tbint.h>
 #include <chemistry/qc/wfn/accum.h>
 #include <chemistry/qc/wfn/obwfn.h>
+#include <chemistry/qc/scf/gbsched.h>
 
 namespace sc {
 
@@ -68,14 +69,19 @@ class SCF: public OneBodyWavefunction {
     int print_occ_evals_;
 
     double level_shift_;
+    int gbuild_sched_;
 
     Ref<MessageGrp> scf_grp_;
     Ref<ThreadGrp> threadgrp_;
     int local_;
 
     Ref<TwoBodyInt>* tbis_; // a two body integral evaluator for each thread
+    Ref<GBuildScheduler> gbsched_; // distributes the G matrix build tasks
     virtual void init_threads();
     virtual void done_threads();
+    // the smallest accuracy compute_vector requests from ao_fock, with
+    // which cached two electron integrals are kept
+    double integral_precision();
 
     // implement the Compute::compute() function
     virtual void compute();
@@ -171,6 +177,12 @@ class SCF: public OneBodyWavefunction {
         density and \f$G\f$ matrix will be made on all nodes, even if a
         distributed matrix specialization is used.  The default is true.
 
+        <dt><tt>gbuild_scheduler</tt><dd> If this is true, the shell pairs
+        of the \f$G\f$ matrix build are sorted by cost into work-stealing
+        queues, one per thread (see GBuildScheduler).  If false, they are
+        distributed round-robin over the threads of all nodes.  The default
+        is true.
+
         <dt><tt>guess_wavefunction</tt><dd> This specifies the initial
         guess for the solution to the SCF equations.  This can be either a
         OneBodyWavefunction object or the name of file that contains the
@@ -183,12 +183,13 @@ TCHF::ao_fock(double accuracy)
       conts[i] = new LocalTCContribution(gmatas[i], pmata, gmatbs[i], pmatb,
                                          kmatas[i], opmata, kmatbs[i], opmatb);
       gblds[i] = new LocalGBuild<LocalTCContribution>(*conts[i], tbis_[i],
-        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i
+        pl, bs, scf_grp_, pmax, gmat_accuracy, nthread, i, gbsched_
         );
 
       threadgrp_->add_thread(i, gblds[i]);
     }
 
+    if (!gbsched_.null()) gbsched_->start();
     Timer tim("start thread");
     if (threadgrp_->start_threads() < 0) {
       ExEnv::err0() << indent
@@ -204,6 +205,7 @@ TCHF::ao_fock(double accuracy)
       abort();
     }
     tim.exit("stop thread");
+    if (!gbsched_.null()) gbsched_->finish();
       
     double tnint=0;
     for (i=0; i < nthread; i++) {
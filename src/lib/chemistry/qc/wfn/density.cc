@@ -377,6 +377,12 @@ BatchElectronDensity::compute_basis_values(const SCVector3&r)
       for (int i=0; i<nshell_; i++) contrib_[i] = i;
     }
 
+  compute_contrib_basis_values(r);
+}
+
+void
+BatchElectronDensity::compute_contrib_basis_values(const SCVector3&r)
+{
   ncontrib_bf_ = 0;
   for (int i=0; i<ncontrib_; i++) {
       int nbf = basis_->shell(contrib_[i]).nfunction();
@@ -634,6 +640,54 @@ BatchElectronDensity::compute_density(const SCVector3 &r,
 
 }
 
+void
+BatchElectronDensity::compute_basis_values(const SCVector3 &r,
+                                           bool need_gradient)
+{
+  if (alpha_dmat_ == 0) {
+      throw ProgrammingError("BatchElectronDensity::compute_basis_values: "
+                             "densities have not been set",
+                             __FILE__, __LINE__);
+    }
+
+  need_gradient_ = need_gradient;
+  need_hessian_ = false;
+
+  compute_basis_values(r);
+}
+
+void
+BatchElectronDensity::compute_basis_values(const SCVector3 &r,
+                                           bool need_gradient,
+                                           int nshell, const int *shells)
+{
+  if (alpha_dmat_ == 0) {
+      throw ProgrammingError("BatchElectronDensity::compute_basis_values: "
+                             "densities have not been set",
+                             __FILE__, __LINE__);
+    }
+
+  need_gradient_ = need_gradient;
+  need_hessian_ = false;
+
+  ncontrib_ = nshell;
+  for (int i=0; i<nshell; i++) contrib_[i] = shells[i];
+
+  compute_contrib_basis_values(r);
+}
+
+bool
+BatchElectronDensity::mark_contributing_shells(const SCVector3 &r,
+                                               std::vector<bool> &contributes)
+{
+  if (!linear_scaling_ || extent_ == 0) return false;
+
+  const std::vector<ExtentData> &cs
+      = extent_->contributing_shells(r[0],r[1],r[2]);
+  for (int i=0; i<cs.size(); i++) contributes[cs[i].shell] = true;
+  return true;
+}
+
 void
 BatchElectronDensity::compute()
 {
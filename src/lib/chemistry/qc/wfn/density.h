@@ -102,6 +102,8 @@ class BatchElectronDensity: public Volume {
     // either with init_common_data or by copying
     virtual void init_scratch_data();
     void compute_basis_values(const SCVector3&r);
+    // computes the values of the shells in contrib_
+    void compute_contrib_basis_values(const SCVector3&r);
     void compute_spin_density(const double *RESTRICT dmat,
                               double *RESTRICT rho,
                               double *RESTRICT grad,
@@ -152,6 +154,23 @@ class BatchElectronDensity: public Volume {
                          double *beta_density_grad,
                          double *beta_density_hessian);
 
+    /** Computes only the values of the contributing basis functions at r,
+        and their gradients if need_gradient is true.  The results are
+        available from ncontrib_bf(), contrib_bf(), bs_values(), and
+        bsg_values().  The density matrices must already be set. */
+    void compute_basis_values(const SCVector3 &r, bool need_gradient);
+    /** Like compute_basis_values(r,need_gradient), but the values of
+        the given nshell shells are computed, instead of the shells
+        selected by the shell extents. */
+    void compute_basis_values(const SCVector3 &r, bool need_gradient,
+                              int nshell, const int *shells);
+    /** Sets contributes[i] to true for each shell i that the shell
+        extents select at r.  Returns false, without modifying
+        contributes, if shell extents are not used, in which case all
+        shells contribute everywhere. */
+    bool mark_contributing_shells(const SCVector3 &r,
+                                  std::vector<bool> &contributes);
+
     /** This is called to finish initialization of the object.  It must not
         be called with objects created in a way that they share parent
         data; those objects are initialized when they are constructed. This
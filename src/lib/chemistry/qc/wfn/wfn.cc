@@ -1722,6 +1722,7 @@ Wavefunction::init_orthog()
 double
 Wavefunction::min_orthog_res()
 {
+  if (orthog_.null()) init_orthog();
   return orthog_->min_orthog_res();
 }
 
@@ -44,6 +44,7 @@
 #ifdef HAVE_MPI
 #include <math/distarray4/distarray4_mpiiofile.h>
 #endif
+#include <math/distarray4/distarray4_stream.h>
 
 using namespace std;
 using namespace sc;
@@ -613,9 +614,12 @@ namespace sc {
     const unsigned int blksize_int_sq = n1 * n2;
     const unsigned int blksize_int = blksize_int_sq;
     //
-    // maximum tile size is determined by the available memory
+    // maximum tile size is determined by the available memory; the tiles are
+    // held in the buffers of the stream that reads them, see below
     const size_t memory_available = ConsumableResources::get_default_instance()->memory();
-    const size_t max_tile_size = memory_available / (2 * blksize_int * sizeof(double));
+    const int stream_depth = DistArray4PairBlockStream::default_depth();
+    const size_t max_tile_size = memory_available /
+        DistArray4PairBlockStream::memory(stream_depth, blksize_int);
     if (max_tile_size == 0) {
       throw AlgorithmException("not enough memory for a single tile, increase memory", __FILE__, __LINE__);
     }
@@ -630,9 +634,7 @@ namespace sc {
     const size_t tile_size_bra = (nij_bra + ntiles_bra - 1) / ntiles_bra;
     const size_t tile_size_ket = (nij_ket + ntiles_ket - 1) / ntiles_ket;
 
-    // scratch buffers to hold tiles and the result of the contraction
-    double* T_bra = allocate<double>(tile_size_bra * blksize_int);
-    double* T_ket = allocate<double>(tile_size_ket * blksize_int);
+    // scratch buffer to hold the result of the contraction
     double* T_result = allocate<double>(tile_size_bra * tile_size_ket);
 
     // split work over tasks which have access to integrals
@@ -643,24 +645,49 @@ namespace sc {
 
     if (bra->has_access(me)) {
 
-      size_t task_count = 0;
-
       // these will keep track of each tile's sets of i and j values
       typedef triple<unsigned int, unsigned int, unsigned int> uint3;
-      std::vector<uint3> bra_ij;
+      std::vector< std::vector<uint3> > bra_tiles(ntiles_bra);
       iterbra.start();
+      for (size_t tbra = 0; tbra < ntiles_bra; ++tbra)
+        for (size_t i=0; iterbra && i<tile_size_bra; ++i, iterbra.next())
+          bra_tiles[tbra].push_back(uint3(iterbra.i(), iterbra.j(), iterbra.ij()));
+      std::vector< std::vector<uint3> > ket_tiles(ntiles_ket);
+      iterket.start();
+      for (size_t tket = 0; tket < ntiles_ket; ++tket)
+        for (size_t i=0; iterket && i<tile_size_ket; ++i, iterket.next())
+          ket_tiles[tket].push_back(uint3(iterket.i(), iterket.j(), iterket.ij()));
+
+      // tiles are read ahead in the order in which they are used below,
+      // so that reading the next tile overlaps with the contraction of the current one;
+      // the contraction works directly on the buffers of the stream
+      DistArray4PairBlockStream blocks(stream_depth);
+      size_t task_count = 0;
+      for (size_t tbra = 0; tbra < ntiles_bra; ++tbra) {
+        bool bra_loaded = false;
+        for (size_t tket = 0; tket < ntiles_ket; ++tket, ++task_count) {
+          if (task_count % nproc_with_ints != proc_with_ints[me])
+            continue;
+          if (!bra_loaded) {
+            for (size_t i=0; i<bra_tiles[tbra].size(); ++i)
+              blocks.add(bra, bra_tiles[tbra][i].i0_, bra_tiles[tbra][i].i1_, intsetidx_bra, i == 0);
+            bra_loaded = true;
+          }
+          for (size_t i=0; i<ket_tiles[tket].size(); ++i)
+            blocks.add(ket, ket_tiles[tket][i].i0_, ket_tiles[tket][i].i1_, intsetidx_ket, i == 0);
+        }
+      }
+      blocks.start();
+
+      task_count = 0;
       // loop over bra tiles for this set
-      size_t tbra_offset = 0;
-      for (size_t tbra = 0; tbra < ntiles_bra; ++tbra, tbra_offset += tile_size_bra) {
-        double* bra_tile = 0;   // zero indicates it needs to be loaded
+      for (size_t tbra = 0; tbra < ntiles_bra; ++tbra) {
+        const std::vector<uint3>& bra_ij = bra_tiles[tbra];
+        const double* bra_tile = 0;   // zero indicates it needs to be loaded
 
-        // these will keep track of each tile's sets of i and j values
-        std::vector<uint3> ket_ij;
-        iterket.start();
         // loop over ket tiles for this set
-        size_t tket_offset = 0;
-        for (size_t tket = 0; tket < ntiles_ket; ++tket, tket_offset += tile_size_ket, ++task_count) {
-          double* ket_tile = 0;   // zero indicates it needs to be loaded
+        for (size_t tket = 0; tket < ntiles_ket; ++tket, ++task_count) {
+          const std::vector<uint3>& ket_ij = ket_tiles[tket];
 
           // distribute tasks by round-robin
           const int task_proc = task_count % nproc_with_ints;
@@ -669,23 +696,12 @@ namespace sc {
 
           // has the bra tile been loaded?
           if (bra_tile == 0) {
-            bra_tile = T_bra;
-            for (size_t i=0; iterbra && i<tile_size_bra; ++i, iterbra.next()) {
-              const uint3 ijt(iterbra.i(), iterbra.j(), iterbra.ij());
-              bra_ij.push_back(ijt);
-
-              double* blk_ptr = bra_tile + i*blksize_int;
-              // where to read the integrals? if not antisymmetrizing read directly to T_bra, else read to scratch
-              // buffer, then antisymmetrize to T_bra
-              double* blk_ptr_read = blk_ptr;
-              Timer tim_intsretrieve("MO ints retrieve");
-              const double* blk_cptr = bra->retrieve_pair_block(ijt.i0_,
-                                                                   ijt.i1_,
-                                                                   intsetidx_bra,
-                                                                   blk_ptr_read);
-              tim_intsretrieve.exit();
-
-              if (debug >= DefaultPrintThresholds::allO2N2) {
+            Timer tim_intsretrieve("MO ints retrieve");
+            bra_tile = blocks.next();
+            tim_intsretrieve.exit();
+            if (debug >= DefaultPrintThresholds::allO2N2) {
+              for (size_t i=0; i<bra_ij.size(); ++i) {
+                const uint3& ijt = bra_ij[i];
                 ExEnv::outn() << indent << "task " << me
                     << ": obtained ij blocks" << std::endl;
                 ExEnv::outn() << indent
@@ -694,44 +710,29 @@ namespace sc {
 
                 RefSCMatrix blk_scmat = SCMatrixKit::default_matrixkit()->matrix(new SCDimension(n1),
                                                                                  new SCDimension(n2));
-                blk_scmat.assign(blk_cptr);
+                blk_scmat.assign(bra_tile + i*blksize_int);
                 blk_scmat.print("ij block");
               }
-
             }
           }
 
-          // has the ket tile been loaded?
-          if (ket_tile == 0) {
-            ket_tile = T_ket;
-            for (size_t i=0; iterket && i<tile_size_ket; ++i, iterket.next()) {
-              const uint3 ijt(iterket.i(), iterket.j(), iterket.ij());
-              ket_ij.push_back(ijt);
-
-              double* blk_ptr = ket_tile + i*blksize_int;
-              // where to read the integrals? if not antisymmetrizing read directly to T_ket, else read to scratch
-              // buffer, then antisymmetrize to T_ket
-              double* blk_ptr_read = blk_ptr;
-              Timer tim_intsretrieve("MO ints retrieve");
-              const double* blk_cptr = ket->retrieve_pair_block(ijt.i0_,
-                                                                   ijt.i1_,
-                                                                   intsetidx_ket,
-                                                                   blk_ptr_read);
-              tim_intsretrieve.exit();
-
-              if (debug >= DefaultPrintThresholds::allO2N2) {
-                ExEnv::outn() << indent << "task " << me
-                    << ": obtained kl blocks" << std::endl;
-                ExEnv::outn() << indent
-                              << "k = " << ijt.i0_
-                              << " l = " << ijt.i1_ << std::endl;
-
-                RefSCMatrix blk_scmat = SCMatrixKit::default_matrixkit()->matrix(new SCDimension(n1),
-                                                                                 new SCDimension(n2));
-                blk_scmat.assign(blk_cptr);
-                blk_scmat.print("kl block");
-              }
-
+          // load the ket tile
+          Timer tim_intsretrieve("MO ints retrieve");
+          const double* ket_tile = blocks.next();
+          tim_intsretrieve.exit();
+          if (debug >= DefaultPrintThresholds::allO2N2) {
+            for (size_t i=0; i<ket_ij.size(); ++i) {
+              const uint3& ijt = ket_ij[i];
+              ExEnv::outn() << indent << "task " << me
+                  << ": obtained kl blocks" << std::endl;
+              ExEnv::outn() << indent
+                            << "k = " << ijt.i0_
+                            << " l = " << ijt.i1_ << std::endl;
+
+              RefSCMatrix blk_scmat = SCMatrixKit::default_matrixkit()->matrix(new SCDimension(n1),
+                                                                               new SCDimension(n2));
+              blk_scmat.assign(ket_tile + i*blksize_int);
+              blk_scmat.print("kl block");
             }
           }
 
@@ -743,6 +744,7 @@ namespace sc {
                   scale, bra_tile, blksize_int,
                   ket_tile, blksize_int,
                   0.0, T_result, tile_size_ket);
+          blocks.release(ket_tile);
           if (debug >= DefaultPrintThresholds::allO2N2) {
             ExEnv::outn() << indent << "task " << me
                 << ": nbra_ij = " << nbra_ij << " nket_ij = " << nket_ij << std::endl;
@@ -774,34 +776,12 @@ namespace sc {
             }
           }
 
-          if (ket_tile != 0) {
-            for(size_t kl=0; kl<nket_ij; ++kl) {
-              ket->release_pair_block(ket_ij[kl].i0_,
-                                         ket_ij[kl].i1_,
-                                         intsetidx_ket);
-            }
-            ket_tile = 0;
-            ket_ij.resize(0);
-          }
-
         } // ket tile loop
-
-        if (bra_tile != 0) {
-          const size_t nbra_ij = bra_ij.size();
-          for(size_t ij=0; ij<nbra_ij; ++ij) {
-            bra->release_pair_block(bra_ij[ij].i0_,
-                                       bra_ij[ij].i1_,
-                                       intsetidx_bra);
-          }
-          bra_tile = 0;
-          bra_ij.resize(0);
-        }
+        if (bra_tile != 0) blocks.release(bra_tile);
 
       } // bra tile loop
     } // loop over tasks with access
 
-    deallocate(T_bra);
-    deallocate(T_ket);
     deallocate(T_result);
 
     if (bra->data_persistent()) bra->deactivate();
@@ -1050,7 +1030,21 @@ namespace sc {
       const unsigned int ny = src->ny();
       const unsigned int nX = dest->nx();
       const unsigned int nY = dest->ny();
+      // blocks of this task are read ahead while the current block is contracted
+      DistArray4PairBlockStream src_blocks;
       size_t task_id = 0;
+      for(int i=0; i<ni; ++i) {
+        for(int j=0; j<nj; ++j) {
+          for(int t=0; t<dest->num_te_types(); ++t, ++task_id) {
+            // round-robin task allocation
+            if(task_id%nworkers == worker_id[me])
+              src_blocks.add(src, i, j, t);
+          }
+        }
+      }
+      src_blocks.start();
+
+      task_id = 0;
       for(int i=0; i<ni; ++i) {
         for(int j=0; j<nj; ++j) {
           for(int t=0; t<dest->num_te_types(); ++t, ++task_id) {
@@ -1059,7 +1053,7 @@ namespace sc {
             if(task_id%nworkers != worker_id[me])
               continue;
 
-            const double* src_buf = src->retrieve_pair_block(i, j, t);
+            const double* src_buf = src_blocks.next();
 
             if (ContrIndex == Index4)
               // src_buf * tform_buf = dest_buf
@@ -1068,8 +1062,9 @@ namespace sc {
               // tform_buf^t * src_buf  = dest_buf
               C_DGEMM('t','n', nX, nY, nx, 1.0, tform_buf, nX, src_buf, ny, 0.0, dest_buf, nY);
 
+            src_blocks.release(src_buf);
+
             dest->store_pair_block(i, j, t, dest_buf);
-            src->release_pair_block(i, j, t);
           }
         }
       }
@@ -131,6 +131,10 @@ class DistArray4: virtual public SavableState {
     virtual void deactivate() { active_ = false; }
     /// if this returns false, call to deactivate may destroy data
     virtual bool data_persistent() const =0;
+    /** if this returns true, retrieve_pair_block() and release_pair_block() may be called from
+        a background thread while the calling thread works with other DistArray4 objects.
+        This is used by DistArray4PairBlockStream to overlap reading with computation. */
+    virtual bool async_retrieve() const { return true; }
     /** Retrieves an ij block of integrals. Note that it comes stored according to storage().
         No locking is performed.
 
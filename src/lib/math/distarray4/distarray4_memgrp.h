@@ -77,6 +77,8 @@ class DistArray4_MemoryGrp: public DistArray4 {
     void deactivate();
     // Implementation of DistArray4::data_persistent()
     bool data_persistent() const { return false; }
+    // data is already in memory, nothing to gain from reading it in the background
+    bool async_retrieve() const { return false; }
 
     void store_pair_block(int i, int j, tbint_type oper_type, const double *ints);
     void store_pair_subblock(int i, int j, tbint_type oper_type,
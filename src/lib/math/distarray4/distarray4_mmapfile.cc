@@ -0,0 +1,362 @@
+//
+// distarray4_mmapfile.cc
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include <sstream>
+#include <util/misc/scexception.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <util/misc/string.h>
+#include <util/misc/formio.h>
+#include <util/misc/exenv.h>
+#include <math/distarray4/distarray4_mmapfile.h>
+
+using namespace std;
+using namespace sc;
+
+///////////////////////////////////////////////////////////////
+
+static ClassDesc DistArray4_MMapFile_cd(
+  typeid(DistArray4_MMapFile),"DistArray4_MMapFile",1,"public DistArray4",
+  0, 0, create<DistArray4_MMapFile>);
+
+DistArray4_MMapFile::DistArray4_MMapFile(const char* filename, int num_te_types,
+                                         int ni, int nj, int nx, int ny,
+                                         DistArray4Storage storage) :
+  DistArray4(num_te_types, ni, nj, nx, ny, storage)
+{
+  filename_ = strdup(filename);
+  init(false);
+}
+
+DistArray4_MMapFile::DistArray4_MMapFile(StateIn& si) :
+  DistArray4(si)
+{
+  si.getstring(filename_);
+  clonelist_ = ListOfClones::restore_instance(si);
+  init(true);
+}
+
+DistArray4_MMapFile::~DistArray4_MMapFile() {
+  deactivate();
+  delete[] pairblk_;
+
+  // Destroy the file
+  if (me() == 0)
+    unlink(filename_);
+  free(filename_);
+}
+
+void
+DistArray4_MMapFile::save_data_state(StateOut& so)
+{
+  DistArray4::save_data_state(so);
+  so.putstring(filename_);
+  ListOfClones::save_instance(clonelist_, so);
+}
+
+namespace {
+  void clone_filename(std::string& result, const char* original, int id) {
+    std::ostringstream oss;
+    oss << original << ".clone" << id;
+    result = oss.str();
+  }
+}
+
+Ref<DistArray4>
+DistArray4_MMapFile::clone(const DistArray4Dimensions& dim) {
+  int id = 0;
+  std::string clonename;
+  clone_filename(clonename, this->filename_, id);
+  if (clonelist_) {
+    while (clonelist_->key_exists(clonename)) {
+      ++id;
+      clone_filename(clonename, this->filename_, id);
+    }
+  }
+  else {
+    clonelist_ = ListOfClones::instance();
+  }
+  clonelist_->add(clonename, id);
+
+  Ref<DistArray4_MMapFile> result;
+  if (dim == DistArray4Dimensions::default_dim())
+    result = new DistArray4_MMapFile(clonename.c_str(), num_te_types(),
+                                     ni(), nj(), nx(), ny(), storage());
+  else
+    result = new DistArray4_MMapFile(clonename.c_str(), dim.num_te_types(),
+                                     dim.n1(), dim.n2(), dim.n3(), dim.n4(),
+                                     dim.storage());
+
+  result->set_clonelist(clonelist_);
+  return result;
+}
+
+void
+DistArray4_MMapFile::init(bool restart)
+{
+  map_ = 0;
+  datafile_ = -1;
+  last_ij_ = -1;
+  lock_ = ThreadGrp::get_default_threadgrp()->new_lock();
+  mapsize_ = (size_t)ni()*nj()*blocksize();
+
+  pairblk_ = new PairBlkInfo[ni()*nj()];
+  int i, j, ij;
+  for(i=0,ij=0;i<ni();i++)
+    for(j=0;j<nj();j++,ij++) {
+      for(int type=0; type<num_te_types(); type++)
+        pairblk_[ij].refcount_[type] = 0;
+      pairblk_[ij].offset_ = (off_t)ij*blocksize();
+    }
+
+  // node 0 will have the file
+  if (me() != 0)
+    return;
+
+  // See if can open/create the file
+  if (restart) {
+    datafile_ = open(filename_,O_RDWR,0644);
+  }
+  else {
+    datafile_ = open(filename_,O_RDWR|O_CREAT|O_TRUNC,0644);
+  }
+  // Check if the file was opened correctly
+  check_filedescr_();
+  // the file must be as large as the mapping; this does not allocate disk space
+  if (!restart && ftruncate(datafile_, (off_t)mapsize_) != 0) {
+    std::ostringstream oss;
+    oss << "DistArray4_MMapFile::init() -- ftruncate failed: " << strerror(errno);
+    close(datafile_);
+    throw FileOperationFailed(oss.str().c_str(),
+                              __FILE__, __LINE__,
+                              filename_, FileOperationFailed::Write);
+  }
+  // If everything is fine close it and proceed
+  close(datafile_);
+  datafile_ = -1;
+}
+
+void
+DistArray4_MMapFile::check_filedescr_()
+{
+  // If the file was not opened correctly - throw an exception
+  if (datafile_ == -1) {
+    std::ostringstream oss;
+    oss << "DistArray4_MMapFile -- failed to open POSIX file on node 0: " << strerror(errno);
+    throw FileOperationFailed(oss.str().c_str(),
+                              __FILE__, __LINE__,
+                              filename_, FileOperationFailed::OpenRW);
+  }
+}
+
+void
+DistArray4_MMapFile::set_clonelist(const Ref<ListOfClones>& cl) {
+  clonelist_ = cl;
+}
+
+void
+DistArray4_MMapFile::activate()
+{
+  if (active()) return;
+
+  if (me() == 0) {
+    datafile_ = open(filename_, O_RDWR);
+    check_filedescr_();
+    if (mapsize_ > 0) {
+      void* addr = mmap(0, mapsize_, PROT_READ | PROT_WRITE, MAP_SHARED, datafile_, 0);
+      if (addr == MAP_FAILED) {
+        std::ostringstream oss;
+        oss << "DistArray4_MMapFile::activate() -- mmap failed: " << strerror(errno);
+        close(datafile_);
+        datafile_ = -1;
+        throw FileOperationFailed(oss.str().c_str(),
+                                  __FILE__, __LINE__,
+                                  filename_, FileOperationFailed::Other);
+      }
+      map_ = static_cast<char*>(addr);
+    }
+    last_ij_ = -1;
+  }
+  DistArray4::activate();
+  if (classdebug() > 0)
+    ExEnv::out0() << indent << "mapped file=" << filename_ << " size=" << mapsize_ << endl;
+}
+
+void
+DistArray4_MMapFile::deactivate()
+{
+  if (!active()) return;
+
+  if (me() == 0) {
+    if (map_ != 0)
+      munmap(map_, mapsize_);
+    map_ = 0;
+    close(datafile_);
+    datafile_ = -1;
+  }
+  DistArray4::deactivate();
+  if (classdebug() > 0)
+    ExEnv::out0() << indent << "unmapped file=" << filename_ << endl;
+}
+
+void
+DistArray4_MMapFile::prefetch(int ij) const
+{
+  if (ij < 0 || ij >= ni()*nj()) return;
+
+  // madvise requires a page-aligned address
+  static const size_t pagesize = sysconf(_SC_PAGESIZE);
+  const size_t start = pairblk_[ij].offset_;
+  const size_t astart = start - start % pagesize;
+  madvise(map_ + astart, start + blocksize() - astart, MADV_WILLNEED);
+}
+
+void
+DistArray4_MMapFile::store_pair_block(int i, int j, tbint_type oper_type, const double *data)
+{
+  MPQC_ASSERT(this->active());  //make sure we are active
+  // Can write blocks?
+  if (!is_avail(i,j))
+    throw ProgrammingError("DistArray4_MMapFile::store_pair_block -- can only be called on node 0",
+                           __FILE__,__LINE__);
+
+  const int ij = ij_index(i,j);
+  if (classdebug() > 0)
+    ExEnv::out0() << indent << "storing block: file=" << filename_ << " i,j=" << i << "," << j << " oper_type=" << oper_type << endl;
+  std::copy(data, data + nxy(), block_ptr(ij, oper_type));
+}
+
+void
+DistArray4_MMapFile::store_pair_subblock(int i, int j, tbint_type oper_type,
+                                         int xstart, int xfence, int ystart, int yfence,
+                                         const double *buf)
+{
+  MPQC_ASSERT(this->active());  //make sure we are active
+  // Can write blocks?
+  if (!is_avail(i,j))
+    throw ProgrammingError("DistArray4_MMapFile::store_pair_subblock -- can only be called on node 0",
+                           __FILE__,__LINE__);
+
+  const int ysize = yfence - ystart;
+  double* outbuf = block_ptr(ij_index(i,j), oper_type) + (xstart * ny() + ystart);
+  for(int x=xstart; x<xfence; ++x, outbuf+=ny(), buf+=ysize) {
+    std::copy(buf, buf + ysize, outbuf);
+  }
+}
+
+const double * DistArray4_MMapFile::retrieve_pair_block(int i, int j,
+                                                        tbint_type oper_type,
+                                                        double* buf) const {
+  if (not this->active()) { //make sure we are active
+    std::ostringstream oss;
+    oss << "DistArray4_MMapFile::retrieve_pair_block -- file " << this->filename_ << " is not mapped" << std::endl;
+    ExEnv::outn() << oss.str();
+    throw ProgrammingError(oss.str().c_str(), __FILE__, __LINE__);
+  }
+  // Can read blocks?
+  if (!is_avail(i, j))
+    throw ProgrammingError("DistArray4_MMapFile::retrieve_pair_block -- can only be called on node 0",
+        __FILE__,__LINE__);
+
+  const int ij = ij_index(i, j);
+  const PairBlkInfo* pb = &pairblk_[ij];
+
+  // the next block is most likely the one as far from this one as this is from the previous,
+  // e.g. ij+1 when looping over j, or ij+nj when looping over i
+  int prefetch_ij = -1;
+  lock_->lock();
+  if (ij != last_ij_) {
+    const int stride = (last_ij_ >= 0 && ij > last_ij_) ? ij - last_ij_ : 1;
+    prefetch_ij = ij + stride;
+    last_ij_ = ij;
+  }
+  const int refcount = (pb->refcount_[oper_type] += 1);
+  lock_->unlock();
+  if (prefetch_ij >= 0)
+    prefetch(prefetch_ij);
+
+  const double* ints = block_ptr(ij, oper_type);
+  if (buf != 0)
+    std::copy(ints, ints + nxy(), buf);
+
+  if (classdebug() > 0)
+    ExEnv::outn() << indent << me() << ":refcount="
+        << refcount << ": i = " << i << " j = " << j
+        << " tbint_type = " << oper_type << endl;
+  if (buf)
+    return buf;
+  else
+    return ints;
+}
+
+void
+DistArray4_MMapFile::retrieve_pair_subblock(int i, int j, tbint_type oper_type,
+                                            int xstart, int xfence, int ystart, int yfence,
+                                            double* buf) const
+{
+  MPQC_ASSERT(this->active());  //make sure we are active
+  // Can read blocks?
+  if (!is_avail(i, j))
+    throw ProgrammingError("DistArray4_MMapFile::retrieve_pair_subblock() -- can only be called on node 0",
+        __FILE__,__LINE__);
+
+  const int ysize = yfence - ystart;
+  const double* srcbuf = block_ptr(ij_index(i,j), oper_type) + (xstart * ny() + ystart);
+  for(int x=xstart; x<xfence; ++x, srcbuf+=ny(), buf+=ysize) {
+    std::copy(srcbuf, srcbuf + ysize, buf);
+  }
+}
+
+void
+DistArray4_MMapFile::release_pair_block(int i, int j, tbint_type oper_type) const
+{
+  MPQC_ASSERT(this->active());  //make sure we are active
+  if (is_avail(i,j)) {
+    const int ij = ij_index(i,j);
+    const PairBlkInfo *pb = &pairblk_[ij];
+    lock_->lock();
+    const int refcount = pb->refcount_[oper_type];
+    // nothing to free: the pages stay in the page cache for subsequent retrievals
+    if (refcount > 0) pb->refcount_[oper_type] -= 1;
+    lock_->unlock();
+    if (refcount <= 0) {
+      ExEnv::outn() << indent << me() << ":refcount=0: i = " << i << " j = " << j << " tbint_type = " << oper_type << endl;
+      throw std::runtime_error("Logic error: DistArray4_MMapFile::release_pair_block: refcount is already zero!");
+    }
+    if (classdebug() > 0)
+      ExEnv::outn() << indent << me() << ":refcount=" << refcount - 1
+                    << ": i = " << i << " j = " << j << " tbint_type = " << oper_type << endl;
+  }
+}
+
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
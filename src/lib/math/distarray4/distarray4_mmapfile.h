@@ -0,0 +1,129 @@
+//
+// distarray4_mmapfile.h
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#ifndef _math_distarray4_distarray4_mmapfile_h
+#define _math_distarray4_distarray4_mmapfile_h
+
+#include <unistd.h>
+#include <util/ref/ref.h>
+#include <util/group/memory.h>
+#include <util/group/thread.h>
+#include <util/misc/registry.h>
+#include <math/distarray4/distarray4.h>
+
+namespace sc {
+
+/////////////////////////////////////////////////////////////////////
+/** DistArray4_MMapFile handles transformed integrals stored in a file
+    on node 0 that is memory-mapped while the array is active.
+
+    The layout of the file is identical to that of DistArray4_Node0File,
+    but blocks are accessed through the mapping instead of lseek/read/write.
+    Hence retrieve_pair_block() returns a pointer directly into the mapped
+    file (no copy is made unless the caller provides a buffer), and repeated
+    retrievals of the same block are served from the page cache.
+    When a block is retrieved the block that follows it in the
+    current (i,j) access pattern is prefetched with madvise().
+
+    Remote retrieval is not possible.
+*/
+
+class DistArray4_MMapFile: public DistArray4 {
+
+    char *filename_;
+    int datafile_;
+    char *map_;           // the mapped file, nonnull only when active on node 0
+    size_t mapsize_;      // the size of the file (in bytes)
+
+    // keep track of clones of this object to be able to create unique names
+    typedef Registry<std::string,int,detail::NonsingletonCreationPolicy> ListOfClones;
+    Ref<ListOfClones> clonelist_;
+    void set_clonelist(const Ref<ListOfClones>& cl);
+
+    struct PairBlkInfo {
+      // mutable since this data is only bookkeeping. offset is the only real data.
+      mutable int refcount_[max_num_te_types];      // number of references
+      off_t offset_;      // location in file (in bytes)
+    };
+    PairBlkInfo* pairblk_;
+    // the most recently retrieved pair block, used to guess the next one
+    mutable int last_ij_;
+    // protects last_ij_ and the reference counts, since blocks may be
+    // retrieved and released from several threads (see async_retrieve())
+    Ref<ThreadLock> lock_;
+
+    /// Initialization tasks common to all constructors
+    void init(bool restart);
+    // Check if the file operation went OK
+    void check_filedescr_();
+    // returns the address of the block in the mapped file
+    double* block_ptr(int ij, tbint_type oper_type) const {
+      return reinterpret_cast<double*>(map_ + pairblk_[ij].offset_ + (off_t)oper_type*blksize());
+    }
+    // advise the kernel that pair block ij (all operator types) will be needed soon
+    void prefetch(int ij) const;
+
+  public:
+    DistArray4_MMapFile(const char *filename, int num_te_types, int ni, int nj, int nx, int ny,
+                        DistArray4Storage storage = DistArray4Storage_XY);
+    DistArray4_MMapFile(StateIn&);
+    ~DistArray4_MMapFile();
+    void save_data_state(StateOut&);
+
+    Ref<DistArray4> clone(const DistArray4Dimensions& dim = DistArray4Dimensions::default_dim());
+
+    /// implementation of DistArray4::activate(). Maps the file.
+    void activate();
+    /// implementation of DistArray4::deactivate(). Unmaps the file.
+    void deactivate();
+    /// implementation of DistArray4::data_persistent()
+    bool data_persistent() const { return true; }
+
+    void store_pair_block(int i, int j, tbint_type oper_type, const double* ints);
+    void store_pair_subblock(int i, int j, tbint_type oper_type,
+                             int xstart, int xfence, int ystart, int yfence,
+                             const double* ints);
+    /// Returns a pointer into the mapped file, unless buf is given, in which case the block is copied to buf.
+    /// The pointer is valid until the array is deactivated.
+    const double* retrieve_pair_block(int i, int j, tbint_type oper_type, double* buf = 0) const;
+    void retrieve_pair_subblock(int i, int j, tbint_type oper_type,
+                                int xstart, int xfence, int ystart, int yfence,
+                                double* buf) const;
+    /// Releases an ij pair block of integrals
+    void release_pair_block(int i, int j, tbint_type oper_type) const;
+
+    /// Is this block stored locally?
+    bool is_local(int i, int j) const { return (me() == 0);};
+    /// In this implementation blocks are available only on node 0
+    bool is_avail(int i, int j) const { return (me() == 0);};
+    /// Does this task have access to all the integrals?
+    bool has_access(int proc) const { return (proc == 0);};
+};
+
+}
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
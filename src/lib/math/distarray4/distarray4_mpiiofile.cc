@@ -173,6 +173,14 @@ DistArray4_MPIIOFile::deactivate()
   }
 }
 
+bool
+DistArray4_MPIIOFile::async_retrieve() const
+{
+  int provided;
+  MPI_Query_thread(&provided);
+  return provided == MPI_THREAD_MULTIPLE;
+}
+
 void
 DistArray4_MPIIOFile::release_pair_block(int i, int j, tbint_type oper_type) const
 {
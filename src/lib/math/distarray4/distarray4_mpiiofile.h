@@ -99,6 +99,8 @@ class DistArray4_MPIIOFile: public DistArray4 {
     void deactivate();
     /// implementation of DistArray4::data_persistent()
     bool data_persistent() const { return true; }
+    /// implementation of DistArray4::async_retrieve(): only possible if MPI allows calls from any thread
+    bool async_retrieve() const;
     /// Releases an ij pair block of integrals
     void release_pair_block(int i, int j, tbint_type oper_type) const;
 
@@ -0,0 +1,306 @@
+//
+// distarray4_stream.cc
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include <util/misc/consumableresources.h>
+#include <util/misc/scexception.h>
+#include <math/distarray4/distarray4_stream.h>
+
+using namespace sc;
+
+namespace sc {
+
+  /// reads the tiles of a DistArray4PairBlockStream into its buffers
+  class DistArray4PairBlockStreamThread: public Thread {
+    public:
+      DistArray4PairBlockStreamThread(DistArray4PairBlockStream* s) : s_(s) {}
+      void run();
+    private:
+      DistArray4PairBlockStream* s_;
+  };
+
+  void
+  DistArray4PairBlockStreamThread::run()
+  {
+#ifdef HAVE_PTHREAD
+    const size_t ntile = s_->size();
+    for (size_t t = 0; t < ntile; ++t) {
+
+      // wait for a free slot
+      pthread_mutex_lock(&s_->mutex_);
+      while (!s_->abort_ && s_->free_slots_.empty())
+        pthread_cond_wait(&s_->cond_, &s_->mutex_);
+      if (s_->abort_) {
+        pthread_mutex_unlock(&s_->mutex_);
+        return;
+      }
+      const int slot = s_->free_slots_.back();
+      s_->free_slots_.pop_back();
+      pthread_mutex_unlock(&s_->mutex_);
+
+      std::string error;
+      try {
+        s_->read_tile(t, s_->slots_[slot]);
+      }
+      catch (std::exception& e) {
+        error = e.what();
+      }
+
+      pthread_mutex_lock(&s_->mutex_);
+      if (error.empty()) {
+        s_->tile_slot_[t] = slot;
+        s_->nread_ = t + 1;
+      }
+      else
+        s_->error_ = error;
+      pthread_cond_broadcast(&s_->cond_);
+      pthread_mutex_unlock(&s_->mutex_);
+      if (!error.empty()) return;
+    }
+#endif
+  }
+
+}
+
+int DistArray4PairBlockStream::default_depth_ = 2;
+
+DistArray4PairBlockStream::DistArray4PairBlockStream(int depth) :
+  depth_(depth), started_(false), ncurrent_(0), slotsize_(0), thread_(0),
+  nread_(0), abort_(false)
+{
+  if (depth_ < 0) depth_ = 0;
+  tiles_.push_back(0);
+#ifdef HAVE_PTHREAD
+  pthread_mutex_init(&mutex_, 0);
+  pthread_cond_init(&cond_, 0);
+#endif
+}
+
+DistArray4PairBlockStream::~DistArray4PairBlockStream()
+{
+  finish();
+#ifdef HAVE_PTHREAD
+  pthread_cond_destroy(&cond_);
+  pthread_mutex_destroy(&mutex_);
+#endif
+}
+
+void
+DistArray4PairBlockStream::add(const Ref<DistArray4>& array, int i, int j,
+                               DistArray4::tbint_type oper_type, bool new_tile)
+{
+  if (started_)
+    throw ProgrammingError("DistArray4PairBlockStream::add -- stream already started",
+                           __FILE__, __LINE__);
+  if (std::find(arrays_.begin(), arrays_.end(), array) == arrays_.end())
+    arrays_.push_back(array);
+  Block blk;
+  blk.array = array.pointer();
+  blk.i = i;
+  blk.j = j;
+  blk.oper_type = oper_type;
+  blocks_.push_back(blk);
+  if (new_tile || tiles_.size() == 1)
+    tiles_.push_back(blocks_.size());
+  else
+    tiles_.back() = blocks_.size();
+}
+
+size_t
+DistArray4PairBlockStream::tile_size(size_t t) const
+{
+  size_t result = 0;
+  for (size_t b = tiles_[t]; b < tiles_[t+1]; ++b)
+    result += (size_t)blocks_[b].array->nx() * blocks_[b].array->ny();
+  return result;
+}
+
+void
+DistArray4PairBlockStream::read_tile(size_t t, double* buf) const
+{
+  for (size_t b = tiles_[t]; b < tiles_[t+1]; ++b) {
+    const Block& blk = blocks_[b];
+    blk.array->retrieve_pair_block(blk.i, blk.j, blk.oper_type, buf);
+    blk.array->release_pair_block(blk.i, blk.j, blk.oper_type);
+    buf += (size_t)blk.array->nx() * blk.array->ny();
+  }
+}
+
+void
+DistArray4PairBlockStream::start()
+{
+  if (started_)
+    throw ProgrammingError("DistArray4PairBlockStream::start -- stream already started",
+                           __FILE__, __LINE__);
+  started_ = true;
+  ncurrent_ = 0;
+
+  slotsize_ = 0;
+  for (size_t t = 0; t < size(); ++t)
+    slotsize_ = std::max(slotsize_, tile_size(t));
+
+#ifdef HAVE_PTHREAD
+  bool async = (depth_ > 0 && size() > 1);
+  for (size_t a = 0; async && a < arrays_.size(); ++a)
+    async = arrays_[a]->async_retrieve();
+  if (!async) return;
+
+  // need one thread in addition to the calling thread
+  thr_ = ThreadGrp::get_default_threadgrp()->clone(2);
+  if (thr_->nthread() < 2) {
+    thr_ = 0;
+    return;
+  }
+
+  const size_t nslot = std::min((size_t)depth_ + max_held, size());
+  slots_.resize(nslot);
+  free_slots_.resize(nslot);
+  for (size_t s = 0; s < nslot; ++s) {
+    slots_[s] = allocate<double>(slotsize_);
+    // the thread takes slots from the back
+    free_slots_[s] = nslot - 1 - s;
+  }
+  tile_slot_.assign(size(), -1);
+
+  nread_ = 0;
+  abort_ = false;
+  thread_ = new DistArray4PairBlockStreamThread(this);
+  thr_->add_thread(1, thread_);
+  thr_->start_threads();
+#endif
+}
+
+int
+DistArray4PairBlockStream::free_slot_sync()
+{
+  if (free_slots_.empty()) {
+    slots_.push_back(allocate<double>(slotsize_));
+    return slots_.size() - 1;
+  }
+  const int slot = free_slots_.back();
+  free_slots_.pop_back();
+  return slot;
+}
+
+const double*
+DistArray4PairBlockStream::next()
+{
+  if (!started_)
+    throw ProgrammingError("DistArray4PairBlockStream::next -- stream not started",
+                           __FILE__, __LINE__);
+  if (ncurrent_ == size())
+    return 0;
+  if (held_.size() == max_held)
+    throw ProgrammingError("DistArray4PairBlockStream::next -- too many tiles held",
+                           __FILE__, __LINE__);
+
+  Held h;
+  h.tile = ncurrent_++;
+
+  // synchronous mode: the tile is read now
+  if (thr_.null()) {
+    if (tiles_[h.tile+1] - tiles_[h.tile] == 1) {
+      const Block& blk = blocks_[tiles_[h.tile]];
+      h.ptr = blk.array->retrieve_pair_block(blk.i, blk.j, blk.oper_type);
+      h.slot = -1;
+    }
+    else {
+      h.slot = free_slot_sync();
+      read_tile(h.tile, slots_[h.slot]);
+      h.ptr = slots_[h.slot];
+    }
+    held_.push_back(h);
+    return h.ptr;
+  }
+
+#ifdef HAVE_PTHREAD
+  // asynchronous mode: wait for the thread to read the tile
+  pthread_mutex_lock(&mutex_);
+  while (nread_ <= h.tile && error_.empty())
+    pthread_cond_wait(&cond_, &mutex_);
+  const std::string error = error_;
+  h.slot = tile_slot_[h.tile];
+  pthread_mutex_unlock(&mutex_);
+  if (!error.empty()) {
+    finish();
+    throw AlgorithmException(error.c_str(), __FILE__, __LINE__);
+  }
+  h.ptr = slots_[h.slot];
+  held_.push_back(h);
+#endif
+  return h.ptr;
+}
+
+void
+DistArray4PairBlockStream::release(const double* tile)
+{
+  std::vector<Held>::iterator h = held_.begin();
+  while (h != held_.end() && h->ptr != tile) ++h;
+  if (h == held_.end())
+    throw ProgrammingError("DistArray4PairBlockStream::release -- tile not held",
+                           __FILE__, __LINE__);
+
+  if (h->slot < 0) {
+    const Block& blk = blocks_[tiles_[h->tile]];
+    blk.array->release_pair_block(blk.i, blk.j, blk.oper_type);
+  }
+  else if (thr_.null())
+    free_slots_.push_back(h->slot);
+  else {
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&mutex_);
+    free_slots_.push_back(h->slot);
+    pthread_cond_broadcast(&cond_);
+    pthread_mutex_unlock(&mutex_);
+#endif
+  }
+  held_.erase(h);
+}
+
+void
+DistArray4PairBlockStream::finish()
+{
+  while (!held_.empty())
+    release(held_.back().ptr);
+  if (thr_) {
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&mutex_);
+    abort_ = true;
+    pthread_cond_broadcast(&cond_);
+    pthread_mutex_unlock(&mutex_);
+#endif
+    thr_->wait_threads();
+    thr_->delete_threads();
+    thread_ = 0;
+    thr_ = 0;
+  }
+  for (size_t s = 0; s < slots_.size(); ++s)
+    deallocate(slots_[s]);
+  slots_.clear();
+  free_slots_.clear();
+}
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
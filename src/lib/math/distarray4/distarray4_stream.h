@@ -0,0 +1,152 @@
+//
+// distarray4_stream.h
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+#ifndef _math_distarray4_distarray4_stream_h
+#define _math_distarray4_distarray4_stream_h
+
+#ifdef HAVE_CONFIG_H
+#include <mpqc_config.h>
+#endif
+#include <string>
+#include <vector>
+#ifdef HAVE_PTHREAD
+#  include <pthread.h>
+#endif
+#include <util/group/thread.h>
+#include <math/distarray4/distarray4.h>
+
+namespace sc {
+
+  class DistArray4PairBlockStreamThread;
+
+  /** DistArray4PairBlockStream delivers a sequence of tiles of pair blocks from one
+      or more DistArray4 objects, reading up to depth() tiles ahead on a background
+      thread.  This allows reading of the next tiles to overlap with the computation
+      on the current ones.
+
+      Usage: add() the blocks in the order they will be used, call start(), then
+      call next() once for each tile.  The blocks of a tile are stored one after
+      another in the buffer returned by next(), so a tile can be used directly as a
+      matrix whose rows are the blocks.  The buffer stays valid until it is given
+      back with release(); up to two tiles may be held at a time, e.g. a bra and a
+      ket tile.  While the stream is active the arrays in it must not be accessed
+      otherwise, except through store_pair_block() and store_pair_subblock() of
+      arrays that are not in the stream.
+
+      If depth() is zero, the default ThreadGrp cannot provide an extra thread, or any of
+      the arrays does not support reading from a background thread
+      (see DistArray4::async_retrieve()), tiles are read synchronously in next().
+      Single-block tiles are then returned without copying when the array allows it.
+    */
+  class DistArray4PairBlockStream {
+    public:
+      /// the maximum number of tiles held by the caller at a time
+      static const int max_held = 2;
+
+      /// depth is the maximum number of tiles read ahead of the ones held
+      DistArray4PairBlockStream(int depth = default_depth());
+      ~DistArray4PairBlockStream();
+
+      /** appends block (i,j) of operator type oper_type of array to the stream.
+          If new_tile is true the block starts a new tile, otherwise it is
+          appended to the last tile. */
+      void add(const Ref<DistArray4>& array, int i, int j,
+               DistArray4::tbint_type oper_type, bool new_tile = true);
+      /// the number of tiles in the stream
+      size_t size() const { return tiles_.size() - 1; }
+      /// the number of tiles read ahead
+      int depth() const { return depth_; }
+
+      /// starts reading blocks. No more blocks can be added after this.
+      void start();
+      /// returns the next tile, in the order in which the tiles were added, or 0 if all have been delivered
+      const double* next();
+      /// gives back a tile returned by next()
+      void release(const double* tile);
+
+      /// default depth used by the constructor, initially 2
+      static int default_depth() { return default_depth_; }
+      static void set_default_depth(int d) { default_depth_ = d; }
+      /** the number of bytes of buffers used by a stream of the given depth
+          whose largest tile has tilesize doubles; use this to budget memory
+          for the stream */
+      static size_t memory(int depth, size_t tilesize) {
+        return (depth + max_held) * tilesize * sizeof(double);
+      }
+
+    private:
+      friend class DistArray4PairBlockStreamThread;
+
+      struct Block {
+        const DistArray4* array;
+        int i, j;
+        DistArray4::tbint_type oper_type;
+      };
+      std::vector<Block> blocks_;
+      // the blocks of tile t are blocks_[tiles_[t]] .. blocks_[tiles_[t+1]-1]
+      std::vector<size_t> tiles_;
+      std::vector< Ref<DistArray4> > arrays_;   // holds references to the arrays in blocks_
+      int depth_;
+      static int default_depth_;
+
+      bool started_;
+      size_t ncurrent_;           // number of calls to next() so far
+
+      size_t slotsize_;           // in doubles
+      std::vector<double*> slots_;  // tile buffers
+      // the tiles returned by next() and not yet released
+      struct Held {
+        const double* ptr;
+        size_t tile;
+        int slot;                 // -1 if ptr belongs to the array
+      };
+      std::vector<Held> held_;
+
+      // asynchronous mode
+      Ref<ThreadGrp> thr_;
+      DistArray4PairBlockStreamThread* thread_;
+#ifdef HAVE_PTHREAD
+      pthread_mutex_t mutex_;
+      pthread_cond_t cond_;       // signaled when a tile is read or a slot is freed
+#endif
+      // protected by mutex_
+      std::vector<int> free_slots_;
+      std::vector<int> tile_slot_; // the slot holding each tile that has been read
+      size_t nread_;              // number of tiles read by the thread
+      bool abort_;                // set to stop the thread early
+      std::string error_;         // set by the thread if reading failed
+
+      size_t tile_size(size_t t) const;
+      void read_tile(size_t t, double* buf) const;
+      int free_slot_sync();
+      /// waits for the thread and frees the buffers
+      void finish();
+  };
+
+}
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
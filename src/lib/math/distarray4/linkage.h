@@ -28,16 +28,25 @@
 #ifndef _math_distarray4_linkage_h
 #define _math_distarray4_linkage_h
 
+#ifdef HAVE_CONFIG_H
+#include <mpqc_config.h>
+#endif
 #include <math/distarray4/distarray4.h>
 #include <math/distarray4/distarray4_node0file.h>
 #include <math/distarray4/distarray4_memgrp.h>
 #include <math/distarray4/distarray4_mpiio.h>
+#ifdef HAVE_SYS_MMAN_H
+#  include <math/distarray4/distarray4_mmapfile.h>
+#endif
 
 namespace sc {
 
 ForceLink<DistArray4_MemoryGrp> math_distarray4_force_link_a_;
 ForceLink<DistArray4_Node0File> math_distarray4_force_link_b_;
 ForceLink<DistArray4_MPIIO>     math_distarray4_force_link_c_;
+#ifdef HAVE_SYS_MMAN_H
+ForceLink<DistArray4_MMapFile>  math_distarray4_force_link_d_;
+#endif
 
 }
 
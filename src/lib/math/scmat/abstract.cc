@@ -28,6 +28,8 @@
 #include <math.h>
 
 #include <util/misc/formio.h>
+#include <util/misc/scexception.h>
+#include <util/keyval/keyval.h>
 #include <util/state/stateio.h>
 #include <math/scmat/matrix.h>
 #include <math/scmat/blkiter.h>
@@ -47,15 +49,33 @@ static ClassDesc SCMatrixKit_cd(
   typeid(SCMatrixKit),"SCMatrixKit",1,"public DescribedClass",
   0, 0, 0);
 
-SCMatrixKit::SCMatrixKit()
+SCMatrixKit::SCMatrixKit():
+  diag_method_(TQLI)
 {
   grp_ = MessageGrp::get_default_messagegrp();
 }
 
-SCMatrixKit::SCMatrixKit(const Ref<KeyVal>& keyval)
+SCMatrixKit::SCMatrixKit(const Ref<KeyVal>& keyval):
+  diag_method_(TQLI)
 {
   grp_ << keyval->describedclassvalue("messagegrp");
   if (grp_.null()) grp_ = MessageGrp::get_default_messagegrp();
+
+  std::string diag_method = keyval->stringvalue("diag_method",
+                                                KeyValValuestring("tqli"));
+  if (diag_method == "tqli")
+    diag_method_ = TQLI;
+  else if (diag_method == "dsyevd")
+    diag_method_ = DSYEVD;
+  else if (diag_method == "dsyevr")
+    diag_method_ = DSYEVR;
+  else
+    throw InputError("invalid value",
+                     __FILE__,
+                     __LINE__,
+                     "diag_method",
+                     diag_method.c_str(),
+                     class_desc());
 }
 
 SCMatrixKit::~SCMatrixKit()
@@ -669,6 +689,34 @@ SymmSCMatrix::copy()
   return result;
 }
 
+void
+SymmSCMatrix::diagonalize_lowest(DiagSCMatrix*a, SCMatrix*b)
+{
+  const int nvec = a->n();
+  if (!b->rowdim()->equiv(dim()) || !b->coldim()->equiv(a->dim())
+      || nvec > n()) {
+    throw ProgrammingError("SymmSCMatrix::diagonalize_lowest: bad dims",
+                           __FILE__, __LINE__, class_desc());
+  }
+  if (nvec == 0) return;
+
+  RefDiagSCMatrix vals = kit()->diagmatrix(dim());
+  RefSCMatrix vecs = kit()->matrix(dim(),dim());
+  diagonalize(vals.pointer(), vecs.pointer());
+
+  for (int i=0; i<nvec; i++)
+    a->set_element(i, vals->get_element(i));
+  b->assign_subblock(vecs.pointer(), 0, n()-1, 0, nvec-1);
+}
+
+void
+SymmSCMatrix::diagonalize_using(SCMatrixKit::DiagMethod method,
+                                DiagSCMatrix*a, SCMatrix*b, bool lowest)
+{
+  if (lowest) diagonalize_lowest(a,b);
+  else diagonalize(a,b);
+}
+
 void
 SymmSCMatrix::accumulate_symmetric_product(SCMatrix *a)
 {
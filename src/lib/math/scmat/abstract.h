@@ -52,11 +52,34 @@ class RefSCDimension;
 matrices.  By using one of these, the program makes sure that all of the
 matrices are consistent.  */
 class SCMatrixKit: public DescribedClass {
+  public:
+    /// The algorithms that can be used by SymmSCMatrix::diagonalize().
+    enum DiagMethod {
+      TQLI,    ///< Householder reduction and implicit QL (cmat_diag)
+      DSYEVD,  ///< LAPACK divide and conquer
+      DSYEVR   ///< LAPACK relatively robust representations
+    };
+
   protected:
     Ref<MessageGrp> grp_;
+    DiagMethod diag_method_;
 
   public:
     SCMatrixKit();
+    /** The KeyVal constructor.
+        <dl>
+
+        <dt><tt>messagegrp</tt><dd> The MessageGrp used by the matrices.
+        The default is the default MessageGrp.
+
+        <dt><tt>diag_method</tt><dd> The algorithm used to diagonalize
+        symmetric matrices, one of <tt>tqli</tt>, <tt>dsyevd</tt>, or
+        <tt>dsyevr</tt>.  <tt>dsyevr</tt> is the fastest choice when only
+        the lowest eigenpairs are needed.  The default is
+        <tt>tqli</tt>, which gives the same eigenvectors as earlier
+        versions.
+
+        </dl> */
     SCMatrixKit(const Ref<KeyVal>&);
     ~SCMatrixKit();
 
@@ -69,6 +92,11 @@ class SCMatrixKit: public DescribedClass {
 
     Ref<MessageGrp> messagegrp() const;
 
+    /// Returns the algorithm used to diagonalize symmetric matrices.
+    DiagMethod diag_method() const { return diag_method_; }
+    /// Changes the algorithm used to diagonalize symmetric matrices.
+    void set_diag_method(DiagMethod m) { diag_method_ = m; }
+
     /// Given the dimensions, create matrices or vectors.
     virtual SCMatrix* matrix(const RefSCDimension&,const RefSCDimension&) = 0;
     virtual SymmSCMatrix* symmmatrix(const RefSCDimension&) = 0;
@@ -460,6 +488,19 @@ class SymmSCMatrix: public DescribedClass {
     /** Diagonalize this, placing the eigenvalues in d and the eigenvectors
         in m. */
     virtual void diagonalize(DiagSCMatrix*d,SCMatrix*m) = 0;
+    /** Compute the lowest eigenvalues of this and place them in d and
+        the corresponding eigenvectors in the columns of m.  The number of
+        eigenpairs computed is the dimension of d, which must also be the
+        column dimension of m.  The default implementation calls
+        diagonalize() and copies the lowest eigenpairs. */
+    virtual void diagonalize_lowest(DiagSCMatrix*d,SCMatrix*m);
+    /** Like diagonalize_lowest(), if lowest is true, or diagonalize(),
+        but with the algorithm given by method.  Implementations that do
+        not copy references to objects shared with other matrices, such
+        as the kit, may be called concurrently on different matrices.
+        The default implementation ignores method. */
+    virtual void diagonalize_using(SCMatrixKit::DiagMethod method,
+                                   DiagSCMatrix*d,SCMatrix*m,bool lowest);
     /** Solve generalized eigensystem for this with metric s, placing the eigenvalues in d and the eigenvectors
         in m.
         \exception AlgorithmException eigensystem could not be solved within available precision. Check condition number of s.
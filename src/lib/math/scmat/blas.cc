@@ -57,6 +57,83 @@ namespace sc {
     F77_DGEMM(&transb,&transa,&nf,&mf,&kf,&alpha,B,&ncbf,A,&ncaf,&beta,C,&nccf);
 
   }
+
+  namespace {
+    // a row-major matrix is its column-major transpose, hence the
+    // triangle and the transposition flags flip
+    char flip_uplo(char uplo) {
+      return (uplo == 'U' || uplo == 'u') ? 'L' : 'U';
+    }
+    char flip_side(char side) {
+      return (side == 'L' || side == 'l') ? 'R' : 'L';
+    }
+    char flip_trans(char trans) {
+      return (trans == 'N' || trans == 'n') ? 'T' : 'N';
+    }
+  }
+
+  void C_DSYMM(char side, char uplo, int m, int n, double alpha,
+               const double *A, int nca, const double *B, int ncb, double beta,
+               double *C, int ncc)
+  {
+    if (m == 0 || n == 0) return;
+
+    const char sidef = flip_side(side);
+    const char uplof = flip_uplo(uplo);
+    const blasint nf = n;
+    const blasint mf = m;
+    const blasint ncaf = nca;
+    const blasint ncbf = ncb;
+    const blasint nccf = ncc;
+
+    F77_DSYMM(&sidef,&uplof,&nf,&mf,&alpha,A,&ncaf,B,&ncbf,&beta,C,&nccf);
+  }
+
+  void C_DSYRK(char uplo, char trans, int n, int k, double alpha,
+               const double *A, int nca, double beta,
+               double *C, int ncc)
+  {
+    if (n == 0 || k == 0) return;
+
+    const char uplof = flip_uplo(uplo);
+    const char transf = flip_trans(trans);
+    const blasint nf = n;
+    const blasint kf = k;
+    const blasint ncaf = nca;
+    const blasint nccf = ncc;
+
+    F77_DSYRK(&uplof,&transf,&nf,&kf,&alpha,A,&ncaf,&beta,C,&nccf);
+  }
+
+  void C_DGEMV(char trans, int m, int n, double alpha,
+               const double *A, int nca, const double *X, int incx,
+               double beta, double *Y, int incy)
+  {
+    if (m == 0 || n == 0) return;
+
+    const char transf = flip_trans(trans);
+    const blasint nf = n;
+    const blasint mf = m;
+    const blasint ncaf = nca;
+    const blasint incxf = incx;
+    const blasint incyf = incy;
+
+    F77_DGEMV(&transf,&nf,&mf,&alpha,A,&ncaf,X,&incxf,&beta,Y,&incyf);
+  }
+
+  void C_DSPMV(int n, double alpha, const double *A, const double *X,
+               int incx, double beta, double *Y, int incy)
+  {
+    if (n == 0) return;
+
+    // lower triangle packed by rows == upper triangle packed by columns
+    const char uplof = 'U';
+    const blasint nf = n;
+    const blasint incxf = incx;
+    const blasint incyf = incy;
+
+    F77_DSPMV(&uplof,&nf,&alpha,A,X,&incxf,&beta,Y,&incyf);
+  }
   
 };
 
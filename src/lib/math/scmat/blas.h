@@ -42,6 +42,17 @@ extern void F77_DGEMM(const char* transa, const char* transb, const blasint* nro
                       const double* beta,
                       double* C, const blasint* ldc);
 
+extern void F77_DSYMM(const char* side, const char* uplo, const blasint* m, const blasint* n,
+                      const double* alpha, const double* A, const blasint* lda,
+                      const double* B, const blasint* ldb,
+                      const double* beta,
+                      double* C, const blasint* ldc);
+
+extern void F77_DSYRK(const char* uplo, const char* trans, const blasint* n, const blasint* k,
+                      const double* alpha, const double* A, const blasint* lda,
+                      const double* beta,
+                      double* C, const blasint* ldc);
+
 extern void F77_DGEMV(const char* trans, const blasint* m, const blasint* n, const double* alpha,
                       const double* A, const blasint* lda, const double* X, const blasint* incX,
                       const double* beta, double* Y, const blasint* incY);
@@ -146,6 +157,34 @@ namespace sc {
                const double *A, int nca, const double *B, int ncb, double beta,
                double *C, int ncc);
 
+  /** Computes C(m,n) = alpha*A*B + beta*C (side = 'L', A is (m,m) symmetric)
+      or C(m,n) = alpha*B*A + beta*C (side = 'R', A is (n,n) symmetric).
+      All matrices are stored in row-major (C) order; only the uplo
+      triangle of A is referenced. */
+  void C_DSYMM(char side, char uplo, int m, int n, double alpha,
+               const double *A, int nca, const double *B, int ncb, double beta,
+               double *C, int ncc);
+
+  /** Computes C(n,n) = alpha*A*A^T + beta*C (trans = 'N', A is (n,k))
+      or C(n,n) = alpha*A^T*A + beta*C (trans = 'T', A is (k,n)).
+      All matrices are stored in row-major (C) order; only the uplo
+      triangle of C is referenced and updated. */
+  void C_DSYRK(char uplo, char trans, int n, int k, double alpha,
+               const double *A, int nca, double beta,
+               double *C, int ncc);
+
+  /** Computes y = alpha*op(A)*x + beta*y, where A(m,n) is stored in
+      row-major (C) order. */
+  void C_DGEMV(char trans, int m, int n, double alpha,
+               const double *A, int nca, const double *X, int incx,
+               double beta, double *Y, int incy);
+
+  /** Computes y = alpha*A*x + beta*y, where A(n,n) is a symmetric matrix
+      whose lower triangle is packed by rows, the storage used by
+      LocalSymmSCMatrix and ReplSymmSCMatrix. */
+  void C_DSPMV(int n, double alpha, const double *A, const double *X,
+               int incx, double beta, double *Y, int incy);
+
 }
 #endif // __cplusplus
 
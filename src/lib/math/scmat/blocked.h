@@ -217,6 +217,9 @@ class BlockedSymmSCMatrix: public SymmSCMatrix {
     RefSymmSCMatrix *mats_;
 
     void resize(SCDimension*);
+    /// diagonalize the blocks concurrently using the default ThreadGrp
+    void diagonalize_blocks(BlockedDiagSCMatrix*, BlockedSCMatrix*,
+                            bool lowest);
 
   public:
     BlockedSymmSCMatrix(const RefSCDimension&,BlockedSCMatrixKit*);
@@ -257,6 +260,7 @@ class BlockedSymmSCMatrix: public SymmSCMatrix {
 
     double scalar_product(SCVector*);
     void diagonalize(DiagSCMatrix*,SCMatrix*);
+    void diagonalize_lowest(DiagSCMatrix*,SCMatrix*);
     /// like diagonalize(), but with general metric S
     void eigensystem(SymmSCMatrix* S, DiagSCMatrix* e, SCMatrix* V);
 
@@ -26,11 +26,17 @@
 //
 
 #include <math.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 #include <util/misc/formio.h>
+#include <util/misc/scexception.h>
 #include <util/keyval/keyval.h>
 #include <util/state/stateio.h>
+#include <util/group/thread.h>
 #include <math/scmat/blocked.h>
+#include <math/scmat/local.h>
 #include <math/scmat/cmatrix.h>
 #include <math/scmat/elemop.h>
 
@@ -375,6 +381,114 @@ BlockedSymmSCMatrix::scalar_product(SCVector*a)
   return result;
 }
 
+namespace sc {
+
+/** Diagonalizes the blocks of a BlockedSymmSCMatrix, largest block first.
+    The blocks share the subkit, whose reference count is not locked, so
+    the algorithm is passed in rather than obtained from the kit. */
+class BlockDiagThread: public Thread {
+    Ref<ThreadLock> lock_;
+    int *next_;
+    const std::vector<int> &order_;
+    RefSymmSCMatrix *mats_;
+    RefDiagSCMatrix *vals_;
+    RefSCMatrix *vecs_;
+    SCMatrixKit::DiagMethod method_;
+    bool lowest_;
+    std::string error_;
+  public:
+    BlockDiagThread(const Ref<ThreadLock> &lock, int *next,
+                    const std::vector<int> &order,
+                    RefSymmSCMatrix *mats, RefDiagSCMatrix *vals,
+                    RefSCMatrix *vecs, SCMatrixKit::DiagMethod method,
+                    bool lowest):
+      lock_(lock), next_(next), order_(order),
+      mats_(mats), vals_(vals), vecs_(vecs), method_(method),
+      lowest_(lowest) {}
+    void run();
+    const std::string &error() const { return error_; }
+};
+
+void
+BlockDiagThread::run()
+{
+  try {
+    while (true) {
+      lock_->lock();
+      int i = (*next_)++;
+      lock_->unlock();
+      if (i >= order_.size()) break;
+      int b = order_[i];
+      mats_[b]->diagonalize_using(method_, vals_[b].pointer(),
+                                  vecs_[b].pointer(), lowest_);
+    }
+  }
+  catch (std::exception &e) {
+    error_ = e.what();
+  }
+}
+
+}
+
+void
+BlockedSymmSCMatrix::diagonalize_blocks(BlockedDiagSCMatrix*la,
+                                        BlockedSCMatrix*lb,
+                                        bool lowest)
+{
+  // order the blocks by decreasing size so that the largest are started
+  // first
+  std::vector<std::pair<int,int> > sizes;
+  for (int i=0; i < d->blocks()->nblock(); i++)
+    if (mats_[i] && la->mats_[i])
+      sizes.push_back(std::make_pair(-mats_[i]->n(), i));
+  std::sort(sizes.begin(), sizes.end());
+  std::vector<int> order(sizes.size());
+  for (int i=0; i < sizes.size(); i++) order[i] = sizes[i].second;
+
+  // only local blocks are diagonalized concurrently, since they do not
+  // communicate and LocalSymmSCMatrix::diagonalize_using() does not touch
+  // references shared between the blocks
+  const SCMatrixKit::DiagMethod method = subkit->diag_method();
+  Ref<ThreadGrp> thr = ThreadGrp::get_default_threadgrp();
+  int nthread = std::min(thr->nthread(), int(order.size()));
+  if (dynamic_cast<LocalSCMatrixKit*>(subkit.pointer()) == 0)
+    nthread = 1;
+
+  if (nthread <= 1) {
+    for (int i=0; i < order.size(); i++) {
+      int b = order[i];
+      if (lowest)
+        mats_[b]->diagonalize_lowest(la->mats_[b].pointer(),
+                                     lb->mats_[b].pointer());
+      else
+        mats_[b]->diagonalize(la->mats_[b].pointer(),lb->mats_[b].pointer());
+    }
+    return;
+  }
+
+  Ref<ThreadLock> lock = thr->new_lock();
+  int next = 0;
+  std::vector<BlockDiagThread*> threads(nthread);
+  for (int i=0; i<thr->nthread(); i++) thr->add_thread(i,0);
+  for (int i=0; i<nthread; i++) {
+    threads[i] = new BlockDiagThread(lock, &next, order, mats_,
+                                     la->mats_, lb->mats_, method, lowest);
+    thr->add_thread(i,threads[i]);
+  }
+  thr->start_threads();
+  thr->wait_threads();
+
+  std::string error;
+  for (int i=0; i<nthread; i++) {
+    if (error.empty()) error = threads[i]->error();
+    thr->add_thread(i,0);
+    delete threads[i];
+  }
+
+  if (!error.empty())
+    throw AlgorithmException(error.c_str(), __FILE__, __LINE__, class_desc());
+}
+
 void
 BlockedSymmSCMatrix::diagonalize(DiagSCMatrix*a,SCMatrix*b)
 {
@@ -390,9 +504,27 @@ BlockedSymmSCMatrix::diagonalize(DiagSCMatrix*a,SCMatrix*b)
     abort();
   }
 
-  for (int i=0; i < d->blocks()->nblock(); i++)
-    if (mats_[i])
-      mats_[i]->diagonalize(la->mats_[i].pointer(),lb->mats_[i].pointer());
+  diagonalize_blocks(la, lb, false);
+}
+
+void
+BlockedSymmSCMatrix::diagonalize_lowest(DiagSCMatrix*a,SCMatrix*b)
+{
+  const char* name = "BlockedSymmSCMatrix::diagonalize_lowest";
+  // make sure that the arguments is of the correct type
+  BlockedDiagSCMatrix* la = require_dynamic_cast<BlockedDiagSCMatrix*>(a,name);
+  BlockedSCMatrix* lb = require_dynamic_cast<BlockedSCMatrix*>(b,name);
+
+  // each block of this yields the number of eigenpairs in the
+  // corresponding block of a
+  if (!dim()->equiv(lb->rowdim()) || !la->dim()->equiv(lb->coldim()) ||
+      la->dim()->blocks()->nblock() != d->blocks()->nblock()) {
+    ExEnv::errn() << indent << "BlockedSymmSCMatrix::"
+         << "diagonalize_lowest(DiagSCMatrix*a,SCMatrix*b): bad dims\n";
+    abort();
+  }
+
+  diagonalize_blocks(la, lb, true);
 }
 
 void
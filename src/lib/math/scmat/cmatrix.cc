@@ -671,6 +671,107 @@ cmat_transform_diagonal_matrix(double**a,int na, /* a is (na,na) */
   }
 }
 
+/*
+ * a is symmetric (n,n) in a triangular storage format
+ * sq is (n,n) in a contiguous rectangular storage format
+ * both triangles of sq are set to a
+ */
+void
+cmat_symmetric_to_square(double**a, double*sq, int n)
+{
+  int i,j;
+  for (i=0; i < n; i++) {
+    for (j=0; j <= i; j++) {
+      sq[i*n+j] = sq[j*n+i] = a[i][j];
+    }
+  }
+}
+
+/*
+ * a is symmetric (na,na) in a triangular storage format
+ * b is (na,nb) in a contiguous rectangular storage format
+ * a (+)= b * transpose(b) (+= if add)
+ * this is cmat_symmetric_mxm done with DSYRK
+ */
+void
+cmat_symmetric_mxm_blas(double**a,int na, /* a is (na,na) */
+                        double**b,int nb, /* b is (na,nb) */
+                        int add)
+{
+  int i,j;
+  double *t;
+
+  if (na == 0) return;
+  if (nb == 0) {
+    if (!add)
+      for (i=0; i < na; i++)
+        for (j=0; j <= i; j++) a[i][j] = 0.0;
+    return;
+  }
+
+  t = allocate<double>(na*na);
+  C_DSYRK('l', 'n', na, nb, 1.0, b[0], nb, 0.0, t, na);
+  for (i=0; i < na; i++) {
+    double *ai = a[i];
+    const double *ti = t + i*na;
+    if (add)
+      for (j=0; j <= i; j++) ai[j] += ti[j];
+    else
+      for (j=0; j <= i; j++) ai[j] = ti[j];
+  }
+  deallocate(t);
+}
+
+/*
+ * a is symmetric (na,na) in a triangular storage format
+ * b is symmetric (nb,nb) in a triangular storage format
+ * c is (na,nb) (if tc then (nb,na)) in a contiguous rectangular storage format
+ * rows istart through iend-1 of a += c(t) * b * transpose(c(t))
+ * the product is formed with DSYMM and DGEMM; only the rows of a
+ * in [istart,iend) are modified, so that the work can be divided among
+ * nodes that each own a range of rows
+ */
+void
+cmat_transform_symmetric_matrix_rows(double**a,int na, /* a is (na,na) */
+                                     double**b,int nb, /* b is (nb,nb) */
+                                     double**c,int tc, /* c is (na,nb) */
+                                     int istart, int iend)
+{
+  int i,j;
+  int ni = iend - istart;
+  double *bsq, *t, *r;
+
+  if (ni <= 0 || nb == 0) return;
+
+  bsq = allocate<double>(nb*nb);
+  cmat_symmetric_to_square(b, bsq, nb);
+
+  /* t = c(t)[istart:iend,:] * b */
+  t = allocate<double>(ni*nb);
+  if (tc)
+    C_DGEMM('t', 'n', ni, nb, nb, 1.0, c[0]+istart, na, bsq, nb,
+            0.0, t, nb);
+  else
+    C_DSYMM('r', 'l', ni, nb, 1.0, bsq, nb, c[istart], nb,
+            0.0, t, nb);
+  deallocate(bsq);
+
+  /* r = t * transpose(c(t)[0:iend,:]), only the lower triangle is used */
+  r = allocate<double>(ni*iend);
+  if (tc)
+    C_DGEMM('n', 'n', ni, iend, nb, 1.0, t, nb, c[0], na, 0.0, r, iend);
+  else
+    C_DGEMM('n', 't', ni, iend, nb, 1.0, t, nb, c[0], nb, 0.0, r, iend);
+  deallocate(t);
+
+  for (i=istart; i < iend; i++) {
+    double *ai = a[i];
+    const double *ri = r + (i-istart)*iend;
+    for (j=0; j <= i; j++) ai[j] += ri[j];
+  }
+  deallocate(r);
+}
+
 /*
  * Argument a contains pointers to the rows of a symmetrix matrix.  The
  * in each row is the row number + 1.  These rows are stored in
@@ -1008,6 +1109,100 @@ cmat_schmidt_tol(double **C, double *S, int nrow, int ncol,
   return northog;
 }
 
+/*
+ * Argument a contains pointers to the rows of a symmetric matrix in
+ * triangular storage.  The lowest nvec eigenvalues are placed in evals
+ * and the corresponding eigenvectors in the columns of evecs, which is
+ * (n,nvec) and stored contiguously.  If use_dsyevr is nonzero, DSYEVR is
+ * used and only the requested eigenpairs are computed, otherwise all
+ * eigenpairs are computed with DSYEVD.  Only workspace allocated here is
+ * touched, so this may be called concurrently from several threads.
+ */
+void
+cmat_diag_lapack(double**a, double*evals, double**evecs, int n, int nvec,
+                 int use_dsyevr)
+{
+  if (n == 0 || nvec == 0) return;
+
+  // Convert to the lapack storage format.
+  std::vector<double> asq(n*n);
+  for (int i=0; i<n; i++) {
+    for (int j=0; j<=i; j++) {
+      asq[i*n+j] = asq[j*n+i] = a[i][j];
+    }
+  }
+
+  const char jobz_V = 'V';
+  const char uplo_U = 'U';  // lower triangle in C -> upper triange in Fortran
+  const blasint nn = n;
+  std::vector<double> w(n);
+  blasint lwork = -1;
+  blasint liwork = -1;
+  blasint info;
+  double optlwork;
+  blasint optliwork;
+  const char *routine;
+
+  // the eigenvectors in Fortran order
+  std::vector<double> z;
+
+  if (use_dsyevr) {
+    routine = "dsyevr";
+    const char range = (nvec < n) ? 'I' : 'A';
+    const double vl = 0.0, vu = 0.0;
+    const blasint il = 1;
+    const blasint iu = nvec;
+    const char safe_min = 'S';
+    const double abstol = F77_DLAMCH(&safe_min);
+    blasint m;
+    z.resize(n*nvec);
+    std::vector<blasint> isuppz(2*nvec);
+    F77_DSYEVR(&jobz_V, &range, &uplo_U, &nn, &asq[0], &nn,
+               &vl, &vu, &il, &iu, &abstol, &m, &w[0], &z[0], &nn,
+               &isuppz[0], &optlwork, &lwork, &optliwork, &liwork, &info);
+    if (info == 0) {
+      lwork = (blasint)optlwork;
+      liwork = optliwork;
+      std::vector<double> work(lwork);
+      std::vector<blasint> iwork(liwork);
+      F77_DSYEVR(&jobz_V, &range, &uplo_U, &nn, &asq[0], &nn,
+                 &vl, &vu, &il, &iu, &abstol, &m, &w[0], &z[0], &nn,
+                 &isuppz[0], &work[0], &lwork, &iwork[0], &liwork, &info);
+    }
+  }
+  else {
+    routine = "dsyevd";
+    F77_DSYEVD(&jobz_V, &uplo_U, &nn, &asq[0], &nn, &w[0],
+               &optlwork, &lwork, &optliwork, &liwork, &info);
+    if (info == 0) {
+      lwork = (blasint)optlwork;
+      liwork = optliwork;
+      std::vector<double> work(lwork);
+      std::vector<blasint> iwork(liwork);
+      F77_DSYEVD(&jobz_V, &uplo_U, &nn, &asq[0], &nn, &w[0],
+                 &work[0], &lwork, &iwork[0], &liwork, &info);
+    }
+    // the eigenvectors overwrite the input matrix
+    z.swap(asq);
+  }
+
+  if (info) {
+    std::ostringstream oss;
+    oss << routine << " could not diagonalize matrix: info = " << info;
+    throw AlgorithmException(oss.str().c_str(),
+                             __FILE__, __LINE__);
+  }
+
+  // the vectors are placed in the columns of z -> transpose to C order
+  for (int j=0; j<nvec; j++) {
+    evals[j] = w[j];
+    const double *zj = &z[j*n];
+    for (int i=0; i<n; i++) {
+      evecs[i][j] = zj[i];
+    }
+  }
+}
+
 void
 cmat_eigensystem(/*const*/ double**atri, /*const*/ double**stri, double*evals, double**evecs, int n,
                  int matz)
@@ -50,6 +50,14 @@ extern "C" {
                                          double**b,int nb, /* b is (nb,nb) */
                                          double**c,        /* c is (na,nb) */
                                          int add);
+    void cmat_symmetric_to_square(double**symm_a, double*sq, int n);
+    void cmat_symmetric_mxm_blas(double**a,int na, /* a is (na,na) */
+                                 double**b,int nb, /* b is (na,nb) */
+                                 int add);
+    void cmat_transform_symmetric_matrix_rows(double**a,int na, /* a is (na,na) */
+                                              double**b,int nb, /* b is (nb,nb) */
+                                              double**c,int tc, /* c is (na,nb) */
+                                              int istart, int iend);
     void cmat_transform_diagonal_matrix(double**a,int na, /* a is (na,na) */
                                         double*b,int nb,  /* b is (nb,nb) */
                                         double**c,        /* c is (na,nb) */
@@ -62,6 +70,8 @@ extern "C" {
     void cmat_matrix_pointers(double**ptrs,double*matrix,int nrow, int ncol);
     void cmat_diag(double**symm_a, double*evals, double**evecs, int n,
                    int matz, double tol);
+    void cmat_diag_lapack(double**symm_a, double*evals, double**evecs, int n,
+                          int nvec, int use_dsyevr);
     void cmat_eigensystem(/*const*/ double**symm_a, /*const*/ double**symm_s, double*evals, double**evecs, int n,
                           int matz);
     void cmat_schmidt(double **rows, double *S, int nrow, int nc);
@@ -17,6 +17,13 @@ extern void F77_DSYEVD(const char* need_evals, const char* uplo, const blasint*
                        double* Asq, const blasint* lda, double* evals, double* work, const blasint* lwork,
                        blasint* iwork, const blasint* liwork, blasint* info);
 
+extern void F77_DSYEVR(const char* jobz, const char* range, const char* uplo, const blasint* n,
+                       double* Asq, const blasint* lda, const double* vl, const double* vu,
+                       const blasint* il, const blasint* iu, const double* abstol, blasint* m,
+                       double* evals, double* Z, const blasint* ldz, blasint* isuppz,
+                       double* work, const blasint* lwork,
+                       blasint* iwork, const blasint* liwork, blasint* info);
+
 extern void F77_DSPTRF(const char* uplo, const blasint* n, double* AP, blasint* ipiv, blasint* info);
 
 extern void F77_DPPTRF(const char* uplo, const blasint* n, double* AP, blasint* info);
@@ -195,6 +195,9 @@ class LocalSymmSCMatrix: public SymmSCMatrix {
 
     double scalar_product(SCVector*);
     void diagonalize(DiagSCMatrix*,SCMatrix*);
+    void diagonalize_lowest(DiagSCMatrix*,SCMatrix*);
+    void diagonalize_using(SCMatrixKit::DiagMethod,DiagSCMatrix*,SCMatrix*,
+                           bool lowest);
     void eigensystem(SymmSCMatrix*,DiagSCMatrix*,SCMatrix*);
     void accumulate_symmetric_outer_product(SCVector*);
     void accumulate_symmetric_product(SCMatrix*);
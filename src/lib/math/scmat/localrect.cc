@@ -32,6 +32,7 @@
 #include <util/keyval/keyval.h>
 #include <math/scmat/local.h>
 #include <math/scmat/cmatrix.h>
+#include <math/scmat/blas.h>
 #include <math/scmat/elemop.h>
 
 using namespace std;
@@ -372,11 +373,10 @@ LocalSCMatrix::accumulate_product_rr(SCMatrix*a,SCMatrix*b)
       abort();
     }
 
-  cmat_mxm(la->rows, 0,
-           lb->rows, 0,
-           rows, 0,
-           nrow(), la->ncol(), this->ncol(),
-           1);
+  C_DGEMM('n', 'n', nrow(), ncol(), la->ncol(),
+          1.0, la->block->data, la->ncol(),
+          lb->block->data, ncol(),
+          1.0, block->data, ncol());
 }
 
 // does the outer product a x b.  this must have rowdim() == a->dim() and
@@ -427,22 +427,15 @@ LocalSCMatrix::accumulate_product_rs(SCMatrix*a,SymmSCMatrix*b)
       abort();
     }
 
-  double **cd = rows;
-  double **ad = la->rows;
-  double **bd = lb->rows;
   int ni = a->rowdim().n();
   int njk = b->dim().n();
-  int i, j, k;
-  for (i=0; i<ni; i++) {
-      for (j=0; j<njk; j++) {
-          for (k=0; k<=j; k++) {
-              cd[i][k] += ad[i][j]*bd[j][k];
-            }
-          for (; k<njk; k++) {
-              cd[i][k] += ad[i][j]*bd[k][j];
-            }
-        }
-    }
+  if (ni == 0 || njk == 0) return;
+
+  double *bsq = allocate<double>(njk*njk);
+  cmat_symmetric_to_square(lb->rows, bsq, njk);
+  C_DSYMM('r', 'l', ni, njk, 1.0, bsq, njk, la->block->data, njk,
+          1.0, block->data, njk);
+  deallocate(bsq);
 }
 
 void
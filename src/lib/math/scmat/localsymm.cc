@@ -37,6 +37,7 @@
 #include <math/scmat/predicate.h>
 
 #include <math/scmat/mops.h>
+#include <math/scmat/util.h>
 
 using namespace std;
 using namespace sc;
@@ -446,12 +447,53 @@ LocalSymmSCMatrix::diagonalize(DiagSCMatrix*a,SCMatrix*b)
       eigvecs = lb->rows;
     }
 
-  cmat_diag(rows,eigvals,eigvecs,n(),1,1.0e-15);
+  scmat_diagonalize_rows(kit_->diag_method(),rows,n(),eigvals,eigvecs,n());
 
   if (!la) delete[] eigvals;
   if (!lb) cmat_delete_matrix(eigvecs);
 }
 
+void
+LocalSymmSCMatrix::diagonalize_lowest(DiagSCMatrix*a,SCMatrix*b)
+{
+  const char* name = "LocalSymmSCMatrix::diagonalize_lowest";
+  // make sure that the arguments is of the correct type
+  LocalDiagSCMatrix* la = require_dynamic_cast<LocalDiagSCMatrix*>(a,name);
+  LocalSCMatrix* lb = require_dynamic_cast<LocalSCMatrix*>(b,name);
+
+  if (!dim()->equiv(lb->rowdim()) || !la->dim()->equiv(lb->coldim())
+      || la->n() > n()) {
+      ExEnv::errn() << indent
+           << "LocalSymmSCMatrix::"
+           << "diagonalize_lowest(DiagSCMatrix*a,SCMatrix*b): bad dims";
+      abort();
+    }
+
+  diagonalize_using(kit_->diag_method(), a, b, true);
+}
+
+void
+LocalSymmSCMatrix::diagonalize_using(SCMatrixKit::DiagMethod method,
+                                     DiagSCMatrix*a, SCMatrix*b, bool lowest)
+{
+  // only the sizes are checked here, since the dimensions are references
+  // that may be shared with matrices used by other threads
+  LocalDiagSCMatrix* la = dynamic_cast<LocalDiagSCMatrix*>(a);
+  LocalSCMatrix* lb = dynamic_cast<LocalSCMatrix*>(b);
+  if (!la || !lb || lb->nrow() != n() || lb->ncol() != la->n()
+      || la->n() > n() || (!lowest && la->n() != n())) {
+      ExEnv::errn() << indent
+           << "LocalSymmSCMatrix::"
+           << "diagonalize_using(DiagMethod,DiagSCMatrix*a,SCMatrix*b,bool):"
+           << " bad args";
+      abort();
+    }
+
+  if (la->n() == 0) return;
+
+  scmat_diagonalize_rows(method,rows,n(),la->block->data,lb->rows,la->n());
+}
+
 void
 LocalSymmSCMatrix::eigensystem(SymmSCMatrix*s, DiagSCMatrix*a, SCMatrix*b)
 {
@@ -510,7 +552,7 @@ LocalSymmSCMatrix::accumulate_symmetric_product(SCMatrix*a)
       abort();
     }
 
-  cmat_symmetric_mxm(rows,n(),la->rows,la->ncol(),1);
+  cmat_symmetric_mxm_blas(rows,n(),la->rows,la->ncol(),1);
 }
 
 // computes this += a + a.t
@@ -569,8 +611,6 @@ void
 LocalSymmSCMatrix::accumulate_transform(SCMatrix*a,SymmSCMatrix*b,
                                        SCMatrix::Transform t)
 {
-  int i,j,k;
-  int ii,jj;
   int nc, nr;
 
   // do the necessary castdowns
@@ -602,80 +642,9 @@ LocalSymmSCMatrix::accumulate_transform(SCMatrix*a,SymmSCMatrix*b,
   if (nr==0 || nc==0)
     return;
 
-  int nproc = messagegrp()->n();
-
-  double **ablock = cmat_new_square_matrix(D1);
-  double **bblock = cmat_new_square_matrix(D1);
-  double **cblock = cmat_new_square_matrix(D1);
-
-  double **temp = cmat_new_rect_matrix(D1,nc);
-
-  for (i=0; i < nr; i += D1) {
-      int ni = nr-i;
-      if (ni > D1) ni = D1;
-
-      memset(temp[0], 0, sizeof(double)*D1*nc);
-
-      for (j=0; j < nc; j+= D1) {
-          int nj = nc-j;
-          if (nj > D1) nj = D1;
-
-          for (k=0; k < nc; k += D1) {
-
-              int nk = nc-k;
-              if (nk > D1) nk = D1;
-
-              if (t == SCMatrix::NormalTransform)
-                  copy_block(ablock, la->rows, i, ni, k, nk);
-              else
-                  copy_trans_block(ablock, la->rows, i, ni, k, nk);
-
-              copy_sym_block(bblock, lb->rows, j, nj, k, nk);
-              copy_block(cblock, temp, 0, ni, j, nj);
-              mult_block(ablock, bblock, cblock, ni, nj, nk);
-              return_block(temp, cblock, 0, ni, j, nj);
-            }
-        }
-
-      // now do ab * a~
-      for (j=0; j <= i; j+= D1) {
-          int nj = nr-j;
-          if (nj > D1) nj = D1;
-
-          memset(cblock[0], 0, sizeof(double)*D1*D1);
-
-          for (k=0; k < nc; k += D1) {
-
-              int nk = nc-k;
-              if (nk > D1) nk = D1;
-
-              copy_block(ablock, temp, 0, ni, k, nk);
-              if (t == SCMatrix::NormalTransform)
-                  copy_block(bblock, la->rows, j, nj, k, nk);
-              else
-                  copy_trans_block(bblock, la->rows, j, nj, k, nk);
-
-              mult_block(ablock, bblock, cblock, ni, nj, nk);
-            }
-
-          // copy cblock(i,j) into result
-          if (j==i) {
-              for (ii=0; ii < ni; ii++)
-                  for (jj=0; jj <= ii; jj++)
-                      rows[i+ii][j+jj] += cblock[ii][jj];
-            } else {
-                for (ii=0; ii < ni; ii++)
-                    for (jj=0; jj < nj; jj++)
-                        rows[i+ii][j+jj] += cblock[ii][jj];
-              }
-        }
-    }
-
-  cmat_delete_matrix(temp);
-
-  cmat_delete_matrix(ablock);
-  cmat_delete_matrix(bblock);
-  cmat_delete_matrix(cblock);
+  cmat_transform_symmetric_matrix_rows(rows, nr, lb->rows, nc, la->rows,
+                                       t != SCMatrix::NormalTransform,
+                                       0, nr);
 }
 
 // this += a * b * transpose(a)
@@ -31,6 +31,7 @@
 #include <util/keyval/keyval.h>
 #include <math/scmat/local.h>
 #include <math/scmat/cmatrix.h>
+#include <math/scmat/blas.h>
 #include <math/scmat/elemop.h>
 
 using namespace std;
@@ -115,11 +116,8 @@ LocalSCVector::accumulate_product_rv(SCMatrix*a,SCVector*b)
       abort();
     }
 
-  cmat_mxm(la->rows, 0,
-           &(lb->block->data), 1,
-           &(block->data), 1,
-           n(), la->ncol(), 1,
-           1);
+  C_DGEMV('n', n(), la->ncol(), 1.0, la->block->data, la->ncol(),
+          lb->block->data, 1, 1.0, block->data, 1);
 }
 
 void
@@ -138,22 +136,8 @@ LocalSCVector::accumulate_product_sv(SymmSCMatrix*a,SCVector*b)
       abort();
     }
 
-  double* thisdat = block->data;
-  double** adat = la->rows;
-  double* bdat = lb->block->data;
-  double tmp;
-  int n = dim()->n();
-  int i, j;
-  for (i=0; i<n; i++) {
-      tmp = 0.0;
-      for (j=0; j<=i; j++) {
-          tmp += adat[i][j] * bdat[j];
-        }
-      for (; j<n; j++) {
-          tmp += adat[j][i] * bdat[j];
-        }
-      thisdat[i] += tmp;
-    }
+  C_DSPMV(n(), 1.0, la->block->data, lb->block->data, 1,
+          1.0, block->data, 1);
 }
 
 void
@@ -950,6 +950,14 @@ RefSymmSCMatrix::diagonalize(const RefDiagSCMatrix& vals,
   pointer()->diagonalize(vals.pointer(),vecs.pointer());
 }
 
+void
+RefSymmSCMatrix::diagonalize_lowest(const RefDiagSCMatrix& vals,
+                                    const RefSCMatrix& vecs) const
+{
+  require_nonnull();
+  pointer()->diagonalize_lowest(vals.pointer(),vecs.pointer());
+}
+
 RefSymmSCMatrix
 RefSymmSCMatrix::copy() const
 {
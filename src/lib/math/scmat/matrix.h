@@ -368,6 +368,11 @@ class RefSymmSCMatrix: public Ref<SymmSCMatrix> {
         The result satisfies eigvecs * eigvals * eigvecs.t() = (*this).  */
     void diagonalize(const RefDiagSCMatrix& eigvals,
                      const RefSCMatrix& eigvecs) const;
+    /** Sets eigvals to the lowest eigenvalues and the columns of eigvecs
+        to the corresponding eigenvectors of the referenced matrix.  The
+        number of eigenpairs is given by the dimension of eigvals.  */
+    void diagonalize_lowest(const RefDiagSCMatrix& eigvals,
+                            const RefSCMatrix& eigvecs) const;
     /// Assign and examine matrix elements.
     SymmSCMatrixdouble operator()(int i,int j) const;
     /** If this matrix is blocked return the number of blocks.
@@ -0,0 +1,173 @@
+//
+// mxmbench.cc
+//
+// This file is part of the SC Toolkit.
+//
+// The SC Toolkit is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Library General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// The SC Toolkit is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public License
+// along with the SC Toolkit; see the file COPYING.LIB.  If not, write to
+// the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+//
+// The U.S. Government is granted a limited license as per AL 91-7.
+//
+
+// Compares the BLAS-backed products of the local matrix kit with the
+// hand-written cmat routines they replaced.  Usage:
+//   mxmbench [n1 n2 ...]
+// where n1, n2, ... are the matrix dimensions to benchmark.
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <util/misc/formio.h>
+#include <util/misc/regtime.h>
+#include <util/group/message.h>
+#include <math/scmat/local.h>
+#include <math/scmat/cmatrix.h>
+
+using namespace std;
+using namespace sc;
+
+// returns the largest difference between a and b relative to the largest
+// element of a
+static double
+max_rel_diff(double *a, double *b, int n)
+{
+  double d = 0.0, amax = 0.0;
+  for (int i=0; i<n; i++) {
+    d = std::max(d, fabs(a[i]-b[i]));
+    amax = std::max(amax, fabs(a[i]));
+  }
+  return (amax > 0.0) ? d/amax : d;
+}
+
+static int
+bench(int n, const Ref<SCMatrixKit> &kit)
+{
+  const int nrepeat = std::max(1, 100000000/(n*n*n));
+  RefSCDimension dim = new SCDimension(n);
+
+  RefSCMatrix a(dim,dim,kit), b(dim,dim,kit), c(dim,dim,kit);
+  RefSymmSCMatrix s(dim,kit), sr(dim,kit);
+  a.randomize();
+  b.randomize();
+  s.randomize();
+
+  double **ra = cmat_new_square_matrix(n);
+  double **rb = cmat_new_square_matrix(n);
+  double **rc = cmat_new_square_matrix(n);
+  a.convert(ra[0]);
+  b.convert(rb[0]);
+
+  // C += A * B
+  double t0 = RegionTimer::get_wall_time();
+  for (int r=0; r<nrepeat; r++) {
+    memset(rc[0], 0, sizeof(double)*n*n);
+    cmat_mxm(ra, 0, rb, 0, rc, 0, n, n, n, 1);
+  }
+  double t_cmat = (RegionTimer::get_wall_time() - t0)/nrepeat;
+
+  t0 = RegionTimer::get_wall_time();
+  for (int r=0; r<nrepeat; r++) {
+    c.assign(0.0);
+    c.accumulate_product(a, b);
+  }
+  double t_blas = (RegionTimer::get_wall_time() - t0)/nrepeat;
+
+  std::vector<double> cblas(n*n);
+  c.convert(&cblas[0]);
+  double err_mxm = max_rel_diff(rc[0], &cblas[0], n*n);
+
+  double gflop = 2.0*n*n*n*1.0e-9;
+  ExEnv::out0() << indent
+                << scprintf("%6d  mxm   cmat %10.6f s (%7.2f GFLOP/s)"
+                            "  blas %10.6f s (%7.2f GFLOP/s)  |diff| %8.2e",
+                            n, t_cmat, gflop/t_cmat,
+                            t_blas, gflop/t_blas, err_mxm)
+                << endl;
+
+  // S' += A * S * A^T
+  double **rsr = new double*[n];
+  std::vector<double> srdata((n*(n+1))/2);
+  for (int i=0; i<n; i++) rsr[i] = &srdata[(i*(i+1))/2];
+  double **rst = new double*[n];
+  std::vector<double> stdata((n*(n+1))/2);
+  for (int i=0; i<n; i++) rst[i] = &stdata[(i*(i+1))/2];
+  s.convert(&stdata[0]);
+
+  t0 = RegionTimer::get_wall_time();
+  for (int r=0; r<nrepeat; r++) {
+    cmat_transform_symmetric_matrix(rsr, n, rst, n, ra, 0);
+  }
+  t_cmat = (RegionTimer::get_wall_time() - t0)/nrepeat;
+
+  t0 = RegionTimer::get_wall_time();
+  for (int r=0; r<nrepeat; r++) {
+    sr.assign(0.0);
+    sr.accumulate_transform(a, s);
+  }
+  t_blas = (RegionTimer::get_wall_time() - t0)/nrepeat;
+
+  std::vector<double> srblas((n*(n+1))/2);
+  sr.convert(&srblas[0]);
+  double err_transform = max_rel_diff(&srdata[0], &srblas[0], (n*(n+1))/2);
+
+  gflop = 4.0*n*n*n*1.0e-9;
+  ExEnv::out0() << indent
+                << scprintf("%6d  trans cmat %10.6f s (%7.2f GFLOP/s)"
+                            "  blas %10.6f s (%7.2f GFLOP/s)  |diff| %8.2e",
+                            n, t_cmat, gflop/t_cmat,
+                            t_blas, gflop/t_blas, err_transform)
+                << endl;
+
+  delete[] rsr;
+  delete[] rst;
+  cmat_delete_matrix(ra);
+  cmat_delete_matrix(rb);
+  cmat_delete_matrix(rc);
+
+  const double tol = 1.0e-12;
+  return (err_mxm > tol || err_transform > tol) ? 1 : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  Ref<MessageGrp> msg = MessageGrp::initial_messagegrp(argc, argv);
+  if (msg.null()) msg = MessageGrp::get_default_messagegrp();
+  MessageGrp::set_default_messagegrp(msg);
+
+  std::vector<int> sizes;
+  for (int i=1; i<argc; i++) sizes.push_back(atoi(argv[i]));
+  if (sizes.empty()) {
+    sizes.push_back(31);
+    sizes.push_back(100);
+    sizes.push_back(257);
+    sizes.push_back(500);
+  }
+
+  Ref<SCMatrixKit> kit = new LocalSCMatrixKit;
+
+  int nfail = 0;
+  for (int i=0; i<sizes.size(); i++) nfail += bench(sizes[i], kit);
+
+  return nfail;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+// Local Variables:
+// mode: c++
+// c-file-style: "CLJ"
+// End:
@@ -231,6 +231,7 @@ class ReplSymmSCMatrix: public SymmSCMatrix {
 
     double scalar_product(SCVector*);
     void diagonalize(DiagSCMatrix*,SCMatrix*);
+    void diagonalize_lowest(DiagSCMatrix*,SCMatrix*);
     void eigensystem(SymmSCMatrix*,DiagSCMatrix*,SCMatrix*);
     void accumulate_symmetric_outer_product(SCVector*);
     void accumulate_symmetric_product(SCMatrix*);
@@ -35,6 +35,7 @@
 #include <util/misc/consumableresources.h>
 #include <math/scmat/repl.h>
 #include <math/scmat/cmatrix.h>
+#include <math/scmat/blas.h>
 #include <math/scmat/elemop.h>
 #include <math/scmat/mops.h>
 
@@ -431,22 +432,6 @@ ReplSCMatrix::accumulate_product_rr(SCMatrix*a,SCMatrix*b)
       abort();
     }
 
-#if 0
-  cmat_transpose_matrix(lb->rows, la->ncol(), this->ncol());
-  double** btrans;
-  btrans = new double*[this->ncol()];
-  btrans[0] = lb->rows[0];
-  cmat_matrix_pointers(btrans,btrans[0],this->ncol(),la->ncol());
-
-  Ref<SCElementOp> op = new SCElementDot(la->rows, btrans, la->ncol());
-  element_op(op);
-
-  cmat_transpose_matrix(btrans,this->ncol(),la->ncol());
-  delete[] btrans;
-#else
-  int i,j,k;
-  int ii,jj;
-
   int nr = la->nrow();
   int nc = lb->ncol();
   int ncc = la->ncol();
@@ -459,50 +444,20 @@ ReplSCMatrix::accumulate_product_rr(SCMatrix*a,SCMatrix*b)
   int mod = nr%nproc;
   int nirow = nr/nproc + ((mod <= me) ? 0 : 1);
   int istart = (nr/nproc)*me + ((mod <= me) ? mod : me);
-  int iend = istart+nirow;
-
-  double ** ablock = cmat_new_square_matrix(D1);
-  double ** bblock = cmat_new_square_matrix(D1);
-  double ** cblock = cmat_new_square_matrix(D1);
 
-  for (i=istart; i < iend; i += D1) {
-    int ni = iend-i;
-    if (ni > D1) ni = D1;
-    
-    for (j=0; j < nc; j += D1) {
-      int nj = nc-j;
-      if (nj > D1) nj = D1;
+  if (nirow)
+    C_DGEMM('n', 'n', nirow, nc, ncc,
+            1.0, la->rows[istart], ncc,
+            lb->matrix, nc,
+            1.0, rows[istart], nc);
 
-      memset(cblock[0], 0, sizeof(double)*D1*D1);
-
-      for (k=0; k < ncc; k += D1) {
-        int nk = ncc-k;
-        if (nk > D1) nk = D1;
-
-        copy_block(ablock, la->rows, i, ni, k, nk);
-        copy_trans_block(bblock, lb->rows, j, nj, k, nk);
-        mult_block(ablock, bblock, cblock, ni, nj, nk);
-      }
-
-      for (ii=0; ii < ni; ii++)
-        for (jj=0; jj < nj; jj++)
-          rows[i+ii][j+jj] += cblock[ii][jj];
-    }
-  }
-
-  for (i=0; i < nproc; i++) {
+  for (int i=0; i < nproc; i++) {
     nirow = nr/nproc + ((mod <= i) ? 0 : 1);
     istart = (nr/nproc)*i + ((mod <= i) ? mod : i);
     if (!nirow)
       break;
     messagegrp()->bcast(rows[istart], nirow*nc, i);
   }
-
-  cmat_delete_matrix(ablock);
-  cmat_delete_matrix(bblock);
-  cmat_delete_matrix(cblock);
-        
-#endif  
 }
 
 // does the outer product a x b.  this must have rowdim() == a->dim() and
@@ -563,22 +518,15 @@ ReplSCMatrix::accumulate_product_rs(SCMatrix*a,SymmSCMatrix*b)
       abort();
     }
 
-  double **cd = rows;
-  double **ad = la->rows;
-  double **bd = lb->rows;
   int ni = a->rowdim().n();
   int njk = b->dim().n();
-  int i, j, k;
-  for (i=0; i<ni; i++) {
-      for (j=0; j<njk; j++) {
-          for (k=0; k<=j; k++) {
-              cd[i][k] += ad[i][j]*bd[j][k];
-            }
-          for (; k<njk; k++) {
-              cd[i][k] += ad[i][j]*bd[k][j];
-            }
-        }
-    }
+  if (ni == 0 || njk == 0) return;
+
+  double *bsq = allocate<double>(njk*njk);
+  cmat_symmetric_to_square(lb->rows, bsq, njk);
+  C_DSYMM('r', 'l', ni, njk, 1.0, bsq, njk, la->matrix, njk,
+          1.0, matrix, njk);
+  deallocate(bsq);
 }
 
 void
@@ -552,7 +552,7 @@ ReplSymmSCMatrix::diagonalize(DiagSCMatrix*a,SCMatrix*b)
   if (nproc==1 || n <= 2) {
       double *eigvals = la->matrix;
       double **eigvecs = lb->rows;
-      cmat_diag(rows, eigvals, eigvecs, n, 1, 1.0e-15);
+      scmat_diagonalize_rows(kit_->diag_method(), rows, n, eigvals, eigvecs, n);
     }
   else {
       Ref<MessageGrp> diagmsggrp;
@@ -644,6 +644,33 @@ ReplSymmSCMatrix::diagonalize(DiagSCMatrix*a,SCMatrix*b)
     }
 }
 
+void
+ReplSymmSCMatrix::diagonalize_lowest(DiagSCMatrix*a,SCMatrix*b)
+{
+  const char* name = "ReplSymmSCMatrix::diagonalize_lowest";
+  // make sure that the arguments is of the correct type
+  ReplDiagSCMatrix* la = require_dynamic_cast<ReplDiagSCMatrix*>(a,name);
+  ReplSCMatrix* lb = require_dynamic_cast<ReplSCMatrix*>(b,name);
+
+  if (!dim()->equiv(lb->rowdim()) || !la->dim()->equiv(lb->coldim())
+      || la->n() > n()) {
+      ExEnv::errn() << indent
+           << "ReplSymmSCMatrix::diagonalize_lowest(DiagSCMatrix*a,SCMatrix*b): "
+           << "bad dims\n";
+      abort();
+    }
+
+  if (la->n() == 0) return;
+
+  // the distributed diagonalizer always finds all of the eigenpairs
+  if (messagegrp()->n() > 1) {
+      SymmSCMatrix::diagonalize_lowest(a,b);
+      return;
+    }
+
+  scmat_diagonalize_rows(kit_->diag_method(), rows, n(), la->matrix, lb->rows, la->n());
+}
+
 void
 ReplSymmSCMatrix::eigensystem(SymmSCMatrix*s, DiagSCMatrix*a, SCMatrix*b)
 {
@@ -696,7 +723,7 @@ ReplSymmSCMatrix::accumulate_symmetric_product(SCMatrix*a)
       abort();
     }
 
-  cmat_symmetric_mxm(rows,n(),la->rows,la->ncol(),1);
+  cmat_symmetric_mxm_blas(rows,n(),la->rows,la->ncol(),1);
 }
 
 // computes this += a + a.t
@@ -753,8 +780,6 @@ void
 ReplSymmSCMatrix::accumulate_transform(SCMatrix*a,SymmSCMatrix*b,
                                        SCMatrix::Transform t)
 {
-  int i,j,k;
-  int ii,jj;
   int nc, nr;
 
   // do the necessary castdowns
@@ -786,200 +811,29 @@ ReplSymmSCMatrix::accumulate_transform(SCMatrix*a,SymmSCMatrix*b,
   if (nr==0 || nc==0)
     return;
 
+  // each node forms a contiguous range of rows of the result, which
+  // is then broadcast to the others
   int nproc = messagegrp()->n();
+  int me = messagegrp()->me();
+  int mod = nr%nproc;
+  int nirow = nr/nproc + ((mod <= me) ? 0 : 1);
+  int istart = (nr/nproc)*me + ((mod <= me) ? mod : me);
 
-  double **ablock = cmat_new_square_matrix(D1);
-  double **bblock = cmat_new_square_matrix(D1);
-  double **cblock = cmat_new_square_matrix(D1);
-
-  // if one processor then minimize the amount of memory used
-  if (nproc == 1) {
-    double **temp = cmat_new_rect_matrix(D1,nc);
-
-    for (i=0; i < nr; i += D1) {
-      int ni = nr-i;
-      if (ni > D1) ni = D1;
-
-      memset(temp[0], 0, sizeof(double)*D1*nc);
-
-      for (j=0; j < nc; j+= D1) {
-        int nj = nc-j;
-        if (nj > D1) nj = D1;
-
-        for (k=0; k < nc; k += D1) {
-
-          int nk = nc-k;
-          if (nk > D1) nk = D1;
-
-          if (t == SCMatrix::NormalTransform)
-            copy_block(ablock, la->rows, i, ni, k, nk);
-          else
-            copy_trans_block(ablock, la->rows, i, ni, k, nk);
-
-          copy_sym_block(bblock, lb->rows, j, nj, k, nk);
-          copy_block(cblock, temp, 0, ni, j, nj);
-          mult_block(ablock, bblock, cblock, ni, nj, nk);
-          return_block(temp, cblock, 0, ni, j, nj);
-        }
-      }
-
-      // now do ab * a~
-      for (j=0; j <= i; j+= D1) {
-        int nj = nr-j;
-        if (nj > D1) nj = D1;
-
-        memset(cblock[0], 0, sizeof(double)*D1*D1);
-
-        for (k=0; k < nc; k += D1) {
-
-          int nk = nc-k;
-          if (nk > D1) nk = D1;
-
-          copy_block(ablock, temp, 0, ni, k, nk);
-          if (t == SCMatrix::NormalTransform)
-            copy_block(bblock, la->rows, j, nj, k, nk);
-          else
-            copy_trans_block(bblock, la->rows, j, nj, k, nk);
-
-          mult_block(ablock, bblock, cblock, ni, nj, nk);
-        }
-
-        // copy cblock(i,j) into result
-        if (j==i) {
-          for (ii=0; ii < ni; ii++)
-            for (jj=0; jj <= ii; jj++)
-              rows[i+ii][j+jj] += cblock[ii][jj];
-        } else {
-          for (ii=0; ii < ni; ii++)
-            for (jj=0; jj < nj; jj++)
-              rows[i+ii][j+jj] += cblock[ii][jj];
-        }
-      }
-    }
-
-    cmat_delete_matrix(temp);
-  }
-
-  // this version requires a full temp matrix be kept
-  else {
-    int me = messagegrp()->me();
-    int mod = nr%nproc;
-    int njrow = nr/nproc + ((mod <= me) ? 0 : 1);
-    int jstart = (nr/nproc)*me + ((mod <= me) ? mod : me);
-    int jend = jstart+njrow;
-
-    double **temp = cmat_new_rect_matrix(nr,nc);
-    memset(temp[0], 0, sizeof(double)*nr*nc);
-
-    for (i=0; i < nc; i += D1) {
-      int ni = nc-i;
-      if (ni > D1) ni = D1;
-
-      for (k=0; k < nc; k += D1) {
-        int nk = nc-k;
-        if (nk > D1) nk = D1;
-
-        copy_sym_block(ablock, lb->rows, i, ni, k, nk);
-
-        for (j=jstart; j < jend; j += D1) {
-          int nj = jend-j;
-          if (nj > D1) nj = D1;
-
-          if (t == SCMatrix::NormalTransform)
-            copy_block(bblock, la->rows, j, nj, k, nk);
-          else
-            copy_trans_block(bblock, la->rows, j, nj, k, nk);
-
-          memset(cblock[0], 0, sizeof(double)*D1*D1);
-          mult_block(ablock, bblock, cblock, ni, nj, nk);
-
-          for (jj=0; jj < nj; jj++)
-            for (ii=0; ii < ni; ii++)
-              temp[j+jj][i+ii] += cblock[ii][jj];
-        }
-      }
-    }
-
-    for (i=0; i < nproc; i++) {
-      njrow = nr/nproc + ((mod <= i) ? 0 : 1);
-      jstart = (nr/nproc)*i + ((mod <= i) ? mod : i);
-      if (!njrow)
-        break;
-      messagegrp()->bcast(temp[jstart], njrow*nc, i);
-    }
-
-    int ind=0;
-    for (i=0; i < nr; i += D1) {
-      int ni = nr-i;
-      if (ni > D1) ni = D1;
-
-      for (j=0; j <= i; j += D1, ind++) {
-        if (ind%nproc != me)
-          continue;
-
-        int nj = nr-j;
-        if (nj > D1) nj = D1;
-
-        memset(cblock[0], 0, sizeof(double)*D1*D1);
-
-        for (k=0; k < nc; k += D1) {
-          int nk = nc-k;
-          if (nk > D1) nk = D1;
-
-          if (t == SCMatrix::NormalTransform)
-            copy_block(ablock, la->rows, i, ni, k, nk);
-          else
-            copy_trans_block(ablock, la->rows, i, ni, k, nk);
-          copy_block(bblock, temp, j, nj, k, nk);
-          mult_block(ablock, bblock, cblock, ni, nj, nk);
-        }
-
-        if (i==j) {
-          for (ii=0; ii < ni; ii++)
-            for (jj=0; jj <= ii; jj++)
-              rows[i+ii][j+jj] += cblock[ii][jj];
-        } else {
-          for (ii=0; ii < ni; ii++)
-            for (jj=0; jj < nj; jj++)
-              rows[i+ii][j+jj] += cblock[ii][jj];
-        }
-      }
-    }
-
-    ind=0;
-    for (i=0; i < nr; i += D1) {
-      int ni = nr-i;
-      if (ni > D1) ni = D1;
-
-      for (j=0; j <= i; j += D1, ind++) {
-        int nj = nr-j;
-        if (nj > D1) nj = D1;
-
-        int proc = ind%nproc;
-
-        if (proc==me)
-          copy_sym_block(ablock, rows, i, ni, j, nj);
-
-        messagegrp()->bcast(ablock[0], D1*D1, proc);
+  cmat_transform_symmetric_matrix_rows(rows, nr, lb->rows, nc, la->rows,
+                                       t != SCMatrix::NormalTransform,
+                                       istart, istart+nirow);
 
-        if (i==j) {
-          for (ii=0; ii < ni; ii++)
-            for (jj=0; jj <= ii; jj++)
-              rows[i+ii][j+jj] = ablock[ii][jj];
-        } else {
-          for (ii=0; ii < ni; ii++)
-            for (jj=0; jj < nj; jj++)
-              rows[i+ii][j+jj] = ablock[ii][jj];
-        }
-      }
-    }
+  if (nproc == 1)
+    return;
 
-    cmat_delete_matrix(temp);
+  for (int i=0; i < nproc; i++) {
+    nirow = nr/nproc + ((mod <= i) ? 0 : 1);
+    istart = (nr/nproc)*i + ((mod <= i) ? mod : i);
+    if (!nirow)
+      break;
+    int iend = istart+nirow;
+    messagegrp()->bcast(rows[istart], (iend*(iend+1))/2 - (istart*(istart+1))/2, i);
   }
-
-  cmat_delete_matrix(ablock);
-  cmat_delete_matrix(bblock);
-  cmat_delete_matrix(cblock);
 }
 
 // this += a * b * transpose(a)
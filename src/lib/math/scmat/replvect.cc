@@ -35,6 +35,7 @@
 #include <util/misc/consumableresources.h>
 #include <math/scmat/repl.h>
 #include <math/scmat/cmatrix.h>
+#include <math/scmat/blas.h>
 #include <math/scmat/elemop.h>
 
 using namespace std;
@@ -145,11 +146,8 @@ ReplSCVector::accumulate_product_rv(SCMatrix*a,SCVector*b)
       abort();
     }
 
-  cmat_mxm(la->rows, 0,
-           &lb->vector, 1,
-           &vector, 1,
-           n(), la->ncol(), 1,
-           1);
+  C_DGEMV('n', n(), la->ncol(), 1.0, la->matrix, la->ncol(),
+          lb->vector, 1, 1.0, vector, 1);
 }
 
 void
@@ -168,21 +166,7 @@ ReplSCVector::accumulate_product_sv(SymmSCMatrix*a,SCVector*b)
       abort();
     }
 
-  double** adat = la->rows;
-  double* bdat = lb->vector;
-  double tmp;
-  int n = dim()->n();
-  int i, j;
-  for (i=0; i<n; i++) {
-      tmp = 0.0;
-      for (j=0; j<=i; j++) {
-          tmp += adat[i][j] * bdat[j];
-        }
-      for (; j<n; j++) {
-          tmp += adat[j][i] * bdat[j];
-        }
-      vector[i] += tmp;
-    }
+  C_DSPMV(n(), 1.0, la->matrix, lb->vector, 1, 1.0, vector, 1);
 }
 
 void
@@ -32,6 +32,7 @@
 #include <util/group/thread.h>
 #include <math/scmat/matrix.h>
 #include <math/scmat/blocked.h>
+#include <math/scmat/cmatrix.h>
 
 namespace sc {
 
@@ -119,6 +120,26 @@ sc::scmat_perform_op_on_blocks(const Ref<SCElementOp>& op,
   delete[] ops;
 }
 
+void
+sc::scmat_diagonalize_rows(SCMatrixKit::DiagMethod method, double **rows, int n,
+                           double *evals, double **evecs, int nvec)
+{
+  switch (method) {
+  case SCMatrixKit::TQLI:
+    if (nvec == n) {
+      cmat_diag(rows,evals,evecs,n,1,1.0e-15);
+      break;
+    }
+    // TQLI cannot compute a subset, fall through to DSYEVR
+  case SCMatrixKit::DSYEVR:
+    cmat_diag_lapack(rows,evals,evecs,n,nvec,1);
+    break;
+  case SCMatrixKit::DSYEVD:
+    cmat_diag_lapack(rows,evals,evecs,n,nvec,0);
+    break;
+  }
+}
+
 void
 sc::canonicalize_column_phases(RefSCMatrix& A) {
   Ref<BlockedSCMatrix> A_blkd = dynamic_cast<BlockedSCMatrix*>(A.pointer());
@@ -4,6 +4,7 @@
 
 #include <math/scmat/elemop.h>
 #include <math/scmat/block.h>
+#include <math/scmat/abstract.h>
 
 namespace sc {
 
@@ -13,6 +14,13 @@ namespace sc {
   scmat_perform_op_on_blocks(const Ref<SCElementOp>& op,
                              const Ref<SCMatrixBlockList> &blocklist);
 
+  /** Diagonalize the symmetric matrix whose lower triangle is given by
+      rows with the algorithm given by method, placing the lowest nvec
+      eigenvalues in evals and the corresponding eigenvectors in the
+      columns of the (n,nvec) matrix evecs. */
+  void scmat_diagonalize_rows(SCMatrixKit::DiagMethod method, double **rows, int n,
+                              double *evals, double **evecs, int nvec);
+
   /// Canonicalize phases of SCMatrix A
   /// phases are canonical when the largest-magnitude coefficient in each column is positive
   void canonicalize_column_phases(RefSCMatrix& A);
@@ -0,0 +1,343 @@
+#ifndef MPQC_CI_CACHE_HPP
+#define MPQC_CI_CACHE_HPP
+
+#include "mpqc/ci/subspace.hpp"
+#include "mpqc/ci/vector.hpp"
+#include "mpqc/math/matrix.hpp"
+
+#include <map>
+#include <string>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <algorithm>
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace mpqc {
+namespace ci {
+
+    /// @addtogroup CI
+    /// @{
+
+    /// Bounded cache of vector blocks, shared by threads, for out-of-core vectors.
+    /// Blocks are read ahead of the task order on a background I/O thread
+    /// and blocks written with put() are written back to the vector on the same thread.
+    /// Reads of a block return the latest data put(), whether or not it was written back.
+    /// Blocks are identified by their alpha/beta subspace indices in the SubspaceGrid.
+    /// With zero capacity there is no I/O thread and get()/put() access the vector directly.
+    /// @tparam V vector, V(alpha,beta) reads or assigns a block, e.g. ci::Vector
+    /// @tparam G grid, G.alpha(a) and G.beta(b) are the block ranges, e.g. SubspaceGrid
+    template<class V, class G>
+    struct BasicBlockCache : boost::noncopyable {
+
+        typedef std::pair<int,int> Block;
+        typedef std::shared_ptr<const mpqc::Matrix> Data;
+        /// Appends blocks needed by task to the vector, in the order they will be read
+        typedef std::function<void(size_t task, std::vector<Block> &blocks)> Prefetch;
+
+        /// @param V vector
+        /// @param G vector subspace grid
+        /// @param capacity cache size in bytes
+        BasicBlockCache(V &v, const G &g, size_t capacity)
+            : V_(v), G_(g), capacity_(capacity),
+              size_(0), dirty_(0), writing_(0), lru_(0),
+              task_(0), claimed_(0), ntask_(0), next_(0), done_(false)
+        {
+            if (capacity_)
+                thread_ = boost::thread(&BasicBlockCache::run, this);
+        }
+
+        /// Writes back all blocks and stops the I/O thread
+        ~BasicBlockCache() {
+            if (!capacity_) return;
+            try {
+                flush();
+            }
+            catch (...) {} // I/O thread failed, nothing more can be written
+            {
+                boost::lock_guard<boost::mutex> lock(mutex_);
+                done_ = true;
+            }
+            cond_.notify_all();
+            thread_.join();
+        }
+
+        /// Reads blocks ahead for tasks [0,ntask) as the tasks are claimed with advance().
+        /// Blocks read ahead in the previous pass but never used can be evicted
+        void prefetch(Prefetch f, size_t ntask) {
+            if (!capacity_) return;
+            boost::lock_guard<boost::mutex> lock(mutex_);
+            prefetch_ = f;
+            ntask_ = ntask;
+            task_ = claimed_ = 0;
+            pending_.clear();
+            next_ = 0;
+            for (auto it = entries_.begin(); it != entries_.end(); ++it)
+                it->second.used = true;
+            cond_.notify_all();
+        }
+
+        /// Tells the cache that the task is being processed,
+        /// and that tasks [task,claimed) are claimed by this process.
+        /// Only blocks of those tasks are read ahead, tasks that other processes
+        /// take are skipped, so blocks read ahead are always used
+        void advance(size_t task, size_t claimed) {
+            if (!capacity_) return;
+            boost::lock_guard<boost::mutex> lock(mutex_);
+            if (task < task_ || (task == task_ && claimed <= claimed_)) return;
+            task_ = task;
+            claimed_ = std::max(task+1, claimed);
+            cond_.notify_all();
+        }
+
+        /// Returns block (a,b), reading it if it is not in the cache
+        Data get(int a, int b) {
+            if (!capacity_) return Data(new mpqc::Matrix(read(a,b)));
+            boost::unique_lock<boost::mutex> lock(mutex_);
+            Block k(a,b);
+            while (true) {
+                auto it = entries_.find(k);
+                if (it == entries_.end()) break;
+                if (it->second.data) {
+                    it->second.lru = ++lru_;
+                    it->second.used = true;
+                    return it->second.data;
+                }
+                cond_.wait(lock); // being read by another thread
+                check();
+            }
+            entries_[k] = Entry();
+            lock.unlock();
+            Data data;
+            try {
+                data.reset(new mpqc::Matrix(read(a,b)));
+            }
+            catch (...) {
+                lock.lock();
+                entries_.erase(k);
+                cond_.notify_all();
+                throw;
+            }
+            lock.lock();
+            insert(k, data, ++lru_);
+            evict(0);
+            cond_.notify_all();
+            return data;
+        }
+
+        /// Sets block (a,b) to m, the block is written back to the vector asynchronously
+        void put(int a, int b, const mpqc::Matrix &m) {
+            if (!capacity_) {
+                V_(G_.alpha(a), G_.beta(b)) = m;
+                return;
+            }
+            Data data(new mpqc::Matrix(m));
+            boost::unique_lock<boost::mutex> lock(mutex_);
+            Block k(a,b);
+            // wait if the block is being read, or if too much data waits to be written
+            while (true) {
+                auto it = entries_.find(k);
+                bool reading = (it != entries_.end() && !it->second.data);
+                if (!reading && dirty_ <= capacity_/2) break;
+                cond_.wait(lock);
+                check();
+            }
+            Entry &e = insert(k, data, ++lru_);
+            if (!e.dirty) dirty_ += bytes(*data);
+            e.dirty = true;
+            if (!e.queued) writes_.push_back(k);
+            e.queued = true;
+            evict(0);
+            cond_.notify_all();
+        }
+
+        /// Waits until all blocks put() are written back to the vector
+        void flush() {
+            if (!capacity_) return;
+            boost::unique_lock<boost::mutex> lock(mutex_);
+            while (!writes_.empty() || writing_) {
+                check();
+                cond_.wait(lock);
+            }
+            check();
+        }
+
+    private:
+
+        struct Entry {
+            Data data;   // null while the block is being read
+            bool dirty;  // put() but not written back
+            bool queued; // in writes_
+            bool used;   // returned by get() or put(), i.e. not only read ahead
+            size_t lru;
+            Entry() : dirty(false), queued(false), used(false), lru(0) {}
+        };
+
+        V &V_;
+        const G &G_;
+        size_t capacity_;
+
+        boost::mutex mutex_;
+        boost::condition_variable cond_;
+        // protected by mutex_
+        std::map<Block,Entry> entries_;
+        std::deque<Block> writes_;
+        size_t size_, dirty_;  // bytes in cache, bytes to be written
+        int writing_;          // blocks being written
+        size_t lru_;
+        Prefetch prefetch_;
+        size_t task_, claimed_;   // current task, end of tasks claimed with it
+        size_t ntask_;            // number of tasks
+        std::deque< std::pair<size_t,Block> > pending_; // blocks to read ahead
+        size_t next_;             // next task to add to pending_
+        bool done_;
+        std::string error_;       // set if the I/O thread failed
+
+        boost::thread thread_;
+
+        static size_t bytes(const mpqc::Matrix &m) {
+            return m.size()*sizeof(double);
+        }
+
+        mpqc::Matrix read(int a, int b) {
+            mpqc::Matrix m = V_(G_.alpha(a), G_.beta(b));
+            return m;
+        }
+
+        Entry& insert(const Block &k, const Data &data, size_t lru) {
+            Entry &e = entries_[k];
+            if (e.data) size_ -= bytes(*e.data);
+            e.data = data;
+            e.used = e.used || lru;
+            e.lru = lru;
+            size_ += bytes(*data);
+            return e;
+        }
+
+        /// throws if the I/O thread failed
+        void check() const {
+            if (!error_.empty())
+                throw MPQC_EXCEPTION("ci::BlockCache: %s", error_.c_str());
+        }
+
+        /// Evicts least recently used clean blocks until n more bytes fit.
+        /// Blocks read ahead but not yet used are evicted last,
+        /// and only if unused is true
+        bool evict(size_t n, bool unused = true) {
+            while (size_ + n > capacity_) {
+                auto lru = entries_.end();
+                for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+                    const Entry &e = it->second;
+                    if (!e.data || e.dirty) continue;
+                    if (!e.used && !unused) continue;
+                    if (lru == entries_.end()) {
+                        lru = it;
+                        continue;
+                    }
+                    const Entry &l = lru->second;
+                    if ((e.used && !l.used) || (e.used == l.used && e.lru < l.lru))
+                        lru = it;
+                }
+                if (lru == entries_.end()) return false;
+                size_ -= bytes(*lru->second.data);
+                entries_.erase(lru);
+            }
+            return true;
+        }
+
+        /// I/O thread: writes back blocks, then reads ahead
+        void run() {
+            boost::unique_lock<boost::mutex> lock(mutex_);
+            Block k;
+            bool reading = false;
+            try {
+                while (!done_) {
+                    if (!writes_.empty()) {
+                        k = writes_.front();
+                        writes_.pop_front();
+                        Entry &e = entries_[k];
+                        e.queued = false;
+                        Data data = e.data;
+                        ++writing_;
+                        lock.unlock();
+                        V_(G_.alpha(k.first), G_.beta(k.second)) = *data;
+                        lock.lock();
+                        --writing_;
+                        Entry &w = entries_[k];
+                        if (w.dirty && w.data == data) {
+                            w.dirty = false;
+                            dirty_ -= bytes(*data);
+                        }
+                        evict(0);
+                        cond_.notify_all();
+                        continue;
+                    }
+                    if (next_block(k)) {
+                        entries_[k] = Entry();
+                        reading = true;
+                        lock.unlock();
+                        Data data(new mpqc::Matrix(read(k.first, k.second)));
+                        lock.lock();
+                        reading = false;
+                        insert(k, data, 0);
+                        cond_.notify_all();
+                        continue;
+                    }
+                    cond_.wait(lock);
+                }
+            }
+            catch (std::exception &e) {
+                if (!lock.owns_lock()) lock.lock();
+                if (reading) entries_.erase(k);
+                error_ = e.what();
+                writing_ = 0;
+                cond_.notify_all();
+            }
+        }
+
+        /// Finds the next block to read ahead that is not in the cache and fits
+        bool next_block(Block &k) {
+            if (!prefetch_) return false;
+            std::vector<Block> blocks;
+            while (true) {
+                while (!pending_.empty() && pending_.front().first < task_)
+                    pending_.pop_front();
+                if (pending_.empty()) {
+                    next_ = std::max(next_, task_);
+                    if (next_ >= std::min(claimed_, ntask_)) return false;
+                    blocks.clear();
+                    prefetch_(next_, blocks);
+                    foreach (const Block &b, blocks)
+                        pending_.push_back(std::make_pair(next_, b));
+                    ++next_;
+                    continue;
+                }
+                k = pending_.front().second;
+                if (entries_.count(k)) {
+                    pending_.pop_front();
+                    continue;
+                }
+                mpqc::range a = G_.alpha(k.first), b = G_.beta(k.second);
+                size_t n = a.size()*b.size()*sizeof(double);
+                if (!evict(n, false)) return false; // full, wait for blocks to be used
+                pending_.pop_front();
+                return true;
+            }
+        }
+
+    };
+
+    /// Cache of ci::Vector blocks
+    typedef BasicBlockCache<ci::Vector, SubspaceGrid> BlockCache;
+
+    /// @}
+
+}
+}
+
+#endif /* MPQC_CI_CACHE_HPP */
@@ -0,0 +1,214 @@
+#define BOOST_TEST_MODULE CI block cache
+
+#include "mpqc/ci/cache.hpp"
+#include "mpqc/range.hpp"
+#include "mpqc/math/matrix.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <map>
+#include <vector>
+#include <utility>
+
+namespace {
+
+    using mpqc::range;
+    using mpqc::Matrix;
+
+    typedef std::pair<int,int> Key;
+
+    /// Square grid of n blocks of size block
+    struct MockGrid {
+        MockGrid(int n, int block) : n(n), block(block) {}
+        range alpha(int a) const { return range(a*block, (a+1)*block); }
+        range beta(int b) const { return alpha(b); }
+        int n, block;
+    };
+
+    /// Vector of blocks that counts and delays reads and writes like a file would
+    struct MockVector {
+
+        struct Block {
+            operator Matrix() const {
+                boost::this_thread::sleep(boost::posix_time::microseconds(100));
+                boost::lock_guard<boost::mutex> lock(v.mutex);
+                ++v.reads[key()];
+                auto it = v.data.find(key());
+                if (it == v.data.end()) return Matrix::Zero(a.size(), b.size());
+                return it->second;
+            }
+            void operator=(const Matrix &m) const {
+                boost::this_thread::sleep(boost::posix_time::microseconds(100));
+                boost::lock_guard<boost::mutex> lock(v.mutex);
+                ++v.writes;
+                v.data[key()] = m;
+            }
+            MockVector &v;
+            range a, b;
+            Key key() const { return Key(*a.begin(), *b.begin()); }
+        };
+
+        MockVector() : writes(0) {}
+
+        Block operator()(range a, range b) {
+            Block block = { *this, a, b };
+            return block;
+        }
+
+        size_t nreads() const {
+            size_t n = 0;
+            for (auto it = reads.begin(); it != reads.end(); ++it)
+                n += it->second;
+            return n;
+        }
+
+        boost::mutex mutex;
+        std::map<Key,Matrix> data;
+        std::map<Key,size_t> reads;
+        size_t writes;
+
+    };
+
+    typedef mpqc::ci::BasicBlockCache<MockVector, MockGrid> Cache;
+
+    /// Task counter handing out chunks of tasks like MPI::Task.
+    /// With stride 2, every other chunk is taken by another process
+    struct MockTask {
+        MockTask(int ntask, int chunk, int stride)
+            : ntask(ntask), chunk(chunk), stride(stride), count(0), next_(0), end_(0) {}
+        /// Returns next task, or ntask, and the end of the chunk it belongs to
+        int next(int &claimed) {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            if (next_ == end_) {
+                next_ = chunk*stride*(count++);
+                end_ = next_ + chunk;
+            }
+            claimed = std::min(end_, ntask);
+            return std::min(next_++, ntask);
+        }
+        int ntask, chunk, stride, count;
+        boost::mutex mutex;
+        int next_, end_;
+    };
+
+    /// Task t sums row t/n of C and block (t%n,t/n), and writes block (t/n,t%n) of S
+    void prefetch(const MockGrid &G, size_t t, std::vector<Cache::Block> &blocks) {
+        int a = t/G.n, b = t%G.n;
+        for (int j = 0; j < G.n; ++j)
+            blocks.push_back(Cache::Block(a,j));
+        blocks.push_back(Cache::Block(b,a));
+    }
+
+    void sigma(const MockGrid &G, Cache &CC, Cache &SC, MockTask &task, size_t &gets) {
+        size_t n = 0;
+        while (true) {
+            int claimed;
+            int t = task.next(claimed);
+            if (t >= task.ntask) break;
+            CC.advance(t, claimed);
+            int a = t/G.n, b = t%G.n;
+            Matrix s = Matrix::Zero(G.block, G.block);
+            for (int j = 0; j < G.n; ++j)
+                s += *CC.get(a,j);
+            s += *CC.get(b,a);
+            n += G.n+1;
+            SC.put(a, b, s);
+        }
+        boost::lock_guard<boost::mutex> lock(task.mutex);
+        gets += n;
+    }
+
+    /// Runs the sigma passes on nthread threads, checks S, returns the number of get()
+    size_t run(const MockGrid &G, MockVector &C, MockVector &S,
+               int stride, int npass, size_t capacity) {
+        const int nthread = 4;
+        int ntask = G.n*G.n;
+        size_t gets = 0;
+        {
+            Cache CC(C, G, capacity), SC(S, G, capacity);
+            for (int pass = 0; pass < npass; ++pass) {
+                MockTask task(ntask, G.n, stride);
+                CC.prefetch([&](size_t t, std::vector<Cache::Block> &blocks) {
+                        prefetch(G, t, blocks);
+                    }, ntask);
+                boost::thread_group threads;
+                for (int i = 0; i < nthread; ++i) {
+                    threads.create_thread([&]() {
+                            sigma(G, CC, SC, task, gets);
+                        });
+                }
+                threads.join_all();
+                SC.flush();
+            }
+        }
+        for (int t = 0; t < ntask; ++t) {
+            int a = t/G.n, b = t%G.n;
+            Key k(*G.alpha(a).begin(), *G.beta(b).begin());
+            if (stride > 1 && a % stride) {
+                BOOST_CHECK(!S.data.count(k));
+                continue;
+            }
+            double s = 0;
+            for (int j = 0; j < G.n; ++j)
+                s += a*100+j;
+            s += b*100+a;
+            BOOST_REQUIRE(S.data.count(k));
+            BOOST_CHECK(S.data[k] == Matrix(Matrix::Constant(G.block, G.block, s)));
+        }
+        return gets;
+    }
+
+    void init(const MockGrid &G, MockVector &C) {
+        for (int a = 0; a < G.n; ++a) {
+            for (int b = 0; b < G.n; ++b) {
+                C.data[Key(*G.alpha(a).begin(), *G.beta(b).begin())] =
+                    Matrix::Constant(G.block, G.block, a*100+b);
+            }
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE(direct) {
+    MockGrid G(8, 4);
+    MockVector C, S;
+    init(G, C);
+    size_t gets = run(G, C, S, 1, 1, 0);
+    BOOST_CHECK_EQUAL(C.nreads(), gets);
+    BOOST_CHECK_EQUAL(S.writes, size_t(G.n*G.n));
+}
+
+BOOST_AUTO_TEST_CASE(read_ahead) {
+    MockGrid G(16, 4);
+    MockVector C, S;
+    init(G, C);
+    // room for a quarter of the blocks
+    size_t capacity = (G.n*G.n/4)*G.block*G.block*sizeof(double);
+    size_t gets = run(G, C, S, 1, 1, capacity);
+    BOOST_TEST_MESSAGE("C reads: " << C.nreads() << ", C get(): " << gets);
+    BOOST_CHECK(C.nreads() < gets/4);
+    BOOST_CHECK_EQUAL(S.writes, size_t(G.n*G.n));
+}
+
+// another process takes the odd rows: their blocks must not be read ahead,
+// and read-ahead must not stop once the cache is full
+BOOST_AUTO_TEST_CASE(read_ahead_claimed) {
+    MockGrid G(16, 4);
+    MockVector C, S;
+    init(G, C);
+    size_t capacity = (G.n*G.n/4)*G.block*G.block*sizeof(double);
+    size_t gets = run(G, C, S, 2, 2, capacity);
+    BOOST_TEST_MESSAGE("C reads: " << C.nreads() << ", C get(): " << gets);
+    BOOST_CHECK(C.nreads() < gets/4);
+    // blocks (odd,odd) are used only by the other process' tasks
+    for (int a = 1; a < G.n; a += 2) {
+        for (int b = 1; b < G.n; b += 2) {
+            Key k(*G.alpha(a).begin(), *G.beta(b).begin());
+            BOOST_CHECK_EQUAL(C.reads[k], size_t(0));
+        }
+    }
+}
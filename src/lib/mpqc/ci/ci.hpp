@@ -33,6 +33,7 @@ namespace ci {
         double convergence; //!< energy convergence criteria
         size_t block;       //!< CI matrix blocking factor (values 1024 to 8192 are ok)
         int incore;         //!< determines if arrays C+S (2), C (1), or none(0) will be in core
+        size_t cache;       //!< memory (in bytes) for caching blocks of each out-of-core array
         struct {
             int chunk;    //!< HDF5 chunking (should be about 256k)
             int compress; //!< GZIP compress level (0 to 9)
@@ -53,6 +54,7 @@ namespace ci {
             convergence = 1e-10;
             block = 1024*4;
             incore = 2;
+            cache = 256*1024*1024;
             hdf5.chunk = 0;
             hdf5.compress = 0;            
             hdf5.direct = false;
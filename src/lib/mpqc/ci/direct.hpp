@@ -90,6 +90,9 @@ namespace ci {
 
         comm.barrier();
 
+        // excitation lists are the same in every iteration
+        const ExcitationsCache excitations(ci);
+
         std::vector<double> E;
 
         for (size_t it = 0;; ++it) {
@@ -110,7 +113,7 @@ namespace ci {
                 read(C, ci.vector.b[it], ci.local());
                 C.sync();
 
-                sigma(ci, h, V, C, D);
+                sigma(ci, h, V, C, D, excitations);
                 D.sync();
 
                 // write local segments of D to Hb(it)
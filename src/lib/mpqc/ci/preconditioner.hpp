@@ -43,7 +43,7 @@ namespace ci {
 
         std::unique_ptr<MPI::Task> task;
 
-        task.reset(new MPI::Task(comm));
+        task.reset(new MPI::Task(comm, MPI::Task::chunk(comm, blocks.size())));
 #pragma omp parallel
         while (true) {
 
@@ -81,7 +81,7 @@ namespace ci {
         double phase = 1.0;
         double scale = 1.0/sqrt(dd);
 
-        task.reset(new MPI::Task(comm));
+        task.reset(new MPI::Task(comm, MPI::Task::chunk(comm, blocks.size())));
 #pragma omp parallel
         while (true) {
 
@@ -5,15 +5,18 @@
 #include "mpqc/ci/string.hpp"
 #include "mpqc/ci/sigma2.hpp"
 #include "mpqc/ci/sigma3.hpp"
+#include "mpqc/ci/cache.hpp"
 #include "mpqc/ci/vector.hpp"
 
 #include "mpqc/utility/timer.hpp"
+#include "mpqc/omp.hpp"
 #include "mpqc/range.hpp"
 #include "mpqc/math/matrix.hpp"
 #include "mpqc/mpi.hpp"
 #include "mpqc/mpi/task.hpp"
 
 #include "mpqc/utility/profile.hpp"
+#include <util/misc/regtime.h>
 
 namespace mpqc {
 namespace ci {
@@ -21,15 +24,30 @@ namespace ci {
     /// @addtogroup CI
     /// @{
 
+    /// Returns a timer for the calling thread, to be merged into the default
+    /// sc::RegionTimer with sigma_merge_timer, or null if there is none
+    inline sc::Ref<sc::RegionTimer> sigma_thread_timer() {
+        sc::RegionTimer *regtimer = sc::RegionTimer::default_regiontimer();
+        if (!regtimer) return sc::Ref<sc::RegionTimer>();
+        return regtimer->new_thread_timer();
+    }
+
+    inline void sigma_merge_timer(const sc::Ref<sc::RegionTimer> &timer) {
+        if (timer.null()) return;
+        sc::RegionTimer::default_regiontimer()->merge_thread(timer, omp::thread_num());
+    }
+
     /// Computes sigma 1,2,3 contributions
     /// @param h one-electron MO integrals (packed symmetric)
     /// @param V two-electron MO integrals (packed symmetric)
     /// @param[in] C C vector
     /// @param[out] S Sigma vector
+    /// @param excitations excitation lists of ci, see ExcitationsCache
     template<class Type, class Index>
     void sigma(const CI<Type, Index> &ci,
                const mpqc::Vector &h, const Matrix &V,
-               ci::Vector &C, ci::Vector &S) {
+               ci::Vector &C, ci::Vector &S,
+               const ExcitationsCache &excitations) {
 
         struct { double s1, s2, s3; timer t; } time = { };
 
@@ -51,14 +69,64 @@ namespace ci {
         const std::vector< Subspace<Beta> > &beta = ci.subspace.beta();
         const auto &blocks = ci::blocks(alpha, beta);
 
+        // C blocks read by sigma1 and sigma2 for task
+        auto sigma12_blocks = [&](size_t task, std::vector<BlockCache::Block> &c) {
+            const SubspaceBlock &next = blocks.at(task);
+            auto Ia = alpha.at(next.alpha);
+            auto Ib = beta.at(next.beta);
+            if (!ci.test(Ia,Ib)) return;
+            for (int jb = 0; jb < beta.size(); ++jb) {
+                if (!ci.test(Ia,beta[jb]) || ci.diff(Ib,beta[jb]) > 2) continue;
+                c.push_back(BlockCache::Block(next.alpha, jb));
+            }
+            if (ci.config.ms == 0) return;
+            for (int ja = 0; ja < alpha.size(); ++ja) {
+                if (!ci.test(alpha[ja],Ib) || ci.diff(Ia,alpha[ja]) > 2) continue;
+                c.push_back(BlockCache::Block(ja, next.beta));
+            }
+        };
+
+        // C blocks read by sigma3, and S blocks updated, for task
+        auto sigma3_blocks = [&](size_t task, std::vector<BlockCache::Block> &c,
+                                 std::vector<BlockCache::Block> &s) {
+            const SubspaceBlock &next = blocks.at(task);
+            if (ci.config.ms == 0 && next.alpha > next.beta) return;
+            if (!ci.test(alpha.at(next.alpha), beta.at(next.beta))) return;
+            s.push_back(BlockCache::Block(next.alpha, next.beta));
+            if (ci.config.ms == 0 && next.alpha != next.beta)
+                s.push_back(BlockCache::Block(next.beta, next.alpha));
+            const std::vector< Excitations<Beta> > &BB = excitations.beta(next.beta);
+            const std::vector< Excitations<Alpha> > &AA = excitations.alpha(next.alpha);
+            for (int jb = 0; jb < BB.size(); ++jb) {
+                if (!BB[jb].size()) continue;
+                for (int ja = 0; ja < AA.size(); ++ja) {
+                    if (!AA[ja].size() || !ci.test(alpha[ja],beta[jb])) continue;
+                    c.push_back(BlockCache::Block(ja, jb));
+                }
+            }
+        };
+
+        // out-of-core vectors are accessed through caches that read blocks
+        // ahead of the task order and write S blocks back asynchronously
+        BlockCache CC(C, ci.subspace, C.incore() ? 0 : ci.config.cache);
+        BlockCache SC(S, ci.subspace, S.incore() ? 0 : ci.config.cache);
+
         std::unique_ptr<MPI::Task> task;
 
-        task.reset(new MPI::Task(comm));
+        // each thread times its regions in its own tree; the reported
+        // sigma times are those of the slowest thread
+        task.reset(new MPI::Task(comm, MPI::Task::chunk(comm, blocks.size())));
+        CC.prefetch(sigma12_blocks, blocks.size());
 #pragma omp parallel
+        {
+        sc::Ref<sc::RegionTimer> thread_timer = sigma_thread_timer();
+        double s1 = 0, s2 = 0;
         while (true) {
 
-            auto next = task->next(blocks.begin(), blocks.end());
+            auto claimed = blocks.end();
+            auto next = task->next(blocks.begin(), blocks.end(), claimed);
             if (next == blocks.end()) break;
+            CC.advance(next - blocks.begin(), claimed - blocks.begin());
 
             auto Ia = alpha.at(next->alpha);
             auto Ib = beta.at(next->beta);
@@ -67,46 +135,73 @@ namespace ci {
             Matrix s = Matrix::Zero(Ia.size(), Ib.size()); //S(Ia, Ib);
 
             // sigma1
-            foreach (auto Jb, beta) {
+            sc::Timer tim(thread_timer, "sigma1");
+            for (int jb = 0; jb < beta.size(); ++jb) {
                 MPQC_PROFILE_LINE;
+                auto Jb = beta[jb];
                 // only single and double excitations are allowed
                 if (!ci.test(Ia,Jb) || ci.diff(Ib,Jb) > 2) continue;
-                Matrix c = C(Ia,Jb);
+                BlockCache::Data c = CC.get(next->alpha, jb);
                 timer t;
-                sigma12(ci, Ib, Jb, H, V, c, s);
-#pragma omp master
-                time.s1 += t;
+                sigma12(ci, Ib, Jb, H, V, *c, s);
+                s1 += t;
             }
+            tim.exit();
 
             // with ms == 0 symmetry, S is symmetrized in sigma3 step
             if (ci.config.ms == 0) goto end;
 
             // sigma2, need to transpose s, c
+            tim.enter("sigma2");
             s = Matrix(s.transpose());
-            foreach (auto Ja, alpha) {
+            for (int ja = 0; ja < alpha.size(); ++ja) {
                 MPQC_PROFILE_LINE;
+                auto Ja = alpha[ja];
                 if (!ci.test(Ja,Ib) || ci.diff(Ia,Ja) > 2) continue;
-                Matrix c = Matrix(C(Ja,Ib)).transpose();
+                Matrix c = CC.get(ja, next->beta)->transpose();
                 timer t;
                 sigma12(ci, Ia, Ja, H, V, c, s);
-                time.s2 += t;
+                s2 += t;
             }
             s = Matrix(s.transpose());
+            tim.exit();
 
         end:
             //s = Matrix::Random(Ia.size(), Ib.size());
-            S(Ia,Ib) = s;
+            SC.put(next->alpha, next->beta, s);
 
         }
+        sigma_merge_timer(thread_timer);
+#pragma omp critical(mpqc_ci_sigma_time)
+        {
+            time.s1 = std::max(time.s1, s1);
+            time.s2 = std::max(time.s2, s2);
+        }
+        }
 
-        task.reset(new MPI::Task(comm));
+        // S blocks must be in S before other processes read them
+        SC.flush();
+
+        task.reset(new MPI::Task(comm, MPI::Task::chunk(comm, blocks.size())));
+        CC.prefetch([&](size_t task, std::vector<BlockCache::Block> &c) {
+            std::vector<BlockCache::Block> s;
+            sigma3_blocks(task, c, s);
+        }, blocks.size());
+        SC.prefetch([&](size_t task, std::vector<BlockCache::Block> &s) {
+            std::vector<BlockCache::Block> c;
+            sigma3_blocks(task, c, s);
+        }, blocks.size());
 #pragma omp parallel
+        {
+        sc::Ref<sc::RegionTimer> thread_timer = sigma_thread_timer();
+        double s3 = 0;
         while (true) {
 
-            timer t;
-
-            auto next = task->next(blocks.begin(), blocks.end());
+            auto claimed = blocks.end();
+            auto next = task->next(blocks.begin(), blocks.end(), claimed);
             if (next == blocks.end()) break;
+            CC.advance(next - blocks.begin(), claimed - blocks.begin());
+            SC.advance(next - blocks.begin(), claimed - blocks.begin());
 
             if (ci.config.ms == 0 && next->alpha > next->beta) continue;
 
@@ -115,59 +210,58 @@ namespace ci {
             if (!ci.test(Ia,Ib)) continue;
 
             // excitations from Ib into each Jb subspace
-            std::vector< Excitations<Beta> > BB;
-            foreach (auto Jb, beta) {
-                MPQC_PROFILE_LINE;
-                BB.push_back(Excitations<Beta>(ci, Ib, Jb));
-            }
+            const std::vector< Excitations<Beta> > &BB = excitations.beta(next->beta);
 
             // excitations from Ia into each Ja subspace
-            std::vector< Excitations<Alpha> > AA;
-            foreach (auto Ja, alpha) {
-                MPQC_PROFILE_LINE;
-                AA.push_back(Excitations<Alpha>(ci, Ia, Ja));
-            }
-            
-            Matrix s = S(Ia,Ib);
+            const std::vector< Excitations<Alpha> > &AA = excitations.alpha(next->alpha);
+
+            Matrix s = *SC.get(next->alpha, next->beta);
+
+            sc::Timer tim(thread_timer, "sigma3");
 
             // if symmetric CI, symmetrize diagonal block
             if (ci.config.ms == 0 && next->alpha == next->beta) 
                 s += Matrix(s).transpose();
 
-            for (auto bb = BB.begin(); bb != BB.end(); ++bb) {
+            for (int jb = 0; jb < BB.size(); ++jb) {
                 MPQC_PROFILE_LINE;
-                if (!bb->size()) continue; // no beta excitations
-                auto Jb = bb->J();
-                for (auto aa = AA.begin(); aa != AA.end(); ++aa) {
-                    if (!aa->size()) continue; // no alpha excitations
-                    auto Ja = aa->J();
-                    if (!ci.test(Ja,Jb)) continue; // forbidden block
-                    Matrix c = C(Ja,Jb);
+                const Excitations<Beta> &bb = BB[jb];
+                if (!bb.size()) continue; // no beta excitations
+                for (int ja = 0; ja < AA.size(); ++ja) {
+                    const Excitations<Alpha> &aa = AA[ja];
+                    if (!aa.size()) continue; // no alpha excitations
+                    if (!ci.test(aa.J(),bb.J())) continue; // forbidden block
+                    BlockCache::Data c = CC.get(ja, jb);
                     timer t;
-                    sigma3(*aa, *bb, V, c, s);
-#pragma omp master
-                    time.s3 += t;
+                    sigma3(aa, bb, V, *c, s);
+                    s3 += t;
                 }
             }
-            
+            tim.exit();
+
             //s = Matrix::Random(Ia.size(), Ib.size());
 
             // if symmetric CI, symmetrize off-diagonal blocks S(Ia,Ib) and S(Ib,Ia)
             if (ci.config.ms == 0 && next->alpha != next->beta) {
                 MPQC_PROFILE_LINE;
-                Matrix t = S(Ib,Ia);
+                Matrix t = *SC.get(next->beta, next->alpha);
                 t += s.transpose();
                 s = t.transpose();
-                S(Ib,Ia) = t;
+                SC.put(next->beta, next->alpha, t);
             }
 
             {
                 MPQC_PROFILE_LINE;
-                S(Ia,Ib) = s;
+                SC.put(next->alpha, next->beta, s);
             }
             
         }
+        sigma_merge_timer(thread_timer);
+#pragma omp critical(mpqc_ci_sigma_time)
+        time.s3 = std::max(time.s3, s3);
+        }
 
+        SC.flush();
         S.sync();
 
         sc::ExEnv::out0() << sc::indent << "sigma took " << double(time.t) << std::endl;
@@ -178,6 +272,16 @@ namespace ci {
 
     }
 
+    /// Computes sigma 1,2,3 contributions,
+    /// building the excitation lists for this call only
+    template<class Type, class Index>
+    void sigma(const CI<Type, Index> &ci,
+               const mpqc::Vector &h, const Matrix &V,
+               ci::Vector &C, ci::Vector &S) {
+        ExcitationsCache excitations(ci);
+        sigma(ci, h, V, C, S, excitations);
+    }
+
     /// @}
 
 }
@@ -13,7 +13,8 @@
 #include "mpqc/array.hpp"
 #include "mpqc/array/functions.hpp"
 
-#include <boost/type_traits/is_same.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace mpqc {
 namespace ci {
@@ -88,12 +89,46 @@ namespace ci {
         Subspace<Spin> I_, J_;
     };
 
-#define MPQC_CI_SIGMA3_NAIVE
+    /// Excitations between all pairs of alpha and all pairs of beta subspaces.
+    /// The lists depend only on the CI space, so they are built once
+    /// and shared by all sigma evaluations (and threads).
+    struct ExcitationsCache {
+        template<class CI>
+        explicit ExcitationsCache(const CI &ci) {
+            build(ci, ci.subspace.alpha(), alpha_);
+            build(ci, ci.subspace.beta(), beta_);
+        }
+        /// Excitations from alpha subspace I into each alpha subspace
+        const std::vector< Excitations<Alpha> >& alpha(int I) const {
+            return alpha_.at(I);
+        }
+        /// Excitations from beta subspace I into each beta subspace
+        const std::vector< Excitations<Beta> >& beta(int I) const {
+            return beta_.at(I);
+        }
+    private:
+        std::vector< std::vector< Excitations<Alpha> > > alpha_;
+        std::vector< std::vector< Excitations<Beta> > > beta_;
+        template<class CI, class Spin>
+        static void build(const CI &ci,
+                          const std::vector< Subspace<Spin> > &S,
+                          std::vector< std::vector< Excitations<Spin> > > &E) {
+            E.resize(S.size());
+#pragma omp parallel for schedule(dynamic)
+            for (int i = 0; i < (int)S.size(); ++i) {
+                E[i].reserve(S.size());
+                foreach (auto J, S) {
+                    E[i].push_back(Excitations<Spin>(ci, S[i], J));
+                }
+            }
+        }
+    };
+
 #ifdef MPQC_CI_SIGMA3_NAIVE
 
     /// Naive non-vectorizable sigma3 kernel
-    void sigma3(const Excitations<Alpha> &alpha, const Excitations<Beta> &beta,
-                const Matrix &V, const Matrix &C, Matrix &S) {                
+    inline void sigma3(const Excitations<Alpha> &alpha, const Excitations<Beta> &beta,
+                       const Matrix &V, const Matrix &C, Matrix &S) {
         // beta->beta excitations
         foreach (auto b, beta) {
             // alpha->alpha excitations
@@ -111,69 +146,92 @@ namespace ci {
 
 #else // MPQC_CI_SIGMA3_NAIVE
 
-    /// Compute s = phase*v*c
-    void sigma3(int n, double phase,
-                const double * RESTRICT v,
-                const double * RESTRICT c,
-                double * RESTRICT s) {
-        for (int i = 0; i < n; ++i) {
-            s[i] += phase*c[i]*v[i];
-        }
-    }
-
-    /// Compute s = phase*v*c
-    template<class V, class C, class S>
-    void sigma3(int n, double phase, const V &v, const C &c, S &s) {
-        sigma3(n, phase, v.data(), c.data(), s.data());
-        // for (int i = 0; i < n; ++i) {
-        //     s[i] += phase*c[i]*v[i];
-        // }
-    }
-
-    /// Vectorized sigma3 kernel
+    /// Vectorized sigma3 kernel, S(Ia,Ib) += sgn(a)*sgn(b)*V(ij,kl)*C(Ja,Jb).
+    /// C columns are gathered by beta excitation into E(Ja*Ib,kl),
+    /// contracted with V(kl,ij) by dgemm, and the result is
+    /// scatter-added into S by alpha excitation.
+    /// Only the ij/kl integral indices present in the excitations take part,
+    /// Ja is processed in blocks to bound the size of the intermediates.
     /// @param A Ia->Ja excitations
     /// @param B Ib->Jb excitations
     /// @param V V(ij,kl)
     /// @param C C(Ja,Jb) block
     /// @param S S(Ia,Ib) block
-    /// @param mutex mutex to lock S updates
-    template<class SpinA, class SpinB>
-    void sigma3(const Excitations<SpinA> &A, const Excitations<SpinB> &B,
-                const Matrix &V, const Matrix &C, Matrix &S) {
-        static_assert(!boost::is_same<SpinA,SpinB>::value, "spins must not be the same");
-        const int BLOCK = 128;
-        mpqc::Matrix c, v;
-        mpqc::Vector s;
-        std::vector<int> Ia;
-        // iterate over A excitations in blocks
-        for (int ba = 0; ba < A.size(); ba += BLOCK) {
-            int na = std::min<int>(A.size() - ba, BLOCK);
-            c.resize(na, C.cols());
-            v.resize(na, V.cols());
-            Ia.clear();
-            /// pack the Ia->Ja dimension
-            for (int a = 0; a < na; ++a) {
-                auto aa = A[a+ba];
-                c.row(a) = C.row(aa.J - *A.J().begin());
-                v.row(a) = V.col(aa.integral);
-                v.row(a) *= aa.sgn;
-                Ia.push_back(aa.I - *A.I().begin()); // record Ia index
+    inline void sigma3(const Excitations<Alpha> &A, const Excitations<Beta> &B,
+                       const Matrix &V, const Matrix &C, Matrix &S) {
+        if (!A.size() || !B.size()) return;
+
+        const int Ia0 = *A.I().begin(), Ja0 = *A.J().begin();
+        const int Ib0 = *B.I().begin(), Jb0 = *B.J().begin();
+        const int nJa = C.rows();
+        const int nIb = S.cols();
+
+        // compress integral indices to those present in the excitations
+        std::vector<int> map(V.rows(), -1);
+        std::vector<int> kl, bk(B.size());
+        for (size_t b = 0; b < B.size(); ++b) {
+            int &k = map[B[b].integral];
+            if (k < 0) {
+                k = kl.size();
+                kl.push_back(B[b].integral);
+            }
+            bk[b] = k;
+        }
+        std::fill(map.begin(), map.end(), -1);
+        std::vector<int> ij, ai(A.size());
+        for (size_t a = 0; a < A.size(); ++a) {
+            int &i = map[A[a].integral];
+            if (i < 0) {
+                i = ij.size();
+                ij.push_back(A[a].integral);
+            }
+            ai[a] = i;
+        }
+        const int nk = kl.size();
+        const int ni = ij.size();
+
+        Matrix v(nk, ni);
+        for (int i = 0; i < ni; ++i) {
+            for (int k = 0; k < nk; ++k) {
+                v(k,i) = V(ij[i], kl[k]);
+            }
+        }
+
+        // alpha excitations ordered by Ja, to be split by Ja block
+        std::vector<int> order(A.size());
+        for (size_t a = 0; a < A.size(); ++a) order[a] = a;
+        std::stable_sort(order.begin(), order.end(),
+                         [&A](int a, int b) { return A[a].J < A[b].J; });
+
+        // Ja block size, intermediates are bounded to ~2 MB each
+        const int block = std::max(1, std::min(nJa, (1 << 18)/(nIb*std::max(nk,ni))));
+
+        Matrix c, e;
+        auto next = order.begin();
+        for (int ja = 0; ja < nJa; ja += block) {
+            const int n = std::min(block, nJa - ja);
+            auto first = next;
+            while (next != order.end() && A[*next].J - Ja0 < ja + n) ++next;
+            if (first == next) continue; // no alpha excitations into this block
+
+            // gather c(Ja + n*Ib, kl) += sgn(b)*C(Ja,Jb)
+            c = Matrix::Zero(n*nIb, nk);
+            for (size_t b = 0; b < B.size(); ++b) {
+                const Excitation &x = B[b];
+                c.col(bk[b]).segment(n*(x.I - Ib0), n) +=
+                    x.sgn*C.col(x.J - Jb0).segment(ja, n);
             }
-            s = mpqc::Vector::Zero(na);
-            for (auto b = B.begin(); b != B.end(); ++b) {
-                int Ib = b->I - *B.I().begin();
-                int Jb = b->J - *B.J().begin();
-                // vectorized s += sgn(Ib,Jb)*v*c
-                sigma3(na, b->sgn, v.col(b->integral), c.col(Jb), s);
-                // next iteration updates same Ib
-                if ((b+1) != B.end() && (b+1)->I == (b)->I) continue;
-                // scatter
-                //mutex.lock();
-                for (int a = 0; a < Ia.size(); ++a) {
-                    S(Ia[a], Ib) += s(a);
-                    s(a) = 0;
+
+            // e(Ja + n*Ib, ij) = c(Ja + n*Ib, kl)*V(kl,ij)
+            e.noalias() = c*v;
+
+            // scatter S(Ia,Ib) += sgn(a)*e(Ja + n*Ib, ij)
+            for (int Ib = 0; Ib < nIb; ++Ib) {
+                double *s = S.col(Ib).data();
+                for (auto it = first; it != next; ++it) {
+                    const Excitation &x = A[*it];
+                    s[x.I - Ia0] += x.sgn*e(x.J - Ja0 - ja + n*Ib, ai[*it]);
                 }
-                //mutex.unlock();
             }
         }
     }
@@ -22,7 +22,9 @@ namespace ci {
         /// @param G vector grid (blocking and sparsity)
         /// @param comm MPI communicator
         /// @param incore store vector in core (incore=true) or in file
-        Vector(std::string name, const SubspaceGrid &G, MPI::Comm comm, bool incore) {
+        Vector(std::string name, const SubspaceGrid &G, MPI::Comm comm, bool incore)
+            : incore_(incore)
+        {
             blocks_.resize(G.alpha().size(), G.beta().size());
             size_t dets = 0;
             for (size_t j = 0; j < G.beta().size(); ++j) {
@@ -101,6 +103,11 @@ namespace ci {
             this->array_.sync();
         }
 
+        /// Returns true if the vector is stored in core
+        bool incore() const {
+            return incore_;
+        }
+
     private:
 
         struct Block {
@@ -116,6 +123,7 @@ namespace ci {
         std::vector<mpqc::range> beta_;
         mpqc::Array<double> array_;
         mpqc::matrix<Block> blocks_;
+        bool incore_;
 
     private:
 
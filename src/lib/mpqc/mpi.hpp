@@ -10,7 +10,7 @@
 #include "mpqc/mpi/base.hpp"
 #include "mpqc/mpi/comm.hpp"
 
-// N.B. may require ARMCI
+// N.B. requires MPI-3 RMA or ARMCI if using MPI
 //#include "mpqc/mpi/task.hpp"
 
 #endif // MPQC_MPI_HPP
@@ -2,33 +2,52 @@
 #define MPQC_MPI_TASK_HPP
 
 #include "mpqc/mpi.hpp"
+#include "mpqc/range.hpp"
 #include "mpqc/utility/mutex.hpp"
 
-#ifdef HAVE_ARMCI
+#include <iterator>
+#include <algorithm>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+
+#if (defined HAVE_MPI) && (MPI_VERSION >= 3)
+#define MPQC_MPI_TASK_RMA
+#elif (defined HAVE_MPI) && (defined HAVE_ARMCI)
+#define MPQC_MPI_TASK_ARMCI
 extern "C" {
 #include <armci.h>
 }
-#endif
-
-#if (defined HAVE_MPI) && !(defined HAVE_ARMCI)
-#error mpqc::MPI::Task requires ARMCI if using MPI
+#elif (defined HAVE_MPI)
+#error mpqc::MPI::Task requires MPI-3 or ARMCI if using MPI
 #endif
 
 namespace mpqc {
 namespace MPI {
 
-    /// Distributed task
+    /// Distributed task counter.
+    /// The counter lives on rank 0 of the communicator and is advanced
+    /// with MPI-3 RMA fetch-and-op (or ARMCI read-modify-write if MPI-3 is not available).
+    /// Each process takes a chunk of consecutive tasks per remote update,
+    /// and hands them out to its threads locally.
+    /// The communicator can be any communicator, not only MPI_COMM_WORLD.
     /// @ingroup CoreMPI
     struct Task : boost::noncopyable {
 
         typedef int T;
 
-        /// Construct new task
+        /// Construct new task, collective over comm
+        /// @param chunk number of tasks taken per remote update
         /// @warning NOT threadsafe
-        explicit Task(const MPI::Comm &comm)
-            : comm_(comm), data_(0)
+        explicit Task(const MPI::Comm &comm, int chunk = 1)
+            : comm_(comm), chunk_(std::max(chunk, 1))
         {
-#ifdef HAVE_ARMCI
+#if defined MPQC_MPI_TASK_RMA
+            {
+                MPQC_MPI_THREADSAFE;
+                MPI_Aint size = (comm_.rank() == 0) ? sizeof(T) : 0;
+                MPI_Win_allocate(size, sizeof(T), MPI_INFO_NULL, comm_, &data_, &win_);
+            }
+#elif defined MPQC_MPI_TASK_ARMCI
             MPQC_ASSERT(comm == MPI_COMM_WORLD);
             ARMCI_Init();
             data_.resize(comm_.size());
@@ -37,64 +56,130 @@ namespace MPI {
             reset(0);
         }
 
-        /// Destructor
+        /// Returns a chunk size for ntask tasks that gives each process
+        /// about k chunks: few enough remote updates, while the last
+        /// chunks are still small enough to balance the load
+        static int chunk(const MPI::Comm &comm, size_t ntask, int k = 8) {
+            return std::max<size_t>(ntask/(size_t(k)*comm.size()), 1);
+        }
+
+        /// Destructor, collective over comm
         /// @warning NOT threadsafe
         ~Task() {
-#ifdef HAVE_ARMCI
+#if defined MPQC_MPI_TASK_RMA
+            MPQC_MPI_THREADSAFE;
+            MPI_Win_free(&win_);
+#elif defined MPQC_MPI_TASK_ARMCI
             ARMCI_Free(data_[comm_.rank()]);
 #endif
         }
 
-        /// Reset task
+        /// Reset task, collective over comm
         void reset(const T &value = T(0)) {
+            boost::lock_guard<boost::mutex> lock(mutex_);
+#if defined MPQC_MPI_TASK_RMA
+            comm_.barrier();
+            if (comm_.rank() == 0) {
+                MPQC_MPI_THREADSAFE;
+                MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, win_);
+                *data_ = value;
+                MPI_Win_unlock(0, win_);
+            }
+            comm_.barrier();
+#elif defined MPQC_MPI_TASK_ARMCI
             mutex::global::lock();
-#ifdef HAVE_ARMCI
             comm_.barrier();
             if (comm_.rank() == 0) {
                 ARMCI_PutValueInt(value, this->value(), 0);
                 ARMCI_Fence(0);
             }
             comm_.barrier();
+            mutex::global::unlock();
 #else
-            data_ = 0;
+            data_ = value;
 #endif
-            mutex::global::unlock();
+            next_ = end_ = value;
         }
 
         /// Get next task
         T operator++(int) {
-            int next;
-            mutex::global::lock();
-#ifdef HAVE_ARMCI
-            ARMCI_Rmw(ARMCI_FETCH_AND_ADD, &next, this->value(), 1, 0);
-#else
-            next = this->data_++;
-#endif
-            mutex::global::unlock();
-            return next;
+            T end;
+            return next(end);
+        }
+
+        /// Get next task, and the end of the chunk it was taken from:
+        /// tasks [task,end) are all taken by this process
+        T next(T &end) {
+            boost::lock_guard<boost::mutex> lock(mutex_);
+            if (next_ == end_) {
+                next_ = fetch_add(chunk_);
+                end_ = next_ + chunk_;
+            }
+            end = end_;
+            return next_++;
         }
 
         /// Get next task range
-        mpqc::range next(range r, int block = 1) {            
+        mpqc::range next(range r, int block = 1) {
             int i = block*((*this)++);
             return (r & mpqc::range(i, i+block));
         }
 
+        /// Get next task iterator in [begin,end), or end if all tasks are taken.
+        /// Constant time for random access iterators
         template<typename Iterator>
         Iterator next(Iterator begin, Iterator end) {
-            Iterator it = begin;
-            int n = (*this)++;
-            for (int i = 0; i < n; ++i) {
-                if (it == end) break;
-                ++it;
-            }
-            return it;
+            T n = (*this)++;
+            if (n >= std::distance(begin, end)) return end;
+            std::advance(begin, n);
+            return begin;
+        }
+
+        /// Get next task iterator in [begin,end), or end if all tasks are taken.
+        /// Sets claimed to the end of the chunk the task was taken from (at most end),
+        /// i.e. tasks [task,claimed) are all taken by this process
+        template<typename Iterator>
+        Iterator next(Iterator begin, Iterator end, Iterator &claimed) {
+            T last;
+            T n = next(last);
+            T size = std::distance(begin, end);
+            claimed = begin;
+            std::advance(claimed, std::min(last, size));
+            if (n >= size) return end;
+            std::advance(begin, n);
+            return begin;
         }
 
     private:
 
         MPI::Comm comm_;
-#ifdef HAVE_ARMCI
+        int chunk_;
+        boost::mutex mutex_;  // guards next_, end_
+        T next_, end_;        // tasks taken by this process but not yet handed out
+
+        /// Adds n to the counter on rank 0, returns the previous value
+        T fetch_add(T n) {
+            T value;
+#if defined MPQC_MPI_TASK_RMA
+            MPQC_MPI_THREADSAFE;
+            MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, win_);
+            MPI_Fetch_and_op(&n, &value, MPI_INT, 0, 0, MPI_SUM, win_);
+            MPI_Win_unlock(0, win_);
+#elif defined MPQC_MPI_TASK_ARMCI
+            mutex::global::lock();
+            ARMCI_Rmw(ARMCI_FETCH_AND_ADD, &value, this->value(), n, 0);
+            mutex::global::unlock();
+#else
+            value = data_;
+            data_ += n;
+#endif
+            return value;
+        }
+
+#if defined MPQC_MPI_TASK_RMA
+        MPI_Win win_;
+        T* data_;
+#elif defined MPQC_MPI_TASK_ARMCI
         std::vector< void* > data_;
         T* value() {
             return (T*)data_[0];
@@ -23,6 +23,14 @@ namespace omp {
 #endif
     };
 
+    inline int thread_num() {
+#ifndef _OPENMP
+        return 0;
+#else
+        return omp_get_thread_num();
+#endif
+    };
+
     template <typename T>
     struct task : boost::noncopyable {
         task() : value_() {}
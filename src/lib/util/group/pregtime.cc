@@ -29,6 +29,7 @@
 #  include <mpqc_config.h>
 #endif
 
+#include <float.h>
 #include <iostream>
 #include <iomanip>
 
@@ -238,6 +239,32 @@ ParallelRegionTimer::print(ostream &o) const
         }
     }
 
+  // the wall times of the threads on all nodes
+  double *thr_min = 0;
+  double *thr_max = 0;
+  double *thr_avg = 0;
+  double *thr_n = 0;
+  int have_thread_times = (wall_time_ && has_thread_times());
+  msg_->max(have_thread_times);
+  if (have_thread_times) {
+      thr_min = new double[n];
+      thr_max = new double[n];
+      thr_avg = new double[n];
+      thr_n = new double[n];
+      get_thread_wall_times(thr_min, thr_max, thr_avg, thr_n);
+      for (i=0; i<n; i++) {
+          if (thr_n[i] == 0.0) thr_min[i] = DBL_MAX;
+        }
+      msg_->min(thr_min,n);
+      msg_->max(thr_max,n);
+      msg_->sum(thr_avg,n);
+      msg_->sum(thr_n,n);
+      for (i=0; i<n; i++) {
+          if (thr_n[i] > 0.0) thr_avg[i] /= thr_n[i];
+          else thr_min[i] = 0.0;
+        }
+    }
+
   if (msg_->me() == 0) {
       const char **names = new const char*[n];
       get_region_names(names);
@@ -255,6 +282,8 @@ ParallelRegionTimer::print(ostream &o) const
               maxtime = max_wall_time[i];
           if (flops_ && max_flops[i] > maxtime)
               maxtime = max_flops[i];
+          if (thr_n && thr_max[i] > maxtime)
+              maxtime = thr_max[i];
         }
 
       int maxtimewidth = 4;
@@ -278,6 +307,11 @@ ParallelRegionTimer::print(ostream &o) const
           o << " " << setw(maxtimewidth+1) << flops_name;
           o << setw(maxtimewidth+1) << " ";
         }
+      if (thr_n) {
+          o << setw(maxtimewidth+1) << " ";
+          o << setw(maxtimewidth+1) << " Thr";
+          o << setw(maxtimewidth+1) << " ";
+        }
       o << endl;
 
       for (i=0; i<maxwidth; i++) o << " ";
@@ -296,6 +330,11 @@ ParallelRegionTimer::print(ostream &o) const
           o << setw(maxtimewidth+1) << " max";
           o << setw(maxtimewidth+1) << " avg";
         }
+      if (thr_n) {
+          o << setw(maxtimewidth+1) << " min";
+          o << setw(maxtimewidth+1) << " max";
+          o << setw(maxtimewidth+1) << " avg";
+        }
       o << endl;
 
       o.setf(ios::fixed);
@@ -320,6 +359,11 @@ ParallelRegionTimer::print(ostream &o) const
               o << " " << setw(maxtimewidth) << max_flops[i];
               o << " " << setw(maxtimewidth) << avg_flops[i];
             }
+          if (thr_n && thr_n[i] > 0.0) {
+              o << " " << setw(maxtimewidth) << thr_min[i];
+              o << " " << setw(maxtimewidth) << thr_max[i];
+              o << " " << setw(maxtimewidth) << thr_avg[i];
+            }
           o << endl;
         }
 
@@ -339,6 +383,10 @@ ParallelRegionTimer::print(ostream &o) const
   delete[] min_flops;
   delete[] max_flops;
   delete[] avg_flops;
+  delete[] thr_min;
+  delete[] thr_max;
+  delete[] thr_avg;
+  delete[] thr_n;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -51,14 +51,21 @@ class ThreadLock : public RefCount {
 
 /** Acquire a lock on creation and release it on destruction.
     This should be used to lock and unlock ThreadLock objects
-    to provide exception safety.
+    to provide exception safety.  The holder does not reference the
+    lock, which must outlive it, so that holding a lock does not touch
+    the lock's reference count from several threads.
  */
 class ThreadLockHolder {
-    Ref<ThreadLock> lock_;
+    ThreadLock *lock_;
     bool locked_;
   public:
     /// Acquires the lock.
-    ThreadLockHolder(const Ref<ThreadLock> &l): lock_(l) {
+    ThreadLockHolder(const Ref<ThreadLock> &l): lock_(l.pointer()) {
+      lock_->lock();
+      locked_ = true;
+    }
+    /// Acquires the lock.
+    ThreadLockHolder(ThreadLock *l): lock_(l) {
       lock_->lock();
       locked_ = true;
     }
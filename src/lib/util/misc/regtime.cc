@@ -60,6 +60,10 @@
 #define HAVE_CPU_TIME 1
 #endif //HAVE_NX
 
+#ifdef HAVE_PTHREAD
+#  include <pthread.h>
+#endif
+
 #ifdef HAVE_PERF
 #  define HAVE_FLOPS 1
 #else
@@ -145,10 +149,21 @@ TimedRegion::get_depth(int *depth, int current_depth)
     }
 }
 
+double
+TimedRegion::wall_time() const
+{
+  double result = wall_time_;
+  for (std::map<int,double>::const_iterator i = thread_wall_.begin();
+       i != thread_wall_.end(); i++) {
+      if (i->second > result) result = i->second;
+    }
+  return result;
+}
+
 void
 TimedRegion::get_wall_times(double *t)
 {
-  t[0] = wall_time_;
+  t[0] = wall_time();
   int n = 1;
   if (subregions_) while (subregions_->prev_) subregions_ = subregions_->prev_;
   for (TimedRegion *i = subregions_; i!=0; i=i->next_) {
@@ -169,6 +184,26 @@ TimedRegion::get_cpu_times(double *t)
     }
 }
 
+void
+TimedRegion::get_thread_wall_times(double *min, double *max, double *sum,
+                                   double *nthread)
+{
+  min[0] = max[0] = sum[0] = 0.0;
+  nthread[0] = thread_wall_.size();
+  for (std::map<int,double>::const_iterator i = thread_wall_.begin();
+       i != thread_wall_.end(); i++) {
+      if (i == thread_wall_.begin() || i->second < min[0]) min[0] = i->second;
+      if (i == thread_wall_.begin() || i->second > max[0]) max[0] = i->second;
+      sum[0] += i->second;
+    }
+  int n = 1;
+  if (subregions_) while (subregions_->prev_) subregions_ = subregions_->prev_;
+  for (TimedRegion *i = subregions_; i!=0; i=i->next_) {
+      i->get_thread_wall_times(min + n, max + n, sum + n, nthread + n);
+      n += i->nregion();
+    }
+}
+
 void
 TimedRegion::get_flops(double *t)
 {
@@ -293,6 +328,23 @@ TimedRegion::merge(const TimedRegion* r)
     }
 }
 
+void
+TimedRegion::merge_thread(const TimedRegion* r, int ithread)
+{
+  if (!r) return;
+
+  const TimedRegion *start = r;
+  while (start->prev_) start = start->prev_;
+  for (const TimedRegion *riter = start;
+       riter; riter = riter->next_) {
+      TimedRegion *subr = findinsubregion(riter->name());
+      subr->cpu_time_  += riter->cpu_time_;
+      subr->flops_     += riter->flops_;
+      subr->thread_wall_[ithread] += riter->wall_time_;
+      subr->merge_thread(riter->subregions_, ithread);
+    }
+}
+
 //////////////////////////////////////////////////////////////////////
 
 static ClassDesc RegionTimer_cd(
@@ -674,6 +726,21 @@ RegionTimer::print(ostream& o) const
         flops_name = "mflops";
         }
     }
+  // the wall times of the threads
+  double *thr_min = 0;
+  double *thr_max = 0;
+  double *thr_avg = 0;
+  double *thr_n = 0;
+  if (wall_time_ && has_thread_times()) {
+      thr_min = new double[n];
+      thr_max = new double[n];
+      thr_avg = new double[n];
+      thr_n = new double[n];
+      get_thread_wall_times(thr_min, thr_max, thr_avg, thr_n);
+      for (int i=0; i<n; i++) {
+          if (thr_n[i] > 0.0) thr_avg[i] /= thr_n[i];
+        }
+    }
   const char **names = new const char*[n];
   get_region_names(names);
   int *depth = new int[n];
@@ -684,12 +751,14 @@ RegionTimer::print(ostream& o) const
   double maxcputime = 0.0;
   double maxwalltime = 0.0;
   double maxflops = 0.0;
+  double maxthrtime = 0.0;
   for (i=0; i<n; i++) {
       int width = strlen(names[i]) + 2 * depth[i] + 2;
       if (width > maxwidth) maxwidth = width;
       if (cpu_time_ && cpu_time[i] > maxcputime) maxcputime = cpu_time[i];
       if (wall_time_ && wall_time[i] > maxwalltime) maxwalltime = wall_time[i];
       if (flops_ && flops[i] > maxflops) maxflops = flops[i];
+      if (thr_max && thr_max[i] > maxthrtime) maxthrtime = thr_max[i];
     }
 
   size_t maxwallwidth = 4;
@@ -704,11 +773,19 @@ RegionTimer::print(ostream& o) const
     if (maxflopswidth < strlen(flops_name)) maxflopswidth = strlen(flops_name);
     }
 
+  size_t maxthrwidth = 7;
+  while (maxthrtime >= 1000.0) { maxthrtime/=10.0; maxthrwidth++; }
+
   o.setf(ios::right);
   for (i=0; i<maxwidth; i++) o << " ";
   if (cpu_time_) o << " " << setw(maxcpuwidth) << "CPU";
   if (wall_time_) o << " " << setw(maxwallwidth) << "Wall";
   if (flops_) o << " " << setw(maxflopswidth) << flops_name;
+  if (thr_n) {
+      o << " " << setw(maxthrwidth) << "Thr min";
+      o << " " << setw(maxthrwidth) << "Thr max";
+      o << " " << setw(maxthrwidth) << "Thr avg";
+    }
   o << endl;
 
   o.setf(ios::fixed);
@@ -728,6 +805,11 @@ RegionTimer::print(ostream& o) const
       if (flops_) {
           o << " " << setw(maxflopswidth) << flops[i];
         }
+      if (thr_n && thr_n[i] > 0.0) {
+          o << " " << setw(maxthrwidth) << thr_min[i];
+          o << " " << setw(maxthrwidth) << thr_max[i];
+          o << " " << setw(maxthrwidth) << thr_avg[i];
+        }
       o << endl;
     }
   o.precision(oldprecision);
@@ -736,6 +818,10 @@ RegionTimer::print(ostream& o) const
   delete[] cpu_time;
   delete[] wall_time;
   delete[] flops;
+  delete[] thr_min;
+  delete[] thr_max;
+  delete[] thr_avg;
+  delete[] thr_n;
   delete[] names;
   delete[] depth;
 }
@@ -747,6 +833,55 @@ RegionTimer::merge(const Ref<RegionTimer> &r)
   current_->merge(r->top_);
 }
 
+Ref<RegionTimer>
+RegionTimer::new_thread_timer() const
+{
+  return new RegionTimer(top_->name(), 0, wall_time_);
+}
+
+#ifdef HAVE_PTHREAD
+static pthread_mutex_t merge_thread_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+void
+RegionTimer::merge_thread(const Ref<RegionTimer> &r, int ithread)
+{
+  r->update_top();
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&merge_thread_lock);
+#endif
+  // the top region of r is only a container for its subregions
+  current_->merge_thread(r->top_->subregions(), ithread);
+#ifdef HAVE_PTHREAD
+  pthread_mutex_unlock(&merge_thread_lock);
+#endif
+}
+
+bool
+RegionTimer::has_thread_times() const
+{
+  int n = nregion();
+  double *min = new double[n];
+  double *max = new double[n];
+  double *sum = new double[n];
+  double *nthread = new double[n];
+  get_thread_wall_times(min, max, sum, nthread);
+  bool result = false;
+  for (int i=0; i<n; i++) if (nthread[i] > 0.0) result = true;
+  delete[] min;
+  delete[] max;
+  delete[] sum;
+  delete[] nthread;
+  return result;
+}
+
+void
+RegionTimer::get_thread_wall_times(double *min, double *max, double *sum,
+                                   double *nthread) const
+{
+  top_->get_thread_wall_times(min, max, sum, nthread);
+}
+
 static Ref<RegionTimer> default_regtimer;
 
 RegionTimer *
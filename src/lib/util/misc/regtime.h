@@ -31,6 +31,7 @@
 #include <iostream>
 #include <string>
 #include <list>
+#include <map>
 #include <mpqc_config.h>
 #include <util/class/class.h>
 
@@ -50,6 +51,9 @@ class TimedRegion {
     double wall_enter_;
     double flops_;
     double flops_enter_;
+    // the wall time of each thread that timed this region, indexed by
+    // the thread number given to merge_thread
+    std::map<int,double> thread_wall_;
 
     TimedRegion *insert_after(const char *name);
     TimedRegion *insert_before(const char *name);
@@ -72,15 +76,23 @@ class TimedRegion {
     TimedRegion *next() const { return next_; }
     TimedRegion *prev() const { return prev_; }
 
-    /** reports the current values of cpu_time, wall_time, and flops  */
+    /** reports the current values of cpu_time, wall_time, and flops.
+        The threads merged in with merge_thread run concurrently, so the
+        wall time of a region they timed is that of the slowest one. */
     //@{
     double cpu_time() const { return cpu_time_; }
-    double wall_time() const { return wall_time_; }
+    double wall_time() const;
     double flops() const { return flops_; }
     //@}
 
     /// Include the regions in r in this object's regions.
     void merge(const TimedRegion* r);
+    /** Include the regions in r, which were timed by thread ithread,
+        in this object's regions, keeping the time of each thread.  CPU
+        times and flops are summed, wall times are not. */
+    void merge_thread(const TimedRegion* r, int ithread);
+    /// The number of threads that timed this region.
+    int nthread() const { return thread_wall_.size(); }
 
     int nregion();
     void get_region_names(const char *names[]);
@@ -88,12 +100,22 @@ class TimedRegion {
     void get_cpu_times(double *);
     void get_flops(double *);
     void get_depth(int *, int depth = 0);
+    /** Gives the minimum, maximum, and sum of the thread wall times, and
+        the number of threads, for each region. */
+    void get_thread_wall_times(double *min, double *max, double *sum,
+                               double *nthread);
 };
 
 /** The RegionTimer class is used to record the time spent in a section of
 code.  Except for the creation of an initial RegionTimer, this class should
 usually not be used directly.  Instead use the Timer class to control the
-RegionTimer in an exception safe manner. */
+RegionTimer in an exception safe manner.
+
+A RegionTimer is not thread-safe.  Threads time their regions with their
+own RegionTimer, obtained from new_thread_timer(), which is then included
+in the parent's current region with merge_thread().  The time of each
+thread is kept, so that print() can report the minimum, maximum, and
+average time of the threads. */
 class RegionTimer: public DescribedClass {
   protected:
     int wall_time_;
@@ -126,6 +148,14 @@ class RegionTimer: public DescribedClass {
     /// Include the regions in r in this object's regions.
     void merge(const Ref<RegionTimer> &r);
 
+    /** Returns a RegionTimer for use by a single thread.  It measures wall
+        time only, since CPU time is not available per thread. */
+    Ref<RegionTimer> new_thread_timer() const;
+    /** Include the regions in r, which was used by thread ithread, in this
+        object's current region.  Several threads may call this at the
+        same time, but this object must not otherwise be used meanwhile. */
+    void merge_thread(const Ref<RegionTimer> &r, int ithread);
+
     void update_top() const;
 
     int nregion() const;
@@ -134,6 +164,10 @@ class RegionTimer: public DescribedClass {
     void get_cpu_times(double *) const;
     void get_flops(double *) const;
     void get_depth(int *) const;
+    /// Returns true if any region has thread times.
+    bool has_thread_times() const;
+    void get_thread_wall_times(double *min, double *max, double *sum,
+                               double *nthread) const;
 
     static double get_wall_time();
     static double get_cpu_time();
@@ -25,6 +25,7 @@
 // The U.S. Government is granted a limited license as per AL 91-7.
 //
 
+#include <string.h>
 #include <unistd.h>
 
 #include <util/misc/formio.h>
@@ -120,6 +121,46 @@ main(int argc, char* argv[])
   Timer y1("y1");
   y1.exit();
 
+  // per-thread timers, with thread 1 never entering the region
+  tim->enter("threads");
+  for (int ithread=0; ithread<3; ithread+=2) {
+      Ref<RegionTimer> ttim = tim->new_thread_timer();
+      ttim->enter("thread_work");
+      ttim->exit("thread_work");
+      tim->merge_thread(ttim, ithread);
+    }
+  tim->exit("threads");
+  if (!tim->has_thread_times()) {
+      ExEnv::outn() << "ERROR: thread times were not merged" << endl;
+      return 1;
+    }
+  {
+    int n = tim->nregion();
+    const char **names = new const char*[n];
+    double *wall = new double[n];
+    double *thr_min = new double[n];
+    double *thr_max = new double[n];
+    double *thr_sum = new double[n];
+    double *thr_n = new double[n];
+    tim->get_region_names(names);
+    tim->get_wall_times(wall);
+    tim->get_thread_wall_times(thr_min, thr_max, thr_sum, thr_n);
+    for (int i=0; i<n; i++) {
+        if (strcmp(names[i], "thread_work")) continue;
+        if (thr_n[i] != 2.0 || wall[i] != thr_max[i]) {
+            ExEnv::outn() << "ERROR: thread times were merged incorrectly"
+                          << endl;
+            return 1;
+          }
+      }
+    delete[] names;
+    delete[] wall;
+    delete[] thr_min;
+    delete[] thr_max;
+    delete[] thr_sum;
+    delete[] thr_n;
+  }
+
   mtim->print();
 
   tim->print();
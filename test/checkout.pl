@@ -13,6 +13,13 @@ $reffailed = 0;
 $testfailed = 0;
 $ntest = 0;
 
+# the number of digits the energy and gradient must agree to
+$digits = 6;
+if ($ARGV[0] eq "-t") {
+    shift;
+    $digits = shift;
+}
+
 if ($ARGV[0] eq "-r") {
     shift;
     $refdir = shift;
@@ -133,13 +140,13 @@ sub check {
                 #printf " %14.8f %14.8f", $result->energy(),$cresult->energy();
                 my $ldiff = compare_numbers($result->energy(),$cresult->energy());
                 printf " E:%2d", $ldiff;
-                flagerror() if ($ldiff <= 6);
+                flagerror() if ($ldiff <= $digits);
                 if ($result->input()->gradient()
                     && ! $result->input()->optimize()) {
                     my $maxerror = compare_vecs($result->gradient(),
                                                 $cresult->gradient());
                     printf " Grad:%2d", $maxerror;
-                    flagerror() if ($maxerror <= 6);
+                    flagerror() if ($maxerror <= $digits);
                 }
                 if ($result->input()->optimize()) {
                     my $maxerror = compare_vecs(